@@ -161,4 +161,39 @@ mlAcos( const MlScalar x )
 }
 
 
+
+/**
+ * @brief The arc sine of an array of Magic Lantern Scalar primitives.
+ *
+ * The mlAsinBatch() function computes angles[i] = asin(x[i]) for count elements.
+ *
+ * In the floating-point library the values are computed with a single-precision
+ * polynomial, using SIMD instructions where the processor supports them.
+ * In the fixed-point library, and where SIMD instructions are not available,
+ * each element is computed with mlAsin().
+ *
+ * @param x The array of values, each between -1 and 1.
+ * @param angles The array that receives the results. The values are returned in
+ * the Magic Lantern angle unit, like those returned by mlAsin().
+ * @param count The number of elements in each array.
+ */
+MLMATH_API void mlAsinBatch( const MlScalar *x, MlScalar *angles, int count );
+
+/**
+ * @brief The arc cosine of an array of Magic Lantern Scalar primitives.
+ *
+ * The mlAcosBatch() function computes angles[i] = acos(x[i]) for count elements.
+ *
+ * In the floating-point library the values are computed with a single-precision
+ * polynomial, using SIMD instructions where the processor supports them.
+ * In the fixed-point library, and where SIMD instructions are not available,
+ * each element is computed with mlAcos().
+ *
+ * @param x The array of values, each between -1 and 1.
+ * @param angles The array that receives the results. The values are returned in
+ * the Magic Lantern angle unit, like those returned by mlAcos().
+ * @param count The number of elements in each array.
+ */
+MLMATH_API void mlAcosBatch( const MlScalar *x, MlScalar *angles, int count );
+
 #endif /* ASINE_H_INCLUDED */
@@ -170,4 +170,27 @@ mlAtan2Quick( const MlScalar y, const MlScalar x )
 }
 
 
+
+/**
+ * @brief The arc tangent of arrays of Magic Lantern Scalar primitives
+ * [angles[i] = atan2(y[i],x[i])].
+ *
+ * The mlAtan2Batch() function computes the arc tangent of y[i] / x[i] for
+ * count elements, using the signs of both arguments to determine the quadrant
+ * of each result, as mlAtan2() does.
+ *
+ * In the floating-point library the values are computed with a single-precision
+ * polynomial, using SIMD instructions where the processor supports them. The
+ * result of atan2(0,0) is 0. In the fixed-point library, and where SIMD
+ * instructions are not available, each element is computed with mlAtan2().
+ *
+ * @param y The array of y values.
+ * @param x The array of x values.
+ * @param angles The array that receives the results. The values are returned in
+ * the Magic Lantern angle unit, between -ML_ANGLE_PI and ML_ANGLE_PI (inclusive),
+ * like those returned by mlAtan2().
+ * @param count The number of elements in each array.
+ */
+MLMATH_API void mlAtan2Batch( const MlScalar *y, const MlScalar *x, MlScalar *angles, int count );
+
 #endif /* ATAN_H_INCLUDED */
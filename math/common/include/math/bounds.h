@@ -0,0 +1,469 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file bounds.h
+ * @ingroup MlMath
+ *
+ * This file defines axis-aligned bounding boxes and bounding spheres.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef BOUNDS_H_INCLUDED
+#define BOUNDS_H_INCLUDED
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/vector.h>
+#include <math/transfrm.h>
+
+class MlSphere;
+
+
+/**
+ * @brief An axis-aligned bounding box.
+ *
+ * The <b>MlAABB</b> class holds the lowest and the highest corners of a
+ * box whose faces are parallel to the coordinate planes. A box whose lowest
+ * corner is above its highest corner on any axis is empty; the default
+ * constructor and makeEmpty() make the lowest corner ML_SCALAR_MAX and the
+ * highest corner -ML_SCALAR_MAX, so that extending an empty box by a point
+ * or by another box gives the bounds of that point or box.
+ *
+ * The batch methods operate on arrays of boxes, and in floating-point mode
+ * they handle several boxes at a time with the widest SSE4.1, AVX2 or
+ * AVX-512 instruction set that the processor supports. The tests report
+ * their results in a mask of 32 bit words, as <b>MlFrustum</b> does: bit
+ * (i % 32) of word (i / 32) is set if element i passes.
+ */
+class MLMATH_API MlAABB
+{
+  public:
+
+    /**
+	 * Default constructor, makes an empty box.
+	 */
+    MlAABB()
+    { makeEmpty(); }
+
+    /**
+	 * @brief A constructor given the corners of the box.
+	 *
+	 * @param min The corner with the lowest coordinates.
+	 * @param max The corner with the highest coordinates.
+	 */
+    MlAABB(const MlVector3 &min, const MlVector3 &max)
+      : minCorner(min), maxCorner(max)
+    { }
+
+    /**
+	 * @brief Set the corners of the box.
+	 *
+	 * @param min The corner with the lowest coordinates.
+	 * @param max The corner with the highest coordinates.
+	 */
+    void setBounds(const MlVector3 &min, const MlVector3 &max)
+    { minCorner = min; maxCorner = max; }
+
+    /**
+	 * @brief Set the box to the bounds of an array of points.
+	 *
+	 * @param points The points to bound.
+	 * @param count The number of points. If it is zero the box is made empty.
+	 */
+    void setBounds(const MlVector3 *points, int count);
+
+    /**
+	 * @brief Get the corners of the box.
+	 *
+	 * @param min The corner with the lowest coordinates is returned.
+	 * @param max The corner with the highest coordinates is returned.
+	 */
+    void getBounds(MlVector3 &min, MlVector3 &max) const
+    { min = minCorner; max = maxCorner; }
+
+    /**
+	 * @brief Get the corner with the lowest coordinates.
+	 */
+    const MlVector3 &getMin() const
+    { return minCorner; }
+
+    /**
+	 * @brief Get the corner with the highest coordinates.
+	 */
+    const MlVector3 &getMax() const
+    { return maxCorner; }
+
+    /**
+	 * @brief Get the center of the box.
+	 */
+    MlVector3 getCenter() const
+    { return (minCorner + maxCorner) * ML_SCALAR_HALF; }
+
+    /**
+	 * @brief Get the size of the box along each axis.
+	 */
+    MlVector3 getSize() const
+    { return maxCorner - minCorner; }
+
+    /**
+	 * @brief Make the box empty.
+	 */
+    void makeEmpty();
+
+    /**
+	 * @brief Determine whether the box is empty.
+	 *
+	 * @return If the lowest corner is above the highest corner on any axis,
+	 * then 1 will be returned. Otherwise 0 will be returned.
+	 */
+    int isEmpty() const
+    {
+        return maxCorner[0] < minCorner[0] || maxCorner[1] < minCorner[1] ||
+               maxCorner[2] < minCorner[2];
+    }
+
+    /**
+	 * @brief Extend the box to contain a point.
+	 *
+	 * @param pt The point.
+	 */
+    void extendBy(const MlVector3 &pt);
+
+    /**
+	 * @brief Extend the box to contain another box.
+	 *
+	 * @param box The box. If it is empty, this box is unchanged.
+	 */
+    void extendBy(const MlAABB &box);
+
+    /**
+	 * @brief Get the bounds of an array of boxes.
+	 *
+	 * @param boxes The boxes to merge. Empty boxes are ignored.
+	 * @param count The number of boxes.
+	 *
+	 * @return The smallest box that contains all of the boxes is returned;
+	 * it is empty if they all are.
+	 */
+    static MlAABB merge(const MlAABB *boxes, int count);
+
+    /**
+	 * @brief Determine whether the box contains a point.
+	 *
+	 * Points on the faces of the box are contained.
+	 *
+	 * @param pt The point.
+	 *
+	 * @return If the box contains the point, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
+    int contains(const MlVector3 &pt) const;
+
+    /**
+	 * @brief Determine whether the box overlaps another box.
+	 *
+	 * Boxes that touch overlap, and an empty box overlaps nothing.
+	 *
+	 * @param box The other box.
+	 *
+	 * @return If the boxes overlap, then 1 will be returned. Otherwise 0
+	 * will be returned.
+	 */
+    int overlaps(const MlAABB &box) const;
+
+    /**
+	 * @brief Determine whether the box overlaps a sphere.
+	 *
+	 * @see MlSphere::overlaps(const MlAABB &) const
+	 */
+    int overlaps(const MlSphere &sphere) const;
+
+    /**
+	 * @brief Find which of an array of points are in the box.
+	 *
+	 * @param points The points to test.
+	 * @param count The number of points.
+	 * @param mask The result mask, of (count + 31) / 32 words. Unused bits
+	 * of the last word are cleared.
+	 */
+    void containsBatch(const MlVector3 *points, int count, unsigned int *mask) const;
+
+    /**
+	 * @brief Find which of an array of boxes overlap the box.
+	 *
+	 * @param boxes The boxes to test.
+	 * @param count The number of boxes.
+	 * @param mask The result mask, of (count + 31) / 32 words. Unused bits
+	 * of the last word are cleared.
+	 */
+    void overlapsBatch(const MlAABB *boxes, int count, unsigned int *mask) const;
+
+    /**
+	 * @brief Transform the box.
+	 *
+	 * The box is set to the bounds of its corners transformed by m, using
+	 * the absolute value method of Arvo: the center of the box is
+	 * transformed by m, and the half size of the box by the absolute values
+	 * of the elements of m. An empty box stays empty.
+	 *
+	 * @param m The transform.
+	 */
+    void transform(const MlTransform &m);
+
+    /**
+	 * @brief Transform an array of boxes by one transform.
+	 *
+	 * @param m The transform.
+	 * @param src The boxes to transform.
+	 * @param dst The transformed boxes are returned; may be the same array
+	 * as <b>src</b>.
+	 * @param count The number of boxes.
+	 */
+    static void transformBatch(const MlTransform &m, const MlAABB *src, MlAABB *dst, int count);
+
+    /**
+	 * @brief Transform an array of boxes, each by its own transform.
+	 *
+	 * This is the update of the world bounds of a set of objects from
+	 * their local bounds and their transforms.
+	 *
+	 * @param m The transforms, one per box.
+	 * @param src The boxes to transform.
+	 * @param dst The transformed boxes are returned; may be the same array
+	 * as <b>src</b>.
+	 * @param count The number of boxes.
+	 */
+    static void transformBatch(const MlTransform *m, const MlAABB *src, MlAABB *dst, int count);
+
+    /**
+	 * @brief Equality comparison operator.
+	 */
+    MLMATH_API friend int operator ==(const MlAABB &b1, const MlAABB &b2)
+    { return b1.minCorner == b2.minCorner && b1.maxCorner == b2.maxCorner; }
+
+    /**
+	 * @brief Inequality comparison operator.
+	 */
+    MLMATH_API friend int operator !=(const MlAABB &b1, const MlAABB &b2)
+    { return !(b1 == b2); }
+
+  private:
+
+    // The lowest and the highest corners.
+    MlVector3 minCorner, maxCorner;
+};
+
+
+/**
+ * @brief A bounding sphere.
+ *
+ * The <b>MlSphere</b> class holds the center and the radius of a sphere.
+ * A sphere with a negative radius is empty; the default constructor and
+ * makeEmpty() make the radius -1, so that extending an empty sphere by a
+ * point or by another sphere gives a sphere bounding just that point or
+ * sphere.
+ *
+ * The batch tests work as those of <b>MlAABB</b>.
+ */
+class MLMATH_API MlSphere
+{
+  public:
+
+    /**
+	 * Default constructor, makes an empty sphere.
+	 */
+    MlSphere()
+    { makeEmpty(); }
+
+    /**
+	 * @brief A constructor given the center and the radius.
+	 */
+    MlSphere(const MlVector3 &c, MlScalar r)
+      : center(c), radius(r)
+    { }
+
+    /**
+	 * @brief Set the center and the radius.
+	 */
+    void setValue(const MlVector3 &c, MlScalar r)
+    { center = c; radius = r; }
+
+    /**
+	 * @brief Set the sphere to the smallest one that contains a box.
+	 *
+	 * @param box The box. If it is empty, the sphere is made empty.
+	 */
+    void circumscribe(const MlAABB &box);
+
+    /**
+	 * @brief Get the center of the sphere.
+	 */
+    const MlVector3 &getCenter() const
+    { return center; }
+
+    /**
+	 * @brief Get the radius of the sphere.
+	 */
+    MlScalar getRadius() const
+    { return radius; }
+
+    /**
+	 * @brief Make the sphere empty.
+	 */
+    void makeEmpty()
+    { center.setValue(ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ZERO); radius = -ML_SCALAR_ONE; }
+
+    /**
+	 * @brief Determine whether the sphere is empty.
+	 *
+	 * @return If the radius is negative, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
+    int isEmpty() const
+    { return radius < ML_SCALAR_ZERO; }
+
+    /**
+	 * @brief Extend the sphere to contain a point.
+	 *
+	 * The center moves toward the point just far enough for the sphere to
+	 * contain both the point and the old sphere.
+	 *
+	 * @param pt The point.
+	 */
+    void extendBy(const MlVector3 &pt);
+
+    /**
+	 * @brief Extend the sphere to contain another sphere.
+	 *
+	 * The result is the smallest sphere that contains both.
+	 *
+	 * @param sphere The sphere. If it is empty, this sphere is unchanged.
+	 */
+    void extendBy(const MlSphere &sphere);
+
+    /**
+	 * @brief Determine whether the sphere contains a point.
+	 *
+	 * @param pt The point.
+	 *
+	 * @return If the point is inside or on the sphere, then 1 will be
+	 * returned. Otherwise 0 will be returned.
+	 */
+    int contains(const MlVector3 &pt) const;
+
+    /**
+	 * @brief Determine whether the sphere overlaps another sphere.
+	 *
+	 * Spheres that touch overlap, and an empty sphere overlaps nothing.
+	 *
+	 * @param sphere The other sphere.
+	 *
+	 * @return If the spheres overlap, then 1 will be returned. Otherwise 0
+	 * will be returned.
+	 */
+    int overlaps(const MlSphere &sphere) const;
+
+    /**
+	 * @brief Determine whether the sphere overlaps a box.
+	 *
+	 * The test is exact: the sphere overlaps the box if the point of the
+	 * box nearest its center is inside it.
+	 *
+	 * @param box The box.
+	 *
+	 * @return If the sphere and the box overlap, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
+    int overlaps(const MlAABB &box) const;
+
+    /**
+	 * @brief Find which of an array of points are in the sphere.
+	 *
+	 * @param points The points to test.
+	 * @param count The number of points.
+	 * @param mask The result mask, of (count + 31) / 32 words. Unused bits
+	 * of the last word are cleared.
+	 */
+    void containsBatch(const MlVector3 *points, int count, unsigned int *mask) const;
+
+    /**
+	 * @brief Find which of an array of spheres overlap the sphere.
+	 *
+	 * @param spheres The spheres to test.
+	 * @param count The number of spheres.
+	 * @param mask The result mask, of (count + 31) / 32 words. Unused bits
+	 * of the last word are cleared.
+	 */
+    void overlapsBatch(const MlSphere *spheres, int count, unsigned int *mask) const;
+
+    /**
+	 * @brief Transform the sphere.
+	 *
+	 * The center is transformed by m, and the radius is scaled by the
+	 * length of the longest of the first three rows of m. This bounds the
+	 * transformed sphere when m is a scale followed by a rotation and a
+	 * translation, as built by MlTransform::setTransform(); a transform
+	 * with shear may stretch the sphere further.
+	 *
+	 * @param m The transform.
+	 */
+    void transform(const MlTransform &m);
+
+    /**
+	 * @brief Equality comparison operator.
+	 */
+    MLMATH_API friend int operator ==(const MlSphere &s1, const MlSphere &s2)
+    { return s1.center == s2.center && s1.radius == s2.radius; }
+
+    /**
+	 * @brief Inequality comparison operator.
+	 */
+    MLMATH_API friend int operator !=(const MlSphere &s1, const MlSphere &s2)
+    { return !(s1 == s2); }
+
+  private:
+
+    MlVector3 center;
+    MlScalar radius;
+};
+
+
+inline int MlAABB::overlaps(const MlSphere &sphere) const
+{
+    return sphere.overlaps(*this);
+}
+
+#endif /* BOUNDS_H_INCLUDED */
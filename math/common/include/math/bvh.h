@@ -0,0 +1,281 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file bvh.h
+ * @ingroup MlMath
+ *
+ * This file defines a bounding volume hierarchy for ray queries against
+ * triangle meshes.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef BVH_H_INCLUDED
+#define BVH_H_INCLUDED
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/vector.h>
+#include <math/bounds.h>
+
+// The nodes of the tree are internal to the library; see bvh.cxx.
+struct MlBvhNode;
+
+
+/**
+ * @brief The nearest intersection of a ray with a triangle.
+ *
+ * The point hit is origin + t * direction, which is also
+ * (1 - u - v) * p0 + u * p1 + v * p2 for the corners p0, p1 and p2 of the
+ * triangle.
+ */
+typedef struct MLMATH_API _MlBvhHit
+{
+    MlScalar t;   /**< The distance along the ray, in units of its direction. */
+    MlScalar u;   /**< The barycentric coordinate of the second corner. */
+    MlScalar v;   /**< The barycentric coordinate of the third corner. */
+    int triangle; /**< The index of the triangle hit, or -1 if none was. */
+} MlBvhHit;
+
+
+/**
+ * @brief A bounding volume hierarchy over a triangle mesh.
+ *
+ * The <b>MlBvh</b> class holds a copy of the triangles of a mesh, sorted
+ * into a binary tree of axis-aligned boxes, so that the triangles hit by a
+ * ray can be found without testing each of them. It answers picking queries
+ * with intersect(), which finds the nearest triangle hit, and line of sight
+ * or occlusion queries with occluded(), which stops at the first.
+ *
+ * The tree is built by binning the triangles along each axis and splitting
+ * each node where the surface area heuristic predicts the cheapest
+ * traversal. With several threads, the triangles of the large nodes at the
+ * top of the tree are binned in parallel, and the subtrees below them are
+ * then built in parallel. The nodes are stored depth first in one array,
+ * two to a cache line, with the triangles of each leaf next to each other.
+ * The tree is the same whatever the number of threads.
+ *
+ * The batch queries trace rays in packets of consecutive rays, testing
+ * each packet against a node at once with the widest SSE4.1, AVX2 or
+ * AVX-512 instruction set that the processor supports. They run fastest
+ * when neighbouring rays have similar origins and directions, such as the
+ * rays through neighbouring pixels. Large batches may also be split
+ * between threads.
+ *
+ * The tree is held in floats in every version of the library, since the
+ * reciprocals of the components of a direction do not fit in fixed point.
+ * Coordinates and distances are converted on the way in and out.
+ */
+class MLMATH_API MlBvh
+{
+  public:
+
+    /**
+	 * Default constructor. The tree has no triangles.
+	 */
+    MlBvh();
+
+    /**
+	 * @brief A constructor given a mesh.
+	 *
+	 * @see build()
+	 */
+    MlBvh(const MlVector3 *vertices, const int *indices, int numTriangles,
+          int numThreads = 1);
+
+    /**
+	 * @brief Copy constructor.
+	 *
+	 * @param bvh The other tree to copy from.
+	 */
+    MlBvh(const MlBvh &bvh);
+
+    /**
+	 * Destructor.
+	 */
+    ~MlBvh();
+
+    /**
+	 * @brief Assignment operator.
+	 *
+	 * @param bvh The other tree to copy from.
+	 *
+	 * @return A reference to this <b>MlBvh</b> is returned.
+	 */
+    MlBvh &operator =(const MlBvh &bvh);
+
+    /**
+	 * @brief Build the tree over the triangles of a mesh.
+	 *
+	 * The triangles are copied, so the mesh need not be kept. Triangles
+	 * with no area are never hit.
+	 *
+	 * @param vertices The vertices of the mesh.
+	 * @param indices The indices of the three vertices of each triangle,
+	 * or NULL if each three consecutive vertices form a triangle.
+	 * @param numTriangles The number of triangles.
+	 * @param numThreads The number of threads to use. Zero uses one
+	 * thread per processor.
+	 *
+	 * @return A reference to this <b>MlBvh</b> is returned.
+	 */
+    MlBvh &build(const MlVector3 *vertices, const int *indices, int numTriangles,
+                 int numThreads = 1);
+
+    /**
+	 * @brief Get the number of triangles.
+	 *
+	 * @return The number of triangles is returned.
+	 */
+    int getNumTriangles() const
+	{ return numTriangles; }
+
+    /**
+	 * @brief Get the number of nodes of the tree.
+	 *
+	 * @return The number of nodes, leaves included, is returned.
+	 */
+    int getNumNodes() const
+	{ return (numNodes > 0) ? numNodes - 1 : 0; }
+
+    /**
+	 * @brief Get the bounds of the triangles.
+	 *
+	 * @return The box bounding all the triangles, which is empty if there
+	 * are none, is returned.
+	 */
+    MlAABB getBounds() const;
+
+    /**
+	 * @brief Find the nearest triangle hit by a ray.
+	 *
+	 * @param origin The origin of the ray.
+	 * @param direction The direction of the ray, which need not be of
+	 * unit length.
+	 * @param maxDistance Only hits closer than this, in units of the
+	 * direction, are reported.
+	 * @param hit The nearest hit. If there is none, its triangle is -1
+	 * and its distance is <b>maxDistance</b>.
+	 *
+	 * @return If the ray hits a triangle, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
+    int intersect(const MlVector3 &origin, const MlVector3 &direction,
+                  MlScalar maxDistance, MlBvhHit &hit) const;
+
+    /**
+	 * @brief Determine whether a ray hits any triangle.
+	 *
+	 * This is cheaper than intersect(), since the search stops at the
+	 * first hit found.
+	 *
+	 * @param origin The origin of the ray.
+	 * @param direction The direction of the ray.
+	 * @param maxDistance Only hits closer than this, in units of the
+	 * direction, are counted.
+	 *
+	 * @return If the ray hits a triangle, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
+    int occluded(const MlVector3 &origin, const MlVector3 &direction,
+                 MlScalar maxDistance) const;
+
+    /**
+	 * @brief Find the nearest triangles hit by an array of rays.
+	 *
+	 * @param origins The origins of the rays.
+	 * @param directions The directions of the rays.
+	 * @param maxDistances The greatest distance of each ray, or NULL if
+	 * they are unlimited.
+	 * @param hits The nearest hit of each ray, as by intersect().
+	 * @param count The number of rays.
+	 * @param numThreads The number of threads to use. Zero uses one
+	 * thread per processor.
+	 */
+    void intersectBatch(const MlVector3 *origins, const MlVector3 *directions,
+                        const MlScalar *maxDistances, MlBvhHit *hits, int count,
+                        int numThreads = 1) const;
+
+    /**
+	 * @brief Determine which of an array of rays hit any triangle.
+	 *
+	 * @param origins The origins of the rays.
+	 * @param directions The directions of the rays.
+	 * @param maxDistances The greatest distance of each ray, or NULL if
+	 * they are unlimited.
+	 * @param count The number of rays.
+	 * @param mask The occlusion mask, of (count + 31) / 32 words. Bit
+	 * (i % 32) of word (i / 32) is set if ray i hits a triangle; unused
+	 * bits of the last word are cleared.
+	 * @param numThreads The number of threads to use. Zero uses one
+	 * thread per processor.
+	 */
+    void occludedBatch(const MlVector3 *origins, const MlVector3 *directions,
+                       const MlScalar *maxDistances, int count, unsigned int *mask,
+                       int numThreads = 1) const;
+
+  private:
+
+    // Trace the rays of the 32 ray mask words [first, last) of a batch;
+    // see intersectBatch() and occludedBatch().
+    static void traceRange(int first, int last, void *data);
+
+    // Trace one ray in floats. The distance t is the greatest on the way
+    // in and that of the hit on the way out, and uv gets its barycentric
+    // coordinates. If any is non-zero, the search stops at the first hit.
+    // Returns the index of the triangle hit in leaf order, or -1.
+    int trace(const float *origin, const float *direction, float &t,
+              float *uv, int any) const;
+
+    // The number of triangles, and of node slots.
+    int numTriangles;
+    int numNodes;
+
+    // Allocate n nodes aligned to a cache line, returning them and setting
+    // memory to the block to delete.
+    static MlBvhNode *newNodes(int n, MlBvhNode *&memory);
+
+    // The nodes, depth first from the root, and the block holding them.
+    MlBvhNode *nodes;
+    MlBvhNode *nodeMemory;
+
+    // The triangles in leaf order, each as its first corner and its two
+    // edges from it, 9 floats, with the index of each in the mesh.
+    float *triangles;
+    int *triangleIndices;
+};
+
+
+#endif /* BVH_H_INCLUDED */
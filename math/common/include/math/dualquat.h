@@ -0,0 +1,316 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file dualquat.h
+ * @ingroup MlMath
+ *
+ * This file provides dual quaternions, compact rigid 3D transforms.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef DUALQUAT_H_INCLUDED
+#define DUALQUAT_H_INCLUDED
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/vector.h>
+#include <math/rotation.h>
+
+class MlTransform;
+
+
+/**
+ * @brief Specifies a rigid transform as a unit dual quaternion.
+ *
+ * A dual quaternion holds a rotation followed by a translation in eight
+ * scalars: the real part is the rotation, as an <b>MlRotation</b>
+ * quaternion, and the dual part is half the translation multiplied by
+ * the rotation. Both parts are stored x, y, z, w.
+ *
+ * Products follow <b>MlTransform</b> and <b>MlRotation</b>: <i>a</i> *
+ * <i>b</i> is the transform that applies <i>a</i> first and then
+ * <i>b</i>. Blending dual quaternions, rather than matrices, keeps the
+ * result rigid, so skinned joints do not collapse as they twist.
+ */
+class MLMATH_API MlDualQuat
+{
+  public:
+
+    /**
+	 * Default constructor.
+	 */
+    MlDualQuat() {}
+
+    /**
+	 * @brief A constructor given the real and dual parts.
+	 *
+	 * @param real The four components of the real part.
+	 * @param dual The four components of the dual part.
+	 */
+    MlDualQuat(const MlScalar real[4], const MlScalar dual[4])
+	{ setValue(real, dual); }
+
+    /**
+	 * @brief A constructor given a rotation and a translation.
+	 *
+	 * @param rotation The rotation, applied first.
+	 * @param translation The translation, applied after the rotation.
+	 */
+    MlDualQuat(const MlRotation& rotation, const MlVector3& translation)
+	{ setValue(rotation, translation); }
+
+    /**
+	 * @brief A constructor given a rigid transformation matrix.
+	 *
+	 * @param m A reference to a transformation matrix.
+	 */
+    MlDualQuat(const MlTransform& m)
+	{ setValue(m); }
+
+    /**
+	 * @brief Set the real and dual parts.
+	 *
+	 * The parts are used as given; call <b>normalize()</b> if they may
+	 * not describe a rigid transform.
+	 *
+	 * @param real The four components of the real part.
+	 * @param dual The four components of the dual part.
+	 *
+	 * @return A reference to this <b>MlDualQuat</b> is returned.
+	 */
+    MlDualQuat &setValue(const MlScalar real[4], const MlScalar dual[4]);
+
+    /**
+	 * @brief Set the value from a rotation and a translation.
+	 *
+	 * @param rotation The rotation, applied first.
+	 * @param translation The translation, applied after the rotation.
+	 *
+	 * @return A reference to this <b>MlDualQuat</b> is returned.
+	 */
+    MlDualQuat &setValue(const MlRotation& rotation, const MlVector3& translation);
+
+    /**
+	 * @brief Set the value from a transformation matrix.
+	 *
+	 * The matrix must be a rotation followed by a translation, without
+	 * scaling.
+	 *
+	 * @param m A reference to a transformation matrix.
+	 *
+	 * @return A reference to this <b>MlDualQuat</b> is returned.
+	 */
+    MlDualQuat &setValue(const MlTransform& m);
+
+    /**
+	 * @brief Get the real part.
+	 *
+	 * @return A pointer to the four components of the real part is
+	 * returned.
+	 */
+    const MlScalar *getReal() const
+	{ return real; }
+
+    /**
+	 * @brief Get the dual part.
+	 *
+	 * @return A pointer to the four components of the dual part is
+	 * returned.
+	 */
+    const MlScalar *getDual() const
+	{ return dual; }
+
+    /**
+	 * @brief Get the rotation and the translation.
+	 *
+	 * @param rotation The rotation, applied first.
+	 * @param translation The translation, applied after the rotation.
+	 */
+    void getValue(MlRotation& rotation, MlVector3& translation) const;
+
+    /**
+	 * @brief Get the equivalent transformation matrix.
+	 *
+	 * @param matrix The matrix, a rotation followed by a translation.
+	 */
+    void getValue(MlTransform& matrix) const;
+
+    /**
+	 * @brief Get the rotation.
+	 *
+	 * @return The rotation is returned.
+	 */
+    MlRotation getRotation() const
+	{ return MlRotation(real); }
+
+    /**
+	 * @brief Get the translation.
+	 *
+	 * @return The translation is returned.
+	 */
+    MlVector3 getTranslation() const;
+
+    /**
+	 * @brief Multiplication operator.
+	 *
+	 * This operator multiplies this transform by another one, so that
+	 * the product applies this transform and then <i>dq</i>. The
+	 * product is normalized.
+	 *
+	 * @return A reference to this <b>MlDualQuat</b> is returned.
+	 */
+    MlDualQuat &operator *=(const MlDualQuat& dq);
+
+    /**
+	 * @brief Multiplication operator.
+	 *
+	 * This operator is used to produce the multiplication of two
+	 * transforms, applying <i>dq1</i> and then <i>dq2</i>.
+	 *
+	 * @return The product of the transforms is returned.
+	 */
+    MLMATH_API friend MlDualQuat operator *(const MlDualQuat& dq1, const MlDualQuat& dq2);
+
+    /**
+	 * @brief Equality comparison within given tolerance.
+	 *
+	 * The tolerance is compared to the square of the distance between
+	 * the eight components of the two dual quaternions.
+	 *
+	 * @param dq The other dual quaternion to compare.
+	 * @param tolerance The value to determine equivalance.
+	 *
+	 * @return If the dual quaternions are equal, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
+    int equals(const MlDualQuat& dq, MlScalar tolerance) const;
+
+    /**
+	 * @brief Normalize the dual quaternion.
+	 *
+	 * The real part is scaled to unit length and the dual part is made
+	 * orthogonal to it, giving the nearest rigid transform.
+	 *
+	 * @return A reference to this <b>MlDualQuat</b> is returned.
+	 */
+    MlDualQuat &normalize();
+
+    /**
+	 * @brief Change the transform to its inverse.
+	 *
+	 * @return A reference to this <b>MlDualQuat</b> is returned.
+	 */
+    MlDualQuat &invert();
+
+    /**
+	 * @brief Get the inverse of the transform.
+	 *
+	 * @return The inverse transform is returned.
+	 */
+    MlDualQuat inverse() const
+	{ MlDualQuat dq = *this; return dq.invert(); }
+
+    /**
+	 * @brief Transform a point.
+	 *
+	 * @param src The point to transform.
+	 * @param dst The transformed point. May be the same as <i>src</i>.
+	 */
+    void multVec(const MlVector3& src, MlVector3& dst) const;
+
+    /**
+	 * @brief Transform a direction vector.
+	 *
+	 * The direction is rotated; the translation is ignored.
+	 *
+	 * @param src The direction to transform.
+	 * @param dst The transformed direction. May be the same as <i>src</i>.
+	 */
+    void multDir(const MlVector3& src, MlVector3& dst) const;
+
+    /**
+	 * @brief Transform an array of points.
+	 *
+	 * This method is the batch form of <b>multVec()</b>. The transform
+	 * is converted to a matrix once and the points are transformed with
+	 * <b>MlTransform::multVecMatrixBatch()</b>.
+	 *
+	 * @param src The points to transform.
+	 * @param dst The transformed points. May be the same array as
+	 * <b>src</b>.
+	 * @param count The number of points.
+	 */
+    void multVecBatch(const MlVector3 *src, MlVector3 *dst, int count) const;
+
+    /**
+	 * @brief Perform a screw linear interpolation between two transforms.
+	 *
+	 * The result moves along the screw motion from <i>dq0</i> to
+	 * <i>dq1</i>, rotating about and sliding along one axis at
+	 * constant speeds. The shorter of the two rotation paths is taken.
+	 *
+	 * @param dq0 The lower bound of the interpolation.
+	 * @param dq1 The upper bound of the interpolation.
+	 * @param t The control for the interpolation. It must be a value
+	 * from 0 to 1.
+	 *
+	 * @return The interpolated transform is returned.
+	 */
+    static MlDualQuat sclerp(const MlDualQuat& dq0, const MlDualQuat& dq1, MlScalar t);
+
+    /**
+	 * @brief Blend transforms by dual quaternion linear blending.
+	 *
+	 * The weighted sum of the dual quaternions is normalized. Each one
+	 * is first brought into the hemisphere of the first, so that the
+	 * blend takes the shorter paths.
+	 *
+	 * @param dq The transforms to blend.
+	 * @param weights The weight of each transform.
+	 * @param count The number of transforms. It must be at least one.
+	 *
+	 * @return The blended transform is returned.
+	 */
+    static MlDualQuat blend(const MlDualQuat *dq, const MlScalar *weights, int count);
+
+    /**
+	 * @brief Returns the identity transform.
+	 *
+	 * @return A <b>MlDualQuat</b> is returned that neither rotates nor
+	 * translates.
+	 */
+    static MlDualQuat identity();
+
+  private:
+
+	// Storage for the real and dual parts.
+    MlScalar real[4];
+    MlScalar dual[4];
+};
+
+
+#endif /* DUALQUAT_H_INCLUDED */
@@ -0,0 +1,270 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file fixedlut.h
+ * @ingroup MlMath
+ *
+ * This file contains the generators of the fixed point lookup tables.
+ * The library builds its tables from them for ML_FIXED_RADIX, and the
+ * <b>MlFixed</b> scalar types of scalart.h build the same tables for
+ * their own radix.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef FIXEDLUT_H_INCLUDED
+#define FIXEDLUT_H_INCLUDED
+
+// The lookup tables used by the fixed point sine, arc tangent, arc sine,
+// reciprocal, square root and reciprocal square root functions are
+// generated at compile time from the functions below, for a given fixed
+// point radix. Each entry is the table function scaled to the fixed point
+// format and rounded to the nearest integer.
+//
+// The size of each table may be chosen per product by defining the number
+// of index bits; a larger table trades cache footprint for accuracy. The
+// defaults reproduce the sizes of the tables the library has always used.
+//
+//   ML_FIXED_SINE_LUT_BITS   Entries per quarter wave, 10 (1025 longs).
+//   ML_FIXED_ATAN_LUT_BITS   Entries for tangents in [0, 1], 10 (1025 shorts).
+//   ML_FIXED_ASIN_LUT_BITS   Entries for sines in [0, 1], 10 (1025 shorts).
+//   ML_FIXED_RECIP_LUT_BITS  Entries for [1, 2), 11 (2048 longs).
+//   ML_FIXED_SQRT_LUT_BITS   Index bits of the normalized argument, 12
+//                            (3072 longs).
+//   ML_FIXED_RSQRT_LUT_BITS  Index bits of the normalized argument, 10
+//                            (768 longs).
+//
+// The generators need C++14 constexpr support.
+
+// Include system header files.
+#include <stdint.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Include Magic Lantern math header files.
+#include "math/scalar.h"
+
+#ifndef ML_FIXED_SINE_LUT_BITS
+#define ML_FIXED_SINE_LUT_BITS 10
+#endif
+
+#ifndef ML_FIXED_ATAN_LUT_BITS
+#define ML_FIXED_ATAN_LUT_BITS 10
+#endif
+
+#ifndef ML_FIXED_ASIN_LUT_BITS
+#define ML_FIXED_ASIN_LUT_BITS 10
+#endif
+
+#ifndef ML_FIXED_RECIP_LUT_BITS
+#define ML_FIXED_RECIP_LUT_BITS 11
+#endif
+
+#ifndef ML_FIXED_SQRT_LUT_BITS
+#define ML_FIXED_SQRT_LUT_BITS 12
+#endif
+
+#ifndef ML_FIXED_RSQRT_LUT_BITS
+#define ML_FIXED_RSQRT_LUT_BITS 10
+#endif
+
+
+// A lookup table of N entries of type T.
+template <typename T, int N>
+struct MlFixedLut
+{
+    T value[N];
+};
+
+
+#define ML_LUT_PI 3.14159265358979323846
+
+
+// Double precision versions of the table functions that can be evaluated
+// by the compiler. Each is only good over the range its table needs.
+
+// sin(x) for x in [0, pi/2], by its Taylor series.
+static constexpr double mlLutSin(double x)
+{
+    double x2 = x * x;
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 13; n++)
+    {
+        term *= -x2 / ((2*n) * (2*n + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+// sqrt(x) for x in [1, 4], by Newton's method.
+static constexpr double mlLutSqrt(double x)
+{
+    double r = 0.5 * (1.0 + x);
+    for (int n = 0; n < 6; n++)
+        r = 0.5 * (r + x / r);
+    return r;
+}
+
+// atan(x) for x in [0, 1]. Two halvings of the angle, using
+// atan(x) = 2*atan(x/(1 + sqrt(1 + x*x))), bring x below tan(pi/16)
+// where the Taylor series converges quickly.
+static constexpr double mlLutAtan(double x)
+{
+    for (int n = 0; n < 2; n++)
+        x = x / (1.0 + mlLutSqrt(1.0 + x * x));
+    double x2 = x * x;
+    double term = x;
+    double sum = x;
+    for (int n = 1; n < 16; n++)
+    {
+        term *= -x2;
+        sum += term / (2*n + 1);
+    }
+    return 4.0 * sum;
+}
+
+// asin(x) for x in [0, 1], as atan(x/sqrt(1 - x*x)) folded into [0, 1].
+static constexpr double mlLutAsin(double x)
+{
+    if (x >= 1.0)
+        return 0.5 * ML_LUT_PI;
+    // Newton's method for sqrt(1 - x*x); enough steps for 16 index bits.
+    double c = 1.0 - x * x;
+    double r = 0.5 * (1.0 + c);
+    for (int n = 0; n < 24; n++)
+        r = 0.5 * (r + c / r);
+    return (x <= r) ? mlLutAtan(x / r) : 0.5 * ML_LUT_PI - mlLutAtan(r / x);
+}
+
+// Scale a value to a fixed point format with the given radix, rounding to
+// the nearest integer.
+static constexpr long mlLutFixed(double x, int radix)
+{
+    return (long) (x * (double) (1L << radix) + 0.5);
+}
+
+
+// sin(pi/2 * i/2^bits), for i in [0, 2^bits].
+template <int BITS, int RADIX>
+constexpr MlFixedLut<long, (1 << BITS) + 1> mlSineLut()
+{
+    MlFixedLut<long, (1 << BITS) + 1> lut = {};
+    for (int i = 0; i <= (1 << BITS); i++)
+        lut.value[i] = mlLutFixed(mlLutSin(0.5 * ML_LUT_PI * i / (1 << BITS)), RADIX);
+    return lut;
+}
+
+// atan(i/2^bits), for i in [0, 2^bits], as an angle.
+template <int BITS, int RADIX>
+constexpr MlFixedLut<short, (1 << BITS) + 1> mlAtanLut()
+{
+    MlFixedLut<short, (1 << BITS) + 1> lut = {};
+    for (int i = 0; i <= (1 << BITS); i++)
+        lut.value[i] = (short) mlLutFixed(mlLutAtan((double) i / (1 << BITS)) / (2.0 * ML_LUT_PI), RADIX);
+    return lut;
+}
+
+// asin(i/2^bits), for i in [0, 2^bits], as an angle.
+template <int BITS, int RADIX>
+constexpr MlFixedLut<short, (1 << BITS) + 1> mlAsinLut()
+{
+    MlFixedLut<short, (1 << BITS) + 1> lut = {};
+    for (int i = 0; i <= (1 << BITS); i++)
+        lut.value[i] = (short) mlLutFixed(mlLutAsin((double) i / (1 << BITS)) / (2.0 * ML_LUT_PI), RADIX);
+    return lut;
+}
+
+// 1/(1 + i/2^bits), for i in [0, 2^bits).
+template <int BITS, int RADIX>
+constexpr MlFixedLut<unsigned long, (1 << BITS)> mlRecipLut()
+{
+    MlFixedLut<unsigned long, (1 << BITS)> lut = {};
+    for (int i = 0; i < (1 << BITS); i++)
+        lut.value[i] = mlLutFixed(1.0 / (1.0 + (double) i / (1 << BITS)), RADIX);
+    return lut;
+}
+
+// sqrt(1 + i/2^(bits - 2)), for i in [0, 3*2^(bits - 2)), that is, for
+// arguments in [1, 4). The values carry 15 + RADIX/2 fraction bits, which
+// is the scale of the normalized arithmetic of FixedSqrt().
+template <int BITS, int RADIX>
+constexpr MlFixedLut<unsigned long, 3 << (BITS - 2)> mlSqrtLut()
+{
+    MlFixedLut<unsigned long, 3 << (BITS - 2)> lut = {};
+    for (int i = 0; i < (3 << (BITS - 2)); i++)
+        lut.value[i] = mlLutFixed(mlLutSqrt(1.0 + (double) i / (1 << (BITS - 2))), 15 + RADIX / 2);
+    return lut;
+}
+
+// 1/sqrt(x) at the middle of each bin of the sqrt table above, that is, for
+// x = 1 + (i + 1/2)/2^(bits - 2) with i in [0, 3*2^(bits - 2)). The values
+// lie in (1/2, 1] and carry 31 fraction bits, for the normalized arithmetic
+// of FixedRecipSqrt(); they do not depend on the radix.
+template <int BITS>
+constexpr MlFixedLut<unsigned long, 3 << (BITS - 2)> mlRecipSqrtLut()
+{
+    MlFixedLut<unsigned long, 3 << (BITS - 2)> lut = {};
+    for (int i = 0; i < (3 << (BITS - 2)); i++)
+        lut.value[i] = (unsigned long) (2147483648.0 /
+            mlLutSqrt(1.0 + (i + 0.5) / (1 << (BITS - 2))) + 0.5);
+    return lut;
+}
+
+
+// The number of leading zero bits of a non-zero 32-bit value. This is a
+// single instruction on the processors we care about, and lets the fixed
+// point square root and reciprocal normalize their argument in constant
+// time.
+static inline int mlFixedClz(uint32_t x)
+{
+#if defined(__GNUC__)
+    return __builtin_clz(x);
+#elif defined(_MSC_VER)
+    unsigned long bit;
+    _BitScanReverse(&bit, x);
+    return 31 - (int) bit;
+#else
+    int n = 0;
+    if ((x & 0xffff0000) == 0) { n += 16; x <<= 16; }
+    if ((x & 0xff000000) == 0) { n += 8; x <<= 8; }
+    if ((x & 0xf0000000) == 0) { n += 4; x <<= 4; }
+    if ((x & 0xc0000000) == 0) { n += 2; x <<= 2; }
+    if ((x & 0x80000000) == 0) { n += 1; }
+    return n;
+#endif
+}
+
+#endif /* FIXEDLUT_H_INCLUDED */
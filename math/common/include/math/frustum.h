@@ -0,0 +1,273 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file frustum.h
+ * @ingroup MlMath
+ *
+ * This file provides view frustum culling of bounding spheres and boxes.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef FRUSTUM_H_INCLUDED
+#define FRUSTUM_H_INCLUDED
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/vector.h>
+#include <math/transfrm.h>
+#include <math/matrix4.h>
+#include <math/bounds.h>
+
+
+/**
+ * @brief The six planes of a view frustum, for culling bounding volumes.
+ *
+ * Each plane is held as an <b>MlVector4</b> (a, b, c, d) with a unit normal
+ * (a, b, c) pointing into the frustum, so that a point p is inside the plane
+ * when a*p[0] + b*p[1] + c*p[2] + d >= 0. The planes are, in order, the left,
+ * right, bottom, top, near and far planes.
+ *
+ * Spheres and boxes are culled conservatively: a volume is reported visible
+ * unless it lies entirely outside one of the planes, so a volume near a
+ * corner of the frustum may be visible without intersecting it.
+ *
+ * The batch culling methods take the volumes as separate streams of
+ * components (structure-of-arrays) and report them in a visibility mask of
+ * 32 bit words, one bit per volume: bit (i % 32) of word (i / 32) is set
+ * if volume i is visible. In floating-point mode the volumes are tested
+ * several at a time with the widest SSE4.1, AVX2 or AVX-512 instruction set
+ * that the processor supports, and large arrays may be split between
+ * threads.
+ */
+class MLMATH_API MlFrustum
+{
+  public:
+
+    /**
+	 * Default constructor, leaves the planes uninitialized.
+	 */
+    MlFrustum() {}
+
+    /**
+	 * @brief A constructor given a combined view and projection matrix.
+	 *
+	 * @param viewProjection The matrix from world coordinates to clip
+	 * coordinates.
+	 */
+    MlFrustum(const MlMatrix4 &viewProjection)
+    { setValue(viewProjection); }
+
+    /**
+	 * @brief Set the planes from a combined view and projection matrix.
+	 *
+	 * The planes are those of the clip volume, -w <= x, y, z <= w, in world
+	 * coordinates.
+	 *
+	 * @param viewProjection The matrix from world coordinates to clip
+	 * coordinates.
+	 */
+    void setValue(const MlMatrix4 &viewProjection);
+
+    /**
+	 * @brief Set the planes of a perspective view.
+	 *
+	 * @param view The transform from world to eye coordinates; the inverse
+	 * of the transform of the camera.
+	 * @param fovy The vertical field of view, in radians.
+	 * @param aspect The ratio of the width of the view to its height.
+	 * @param zNear The distance to the near plane; greater than zero.
+	 * @param zFar The distance to the far plane.
+	 *
+	 * @see MlMatrix4::setPerspective()
+	 */
+    void setPerspective(const MlTransform &view, MlScalar fovy, MlScalar aspect,
+                        MlScalar zNear, MlScalar zFar);
+
+    /**
+	 * @brief Set the planes of an orthographic view.
+	 *
+	 * @param view The transform from world to eye coordinates; the inverse
+	 * of the transform of the camera.
+	 * @param left The left edge of the view volume.
+	 * @param right The right edge of the view volume.
+	 * @param bottom The bottom edge of the view volume.
+	 * @param top The top edge of the view volume.
+	 * @param zNear The distance to the near plane.
+	 * @param zFar The distance to the far plane.
+	 *
+	 * @see MlMatrix4::setOrthographic()
+	 */
+    void setOrthographic(const MlTransform &view, MlScalar left, MlScalar right,
+                         MlScalar bottom, MlScalar top, MlScalar zNear, MlScalar zFar);
+
+    /**
+	 * @brief Get one of the planes.
+	 *
+	 * @param i The index of the plane: 0 to 5 for the left, right, bottom,
+	 * top, near and far planes.
+	 *
+	 * @return The plane is returned as (a, b, c, d).
+	 */
+    const MlVector4 &getPlane(int i) const
+    { return planes[i]; }
+
+    /**
+	 * @brief Determine whether a sphere may be visible.
+	 *
+	 * @param center The center of the sphere.
+	 * @param radius The radius of the sphere.
+	 *
+	 * @return If the sphere is not entirely outside one of the planes, then
+	 * 1 will be returned. Otherwise 0 will be returned.
+	 */
+    int isVisible(const MlVector3 &center, MlScalar radius) const;
+
+    /**
+	 * @brief Determine whether an axis-aligned box may be visible.
+	 *
+	 * @param min The corner of the box with the lowest coordinates.
+	 * @param max The corner of the box with the highest coordinates.
+	 *
+	 * @return If the box is not entirely outside one of the planes, then
+	 * 1 will be returned. Otherwise 0 will be returned.
+	 */
+    int isVisible(const MlVector3 &min, const MlVector3 &max) const;
+
+    /**
+	 * @brief Determine whether a bounding sphere may be visible.
+	 *
+	 * @return If the sphere is not empty and not entirely outside one of
+	 * the planes, then 1 will be returned. Otherwise 0 will be returned.
+	 */
+    int isVisible(const MlSphere &sphere) const
+    { return ! sphere.isEmpty() && isVisible(sphere.getCenter(), sphere.getRadius()); }
+
+    /**
+	 * @brief Determine whether a bounding box may be visible.
+	 *
+	 * @return If the box is not empty and not entirely outside one of the
+	 * planes, then 1 will be returned. Otherwise 0 will be returned.
+	 */
+    int isVisible(const MlAABB &box) const
+    { return ! box.isEmpty() && isVisible(box.getMin(), box.getMax()); }
+
+    /**
+	 * @brief Cull an array of spheres.
+	 *
+	 * @param x The x coordinates of the centers of the spheres.
+	 * @param y The y coordinates of the centers of the spheres.
+	 * @param z The z coordinates of the centers of the spheres.
+	 * @param radius The radii of the spheres.
+	 * @param count The number of spheres.
+	 * @param mask The visibility mask, of (count + 31) / 32 words. Unused
+	 * bits of the last word are cleared.
+	 * @param numThreads The number of threads to use. Zero uses one
+	 * thread per processor.
+	 */
+    void cullSpheres(const MlScalar *x, const MlScalar *y, const MlScalar *z,
+                     const MlScalar *radius, int count, unsigned int *mask,
+                     int numThreads = 1) const;
+
+    /**
+	 * @brief Cull an array of axis-aligned boxes.
+	 *
+	 * @param minX The lowest x coordinates of the boxes.
+	 * @param minY The lowest y coordinates of the boxes.
+	 * @param minZ The lowest z coordinates of the boxes.
+	 * @param maxX The highest x coordinates of the boxes.
+	 * @param maxY The highest y coordinates of the boxes.
+	 * @param maxZ The highest z coordinates of the boxes.
+	 * @param count The number of boxes.
+	 * @param mask The visibility mask, of (count + 31) / 32 words. Unused
+	 * bits of the last word are cleared.
+	 * @param numThreads The number of threads to use. Zero uses one
+	 * thread per processor.
+	 */
+    void cullBoxes(const MlScalar *minX, const MlScalar *minY, const MlScalar *minZ,
+                   const MlScalar *maxX, const MlScalar *maxY, const MlScalar *maxZ,
+                   int count, unsigned int *mask, int numThreads = 1) const;
+
+    /**
+	 * @brief Cull an array of spheres, listing the visible ones.
+	 *
+	 * This method is cullSpheres() followed by maskToIndices().
+	 *
+	 * @param indices The indices of the visible spheres, in increasing
+	 * order. There must be room for <b>count</b> of them.
+	 *
+	 * @return The number of visible spheres is returned.
+	 */
+    int cullSpheres(const MlScalar *x, const MlScalar *y, const MlScalar *z,
+                    const MlScalar *radius, int count, int *indices,
+                    int numThreads = 1) const;
+
+    /**
+	 * @brief Cull an array of axis-aligned boxes, listing the visible ones.
+	 *
+	 * This method is cullBoxes() followed by maskToIndices().
+	 *
+	 * @param indices The indices of the visible boxes, in increasing
+	 * order. There must be room for <b>count</b> of them.
+	 *
+	 * @return The number of visible boxes is returned.
+	 */
+    int cullBoxes(const MlScalar *minX, const MlScalar *minY, const MlScalar *minZ,
+                  const MlScalar *maxX, const MlScalar *maxY, const MlScalar *maxZ,
+                  int count, int *indices, int numThreads = 1) const;
+
+    /**
+	 * @brief Convert a visibility mask to a list of indices.
+	 *
+	 * @param mask The visibility mask.
+	 * @param count The number of volumes in the mask.
+	 * @param indices The indices of the set bits, in increasing order.
+	 *
+	 * @return The number of indices is returned.
+	 */
+    static int maskToIndices(const unsigned int *mask, int count, int *indices);
+
+  private:
+
+    // Cull the volumes of the 32 bit mask words [first, last) of a batch;
+    // see cullSpheres() and cullBoxes().
+    static void cullSphereRange(int first, int last, void *data);
+    static void cullBoxRange(int first, int last, void *data);
+
+    // The left, right, bottom, top, near and far planes.
+    MlVector4 planes[6];
+};
+
+#endif /* FRUSTUM_H_INCLUDED */
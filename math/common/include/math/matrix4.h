@@ -0,0 +1,383 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file matrix4.h
+ * @ingroup MlMath
+ *
+ * This file provides utility for 4x4 Projective Matrix Transformations.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef MATRIX4_H_INCLUDED
+#define MATRIX4_H_INCLUDED
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/vector.h>
+#include <math/transfrm.h>
+
+
+/**
+ * @brief Specifies a projective transformation of 3D points.
+ *
+ * The <b>MlMatrix4</b> class manages a 4x4 matrix of Magic Lantern Scalars.
+ * It follows the conventions of <b>MlTransform</b>: points are row vectors
+ * multiplied on the left of the matrix, and the translation is held in the
+ * last row. The last column, which <b>MlTransform</b> leaves out, holds the
+ * projective part of the matrix, so that a point transforms to a homogeneous
+ * result (x, y, z, w). An <b>MlTransform</b> converts to an <b>MlMatrix4</b>
+ * whose last column is (0, 0, 0, 1).
+ */
+class MLMATH_API MlMatrix4
+{
+  public:
+
+    /**
+	 * Default constructor.
+	 */
+    MlMatrix4() {}
+
+    /**
+	 * @brief A constructor given all 16 elements in row-major order.
+	 */
+    ML_SCALAR_CONSTEXPR MlMatrix4(MlScalar a11, MlScalar a12, MlScalar a13, MlScalar a14,
+            MlScalar a21, MlScalar a22, MlScalar a23, MlScalar a24,
+            MlScalar a31, MlScalar a32, MlScalar a33, MlScalar a34,
+            MlScalar a41, MlScalar a42, MlScalar a43, MlScalar a44)
+      : matrix{{a11, a12, a13, a14}, {a21, a22, a23, a24},
+               {a31, a32, a33, a34}, {a41, a42, a43, a44}}
+    { }
+
+    /**
+	 * @brief A constructor from a 4x4 array of elements.
+	 *
+	 * @param m A 4x4 array of Magic Lantern Scalars.
+	 */
+    MlMatrix4(const MlScalar m[4][4]);
+
+    /**
+	 * @brief A constructor from an affine transform.
+	 *
+	 * The last column of the matrix is set to (0, 0, 0, 1).
+	 *
+	 * @param t The transform to convert.
+	 */
+    MlMatrix4(const MlTransform &t);
+
+    /**
+	 * @brief Set the value from a 4x4 array of elements.
+	 *
+	 * @param m A 4x4 array of Magic Lantern Scalars.
+	 */
+    void setValue(const MlScalar m[4][4]);
+
+    /**
+	 * @brief Set the value from an affine transform.
+	 *
+	 * @param t The transform to convert.
+	 */
+    void setValue(const MlTransform &t);
+
+    /**
+	 * @brief Get the value of the matrix.
+	 *
+	 * @param m The value of the matrix is returned as a 4x4 array of elements.
+	 */
+    void getValue(MlScalar m[4][4]) const;
+
+    /**
+	 * @brief Get the affine part of the matrix.
+	 *
+	 * The last column of the matrix is thrown away, so the result is only
+	 * the same transformation if isAffine() is true.
+	 *
+	 * @param t The first three columns are returned as a transform.
+	 */
+    void getValue(MlTransform &t) const;
+
+    /**
+	 * @brief Sets this matrix to be identity.
+	 */
+    void makeIdentity();
+
+    /**
+	 * @brief Get an identity matrix.
+	 *
+	 * @return A <b>MlMatrix4</b> is returned.
+	 */
+    static ML_SCALAR_CONSTEXPR MlMatrix4 identity()
+    { return MlMatrix4(ML_SCALAR_ONE, ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ZERO,
+                       ML_SCALAR_ZERO, ML_SCALAR_ONE, ML_SCALAR_ZERO, ML_SCALAR_ZERO,
+                       ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ONE, ML_SCALAR_ZERO,
+                       ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ONE); }
+
+    /**
+	 * @brief Determine whether this matrix is an identity matrix.
+	 *
+	 * @return If this matrix is an identity matrix, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
+    int isIdentity() const;
+
+    /**
+	 * @brief Determine whether this matrix is affine.
+	 *
+	 * @return If the last column of the matrix is (0, 0, 0, 1), then 1 will
+	 * be returned. Otherwise 0 will be returned.
+	 */
+    int isAffine() const;
+
+    /**
+	 * @brief Calculate the determinant of the matrix.
+	 *
+	 * @return The determinant is returned as a Magic Lantern scalar.
+	 */
+    MlScalar det() const;
+
+    /**
+	 * @brief Compute the inverse of the matrix.
+	 *
+	 * Affine matrices are inverted by the block method of
+	 * <b>MlTransform::inverse()</b>; other matrices by their cofactors,
+	 * computed from the twelve 2x2 determinants of the upper and lower
+	 * halves of the matrix.
+	 *
+	 * @return The inverse is returned as a matrix. If the matrix is
+	 * singular, it is returned unchanged.
+	 */
+    MlMatrix4 inverse() const;
+
+    /**
+	 * @brief Compute the tranpose of the matrix.
+	 *
+	 * @return The transpose is returned as a matrix.
+	 */
+    MlMatrix4 transpose() const;
+
+    /**
+	 * @brief Multiply this matrix by m.
+	 *
+	 * This method multiplies the matrix by the given matrix, m,
+	 * on its right: <i>this = this * m</i>. In floating-point mode the
+	 * rows of the product are computed with SSE when the library is built
+	 * for it.
+	 *
+	 * @param m The matrix to multiply.
+	 *
+	 * @return The product is returned as a matrix.
+	 */
+    MlMatrix4 &multRight(const MlMatrix4 &m);
+
+    /**
+	 * @brief Multiply this matrix by m.
+	 *
+	 * This method multiplies the matrix by the given matrix, m,
+	 * on its left: <i>this = m * this</i>.
+	 *
+	 * @param m The matrix to multiply.
+	 *
+	 * @return The product is returned as a matrix.
+	 */
+    MlMatrix4 &multLeft(const MlMatrix4 &m);
+
+    /**
+	 * @brief Multiply a point by this matrix.
+	 *
+	 * This method multiplies a given row vector, with a w of 1, by this
+	 * matrix and divides the result by its w. The result is undefined
+	 * when w is zero.
+	 *
+	 * @param src The point to multiply.
+	 * @param dst The resulting point.
+	 */
+    void multVecMatrix(const MlVector3 &src, MlVector3 &dst) const;
+
+    /**
+	 * @brief Multiply a homogeneous vector by this matrix.
+	 *
+	 * @param src The vector to multiply.
+	 * @param dst The resulting vector.
+	 */
+    void multVecMatrix(const MlVector4 &src, MlVector4 &dst) const;
+
+    /**
+	 * @brief Multiply a direction vector by this matrix.
+	 *
+	 * Only the upper-left 3x3 part of the matrix is used.
+	 *
+	 * @param src The direction vector to multiply.
+	 * @param dst The resulting vector.
+	 */
+    void multDirMatrix(const MlVector3 &src, MlVector3 &dst) const;
+
+    /**
+	 * @brief Multiply an array of points by this matrix.
+	 *
+	 * This method is the batch form of multVecMatrix() for points, including
+	 * the division by w; use it to project points to normalized device
+	 * coordinates. In floating-point mode the points are processed several
+	 * at a time with the SIMD instruction set of the host processor when
+	 * it is available.
+	 *
+	 * @param src The points to multiply.
+	 * @param dst The resulting points. May be the same array as <b>src</b>.
+	 * @param count The number of points to transform.
+	 */
+    void multVecMatrixBatch(const MlVector3 *src, MlVector3 *dst, int count) const;
+
+    /**
+	 * @brief Multiply an array of points by this matrix, without dividing.
+	 *
+	 * The points are taken to have a w of 1 and the homogeneous results
+	 * are stored; use it to transform points to clip space.
+	 *
+	 * @param src The points to multiply.
+	 * @param dst The resulting homogeneous vectors.
+	 * @param count The number of points to transform.
+	 */
+    void multVecMatrixBatch(const MlVector3 *src, MlVector4 *dst, int count) const;
+
+    /**
+	 * @brief Multiply an array of homogeneous vectors by this matrix.
+	 *
+	 * @param src The vectors to multiply.
+	 * @param dst The resulting vectors. May be the same array as <b>src</b>.
+	 * @param count The number of vectors to transform.
+	 */
+    void multVecMatrixBatch(const MlVector4 *src, MlVector4 *dst, int count) const;
+
+    /**
+	 * @brief Set this matrix to a perspective projection.
+	 *
+	 * The projection is that of OpenGL, given as row vector matrix: the eye
+	 * looks down the negative z axis, and points between the near and far
+	 * planes map to a z between -1 and 1 after the division by w.
+	 *
+	 * @param fovy The vertical field of view, in radians.
+	 * @param aspect The ratio of the width of the view to its height.
+	 * @param zNear The distance to the near plane; greater than zero.
+	 * @param zFar The distance to the far plane.
+	 */
+    void setPerspective(MlScalar fovy, MlScalar aspect, MlScalar zNear, MlScalar zFar);
+
+    /**
+	 * @brief Set this matrix to an orthographic projection.
+	 *
+	 * The projection is that of OpenGL's glOrtho(), given as row vector
+	 * matrix.
+	 *
+	 * @param left The left edge of the view volume.
+	 * @param right The right edge of the view volume.
+	 * @param bottom The bottom edge of the view volume.
+	 * @param top The top edge of the view volume.
+	 * @param zNear The distance to the near plane.
+	 * @param zFar The distance to the far plane.
+	 */
+    void setOrthographic(MlScalar left, MlScalar right, MlScalar bottom, MlScalar top,
+                         MlScalar zNear, MlScalar zFar);
+
+    /**
+	 * @brief Cast operator: returns pointer to storage of first element.
+	 */
+    operator MlScalar * () { return &matrix[0][0]; }
+
+    /**
+	 * @brief Index operator.
+	 *
+	 * This operator makes the matrix look like a usual matrix
+	 * (so you can do m[i][j]).
+	 */
+    MlVector4 &operator [](int i)
+        { return *((MlVector4 *) &matrix[i][0]); }
+
+    /**
+	 * @brief Index operator for const versions.
+	 */
+    const MlVector4 &operator [](int i) const
+        { return *((const MlVector4 *) &matrix[i][0]); }
+
+    /**
+	 * @brief Performs right multiplication with another matrix.
+	 *
+	 * @return The product of the multiplication is returned as
+	 * another matrix.
+	 */
+    MlMatrix4 &operator *=(const MlMatrix4 &m)
+        { return multRight(m); }
+
+    /**
+	 * @brief Binary multiplication of matrices.
+	 *
+	 * @return The product of the multiplication is returned as
+	 * another matrix.
+	 */
+    MLMATH_API friend MlMatrix4 operator *(const MlMatrix4 &m1, const MlMatrix4 &m2);
+
+    /**
+	 * @brief Equality comparison operator.
+	 *
+	 * @return If the matrices are equal, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
+    MLMATH_API friend int operator ==(const MlMatrix4 &m1, const MlMatrix4 &m2);
+
+    /**
+	 * @brief Inequality comparison operator.
+	 *
+	 * @return If the matrices are not equal, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
+    MLMATH_API friend int operator !=(const MlMatrix4 &m1, const MlMatrix4 &m2)
+        { return !(m1 == m2); }
+
+    /**
+	 * @brief Equality comparison within given tolerance for each element.
+	 *
+	 * @param m The other matrix to compare.
+	 * @param tolerance The largest difference allowed between two elements.
+	 *
+	 * @return If this matrix is equal to the specified matrix, m, then 1 will
+	 * be returned. Otherwise 0 will be returned.
+	 */
+    int equals(const MlMatrix4 &m, MlScalar tolerance) const;
+
+  private:
+
+    // Storage for the 4x4 matrix.
+    MlScalar matrix[4][4];
+};
+
+#endif /* MATRIX4_H_INCLUDED */
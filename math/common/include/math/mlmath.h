@@ -73,4 +73,15 @@
 # define MLMATH_API
 #endif /* !MLMATH_API */
 
+/*
+ * Inline functions that used to be defined out of line in the library.
+ * When building the library with GCC/Clang, force them to be emitted so
+ * that they remain exported from the shared object.
+ */
+#if defined(MLMATH_EXPORTS) && defined(__GNUC__)
+# define MLMATH_ABI_KEEP __attribute__((used))
+#else /* !MLMATH_EXPORTS || !__GNUC__ */
+# define MLMATH_ABI_KEEP
+#endif /* !MLMATH_EXPORTS || !__GNUC__ */
+
 #endif /* __MLMATH_H_ */
@@ -0,0 +1,118 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file rebase.h
+ * @ingroup MlMath
+ *
+ * This file provides the conversion of double precision positions and
+ * transforms to <b>MlVector3</b> and <b>MlTransform</b>, relative to an
+ * origin.
+ *
+ * A float has 24 bits of precision, so a float position a few hundred
+ * kilometres from the origin is only good to a few centimetres. Large
+ * worlds can instead keep their positions in <b>MlVector3d</b> and their
+ * transforms in <b>MlTransformd</b>, and rebase them each frame to an
+ * origin near the camera. The origin is subtracted in double, and only
+ * the small difference is rounded, so the results keep full precision
+ * near the camera and all the work downstream is done in <b>MlScalar</b>.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef REBASE_H_INCLUDED
+#define REBASE_H_INCLUDED
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/vector.h>
+#include <math/transfrm.h>
+#include <math/vectort.h>
+#include <math/transfrmt.h>
+
+
+/**
+ * @brief Rebase an array of double precision positions to an origin.
+ *
+ * The mlRebaseBatch() function computes dst[i] = src[i] - origin for count
+ * elements. The difference is computed in double and then rounded to
+ * <b>MlScalar</b>.
+ *
+ * In the floating-point library the conversion uses SIMD instructions
+ * where the processor supports them.
+ *
+ * @param src The array of positions.
+ * @param origin The origin, usually the position of the camera.
+ * @param dst The array that receives the positions relative to the origin.
+ * @param count The number of elements in each array.
+ */
+MLMATH_API void mlRebaseBatch( const MlVector3d *src, const MlVector3d &origin,
+    MlVector3 *dst, int count );
+
+/**
+ * @brief Rebase an array of double precision transforms to an origin.
+ *
+ * The mlRebaseBatch() function converts count transforms, subtracting the
+ * origin from each translation. The rest of each matrix is rounded as it
+ * is, so the results map local coordinates to coordinates relative to the
+ * origin, as rebased by the function above.
+ *
+ * In the floating-point library the conversion uses SIMD instructions
+ * where the processor supports them.
+ *
+ * @param src The array of transforms.
+ * @param origin The origin, usually the position of the camera.
+ * @param dst The array that receives the transforms relative to the origin.
+ * @param count The number of elements in each array.
+ */
+MLMATH_API void mlRebaseBatch( const MlTransformd *src, const MlVector3d &origin,
+    MlTransform *dst, int count );
+
+/**
+ * @brief Rebase a double precision position to an origin.
+ *
+ * See mlRebaseBatch().
+ */
+inline void mlRebase( const MlVector3d &src, const MlVector3d &origin, MlVector3 &dst )
+{ mlRebaseBatch(&src, origin, &dst, 1); }
+
+/**
+ * @brief Rebase a double precision transform to an origin.
+ *
+ * See mlRebaseBatch().
+ */
+inline void mlRebase( const MlTransformd &src, const MlVector3d &origin, MlTransform &dst )
+{ mlRebaseBatch(&src, origin, &dst, 1); }
+
+#endif /* REBASE_H_INCLUDED */
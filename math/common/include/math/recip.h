@@ -66,5 +66,21 @@
  */
 MLMATH_API MlScalar FixedReciprocal(const MlScalar val);
 
+/**
+ * @brief Determine the reciprocal values for an array of Magic Lantern
+ * fixed-point Scalar primitives [z[i] = 1 / x[i]].
+ *
+ * The FixedReciprocalBatch() function is the batch form of FixedReciprocal().
+ * The result array may be the same as the input array.
+ *
+ * This function is only available when using the fixed-point versions of
+ * the Magic Lantern Math libraries.
+ *
+ * @param val The array of non-zero Magic Lantern Scalar primitives.
+ * @param result The array that receives 1/val[i].
+ * @param count The number of elements in the arrays.
+ */
+MLMATH_API void FixedReciprocalBatch(const MlScalar *val, MlScalar *result, int count);
+
 #endif /* ML_FIXED_POINT */
 #endif /* RECIP_H_INCLUDED */
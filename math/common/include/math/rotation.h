@@ -70,7 +70,9 @@ class MLMATH_API MlRotation
      *
      * @param rot The other rotation to copy from.
      */
-    MlRotation(const MlRotation &rot);
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlRotation(const MlRotation &rot)
+      : quat{rot.quat[0], rot.quat[1], rot.quat[2], rot.quat[3]}
+    { }
 
     /**
 	 * @brief A constructor given a quaternion as an array of 4 components.
@@ -263,7 +265,7 @@ class MLMATH_API MlRotation
 	 *
 	 * @return A scalar is returned.
 	 */
-    MlScalar &operator [](int i)
+    ML_SCALAR_CONSTEXPR MlScalar &operator [](int i)
 	{ return (quat[i]); }
 
 	/**
@@ -275,7 +277,7 @@ class MLMATH_API MlRotation
 	 *
 	 * @return A scalar is returned.
 	 */
-    const MlScalar &operator [](int i) const
+    ML_SCALAR_CONSTEXPR const MlScalar &operator [](int i) const
 	{ return (quat[i]); }
 
     /**
@@ -296,7 +298,9 @@ class MLMATH_API MlRotation
 	 * @return If the rotations are equal, then 1 will be returned.
 	 * Otherwise 0 will be returned if the rotations are not equal.
 	 */
-    MLMATH_API friend int operator ==(const MlRotation& q1, const MlRotation& q2);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR int operator ==(const MlRotation& q1, const MlRotation& q2)
+	{ return (q1.quat[0] == q2.quat[0] && q1.quat[1] == q2.quat[1] &&
+	          q1.quat[2] == q2.quat[2] && q1.quat[3] == q2.quat[3]); }
 
     /**
 	 * @brief Inequality comparison operator.
@@ -306,7 +310,7 @@ class MLMATH_API MlRotation
 	 * @return If the rotations are not equal, then 1 will be returned.
 	 * Oterwise 0 will be returned if the rotations are equal.
 	 */
-    MLMATH_API friend int operator !=(const MlRotation& q1, const MlRotation& q2)
+    MLMATH_API friend ML_SCALAR_CONSTEXPR int operator !=(const MlRotation& q1, const MlRotation& q2)
 	{ return !(q1 == q2); }
 
     /**
@@ -330,8 +334,27 @@ class MLMATH_API MlRotation
 	 * The result is the product of the rotations.
 	 *
 	 * @return The product of the rotations is returned as another rotation.
+	 *
+	 * In floating-point mode, with a compiler that supports it, this
+	 * operator may be evaluated at compile time; see ML_SQRT_CONSTEXPR.
 	 */
-    MLMATH_API friend MlRotation operator *(const MlRotation& q1, const MlRotation& q2);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SQRT_CONSTEXPR MlRotation operator *(const MlRotation& q1, const MlRotation& q2)
+    {
+        MlRotation q(mlMul(q2.quat[3], q1.quat[0]) + mlMul(q2.quat[0], q1.quat[3]) +
+                     mlMul(q2.quat[1], q1.quat[2]) - mlMul(q2.quat[2], q1.quat[1]),
+
+                     mlMul(q2.quat[3], q1.quat[1]) + mlMul(q2.quat[1], q1.quat[3]) +
+                     mlMul(q2.quat[2], q1.quat[0]) - mlMul(q2.quat[0], q1.quat[2]),
+
+                     mlMul(q2.quat[3], q1.quat[2]) + mlMul(q2.quat[2], q1.quat[3]) +
+                     mlMul(q2.quat[0], q1.quat[1]) - mlMul(q2.quat[1], q1.quat[0]),
+
+                     mlMul(q2.quat[3], q1.quat[3]) - mlMul(q2.quat[0], q1.quat[0]) -
+                     mlMul(q2.quat[1], q1.quat[1]) - mlMul(q2.quat[2], q1.quat[2]),
+                     Normalized());
+        q.normalize();
+        return q;
+    }
 
     /**
 	 * @brief Multiply a vector by this rotation.
@@ -374,6 +397,203 @@ class MLMATH_API MlRotation
     static MlRotation slerp(const MlRotation& rot0,
                             const MlRotation& rot1, MlScalar t);
 
+    /**
+	 * @brief Perform a spherical linear interpolation between
+	 * arrays of rotations.
+	 *
+	 * For each <i>i</i>, <i>result[i]</i> is set to the interpolation
+	 * of <i>rot0[i]</i> and <i>rot1[i]</i> by <i>t[i]</i>, as with
+	 * <b>slerp()</b>. The interpolation coefficients are evaluated with
+	 * a polynomial approximation instead of the trigonometric functions;
+	 * its error is below 2e-7 with floating point scalars, and below
+	 * 2e-5 (before rounding to the scalar) with fixed point scalars.
+	 * The arrays may be the same.
+	 *
+	 * @param rot0 The lower bounds of the interpolations.
+	 * @param rot1 The upper bounds of the interpolations.
+	 * @param t The controls for the interpolations. Each must be a value
+	 * from 0 to 1.
+	 * @param result The interpolated rotations.
+	 * @param count The number of rotations.
+	 */
+    static void slerpBatch(const MlRotation *rot0, const MlRotation *rot1,
+                           const MlScalar *t, MlRotation *result, int count);
+
+    /**
+	 * @brief Perform a normalized linear interpolation between
+	 * two rotations.
+	 *
+	 * The quaternions are interpolated linearly, taking the shorter
+	 * path, and the result is normalized. This follows the same path
+	 * as <b>slerp()</b>, but not at a constant angular velocity;
+	 * it is cheaper, and close to <b>slerp()</b> when the rotations
+	 * are near each other.
+	 *
+	 * @param rot0 The lower bound of the interpolation.
+	 * @param rot1 The upper bound of the interpolation.
+	 * @param t The control for the interpolation. It must be a value from
+	 * 0 to 1.
+	 *
+	 * @return The interpolated rotation is returned.
+	 */
+    static MlRotation nlerp(const MlRotation& rot0,
+                            const MlRotation& rot1, MlScalar t);
+
+    /**
+	 * @brief Perform a normalized linear interpolation between
+	 * arrays of rotations.
+	 *
+	 * For each <i>i</i>, <i>result[i]</i> is set to
+	 * <b>nlerp(rot0[i], rot1[i], t[i])</b>. The arrays may be the same.
+	 *
+	 * @param rot0 The lower bounds of the interpolations.
+	 * @param rot1 The upper bounds of the interpolations.
+	 * @param t The controls for the interpolations.
+	 * @param result The interpolated rotations.
+	 * @param count The number of rotations.
+	 */
+    static void nlerpBatch(const MlRotation *rot0, const MlRotation *rot1,
+                           const MlScalar *t, MlRotation *result, int count);
+
+    /**
+	 * @brief Perform a spherical quadrangle interpolation.
+	 *
+	 * Squad interpolates from <i>rot0</i> to <i>rot1</i> along a
+	 * curve shaped by the inner control points <i>ctrl0</i> and
+	 * <i>ctrl1</i>:
+	 * slerp(slerp(rot0, rot1, t), slerp(ctrl0, ctrl1, t), 2t(1 - t)).
+	 * When the control points come from <b>squadControl()</b>,
+	 * consecutive segments join with a continuous angular velocity.
+	 *
+	 * @param rot0 The start of the segment.
+	 * @param ctrl0 The inner control point at the start of the segment.
+	 * @param ctrl1 The inner control point at the end of the segment.
+	 * @param rot1 The end of the segment.
+	 * @param t The control for the interpolation. It must be a value from
+	 * 0 to 1.
+	 *
+	 * @return The interpolated rotation is returned.
+	 */
+    static MlRotation squad(const MlRotation& rot0, const MlRotation& ctrl0,
+                            const MlRotation& ctrl1, const MlRotation& rot1,
+                            MlScalar t);
+
+    /**
+	 * @brief Compute the inner squad control point of a key.
+	 *
+	 * The control point is
+	 * rot * exp(-(log(rot^-1 * next) + log(rot^-1 * prev))/4),
+	 * with the quaternion products written in the usual order. The
+	 * three keys should be in the same hemisphere, that is, with
+	 * non-negative dot products between neighbours.
+	 *
+	 * @param prev The key before <i>rot</i>.
+	 * @param rot The key whose control point is computed.
+	 * @param next The key after <i>rot</i>.
+	 *
+	 * @return The control point is returned.
+	 */
+    static MlRotation squadControl(const MlRotation& prev, const MlRotation& rot,
+                                   const MlRotation& next);
+
+    /**
+	 * @brief Encode the rotation in 32 bits.
+	 *
+	 * The smallest three encoding drops the quaternion component of
+	 * largest magnitude, after negating the quaternion if needed to make
+	 * it positive, and stores its index in the top 2 bits. The other
+	 * three components lie in [-sqrt(1/2), sqrt(1/2)], and are quantized
+	 * to 10 bits each, in xyzw order, in bits 29-20, 19-10 and 9-0. Zero
+	 * is exactly representable, so the identity is encoded without error.
+	 *
+	 * Each stored component is within 6.92e-4 of the original, and the
+	 * recomputed one within three times that, so the decoded rotation
+	 * is within 0.28 degrees of the original. In the fixed-point version
+	 * the error of an <b>MlScalar</b> is added to these.
+	 *
+	 * @return The encoded rotation is returned.
+	 */
+    unsigned int pack32() const;
+
+    /**
+	 * @brief Decode a rotation encoded by <b>pack32()</b>.
+	 *
+	 * The dropped component is recomputed from the unit length of the
+	 * quaternion.
+	 *
+	 * @param packed The encoded rotation.
+	 *
+	 * @return A reference to this rotation is returned.
+	 */
+    MlRotation &unpack32(unsigned int packed);
+
+    /**
+	 * @brief Encode the rotation in 48 bits.
+	 *
+	 * As <b>pack32()</b>, but the three components are quantized to 15
+	 * bits each, in the low 15 bits of the three words. The index of the
+	 * dropped component is stored in the top bits of the first two
+	 * words, low bit first; the top bit of the third word is zero.
+	 *
+	 * Each stored component is within 2.16e-5 of the original, and the
+	 * recomputed one within three times that, so the decoded rotation
+	 * is within 0.0086 degrees of the original.
+	 *
+	 * @param packed The encoded rotation.
+	 */
+    void pack48(unsigned short packed[3]) const;
+
+    /**
+	 * @brief Decode a rotation encoded by <b>pack48()</b>.
+	 *
+	 * @param packed The encoded rotation.
+	 *
+	 * @return A reference to this rotation is returned.
+	 */
+    MlRotation &unpack48(const unsigned short packed[3]);
+
+    /**
+	 * @brief Encode an array of rotations in 32 bits each.
+	 *
+	 * For each <i>i</i>, <i>packed[i]</i> is set to
+	 * <b>rot[i].pack32()</b>.
+	 *
+	 * @param rot The rotations to encode.
+	 * @param packed The encoded rotations.
+	 * @param count The number of rotations.
+	 */
+    static void pack32Batch(const MlRotation *rot, unsigned int *packed, int count);
+
+    /**
+	 * @brief Decode an array of rotations encoded by <b>pack32()</b>.
+	 *
+	 * @param packed The encoded rotations.
+	 * @param rot The decoded rotations.
+	 * @param count The number of rotations.
+	 */
+    static void unpack32Batch(const unsigned int *packed, MlRotation *rot, int count);
+
+    /**
+	 * @brief Encode an array of rotations in 48 bits each.
+	 *
+	 * For each <i>i</i>, <b>rot[i].pack48()</b> is stored in
+	 * <i>packed[3i]</i> to <i>packed[3i + 2]</i>.
+	 *
+	 * @param rot The rotations to encode.
+	 * @param packed The encoded rotations, 3 words each.
+	 * @param count The number of rotations.
+	 */
+    static void pack48Batch(const MlRotation *rot, unsigned short *packed, int count);
+
+    /**
+	 * @brief Decode an array of rotations encoded by <b>pack48()</b>.
+	 *
+	 * @param packed The encoded rotations, 3 words each.
+	 * @param rot The decoded rotations.
+	 * @param count The number of rotations.
+	 */
+    static void unpack48Batch(const unsigned short *packed, MlRotation *rot, int count);
+
     /**
 	 * @brief Get the identity of a rotation matrix.
 	 *
@@ -382,19 +602,51 @@ class MLMATH_API MlRotation
 	 * @return A <b>MlRotation</b> is returned where the elements of the
 	 * quaternion are [0, 0, 0, 1].
 	 */
-    static MlRotation identity()
-	{ return MlRotation(ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ONE); }
+    MLMATH_ABI_KEEP static ML_SCALAR_CONSTEXPR MlRotation identity()
+	{ return fromNormalized(ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ONE); }
+
+    /**
+	 * @brief Make a rotation from a quaternion that is already normalized.
+	 *
+	 * Unlike the constructor, this uses the quaternion as given, without
+	 * normalizing it, so in floating-point mode it can build constant
+	 * rotations at compile time.
+	 *
+	 * @param q0 The first element of the unit quaternion.
+	 * @param q1 The second element of the unit quaternion.
+	 * @param q2 The third element of the unit quaternion.
+	 * @param q3 The fourth element of the unit quaternion.
+	 *
+	 * @return The rotation is returned.
+	 */
+    static ML_SCALAR_CONSTEXPR MlRotation fromNormalized(MlScalar q0, MlScalar q1, MlScalar q2, MlScalar q3)
+	{ return MlRotation(q0, q1, q2, q3, Normalized()); }
 
   private:
 
 	// Storage for quaternion components.
     MlScalar quat[4];
 
+    // Selects the constructor that does not normalize.
+    struct Normalized { };
+
+    ML_SCALAR_CONSTEXPR MlRotation(MlScalar q0, MlScalar q1, MlScalar q2, MlScalar q3, Normalized)
+      : quat{q0, q1, q2, q3}
+    { }
+
     // Returns the normal (square of the 4D length) of a rotation's quaterion.
-    MlScalar norm() const;
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlScalar norm() const
+    { return mlSquare(quat[0]) + mlSquare(quat[1]) + mlSquare(quat[2]) + mlSquare(quat[3]); }
 
     // Normalizes a rotation quaternion to unit 4D length.
-    void normalize();
+    MLMATH_ABI_KEEP ML_SQRT_CONSTEXPR void normalize()
+    {
+        MlScalar dist = mlRecipSqrt(norm());
+        quat[0] = mlMul(quat[0], dist);
+        quat[1] = mlMul(quat[1], dist);
+        quat[2] = mlMul(quat[2], dist);
+        quat[3] = mlMul(quat[3], dist);
+    }
 };
 
 
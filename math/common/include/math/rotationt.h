@@ -0,0 +1,354 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file rotationt.h
+ * @ingroup MlMath
+ *
+ * This file provides a 3D rotation templated on its scalar type.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef ROTATIONT_H_INCLUDED
+#define ROTATIONT_H_INCLUDED
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/scalart.h>
+#include <math/vectort.h>
+#include <math/rotation.h>
+
+
+/**
+ * @brief A 3D rotation of scalars of type S, stored as a unit quaternion.
+ *
+ * S is <i>float</i>, <i>double</i> or an <b>MlFixed</b> type; see
+ * scalart.h. The rotation provides the core of <b>MlRotation</b>, with the
+ * same conventions: the quaternion is stored as (x, y, z, w), angles are
+ * in radians, and <i>r1 * r2</i> rotates by <i>r1</i> and then by
+ * <i>r2</i>.
+ */
+template <class S>
+class MlRotationT
+{
+  public:
+
+    /**
+	 * @brief The scalar type.
+	 */
+    typedef S Scalar;
+
+    /**
+	 * Default constructor, leaves the quaternion uninitialized.
+	 */
+    MlRotationT() {}
+
+    /**
+	 * @brief A constructor given the four components of a quaternion,
+	 * which are normalized.
+	 */
+    MlRotationT(S q0, S q1, S q2, S q3)
+    { setValue(q0, q1, q2, q3); }
+
+    /**
+	 * @brief A constructor given a 3D rotation axis and an angle in
+	 * radians.
+	 */
+    MlRotationT(const MlVector3T<S> &axis, S radians)
+    { setValue(axis, radians); }
+
+    /**
+	 * @brief A constructor converting a rotation of another scalar type.
+	 */
+    template <class T>
+    explicit MlRotationT(const MlRotationT<T> &r)
+    {
+        const T *q = r.getValue();
+        setValue(mlScalarCast<S>(q[0]), mlScalarCast<S>(q[1]),
+                 mlScalarCast<S>(q[2]), mlScalarCast<S>(q[3]));
+    }
+
+    /**
+	 * @brief A constructor converting an <b>MlRotation</b>.
+	 */
+    explicit MlRotationT(const MlRotation &r)
+    { setValue(r); }
+
+    /**
+	 * @brief Returns the identity rotation.
+	 */
+    static constexpr MlRotationT identity()
+    { return MlRotationT(S(0), S(0), S(0), S(1), Normalized()); }
+
+    /**
+	 * @brief Set the four components of the quaternion, which are
+	 * normalized.
+	 *
+	 * @return A reference to this rotation is returned.
+	 */
+    MlRotationT &setValue(S q0, S q1, S q2, S q3)
+    {
+        quat[0] = q0; quat[1] = q1; quat[2] = q2; quat[3] = q3;
+        normalize();
+        return *this;
+    }
+
+    /**
+	 * @brief Set the value from a 3D rotation axis and an angle in
+	 * radians.
+	 *
+	 * @return A reference to this rotation is returned.
+	 */
+    MlRotationT &setValue(const MlVector3T<S> &axis, S radians)
+    {
+        MlVector3T<S> q = axis;
+        q.normalize();
+        q *= MlScalarTraits<S>::sin(radians * S(0.5f));
+
+        quat[0] = q[0];
+        quat[1] = q[1];
+        quat[2] = q[2];
+        quat[3] = MlScalarTraits<S>::cos(radians * S(0.5f));
+        return *this;
+    }
+
+    /**
+	 * @brief Set the value from an <b>MlRotation</b>.
+	 *
+	 * @return A reference to this rotation is returned.
+	 */
+    MlRotationT &setValue(const MlRotation &r)
+    {
+        const MlScalar *q = r.getValue();
+        return setValue(mlScalarFromNative<S>(q[0]), mlScalarFromNative<S>(q[1]),
+                        mlScalarFromNative<S>(q[2]), mlScalarFromNative<S>(q[3]));
+    }
+
+    /**
+	 * @brief Get the value as an <b>MlRotation</b>.
+	 */
+    void getValue(MlRotation &r) const
+    {
+        r.setValue(mlScalarToNative(quat[0]), mlScalarToNative(quat[1]),
+                   mlScalarToNative(quat[2]), mlScalarToNative(quat[3]));
+    }
+
+    /**
+	 * @brief Get the four components of the quaternion.
+	 *
+	 * @return A pointer to the components is returned.
+	 */
+    const S *getValue() const
+    { return quat; }
+
+    /**
+	 * @brief Get the 3D rotation axis and the angle in radians.
+	 *
+	 * The axis of the identity rotation is reported as +Z.
+	 */
+    void getValue(MlVector3T<S> &axis, S &radians) const
+    {
+        MlVector3T<S> q(quat[0], quat[1], quat[2]);
+        S len = q.length();
+
+        if (len > S(0.00001f)) {
+            axis = q / len;
+            S w = (quat[3] > S(1)) ? S(1) : (quat[3] < S(-1)) ? S(-1) : quat[3];
+            radians = S(2) * MlScalarTraits<S>::acos(w);
+        } else {
+            axis.setValue(S(0), S(0), S(1));
+            radians = S(0);
+        }
+    }
+
+    /**
+	 * @brief Get the rotation matrix.
+	 *
+	 * The rows are as in the upper 3x3 part of an <b>MlTransform</b>, so
+	 * row vectors are multiplied on the left.
+	 */
+    void getValue(S m[3][3]) const
+    {
+        const S x = quat[0], y = quat[1], z = quat[2], w = quat[3];
+
+        m[0][0] = S(1) - S(2) * (y * y + z * z);
+        m[0][1] = S(2) * (x * y + z * w);
+        m[0][2] = S(2) * (z * x - y * w);
+
+        m[1][0] = S(2) * (x * y - z * w);
+        m[1][1] = S(1) - S(2) * (z * z + x * x);
+        m[1][2] = S(2) * (y * z + x * w);
+
+        m[2][0] = S(2) * (z * x + y * w);
+        m[2][1] = S(2) * (y * z - x * w);
+        m[2][2] = S(1) - S(2) * (y * y + x * x);
+    }
+
+    /**
+	 * @brief Changes the rotation to be its inverse.
+	 *
+	 * @return A reference to this rotation is returned.
+	 */
+    MlRotationT &invert()
+    { quat[0] = -quat[0]; quat[1] = -quat[1]; quat[2] = -quat[2]; return *this; }
+
+    /**
+	 * @brief Returns the inverse of the rotation.
+	 */
+    MlRotationT inverse() const
+    { return MlRotationT(*this).invert(); }
+
+    /**
+	 * @brief Multiplies by another rotation, which is applied after this
+	 * one.
+	 *
+	 * @return A reference to this rotation is returned.
+	 */
+    MlRotationT &operator *=(const MlRotationT &q)
+    { return *this = *this * q; }
+
+    /**
+	 * @brief Puts the given vector through the rotation.
+	 */
+    void multVec(const MlVector3T<S> &src, MlVector3T<S> &dst) const
+    {
+        S m[3][3];
+        getValue(m);
+
+        dst.setValue(src[0] * m[0][0] + src[1] * m[1][0] + src[2] * m[2][0],
+                     src[0] * m[0][1] + src[1] * m[1][1] + src[2] * m[2][1],
+                     src[0] * m[0][2] + src[1] * m[1][2] + src[2] * m[2][2]);
+    }
+
+    /**
+	 * @brief Equality comparison within given tolerance, the square of
+	 * the length of the maximum distance between the two quaternions.
+	 */
+    bool equals(const MlRotationT &r, S tolerance) const
+    {
+        S d[4] = { quat[0] - r.quat[0], quat[1] - r.quat[1],
+                   quat[2] - r.quat[2], quat[3] - r.quat[3] };
+        return d[0] * d[0] + d[1] * d[1] + d[2] * d[2] + d[3] * d[3] <= tolerance;
+    }
+
+    /**
+	 * @brief Spherical linear interpolation: as t goes from 0 to 1, the
+	 * result goes from rot0 to rot1.
+	 */
+    static MlRotationT slerp(const MlRotationT &rot0, const MlRotationT &rot1, S t)
+    {
+        S cosom = rot0.quat[0] * rot1.quat[0] + rot0.quat[1] * rot1.quat[1] +
+                  rot0.quat[2] * rot1.quat[2] + rot0.quat[3] * rot1.quat[3];
+        S sign = S(1);
+
+        // Take the shorter way around.
+        if (cosom < S(0)) {
+            cosom = -cosom;
+            sign = S(-1);
+        }
+
+        S scale0, scale1;
+        if (S(1) - cosom > S(0.00001f)) {
+            S omega = MlScalarTraits<S>::acos(cosom);
+            S sinom = MlScalarTraits<S>::sin(omega);
+            scale0 = MlScalarTraits<S>::sin((S(1) - t) * omega) / sinom;
+            scale1 = MlScalarTraits<S>::sin(t * omega) / sinom;
+        } else {
+            // The rotations are very close, so interpolate linearly.
+            scale0 = S(1) - t;
+            scale1 = t;
+        }
+        scale1 = scale1 * sign;
+
+        MlRotationT rot;
+        for (int i = 0; i < 4; i++)
+            rot.quat[i] = scale0 * rot0.quat[i] + scale1 * rot1.quat[i];
+        return rot;
+    }
+
+    /**
+	 * @brief Binary multiplication: the result rotates by <i>q1</i> and
+	 * then by <i>q2</i>.
+	 */
+    friend MlRotationT operator *(const MlRotationT &q1, const MlRotationT &q2)
+    {
+        const S *a = q1.quat, *b = q2.quat;
+
+        return MlRotationT(b[3] * a[0] + b[0] * a[3] + b[1] * a[2] - b[2] * a[1],
+                           b[3] * a[1] + b[1] * a[3] + b[2] * a[0] - b[0] * a[2],
+                           b[3] * a[2] + b[2] * a[3] + b[0] * a[1] - b[1] * a[0],
+                           b[3] * a[3] - b[0] * a[0] - b[1] * a[1] - b[2] * a[2]);
+    }
+
+    friend constexpr bool operator ==(const MlRotationT &q1, const MlRotationT &q2)
+    {
+        return q1.quat[0] == q2.quat[0] && q1.quat[1] == q2.quat[1] &&
+               q1.quat[2] == q2.quat[2] && q1.quat[3] == q2.quat[3];
+    }
+
+    friend constexpr bool operator !=(const MlRotationT &q1, const MlRotationT &q2)
+    { return !(q1 == q2); }
+
+  private:
+
+    struct Normalized {};
+
+    // Builds a rotation from a quaternion known to be unit length.
+    constexpr MlRotationT(S q0, S q1, S q2, S q3, Normalized)
+      : quat{q0, q1, q2, q3}
+    { }
+
+    // Normalizes the quaternion to unit 4D length.
+    void normalize()
+    {
+        S len = MlScalarTraits<S>::sqrt(quat[0] * quat[0] + quat[1] * quat[1] +
+                                        quat[2] * quat[2] + quat[3] * quat[3]);
+        if (len != S(0)) {
+            quat[0] /= len; quat[1] /= len; quat[2] /= len; quat[3] /= len;
+        }
+    }
+
+    S quat[4];  // Storage for quaternion components.
+};
+
+/**
+ * @brief The rotation types of the scalar types in scalart.h.
+ */
+typedef MlRotationT<float> MlRotationf;
+typedef MlRotationT<double> MlRotationd;
+typedef MlRotationT<MlFixed16> MlRotationx16;
+typedef MlRotationT<MlFixed12> MlRotationx12;
+
+#endif /* ROTATIONT_H_INCLUDED */
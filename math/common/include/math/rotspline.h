@@ -0,0 +1,205 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file rotspline.h
+ * @ingroup MlMath
+ *
+ * This file provides smooth interpolation through a sequence of 3D rotations.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef ROTSPLINE_H_INCLUDED
+#define ROTSPLINE_H_INCLUDED
+
+// Include math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/rotation.h>
+
+
+/**
+ * @brief A squad spline through a sequence of rotation keys.
+ *
+ * The keys are joined by segments that are evaluated with
+ * <b>MlRotation::squad()</b>. The inner control points of every segment
+ * are computed once, when the keys are set, so that evaluating the spline
+ * costs three spherical interpolations. The curve passes through each key
+ * with a continuous angular velocity; at the first and last keys the
+ * control point is the key itself.
+ *
+ * The keys are adjusted so that neighbouring keys are in the same
+ * hemisphere; this does not change the rotations they represent.
+ */
+class MLMATH_API MlRotationSpline
+{
+  public:
+
+    /**
+	 * Default constructor. The spline has no keys.
+	 */
+    MlRotationSpline();
+
+    /**
+	 * @brief A constructor given an array of keys.
+	 *
+	 * @param keys An array of rotations to interpolate.
+	 * @param numKeys The number of keys.
+	 */
+    MlRotationSpline(const MlRotation *keys, int numKeys);
+
+    /**
+	 * @brief Copy constructor.
+	 *
+	 * @param spline The other spline to copy from.
+	 */
+    MlRotationSpline(const MlRotationSpline &spline);
+
+    /**
+	 * Destructor.
+	 */
+    ~MlRotationSpline();
+
+    /**
+	 * @brief Assignment operator.
+	 *
+	 * @param spline The other spline to copy from.
+	 *
+	 * @return A reference to this <b>MlRotationSpline</b> is returned.
+	 */
+    MlRotationSpline &operator =(const MlRotationSpline &spline);
+
+    /**
+	 * @brief Set the keys of the spline.
+	 *
+	 * The control points of each segment are computed here.
+	 *
+	 * @param keys An array of rotations to interpolate.
+	 * @param numKeys The number of keys.
+	 *
+	 * @return A reference to this <b>MlRotationSpline</b> is returned.
+	 */
+    MlRotationSpline &setValue(const MlRotation *keys, int numKeys);
+
+    /**
+	 * @brief Get the number of keys.
+	 *
+	 * @return The number of keys is returned.
+	 */
+    int getNumKeys() const
+	{ return numKeys; }
+
+    /**
+	 * @brief Get the number of segments, one fewer than the number of keys.
+	 *
+	 * @return The number of segments is returned.
+	 */
+    int getNumSegments() const
+	{ return numSegments; }
+
+    /**
+	 * @brief Get the control points of a segment.
+	 *
+	 * The four rotations are the start key, its inner control point,
+	 * the inner control point of the end key and the end key, as
+	 * passed to <b>MlRotation::squad()</b>.
+	 *
+	 * @param segment The index of the segment.
+	 *
+	 * @return A pointer to the four rotations is returned.
+	 */
+    const MlRotation *getSegment(int segment) const
+	{ return &segments[4 * segment]; }
+
+    /**
+	 * @brief Evaluate a segment of the spline.
+	 *
+	 * @param segment The index of the segment.
+	 * @param t The position in the segment. It must be a value from
+	 * 0 to 1.
+	 *
+	 * @return The interpolated rotation is returned.
+	 */
+    MlRotation getValue(int segment, MlScalar t) const;
+
+    /**
+	 * @brief Evaluate the spline.
+	 *
+	 * The integer part of <i>u</i> selects the segment and the
+	 * fraction the position in it, so that key <i>i</i> is reached at
+	 * <i>u</i> = <i>i</i>. Values outside the spline are clamped to
+	 * its ends.
+	 *
+	 * @param u The position along the spline, from 0 to the number of
+	 * segments.
+	 *
+	 * @return The interpolated rotation is returned.
+	 */
+    MlRotation getValue(MlScalar u) const;
+
+    /**
+	 * @brief Evaluate an array of splines at the same position.
+	 *
+	 * For each <i>i</i>, <i>result[i]</i> is set to
+	 * <b>splines[i].getValue(u)</b>. The segments are gathered and
+	 * interpolated together with <b>MlRotation::slerpBatch()</b>, so
+	 * the results agree with <b>getValue()</b> to the accuracy of
+	 * that function. A spline without segments gives its only key,
+	 * or the identity if it has none.
+	 *
+	 * @param splines The splines to evaluate.
+	 * @param count The number of splines.
+	 * @param u The position along each spline, from 0 to its number of
+	 * segments.
+	 * @param result The interpolated rotations.
+	 */
+    static void getValueBatch(const MlRotationSpline *splines, int count,
+                              MlScalar u, MlRotation *result);
+
+  private:
+
+    // Chooses the segment and the position in it for u.
+    int findSegment(MlScalar u, MlScalar &t) const;
+
+    // The number of keys given, and the number of segments.
+    int numKeys;
+    int numSegments;
+
+    // The start key, the two inner control points and the end key of
+    // each segment. A spline with a single key holds just that key.
+    MlRotation *segments;
+};
+
+
+#endif /* ROTSPLINE_H_INCLUDED */
@@ -26,6 +26,10 @@
  * 16, then the format of the scalar will be 16.16. If the ML_FIXED_RADIX is
  * set to 12 then the format of the scalar will be 20.12. If the ML_FIXED_RADIX
  * macro is not set, then the radix format will be set to 16.
+ * </p><p>
+ * If ML_FIXED_INT32=1, a fixed-point scalar is stored in an <b>int32_t</b>
+ * rather than a <b>long</b>. This halves the size of fixed-point vectors,
+ * rotations and transforms on platforms where a <b>long</b> is 64 bits.
  * </p>
  * <h3>
  * Debugging Support
@@ -149,6 +153,31 @@ typedef enum
 } MlScalarType;
 
 
+//------------------------------------------------------------------------
+// The ML_FIXED_INT32 flag selects the storage for a fixed point MlScalar.
+// By default (0) it is a long, which is 64 bits on LP64 platforms even
+// though only 32 of them are used. Set it to 1 to store the scalar in an
+// int32_t, halving the size of vectors, rotations and transforms there.
+// FixedMultiply() and friends still compute their intermediate results
+// in 64 bits. Code built with different settings cannot be mixed.
+
+#if !defined(ML_FIXED_INT32)
+#define ML_FIXED_INT32 0
+#endif /* !defined(ML_FIXED_INT32) */
+
+#if ML_FIXED_POINT
+#if ML_FIXED_INT32
+#include <stdint.h>
+/**
+ * @brief The storage type of a fixed-point <b>MlScalar</b>.
+ */
+typedef int32_t MlFixedStorage;
+#else /* ML_FIXED_INT32 */
+typedef long MlFixedStorage;
+#endif /* ML_FIXED_INT32 */
+#endif /* ML_FIXED_POINT */
+
+
 //------------------------------------------------------------------------
 // Set the MlScalar type early
 
@@ -166,12 +195,48 @@ class MlScalar;
  * When the Magic Lantern Math Library is used in floating-point mode,
  * the <b>MlScalar</b> is typed as a <b>float</b>.
  */
-typedef long MlScalar;
+typedef MlFixedStorage MlScalar;
 #else /* ML_FIXED_POINT */
 typedef float MlScalar;
 #endif /* ML_FIXED_POINT */
 #endif /* ML_MATH_DEBUG */
 
+//------------------------------------------------------------------------
+// ML_SCALAR_CONSTEXPR marks the inline functions that can be evaluated at
+// compile time when MlScalar is a plain float. Neither the fixed point
+// arithmetic nor the debugging MlScalar class can be, so there it is only
+// inline.
+
+#if ML_FIXED_POINT || ML_MATH_DEBUG
+#define ML_SCALAR_CONSTEXPR inline
+#else
+#define ML_SCALAR_CONSTEXPR constexpr
+#endif
+
+// ML_SQRT_CONSTEXPR marks the inline functions that take square roots,
+// such as mlSqrt(). They can be evaluated at compile time too where the
+// compiler can tell when it is doing so, which GCC 9, Clang 9 and Visual
+// C++ 2019 16.5 and later can. There mlConstSqrt() takes the roots,
+// while sqrtf() still takes them at run time.
+#if !ML_FIXED_POINT && !ML_MATH_DEBUG
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define ML_SQRT_CONSTANT_EVALUATED 1
+#endif
+#endif
+#if !defined(ML_SQRT_CONSTANT_EVALUATED) && \
+    ((defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || \
+     (defined(_MSC_VER) && _MSC_VER >= 1925))
+#define ML_SQRT_CONSTANT_EVALUATED 1
+#endif
+#endif
+
+#if defined(ML_SQRT_CONSTANT_EVALUATED)
+#define ML_SQRT_CONSTEXPR constexpr
+#else
+#define ML_SQRT_CONSTEXPR inline
+#endif
+
 
 //------------------------------------------------------------------------
 // Set up the fixed point radix and conversion factors
@@ -216,6 +281,27 @@ static int errorWrongRadix = ML_ASSERT(ML_FIXED_RADIX==16 || ML_FIXED_RADIX==12)
 #endif /* (ML_FIXED_RADIX == 12) */
 #endif /* (ML_FIXED_RADIX == 16) */
 
+//------------------------------------------------------------------------
+// Select what FixedMultiply(), FixedDivide() and FixedMulDiv() do when
+// the result does not fit in the fixed point format.
+//
+//   ML_FIXED_OVERFLOW_WRAP      keep the low order 32 bits of the result
+//   ML_FIXED_OVERFLOW_SATURATE  clamp the result to +/- 0x7fffffff
+//   ML_FIXED_OVERFLOW_ASSERT    assert, then saturate if asserts are
+//                               compiled out (the default)
+//
+// The policy is applied by the 64-bit implementations of these functions
+// (see ML_FIXED_WIDE_ARITH in fixed.cxx). The portable 32-bit versions
+// always assert.
+
+#define ML_FIXED_OVERFLOW_WRAP     0
+#define ML_FIXED_OVERFLOW_SATURATE 1
+#define ML_FIXED_OVERFLOW_ASSERT   2
+
+#ifndef ML_FIXED_OVERFLOW
+#define ML_FIXED_OVERFLOW ML_FIXED_OVERFLOW_ASSERT
+#endif
+
 //------------------------------------------------------------------------
 // Create the ML_SCALAR() macro 4 different ways depending on
 // the compiler flag settings.
@@ -313,7 +399,7 @@ static int errorWrongRadix = ML_ASSERT(ML_FIXED_RADIX==16 || ML_FIXED_RADIX==12)
  * @return A Magic Lantern Scalar is returned, the product of the
  * input values x and y.
  */
-inline MLMATH_API MlScalar mlMul(const MlScalar x, const MlScalar y);
+ML_SCALAR_CONSTEXPR MLMATH_API MlScalar mlMul(const MlScalar x, const MlScalar y);
 
 /**
  * @brief Multiply three Magic Lantern Scalar primitives [v = x * y * z].
@@ -328,7 +414,7 @@ inline MLMATH_API MlScalar mlMul(const MlScalar x, const MlScalar y);
  * @return A Magic Lantern Scalar is returned, the product of the
  * input values x, y and z.
  */
-inline MLMATH_API MlScalar mlMulMul(const MlScalar x, const MlScalar y, const MlScalar z);
+ML_SCALAR_CONSTEXPR MLMATH_API MlScalar mlMulMul(const MlScalar x, const MlScalar y, const MlScalar z);
 
 /**
  * @brief Multiply a Magic Lantern Scalar primitive by another scalar
@@ -359,7 +445,7 @@ inline MLMATH_API MlScalar mlMulBy(MlScalar &x, const MlScalar y);
  * @return A Magic Lantern Scalar is returned, the division of the scalar
  * x by y.
  */
-inline MLMATH_API MlScalar mlDiv(const MlScalar x, const MlScalar y);
+ML_SCALAR_CONSTEXPR MLMATH_API MlScalar mlDiv(const MlScalar x, const MlScalar y);
 
 /**
  * @brief Divide a Magic Lantern Scalar primitive by another
@@ -392,7 +478,7 @@ inline MLMATH_API MlScalar mlDivBy(MlScalar &x, const MlScalar y);
  *
  * @return A Magic Lantern Scalar is returned
  */
-inline MLMATH_API MlScalar mlMulDiv(const MlScalar x, const MlScalar y, const MlScalar z);
+ML_SCALAR_CONSTEXPR MLMATH_API MlScalar mlMulDiv(const MlScalar x, const MlScalar y, const MlScalar z);
 
 /**
  * @brief Calculate the reciprocal value of a Magic Lantern Scalar
@@ -405,7 +491,7 @@ inline MLMATH_API MlScalar mlMulDiv(const MlScalar x, const MlScalar y, const Ml
  *
  * @return A Magic Lantern Scalar is returned.
  */
-inline MLMATH_API MlScalar mlReciprocal( const MlScalar x );
+ML_SCALAR_CONSTEXPR MLMATH_API MlScalar mlReciprocal( const MlScalar x );
 
 /**
  * @brief Calculate the reciprocal value of the square-root of a Magic Lantern Scalar
@@ -418,7 +504,7 @@ inline MLMATH_API MlScalar mlReciprocal( const MlScalar x );
  *
  * @return A Magic Lantern Scalar is returned.
  */
-inline MLMATH_API MlScalar mlRecipSqrt( const MlScalar x );
+ML_SQRT_CONSTEXPR MLMATH_API MlScalar mlRecipSqrt( const MlScalar x );
 
 /**
  * @brief Compute the absolute value of a Magic Lantern Scalar
@@ -431,7 +517,7 @@ inline MLMATH_API MlScalar mlRecipSqrt( const MlScalar x );
  *
  * @return A Magic Lantern Scalar is returned.
  */
-inline MLMATH_API MlScalar mlAbs( const MlScalar x );
+ML_SCALAR_CONSTEXPR MLMATH_API MlScalar mlAbs( const MlScalar x );
 
 /**
  * @brief Determine the maiximum value for two Magic Lantern Scalars
@@ -446,7 +532,7 @@ inline MLMATH_API MlScalar mlAbs( const MlScalar x );
  * @return A Magic Lantern Scalar is returned, either x or y, whichever
  * is larger.
  */
-inline MLMATH_API MlScalar mlMax( const MlScalar x, const MlScalar y );
+ML_SCALAR_CONSTEXPR MLMATH_API MlScalar mlMax( const MlScalar x, const MlScalar y );
 
 /**
  * @brief Compute the sign of the specified Magic Lantern Scalar
@@ -461,7 +547,7 @@ inline MLMATH_API MlScalar mlMax( const MlScalar x, const MlScalar y );
  * If the scalar is negative, then -<b>ML_SCALAR_ONE</b> is returned.
  * If the scalar is positive, then <b>ML_SCALAR_ONE</b> is returned.
  */
-inline MLMATH_API MlScalar mlSign( const MlScalar x );
+ML_SCALAR_CONSTEXPR MLMATH_API MlScalar mlSign( const MlScalar x );
 
 /**
  * @brief Compute the sqare-root of a Magic Lantern Scalar
@@ -474,7 +560,7 @@ inline MLMATH_API MlScalar mlSign( const MlScalar x );
  *
  * @return The square-root of the specified scalar is returned.
  */
-inline MLMATH_API MlScalar mlSqrt( const MlScalar x );
+ML_SQRT_CONSTEXPR MLMATH_API MlScalar mlSqrt( const MlScalar x );
 
 /**
  * @brief Compute the sqare of a Magic Lantern Scalar
@@ -487,7 +573,7 @@ inline MLMATH_API MlScalar mlSqrt( const MlScalar x );
  *
  * @return The square of the specified scalar is returned.
  */
-inline MLMATH_API MlScalar mlSquare( const MlScalar x );
+ML_SCALAR_CONSTEXPR MLMATH_API MlScalar mlSquare( const MlScalar x );
 
 /**
  * @brief Determine whether two Magic Lantern Scalars are equal within
@@ -564,11 +650,13 @@ int ML_MATH_STDCALL mlScalarIsMathDebug(void);
 
 #if ML_MATH_DEBUG
 extern MLMATH_API MlScalar mlFloatToScalar(const float);
-#else
+#elif ML_FIXED_POINT
 extern MlScalar ML_MATH_STDCALL mlFloatToScalar(const float); // TEST ON LINUX
 #endif
+#if ML_FIXED_POINT || ML_MATH_DEBUG
 extern MLMATH_API MlScalar mlLongToScalar(const long);
 extern MLMATH_API MlScalar mlScalarSetValue(const long);
+#endif
 
 #if ML_FIXED_POINT
 
@@ -667,14 +755,14 @@ class MLMATH_API MlScalar
 		{ MlScalar f; f.value = operand && op2.value; return f; }
 	
   protected:
-	long value;
+	MlFixedStorage value;
 };
 
 #else /* ML_MATH_DEBUG */
 //
-// In optimized fixed-point mode we just make the scalar a long and work
-// directly on it.
-typedef long MlScalar;
+// In optimized fixed-point mode we just make the scalar a long (or an
+// int32_t, see ML_FIXED_INT32) and work directly on it.
+typedef MlFixedStorage MlScalar;
 
 /**
  * @brief Get the value of a Magic Lantern Scalar as a <b>long</b> data type.
@@ -1063,15 +1151,15 @@ protected:
 #else /* ML_MATH_DEBUG */
 typedef float MlScalar;
 
-inline MLMATH_API float mlScalarGetValue(const MlScalar number) { return (float)number; }
-inline MLMATH_API MlScalar mlScalarSetValue(const float val) { return val; }
-inline MLMATH_API long mlScalarToLong(const MlScalar number) { return (long)number; };
-inline MLMATH_API MlScalar mlLongToScalar(const long number) { return (MlScalar)number; };
+ML_SCALAR_CONSTEXPR MLMATH_API float mlScalarGetValue(const MlScalar number) { return (float)number; }
+ML_SCALAR_CONSTEXPR MLMATH_API MlScalar mlScalarSetValue(const float val) { return val; }
+ML_SCALAR_CONSTEXPR MLMATH_API long mlScalarToLong(const MlScalar number) { return (long)number; };
+ML_SCALAR_CONSTEXPR MLMATH_API MlScalar mlLongToScalar(const long number) { return (MlScalar)number; };
 
 #ifndef ML_SCALAR_FLOAT_DISALLOWED
-inline MlScalar ML_MATH_STDCALL mlFloatToScalar(const float operand)
+ML_SCALAR_CONSTEXPR MlScalar ML_MATH_STDCALL mlFloatToScalar(const float operand)
 	{ return (MlScalar) operand; }
-inline float ML_MATH_STDCALL mlScalarToFloat(const MlScalar operand)
+ML_SCALAR_CONSTEXPR float ML_MATH_STDCALL mlScalarToFloat(const MlScalar operand)
 	{ return (float) operand; }
 #endif /* ML_SCALAR_FLOAT_DISALLOWED */
 
@@ -1080,7 +1168,7 @@ inline float ML_MATH_STDCALL mlScalarToFloat(const MlScalar operand)
 #endif /* ML_FIXED_POINT */
 
 // z = x * y
-inline MlScalar 
+ML_SCALAR_CONSTEXPR MlScalar
 mlMul(const MlScalar x, const MlScalar y) 
 {
 #if ML_FIXED_POINT
@@ -1091,7 +1179,7 @@ mlMul(const MlScalar x, const MlScalar y)
 }
 
 // v = x * y * z
-inline MlScalar 
+ML_SCALAR_CONSTEXPR MlScalar
 mlMulMul(const MlScalar x, const MlScalar y, const MlScalar z) 
 {
 #if ML_FIXED_POINT
@@ -1114,7 +1202,7 @@ mlMulBy(MlScalar &x, const MlScalar y)
 }
 
 // z = x / y
-inline MlScalar
+ML_SCALAR_CONSTEXPR MlScalar
 mlDiv(const MlScalar x, const MlScalar y)
 {
 #if ML_FIXED_POINT
@@ -1137,7 +1225,7 @@ mlDivBy(MlScalar &x, const MlScalar y)
 }
 
 // w = x * y / z
-inline MlScalar
+ML_SCALAR_CONSTEXPR MlScalar
 mlMulDiv(const MlScalar x, const MlScalar y, const MlScalar z)
 {
 #if ML_FIXED_POINT
@@ -1148,7 +1236,7 @@ mlMulDiv(const MlScalar x, const MlScalar y, const MlScalar z)
 }
 
 // z = 1.0 / x
-inline MlScalar
+ML_SCALAR_CONSTEXPR MlScalar
 mlReciprocal( const MlScalar x )
 {
 #if ML_FIXED_POINT
@@ -1164,33 +1252,65 @@ mlReciprocal( const MlScalar x )
 #endif
 }
 
+#if defined(ML_SQRT_CONSTANT_EVALUATED)
+// z = sqrt(x), correctly rounded as sqrtf() is, for evaluation at compile
+// time. The argument is scaled by powers of four into [1, 4), where
+// Newton's method converges in double precision, which is then rounded
+// once to float.
+constexpr float
+mlConstSqrt( const float x )
+{
+    if (! (x > 0.0f) || x > 3.40282347e+38f)
+        return (x == 0.0f || x > 0.0f) ? x : (x - x) / (x - x);
+
+    double d = x, scale = 1.0;
+    while (d >= 4.0) {
+        d *= 0.25;
+        scale *= 2.0;
+    }
+    while (d < 1.0) {
+        d *= 4.0;
+        scale *= 0.5;
+    }
+
+    double r = 1.5;
+    for (int i = 0; i < 6; i++)
+        r = 0.5 * (r + d / r);
+    return (float) (r * scale);
+}
+#endif
+
 // z = 1.0 / sqrt(x)
-inline MlScalar
+ML_SQRT_CONSTEXPR MlScalar
 mlRecipSqrt( const MlScalar x )
 {
 #if ML_FIXED_POINT
     return FixedRecipSqrt(x);
 #else
+#if defined(ML_SQRT_CONSTANT_EVALUATED)
+    if (__builtin_is_constant_evaluated())
+        return mlFloatToScalar(1.0f / mlConstSqrt(mlScalarToFloat(x)));
+#endif
     return mlFloatToScalar(1.0f / sqrtf(mlScalarToFloat(x)));
 #endif
 }
 
 // z = abs(x)
-inline MlScalar
+ML_SCALAR_CONSTEXPR MlScalar
 mlAbs( const MlScalar x )
 {
     return ( x >= ML_SCALAR_ZERO ) ? x : -x;
 }
 
 // z = MAX(x,y)
-inline MlScalar
+ML_SCALAR_CONSTEXPR MlScalar
 mlMax( const MlScalar x, const MlScalar y )
 {
     return ( x >= y ) ? x : y;
 }
 
 // z = sign(x)
-inline MlScalar
+ML_SCALAR_CONSTEXPR MlScalar
 mlSign( const MlScalar x )
 {
     if (x == ML_SCALAR_ZERO)
@@ -1204,18 +1324,22 @@ mlSign( const MlScalar x )
 }
 
 // z = sqrt(x)
-inline MlScalar
+ML_SQRT_CONSTEXPR MlScalar
 mlSqrt( const MlScalar x )
 {
 #if ML_FIXED_POINT
     return FixedSqrt(x);
 #else
+#if defined(ML_SQRT_CONSTANT_EVALUATED)
+    if (__builtin_is_constant_evaluated())
+        return mlFloatToScalar(mlConstSqrt(mlScalarToFloat(x)));
+#endif
     return mlFloatToScalar(sqrtf(mlScalarToFloat(x)));
 #endif
 }	
 
 // z = x * x;
-inline MlScalar 
+ML_SCALAR_CONSTEXPR MlScalar
 mlSquare( const MlScalar x )
 {
 #if ML_FIXED_POINT
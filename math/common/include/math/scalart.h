@@ -0,0 +1,573 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file scalart.h
+ * @ingroup MlMath
+ *
+ * This file provides the scalar types of the templated math classes.
+ *
+ * <b>MlScalar</b> is chosen for the whole build by ML_FIXED_POINT and
+ * ML_FIXED_RADIX. The templated classes, <b>MlVector3T</b>,
+ * <b>MlRotationT</b> and <b>MlTransformT</b>, take their scalar type as a
+ * parameter instead, so that <i>float</i>, <i>double</i>,
+ * <b>MlFixed<16></b> and <b>MlFixed<12></b> math can all be used in one
+ * program, whatever the library itself was built with. For example, a
+ * tool can run the fixed point simulation and check it against float or
+ * double results.
+ *
+ * <b>MlScalarTraits</b> gives the functions each scalar type needs beyond
+ * the arithmetic operators, and <b>MlNativeScalar</b> is the scalar type
+ * matching the <b>MlScalar</b> of the build.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef SCALART_H_INCLUDED
+#define SCALART_H_INCLUDED
+
+// Include system header files.
+#include <stdint.h>
+#include <math.h>
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/fixedlut.h>
+
+
+/**
+ * @brief A fixed point number with RADIX fraction bits.
+ *
+ * The value is held in 32 bits, as a fixed point <b>MlScalar</b> is, and
+ * the arithmetic follows the library's fixed point functions: products
+ * and quotients are formed in 64 bits and truncated toward zero, division
+ * by zero gives the largest value of the right sign (or one, for 0/0),
+ * and results out of range saturate to +/-0x7fffffff. Sums and
+ * differences saturate too, rather than wrap.
+ *
+ * Integers, floats and doubles convert implicitly, the latter two rounded
+ * to the nearest value, so constants can be written as usual:
+ * <i>x * 0.5f + 1</i>.
+ */
+template <int RADIX>
+class MlFixed
+{
+  public:
+
+    /**
+	 * @brief The number of fraction bits.
+	 */
+    static const int radix = RADIX;
+
+    /**
+	 * Default constructor, leaves the value uninitialized.
+	 */
+    MlFixed() {}
+
+    /**
+	 * @brief A constructor given an integer.
+	 */
+    constexpr MlFixed(int i)
+      : value(saturate((int64_t) i * (int64_t(1) << RADIX)))
+    { }
+
+    /**
+	 * @brief A constructor given a float, rounded to the nearest value.
+	 */
+    constexpr MlFixed(float f)
+      : value(fromDouble(f))
+    { }
+
+    /**
+	 * @brief A constructor given a double, rounded to the nearest value.
+	 */
+    constexpr MlFixed(double d)
+      : value(fromDouble(d))
+    { }
+
+    /**
+	 * @brief Build a number from its raw fixed point value.
+	 *
+	 * @param raw The value scaled by 2^RADIX.
+	 */
+    static constexpr MlFixed fromRaw(int32_t raw)
+    { return MlFixed(raw, Raw()); }
+
+    /**
+	 * @brief Get the raw fixed point value.
+	 *
+	 * @return The value scaled by 2^RADIX is returned.
+	 */
+    constexpr int32_t getValue() const
+    { return value; }
+
+    /**
+	 * @brief Conversion to float.
+	 */
+    constexpr explicit operator float() const
+    { return (float) ((double) value / (double) (int64_t(1) << RADIX)); }
+
+    /**
+	 * @brief Conversion to double.
+	 */
+    constexpr explicit operator double() const
+    { return (double) value / (double) (int64_t(1) << RADIX); }
+
+    /**
+	 * @brief Unary negation.
+	 */
+    constexpr MlFixed operator -() const
+    { return fromRaw(saturate(-(int64_t) value)); }
+
+    friend constexpr MlFixed operator +(MlFixed a, MlFixed b)
+    { return fromRaw(saturate((int64_t) a.value + b.value)); }
+
+    friend constexpr MlFixed operator -(MlFixed a, MlFixed b)
+    { return fromRaw(saturate((int64_t) a.value - b.value)); }
+
+    friend constexpr MlFixed operator *(MlFixed a, MlFixed b)
+    { return fromRaw(multiply(a.value, b.value)); }
+
+    friend constexpr MlFixed operator /(MlFixed a, MlFixed b)
+    { return fromRaw(divide(a.value, b.value)); }
+
+    MlFixed &operator +=(MlFixed b)
+    { return *this = *this + b; }
+
+    MlFixed &operator -=(MlFixed b)
+    { return *this = *this - b; }
+
+    MlFixed &operator *=(MlFixed b)
+    { return *this = *this * b; }
+
+    MlFixed &operator /=(MlFixed b)
+    { return *this = *this / b; }
+
+    friend constexpr bool operator ==(MlFixed a, MlFixed b)
+    { return a.value == b.value; }
+
+    friend constexpr bool operator !=(MlFixed a, MlFixed b)
+    { return a.value != b.value; }
+
+    friend constexpr bool operator <(MlFixed a, MlFixed b)
+    { return a.value < b.value; }
+
+    friend constexpr bool operator >(MlFixed a, MlFixed b)
+    { return a.value > b.value; }
+
+    friend constexpr bool operator <=(MlFixed a, MlFixed b)
+    { return a.value <= b.value; }
+
+    friend constexpr bool operator >=(MlFixed a, MlFixed b)
+    { return a.value >= b.value; }
+
+  private:
+
+    struct Raw {};
+
+    constexpr MlFixed(int32_t raw, Raw)
+      : value(raw)
+    { }
+
+    static constexpr int32_t saturate(int64_t v)
+    { return (v > 0x7fffffff) ? 0x7fffffff : (v < -0x7fffffff) ? -0x7fffffff : (int32_t) v; }
+
+    static constexpr int32_t fromDouble(double d)
+    {
+        return saturate((int64_t) (clamp(d * (double) (int64_t(1) << RADIX)) +
+                                   ((d < 0.0) ? -0.5 : 0.5)));
+    }
+
+    // Keeps the scaled value within int64_t before the conversion.
+    static constexpr double clamp(double d)
+    { return (d > 4294967296.0) ? 4294967296.0 : (d < -4294967296.0) ? -4294967296.0 : d; }
+
+    // As FixedMultiply(): truncate toward zero, then saturate.
+    static constexpr int32_t multiply(int32_t a, int32_t b)
+    {
+        return saturate(((int64_t) a * b +
+                         (((int64_t) a * b < 0) ? (int64_t(1) << RADIX) - 1 : 0)) >> RADIX);
+    }
+
+    // As FixedDivide(), including the results of division by zero.
+    static constexpr int32_t divide(int32_t a, int32_t b)
+    {
+        return (b == 0) ? ((a > 0) ? 0x7fffffff : (a < 0) ? -0x7fffffff : (int32_t) (1 << RADIX))
+                        : saturate((int64_t) a * (int64_t(1) << RADIX) / b);
+    }
+
+    int32_t value;
+};
+
+/**
+ * @brief Fixed point with 16 fraction bits, as ML_FIXED_RADIX 16.
+ */
+typedef MlFixed<16> MlFixed16;
+
+/**
+ * @brief Fixed point with 12 fraction bits, as ML_FIXED_RADIX 12.
+ */
+typedef MlFixed<12> MlFixed12;
+
+
+/**
+ * @brief The functions of a scalar type used by the templated classes.
+ *
+ * Each specialization provides <i>toDouble</i> and <i>fromDouble</i>,
+ * <i>sqrt</i>, <i>length</i> (of a 3D vector given its components),
+ * <i>sin</i>, <i>cos</i>, <i>acos</i> and <i>atan2</i>, with angles in
+ * radians. The arithmetic itself is done by the operators of the type.
+ */
+template <class S>
+struct MlScalarTraits
+{
+};
+
+template <>
+struct MlScalarTraits<float>
+{
+    static double toDouble(float x) { return x; }
+    static float fromDouble(double d) { return (float) d; }
+
+    static float sqrt(float x) { return sqrtf(x); }
+    static float length(float x, float y, float z) { return sqrtf(x * x + y * y + z * z); }
+    static float sin(float x) { return sinf(x); }
+    static float cos(float x) { return cosf(x); }
+    static float acos(float x) { return acosf(x); }
+    static float atan2(float y, float x) { return atan2f(y, x); }
+};
+
+template <>
+struct MlScalarTraits<double>
+{
+    static double toDouble(double x) { return x; }
+    static double fromDouble(double d) { return d; }
+
+    static double sqrt(double x) { return ::sqrt(x); }
+    static double length(double x, double y, double z) { return ::sqrt(x * x + y * y + z * z); }
+    static double sin(double x) { return ::sin(x); }
+    static double cos(double x) { return ::cos(x); }
+    static double acos(double x) { return ::acos(x); }
+    static double atan2(double y, double x) { return ::atan2(y, x); }
+};
+
+/**
+ * The fixed point functions work as the library's fixed point functions
+ * do, from the same tables (see fixedlut.h) generated for the radix of
+ * the type. For <b>MlFixed<ML_FIXED_RADIX></b>, <i>sqrt</i> returns the
+ * bits of mlSqrt(), and <i>sin</i> and <i>cos</i> those of mlSin() and
+ * mlCos() of mlRadiansToAngle(). <i>acos</i> and <i>atan2</i> give the
+ * angles of mlAcos() and mlAtan2() in radians, the latter in [-PI, PI].
+ *
+ * The length refines the square root table estimate in 64 bits, so it is
+ * exact to the nearest value and does not overflow as the sum of the
+ * squared components would.
+ */
+template <int RADIX>
+struct MlScalarTraits< MlFixed<RADIX> >
+{
+    typedef MlFixed<RADIX> Fixed;
+
+    static double toDouble(Fixed x) { return (double) x; }
+    static Fixed fromDouble(double d) { return Fixed(d); }
+
+    static Fixed sqrt(Fixed x)
+    {
+        return (x.getValue() <= 0) ? Fixed(0)
+                                   : Fixed::fromRaw((int32_t) sqrtRaw((uint32_t) x.getValue()));
+    }
+
+    static Fixed length(Fixed x, Fixed y, Fixed z)
+    {
+        // The sum of the squared raw values is the squared raw length.
+        uint64_t sum = (uint64_t) ((int64_t) x.getValue() * x.getValue()) +
+                       (uint64_t) ((int64_t) y.getValue() * y.getValue()) +
+                       (uint64_t) ((int64_t) z.getValue() * z.getValue());
+        if (sum == 0)
+            return Fixed(0);
+
+        // Normalize as sqrtRaw() does, and look up the square root of the
+        // high word, which is sqrt(hi)*2^(RADIX/2). The root of the sum is
+        // that times 2^(16 - RADIX/2 - shift/2).
+        uint32_t high = (uint32_t) (sum >> 32);
+        int shift = ((high != 0) ? mlFixedClz(high) : 32 + mlFixedClz((uint32_t) sum)) & ~1;
+        uint32_t op = (uint32_t) ((sum << shift) >> 32);
+        int scale = 16 - RADIX / 2 - shift / 2;
+        uint64_t r = sqrtLut.value[(op >> SQRT_INDEX_SHIFT) - SQRT_INDEX_OFFSET];
+        r = (scale >= 0) ? r << scale : r >> -scale;
+
+        // Two Newton steps take the table's 11 bits past the 32 of the
+        // result; then round to the nearest.
+        r = (r + sum / r) >> 1;
+        r = (r + sum / r) >> 1;
+        while (r * r + r < sum)
+            r++;
+        while (r * r - r >= sum)
+            r--;
+        return Fixed::fromRaw((r >= 0x7fffffff) ? 0x7fffffff : (int32_t) r);
+    }
+
+    static Fixed sin(Fixed x)
+    { return Fixed::fromRaw(sine(radiansToAngle(x))); }
+
+    static Fixed cos(Fixed x)
+    {
+        // A quarter turn ahead, the sine reads the table where FixedCos()
+        // does.
+        return Fixed::fromRaw(sine((int32_t) ((uint32_t) radiansToAngle(x) + (1u << (RADIX - 2)))));
+    }
+
+    static Fixed acos(Fixed x)
+    {
+        // As FixedAcos(): a quarter turn less the arc sine.
+        int32_t op = x.getValue();
+        int32_t asin;
+        if (op >= (1 << RADIX))
+            asin = 1 << (RADIX - 2);
+        else if (op <= -(1 << RADIX))
+            asin = -(1 << (RADIX - 2));
+        else {
+            uint32_t a = (op < 0) ? -op : op;
+            asin = interpolate(asinLut.value, (a & ASIN_INDEX_MASK) >> ASIN_INDEX_SHIFT,
+                               a & ASIN_REMDR_MASK, ASIN_INDEX_SHIFT);
+            if (op < 0)
+                asin = -asin;
+        }
+        return angleToRadians((1 << (RADIX - 2)) - asin);
+    }
+
+    static Fixed atan2(Fixed y, Fixed x)
+    {
+        // As FixedAtan2(), with the angles past a half turn made negative.
+        int32_t opX = x.getValue(), opY = y.getValue();
+        int32_t angle;
+        if (opX == 0)
+            angle = (opY > 0) ? (1 << (RADIX - 2)) : (opY < 0) ? -(1 << (RADIX - 2)) : 0;
+        else if (opY == 0)
+            angle = (opX > 0) ? 0 : (1 << (RADIX - 1));
+        else {
+            Fixed c = (opX < 0) ? -x : x;
+            Fixed s = (opY < 0) ? -y : y;
+            bool invert = s > c;
+            if (invert) {
+                Fixed t = s;
+                s = c;
+                c = t;
+            }
+            if (s == c)
+                angle = atanLut.value[1 << ML_FIXED_ATAN_LUT_BITS];
+            else {
+                uint32_t t = (uint32_t) (s / c).getValue();
+                angle = interpolate(atanLut.value, (t & ATAN_INDEX_MASK) >> ATAN_INDEX_SHIFT,
+                                    t & ATAN_REMDR_MASK, ATAN_INDEX_SHIFT);
+            }
+            if (invert)
+                angle = (1 << (RADIX - 2)) - angle;
+            if (opX < 0)
+                angle = (1 << (RADIX - 1)) - angle;
+            if (opY < 0)
+                angle = -angle;
+        }
+        return angleToRadians(angle);
+    }
+
+  private:
+
+    static_assert((RADIX & 1) == 0, "RADIX must be even");
+    static_assert(RADIX - 2 - ML_FIXED_SINE_LUT_BITS >= 0, "ML_FIXED_SINE_LUT_BITS is too large for RADIX");
+    static_assert(RADIX - ML_FIXED_ATAN_LUT_BITS >= 0, "ML_FIXED_ATAN_LUT_BITS is too large for RADIX");
+    static_assert(RADIX - ML_FIXED_ASIN_LUT_BITS >= 0, "ML_FIXED_ASIN_LUT_BITS is too large for RADIX");
+
+    // The table layouts of sqrt.cxx, sine.cxx, atan.cxx and asine.cxx.
+    enum
+    {
+        SQRT_INDEX_SHIFT = 32 - ML_FIXED_SQRT_LUT_BITS,
+        SQRT_INDEX_OFFSET = 1 << (ML_FIXED_SQRT_LUT_BITS - 2),
+        SINE_INDEX_SHIFT = RADIX - 2 - ML_FIXED_SINE_LUT_BITS,
+        SINE_INDEX_MASK = ((2 << ML_FIXED_SINE_LUT_BITS) - 1) << SINE_INDEX_SHIFT,
+        SINE_REMDR_MASK = (1 << SINE_INDEX_SHIFT) - 1,
+        ATAN_INDEX_SHIFT = RADIX - ML_FIXED_ATAN_LUT_BITS,
+        ATAN_INDEX_MASK = ((1 << ML_FIXED_ATAN_LUT_BITS) - 1) << ATAN_INDEX_SHIFT,
+        ATAN_REMDR_MASK = (1 << ATAN_INDEX_SHIFT) - 1,
+        ASIN_INDEX_SHIFT = RADIX - ML_FIXED_ASIN_LUT_BITS,
+        ASIN_INDEX_MASK = ((1 << ML_FIXED_ASIN_LUT_BITS) - 1) << ASIN_INDEX_SHIFT,
+        ASIN_REMDR_MASK = (1 << ASIN_INDEX_SHIFT) - 1
+    };
+
+    static constexpr MlFixedLut<unsigned long, 3 << (ML_FIXED_SQRT_LUT_BITS - 2)> sqrtLut =
+        mlSqrtLut<ML_FIXED_SQRT_LUT_BITS, RADIX>();
+    static constexpr MlFixedLut<long, (1 << ML_FIXED_SINE_LUT_BITS) + 1> sineLut =
+        mlSineLut<ML_FIXED_SINE_LUT_BITS, RADIX>();
+    static constexpr MlFixedLut<short, (1 << ML_FIXED_ATAN_LUT_BITS) + 1> atanLut =
+        mlAtanLut<ML_FIXED_ATAN_LUT_BITS, RADIX>();
+    static constexpr MlFixedLut<short, (1 << ML_FIXED_ASIN_LUT_BITS) + 1> asinLut =
+        mlAsinLut<ML_FIXED_ASIN_LUT_BITS, RADIX>();
+
+    // As fixedSqrt() in sqrt.cxx: shift the argument left by an even
+    // number of bits, look up the root of its high bits, then take one
+    // Newton step and shift back, rounding.
+    static uint32_t sqrtRaw(uint32_t op)
+    {
+        int shift = mlFixedClz(op) >> 1;
+        op <<= 2 * shift;
+        uint32_t estimate = (uint32_t) sqrtLut.value[(op >> SQRT_INDEX_SHIFT) - SQRT_INDEX_OFFSET];
+
+        uint64_t sOp = ((uint64_t) op + 1) >> 1;
+        uint32_t div = (uint32_t) ((sOp << RADIX) / estimate) << 1;
+        if (div > estimate)
+            estimate += (div - estimate) >> 1;
+        else
+            estimate -= (estimate - div) >> 1;
+        return (estimate + ((1u << shift) >> 1)) >> shift;
+    }
+
+    // As FixedTableInterp(): the entry at index, plus the fraction remdr
+    // of a bin of 2^shift toward the next, rounded.
+    template <class T>
+    static int32_t interpolate(const T *table, uint32_t index, uint32_t remdr, int shift)
+    {
+        int64_t lower = table[index];
+        if (remdr != 0)
+            lower += ((table[index + 1] - lower) * ((int64_t) remdr << (RADIX - shift)) +
+                      (1 << (RADIX - 1))) >> RADIX;
+        return (int32_t) lower;
+    }
+
+    // As FixedSin(): the two high bits of the fraction of the angle are
+    // the quadrant, and the table covers the first.
+    static int32_t sine(int32_t angle)
+    {
+        uint32_t a = (uint32_t) angle;
+        uint32_t quadrant = (a >> (RADIX - 2)) & 3;
+        if (quadrant & 1)
+            a = (1u << (RADIX - 1)) - a;
+        int32_t s = interpolate(sineLut.value, (a & SINE_INDEX_MASK) >> SINE_INDEX_SHIFT,
+                                a & SINE_REMDR_MASK, SINE_INDEX_SHIFT);
+        return (quadrant & 2) ? -s : s;
+    }
+
+    // As mlRadiansToAngle(): times 5.09/32 for 1/2PI. The constants are
+    // those of ML_SCALAR(), which truncates.
+    static int32_t radiansToAngle(Fixed x)
+    {
+        return (x * Fixed::fromRaw((int32_t) (5.09295817894065075808 * (1 << RADIX)))).getValue() >> 5;
+    }
+
+    // As mlAngleToRadians().
+    static Fixed angleToRadians(int32_t angle)
+    {
+        return Fixed::fromRaw((int32_t) (6.2831853071795864f * (float) (1 << RADIX))) *
+               Fixed::fromRaw(angle);
+    }
+};
+
+template <int RADIX>
+constexpr MlFixedLut<unsigned long, 3 << (ML_FIXED_SQRT_LUT_BITS - 2)>
+    MlScalarTraits< MlFixed<RADIX> >::sqrtLut;
+template <int RADIX>
+constexpr MlFixedLut<long, (1 << ML_FIXED_SINE_LUT_BITS) + 1>
+    MlScalarTraits< MlFixed<RADIX> >::sineLut;
+template <int RADIX>
+constexpr MlFixedLut<short, (1 << ML_FIXED_ATAN_LUT_BITS) + 1>
+    MlScalarTraits< MlFixed<RADIX> >::atanLut;
+template <int RADIX>
+constexpr MlFixedLut<short, (1 << ML_FIXED_ASIN_LUT_BITS) + 1>
+    MlScalarTraits< MlFixed<RADIX> >::asinLut;
+
+
+/**
+ * @brief Convert between scalar types.
+ *
+ * The conversion goes through double, so it is exact between the fixed
+ * point types of the same radix and from any of them to double.
+ *
+ * @param x The scalar to convert.
+ *
+ * @return The scalar of type To nearest to <i>x</i> is returned.
+ */
+template <class To, class From>
+inline To mlScalarCast(From x)
+{
+    return MlScalarTraits<To>::fromDouble(MlScalarTraits<From>::toDouble(x));
+}
+
+
+#if ML_FIXED_POINT
+/**
+ * @brief The scalar type matching the <b>MlScalar</b> of the build.
+ *
+ * This is <b>MlFixed<ML_FIXED_RADIX></b> in fixed point mode and
+ * <i>float</i> otherwise. The templated classes over it have the same
+ * values as <b>MlVector3</b>, <b>MlRotation</b> and <b>MlTransform</b>.
+ */
+typedef MlFixed<ML_FIXED_RADIX> MlNativeScalar;
+#else /* ML_FIXED_POINT */
+typedef float MlNativeScalar;
+#endif /* ML_FIXED_POINT */
+
+/**
+ * @brief Convert an <b>MlScalar</b> to another scalar type.
+ *
+ * @param x The scalar to convert.
+ *
+ * @return The scalar of type S nearest to <i>x</i> is returned.
+ */
+template <class S>
+inline S mlScalarFromNative(MlScalar x)
+{
+#if ML_FIXED_POINT
+    return mlScalarCast<S>(MlNativeScalar::fromRaw((int32_t) mlScalarGetValue(x)));
+#else /* ML_FIXED_POINT */
+    return mlScalarCast<S>((float) mlScalarGetValue(x));
+#endif /* ML_FIXED_POINT */
+}
+
+/**
+ * @brief Convert a scalar to an <b>MlScalar</b>.
+ *
+ * @param x The scalar to convert.
+ *
+ * @return The <b>MlScalar</b> nearest to <i>x</i> is returned.
+ */
+template <class S>
+inline MlScalar mlScalarToNative(S x)
+{
+#if ML_FIXED_POINT
+    return mlScalarSetValue((long) mlScalarCast<MlNativeScalar>(x).getValue());
+#else /* ML_FIXED_POINT */
+    return mlScalarSetValue(mlScalarCast<MlNativeScalar>(x));
+#endif /* ML_FIXED_POINT */
+}
+
+#endif /* SCALART_H_INCLUDED */
@@ -61,6 +61,82 @@
 
 #endif /* !defined(__sgi) */
 
+/**
+ * @brief Accuracy tiers for the single-precision sine/cosine kernel.
+ *
+ * ML_SINCOS_FULL is accurate to within a couple of ulps of single precision,
+ * ML_SINCOS_MEDIUM to about 1e-5 and ML_SINCOS_FAST to about 2e-3 (absolute
+ * error). The default tier used by mlFloatSinCos() and, in the floating-point
+ * library, by mlSinCos() may be selected at compile time by defining
+ * ML_SINCOS_ACCURACY.
+ */
+#define ML_SINCOS_FULL   0
+#define ML_SINCOS_MEDIUM 1
+#define ML_SINCOS_FAST   2
+
+#ifndef ML_SINCOS_ACCURACY
+#define ML_SINCOS_ACCURACY ML_SINCOS_FULL
+#endif /* ML_SINCOS_ACCURACY */
+
+/**
+ * @brief A fused single-precision sine and cosine function, where the angle
+ * is given in turns (the Magic Lantern angle unit, 1.0 == 360 degrees).
+ *
+ * The angle is reduced exactly to the nearest quarter turn, leaving a remainder
+ * in [-1/8, 1/8] turns, and both results are evaluated with minimax polynomials
+ * in that remainder. Since no conversion to radians takes place, multiples of a
+ * quarter turn produce exact results. No double-precision arithmetic is used.
+ *
+ * This function is available for both the floating-point and the fixed-point
+ * versions of the Magic Lantern Math libraries.
+ *
+ * @param turns The angle, in turns.
+ * @param s The sine result.
+ * @param c The cosine result.
+ * @param accuracy One of ML_SINCOS_FULL, ML_SINCOS_MEDIUM or ML_SINCOS_FAST.
+ * The default is ML_SINCOS_ACCURACY.
+ */
+inline void
+mlFloatSinCos( const float turns, float &s, float &c, const int accuracy = ML_SINCOS_ACCURACY )
+{
+    // Reduce to the nearest quarter turn. Both the product and the
+    // subtraction are exact, so no error is introduced here.
+    float q = turns * 4.0f;
+    float r;
+    int quadrant;
+    if ((q > -2147483520.0f) && (q < 2147483520.0f)) {
+        int n = (int)(q + ((q >= 0.0f) ? 0.5f : -0.5f));
+        r = turns - (float)n * 0.25f;
+        quadrant = n & 3;
+    } else {
+        // Beyond 2^29 every float is a whole number of turns; infinities
+        // and NaNs propagate as NaN.
+        r = turns - turns;
+        quadrant = 0;
+    }
+
+    // Minimax polynomials for sin(2*pi*r) and cos(2*pi*r), r in [-1/8, 1/8].
+    float u = r * r;
+    float sr, cr;
+    if (accuracy == ML_SINCOS_FAST) {
+        sr = r * (6.27708028f + u * -39.7708978f);
+        cr = 0.998072438f + u * -18.7436076f;
+    } else if (accuracy == ML_SINCOS_MEDIUM) {
+        sr = r * (6.28315373f + u * (-41.3255161f + u * 79.5281292f));
+        cr = 0.999989987f + u * (-19.7276501f + u * 62.9598332f);
+    } else {
+        sr = r * (6.28318522f + u * (-41.3416277f + u * (81.5880701f + u * -75.2377388f)));
+        cr = 1.0f + u * (-19.7392086f + u * (64.9393158f + u * (-85.4428076f + u * 59.2187807f)));
+    }
+
+    switch (quadrant) {
+        case 0:  s =  sr; c =  cr; break;
+        case 1:  s =  cr; c = -sr; break;
+        case 2:  s = -sr; c = -cr; break;
+        default: s = -cr; c =  sr; break;
+    }
+}
+
 #if ML_FIXED_POINT
 /**
  * @brief The sine function for a Magic Lantern fixed-point Scalar primitive
@@ -171,6 +247,9 @@ mlCos( const MlScalar x )
  * It also returns the cosine of x. Essentially, s = sin(x) and c = cos(x).
  * The usage should be "mlSinCos(x,s,c)" where c, s and x are MlScalars.
  *
+ * In the floating-point library both values are computed together by
+ * mlFloatSinCos(), at the accuracy selected by ML_SINCOS_ACCURACY.
+ *
  * @param x A Magic Lantern Scalar primitive.
  * @param s The sine result of x. The value is returned as a Magic Lantern Scalar between -1 and 1.
  * @param c The cosine result of x. The value is returned as a Magic Lantern Scalar between -1 and 1.
@@ -181,10 +260,36 @@ mlSinCos( const MlScalar x, MlScalar &s, MlScalar &c )
 #if ML_FIXED_POINT
     FixedSinCos( x, s, c );
 #else
-    s = mlSin(x);
-    c = mlCos(x);
+    float sf, cf;
+    mlFloatSinCos( mlScalarToFloat(x), sf, cf );
+    s = mlFloatToScalar(sf);
+    c = mlFloatToScalar(cf);
 #endif
 }
 
 
+
+/**
+ * @brief The sine and cosine of an array of Magic Lantern Scalar primitives.
+ *
+ * The mlSinCosBatch() function computes s[i] = sin(angles[i]) and
+ * c[i] = cos(angles[i]) for count angles, where the angles are given in the
+ * Magic Lantern angle unit like those passed to mlSin() and mlCos().
+ *
+ * In the floating-point library the values are computed with the polynomials
+ * of mlFloatSinCos(), using SIMD instructions where the processor supports
+ * them. In the fixed-point library, and where SIMD instructions are not
+ * available, each element is computed with mlSinCos(); the accuracy parameter
+ * is ignored by the fixed-point library.
+ *
+ * @param angles The array of angles.
+ * @param s The array that receives the sine of each angle.
+ * @param c The array that receives the cosine of each angle.
+ * @param count The number of elements in each array.
+ * @param accuracy One of ML_SINCOS_FULL, ML_SINCOS_MEDIUM or ML_SINCOS_FAST.
+ * The default is ML_SINCOS_ACCURACY.
+ */
+MLMATH_API void mlSinCosBatch( const MlScalar *angles, MlScalar *s, MlScalar *c,
+    int count, const int accuracy = ML_SINCOS_ACCURACY );
+
 #endif /* SINE_H_INCLUDED */
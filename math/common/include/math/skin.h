@@ -0,0 +1,241 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file skin.h
+ * @ingroup MlMath
+ *
+ * This file provides linear blend skinning of meshes by a palette of bone
+ * transforms.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+#ifndef SKIN_H_INCLUDED
+#define SKIN_H_INCLUDED
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/vector.h>
+#include <math/transfrm.h>
+#include <math/dualquat.h>
+
+
+/**
+ * @brief The bones that influence a skinned vertex.
+ *
+ * A vertex is influenced by up to four bones. Unused slots have a weight
+ * of zero.
+ */
+typedef struct MLMATH_API _MlSkinInfluence
+{
+    MlScalar weight[4]; /**< The weights of the bones. */
+    int bone[4];        /**< The indices of the bones in the palette. */
+} MlSkinInfluence;
+
+
+/**
+ * @brief A mesh deformed by linear blend skinning.
+ *
+ * The skin holds the positions and normals of the vertices of a mesh in
+ * its bind pose, with the bones that influence each vertex. Applying a
+ * palette of bone transforms moves each vertex by the weighted sum of the
+ * transforms of its bones: positions are transformed as by
+ * <b>MlTransform::multVecMatrix()</b>, and normals as by
+ * <b>MlTransform::multDirMatrix()</b> and then normalized. Each palette
+ * entry is usually the inverse bind transform of a bone followed by its
+ * current transform.
+ *
+ * Normals are transformed by the blended matrix itself, so they are only
+ * correct for bones without non-uniform scaling.
+ *
+ * The bones may instead be given as rigid <b>MlDualQuat</b> transforms,
+ * which are blended by dual quaternion linear blending. This avoids the
+ * loss of volume of linear blending at twisting joints.
+ */
+class MLMATH_API MlSkin
+{
+  public:
+
+    /**
+	 * Default constructor. The skin has no vertices.
+	 */
+    MlSkin();
+
+    /**
+	 * @brief A constructor given the bind pose of a mesh.
+	 *
+	 * @param positions The positions of the vertices.
+	 * @param normals The normals of the vertices, or NULL if the mesh
+	 * has none.
+	 * @param influences The bones that influence each vertex.
+	 * @param numVertices The number of vertices.
+	 */
+    MlSkin(const MlVector3 *positions, const MlVector3 *normals,
+           const MlSkinInfluence *influences, int numVertices);
+
+    /**
+	 * @brief Copy constructor.
+	 *
+	 * @param skin The other skin to copy from.
+	 */
+    MlSkin(const MlSkin &skin);
+
+    /**
+	 * Destructor.
+	 */
+    ~MlSkin();
+
+    /**
+	 * @brief Assignment operator.
+	 *
+	 * @param skin The other skin to copy from.
+	 *
+	 * @return A reference to this <b>MlSkin</b> is returned.
+	 */
+    MlSkin &operator =(const MlSkin &skin);
+
+    /**
+	 * @brief Set the bind pose of the mesh.
+	 *
+	 * The weights of each vertex are scaled to add up to one. A vertex
+	 * whose weights are all zero is not moved by its bones.
+	 *
+	 * @param positions The positions of the vertices.
+	 * @param normals The normals of the vertices, or NULL if the mesh
+	 * has none.
+	 * @param influences The bones that influence each vertex. The bone
+	 * indices must not be negative.
+	 * @param numVertices The number of vertices.
+	 *
+	 * @return A reference to this <b>MlSkin</b> is returned.
+	 */
+    MlSkin &setValue(const MlVector3 *positions, const MlVector3 *normals,
+                     const MlSkinInfluence *influences, int numVertices);
+
+    /**
+	 * @brief Get the number of vertices.
+	 *
+	 * @return The number of vertices is returned.
+	 */
+    int getNumVertices() const
+	{ return numVertices; }
+
+    /**
+	 * @brief Get the number of bones that the palette must hold.
+	 *
+	 * @return One more than the largest bone index of any vertex is
+	 * returned.
+	 */
+    int getNumBones() const
+	{ return numBones; }
+
+    /**
+	 * @brief Get the bind positions.
+	 *
+	 * @return A pointer to the array of positions is returned.
+	 */
+    const MlVector3 *getPositions() const
+	{ return positions; }
+
+    /**
+	 * @brief Get the bind normals.
+	 *
+	 * @return A pointer to the array of normals, or NULL if the mesh
+	 * has none, is returned.
+	 */
+    const MlVector3 *getNormals() const
+	{ return normals; }
+
+    /**
+	 * @brief Get the influences.
+	 *
+	 * @return A pointer to the array of influences, with normalized
+	 * weights, is returned.
+	 */
+    const MlSkinInfluence *getInfluences() const
+	{ return influences; }
+
+    /**
+	 * @brief Deform the mesh by a palette of bone transforms.
+	 *
+	 * In floating-point mode the vertices are processed several at a
+	 * time with the widest SSE4.1, AVX2 or AVX-512 instruction set that
+	 * the processor supports. Large meshes may also be split between
+	 * threads.
+	 *
+	 * @param palette The transforms of the bones, at least
+	 * <b>getNumBones()</b> of them.
+	 * @param numBones The number of transforms in the palette.
+	 * @param positions The skinned positions.
+	 * @param normals The skinned normals, or NULL if they are not
+	 * wanted. They are not computed if the mesh has no normals.
+	 * @param numThreads The number of threads to use. Zero uses one
+	 * thread per processor.
+	 */
+    void apply(const MlTransform *palette, int numBones,
+               MlVector3 *positions, MlVector3 *normals, int numThreads = 1) const;
+
+    /**
+	 * @brief Deform the mesh by a palette of rigid bone transforms.
+	 *
+	 * The transforms of the bones of each vertex are blended as by
+	 * <b>MlDualQuat::blend()</b>. Positions are transformed by the
+	 * blended transform and normals are rotated by it. As with the
+	 * matrix palette, the vertices are processed several at a time in
+	 * floating-point mode, and may be split between threads.
+	 *
+	 * @param palette The transforms of the bones, at least
+	 * <b>getNumBones()</b> of them.
+	 * @param numBones The number of transforms in the palette.
+	 * @param positions The skinned positions.
+	 * @param normals The skinned normals, or NULL if they are not
+	 * wanted. They are not computed if the mesh has no normals.
+	 * @param numThreads The number of threads to use. Zero uses one
+	 * thread per processor.
+	 */
+    void apply(const MlDualQuat *palette, int numBones,
+               MlVector3 *positions, MlVector3 *normals, int numThreads = 1) const;
+
+  private:
+
+    // Skin the vertices [first, last) of a batch by a matrix or a dual
+    // quaternion palette; see apply().
+    static void skinRange(int first, int last, void *data);
+    static void skinDualRange(int first, int last, void *data);
+
+    // The number of vertices, and of bones referred to.
+    int numVertices;
+    int numBones;
+
+    // The bind pose. The normals are NULL if the mesh has none.
+    MlVector3 *positions;
+    MlVector3 *normals;
+    MlSkinInfluence *influences;
+};
+
+
+#endif /* SKIN_H_INCLUDED */
@@ -66,6 +66,22 @@
  */
 MLMATH_API MlScalar FixedSqrt(const MlScalar val);
 
+/**
+ * @brief Compute the square-roots of an array of Magic Lantern Scalars
+ * in fixed-point mode [z[i] = sqrt(x[i])].
+ *
+ * The FixedSqrtBatch() function is the batch form of FixedSqrt().
+ * The result array may be the same as the input array.
+ *
+ * This function is only available when using the fixed-point versions of
+ * the Magic Lantern Math libraries.
+ *
+ * @param val The array of non-negative scalars.
+ * @param result The array that receives the square-roots.
+ * @param count The number of elements in the arrays.
+ */
+MLMATH_API void FixedSqrtBatch(const MlScalar *val, MlScalar *result, int count);
+
 /**
  * @brief Calculate the reciprocal value of the square-root of a Magic Lantern Scalar
  * in fixed-point mode [z = 1.0 / sqrt(x)].
@@ -82,5 +98,21 @@ MLMATH_API MlScalar FixedSqrt(const MlScalar val);
  */
 MLMATH_API MlScalar FixedRecipSqrt(const MlScalar val);
 
+/**
+ * @brief Calculate the reciprocal values of the square-roots of an array of
+ * Magic Lantern Scalars in fixed-point mode [z[i] = 1.0 / sqrt(x[i])].
+ *
+ * The FixedRecipSqrtBatch() function is the batch form of FixedRecipSqrt().
+ * The result array may be the same as the input array.
+ *
+ * This function is only available when using the fixed-point versions of
+ * the Magic Lantern Math libraries.
+ *
+ * @param val The array of positive scalars.
+ * @param result The array that receives the reciprocal square-roots.
+ * @param count The number of elements in the arrays.
+ */
+MLMATH_API void FixedRecipSqrtBatch(const MlScalar *val, MlScalar *result, int count);
+
 #endif /* ML_FIXED_POINT */
 #endif /* SQRT_H_INCLUDED */
@@ -0,0 +1,348 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file track.h
+ * @ingroup MlMath
+ *
+ * This file provides keyframe animation tracks of vectors and rotations.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef TRACK_H_INCLUDED
+#define TRACK_H_INCLUDED
+
+// Include math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/vector.h>
+#include <math/rotation.h>
+
+
+/**
+ * @brief The keyframe times of an animation track.
+ *
+ * <b>MlTrack</b> holds the sorted key times shared by the value tracks,
+ * <b>MlVector3Track</b> and <b>MlRotationTrack</b>, and the cursor used to
+ * find the keys around a sample time. The cursor remembers the segment of
+ * the last sample, so playback that moves forward or backward a little at
+ * a time finds its keys in constant time; other jumps fall back on a
+ * binary search.
+ *
+ * A track is sampled by one thread at a time, since sampling moves the
+ * cursor.
+ */
+class MLMATH_API MlTrack
+{
+  public:
+
+    /**
+	 * @brief Get the number of keys.
+	 *
+	 * @return The number of keys is returned.
+	 */
+    int getNumKeys() const
+	{ return numKeys; }
+
+    /**
+	 * @brief Get the key times.
+	 *
+	 * @return A pointer to the array of key times is returned.
+	 */
+    const MlScalar *getTimes() const
+	{ return times; }
+
+    /**
+	 * @brief Get the time of the first key.
+	 *
+	 * @return The time of the first key, or zero if there are no keys,
+	 * is returned.
+	 */
+    MlScalar getStartTime() const
+	{ return (numKeys > 0) ? times[0] : ML_SCALAR_ZERO; }
+
+    /**
+	 * @brief Get the time of the last key.
+	 *
+	 * @return The time of the last key, or zero if there are no keys,
+	 * is returned.
+	 */
+    MlScalar getEndTime() const
+	{ return (numKeys > 0) ? times[numKeys - 1] : ML_SCALAR_ZERO; }
+
+    /**
+	 * @brief Move the cursor back to the first key.
+	 */
+    void resetCursor()
+	{ cursor = 0; }
+
+  protected:
+
+    // Constructors and destructor, for the value tracks.
+    MlTrack();
+    MlTrack(const MlTrack &track);
+    ~MlTrack();
+
+    // Copies the key times, which must be increasing.
+    void setTimes(const MlScalar *times, int numKeys);
+
+    // Returns the key at or before time, clamped to the keys of the
+    // track, and sets weight to the position between that key and the
+    // next one. The cursor is left on the key returned. There must be at
+    // least two keys.
+    int findKey(MlScalar time, MlScalar &weight);
+
+    int numKeys;
+    int cursor;
+    MlScalar *times;
+
+  private:
+
+    // Not implemented; the value tracks copy the times themselves.
+    MlTrack &operator =(const MlTrack &track);
+};
+
+
+/**
+ * @brief An animation track of 3D vectors, such as translations or scales.
+ *
+ * The track is sampled by linear interpolation between its keys, with
+ * <b>MlVector3::interpolate()</b>. Before the first key and after the
+ * last, the track holds the value of that key.
+ */
+class MLMATH_API MlVector3Track : public MlTrack
+{
+  public:
+
+    /**
+	 * Default constructor. The track has no keys.
+	 */
+    MlVector3Track();
+
+    /**
+	 * @brief A constructor given arrays of keys.
+	 *
+	 * @param times The key times, in increasing order.
+	 * @param values The key values.
+	 * @param numKeys The number of keys.
+	 */
+    MlVector3Track(const MlScalar *times, const MlVector3 *values, int numKeys);
+
+    /**
+	 * @brief Copy constructor.
+	 *
+	 * @param track The other track to copy from.
+	 */
+    MlVector3Track(const MlVector3Track &track);
+
+    /**
+	 * Destructor.
+	 */
+    ~MlVector3Track();
+
+    /**
+	 * @brief Assignment operator.
+	 *
+	 * @param track The other track to copy from.
+	 *
+	 * @return A reference to this <b>MlVector3Track</b> is returned.
+	 */
+    MlVector3Track &operator =(const MlVector3Track &track);
+
+    /**
+	 * @brief Set the keys of the track.
+	 *
+	 * The cursor is reset to the first key.
+	 *
+	 * @param times The key times, in increasing order.
+	 * @param values The key values.
+	 * @param numKeys The number of keys.
+	 *
+	 * @return A reference to this <b>MlVector3Track</b> is returned.
+	 */
+    MlVector3Track &setValue(const MlScalar *times, const MlVector3 *values, int numKeys);
+
+    /**
+	 * @brief Get the key values.
+	 *
+	 * @return A pointer to the array of key values is returned.
+	 */
+    const MlVector3 *getValues() const
+	{ return values; }
+
+    /**
+	 * @brief Sample the track.
+	 *
+	 * @param time The time to sample at.
+	 *
+	 * @return The interpolated value is returned. A track without keys
+	 * gives the zero vector.
+	 */
+    MlVector3 getValue(MlScalar time);
+
+    /**
+	 * @brief Sample an array of tracks at the same time.
+	 *
+	 * For each <i>i</i>, <i>result[i]</i> is set to
+	 * <b>tracks[i].getValue(time)</b>. The tracks are divided between
+	 * <i>numThreads</i> threads, each writing its own part of the
+	 * result; short arrays use fewer threads.
+	 *
+	 * @param tracks The tracks to sample.
+	 * @param count The number of tracks.
+	 * @param time The time to sample at.
+	 * @param result The sampled values.
+	 * @param numThreads The largest number of threads to use, or zero
+	 * for one per processor.
+	 */
+    static void getValueBatch(MlVector3Track *tracks, int count, MlScalar time,
+                              MlVector3 *result, int numThreads = 1);
+
+  private:
+
+    // Samples tracks [first, last) of a batch, for getValueBatch().
+    static void sampleRange(int first, int last, void *data);
+
+    MlVector3 *values;
+};
+
+
+/**
+ * @brief An animation track of rotations.
+ *
+ * The track is sampled by spherical linear interpolation between its
+ * keys, with <b>MlRotation::slerp()</b>. Before the first key and after
+ * the last, the track holds the value of that key.
+ */
+class MLMATH_API MlRotationTrack : public MlTrack
+{
+  public:
+
+    /**
+	 * Default constructor. The track has no keys.
+	 */
+    MlRotationTrack();
+
+    /**
+	 * @brief A constructor given arrays of keys.
+	 *
+	 * @param times The key times, in increasing order.
+	 * @param values The key values.
+	 * @param numKeys The number of keys.
+	 */
+    MlRotationTrack(const MlScalar *times, const MlRotation *values, int numKeys);
+
+    /**
+	 * @brief Copy constructor.
+	 *
+	 * @param track The other track to copy from.
+	 */
+    MlRotationTrack(const MlRotationTrack &track);
+
+    /**
+	 * Destructor.
+	 */
+    ~MlRotationTrack();
+
+    /**
+	 * @brief Assignment operator.
+	 *
+	 * @param track The other track to copy from.
+	 *
+	 * @return A reference to this <b>MlRotationTrack</b> is returned.
+	 */
+    MlRotationTrack &operator =(const MlRotationTrack &track);
+
+    /**
+	 * @brief Set the keys of the track.
+	 *
+	 * The cursor is reset to the first key.
+	 *
+	 * @param times The key times, in increasing order.
+	 * @param values The key values.
+	 * @param numKeys The number of keys.
+	 *
+	 * @return A reference to this <b>MlRotationTrack</b> is returned.
+	 */
+    MlRotationTrack &setValue(const MlScalar *times, const MlRotation *values, int numKeys);
+
+    /**
+	 * @brief Get the key values.
+	 *
+	 * @return A pointer to the array of key values is returned.
+	 */
+    const MlRotation *getValues() const
+	{ return values; }
+
+    /**
+	 * @brief Sample the track.
+	 *
+	 * @param time The time to sample at.
+	 *
+	 * @return The interpolated rotation is returned. A track without
+	 * keys gives the identity.
+	 */
+    MlRotation getValue(MlScalar time);
+
+    /**
+	 * @brief Sample an array of tracks at the same time.
+	 *
+	 * For each <i>i</i>, <i>result[i]</i> is set to
+	 * <b>tracks[i].getValue(time)</b>, except that the interpolations
+	 * are carried out together with <b>MlRotation::slerpBatch()</b>,
+	 * which agrees with <b>MlRotation::slerp()</b> to its accuracy.
+	 * The tracks are divided between <i>numThreads</i> threads, each
+	 * writing its own part of the result; short arrays use fewer
+	 * threads.
+	 *
+	 * @param tracks The tracks to sample.
+	 * @param count The number of tracks.
+	 * @param time The time to sample at.
+	 * @param result The sampled rotations.
+	 * @param numThreads The largest number of threads to use, or zero
+	 * for one per processor.
+	 */
+    static void getValueBatch(MlRotationTrack *tracks, int count, MlScalar time,
+                              MlRotation *result, int numThreads = 1);
+
+  private:
+
+    // Samples tracks [first, last) of a batch, for getValueBatch().
+    static void sampleRange(int first, int last, void *data);
+
+    MlRotation *values;
+};
+
+
+#endif /* TRACK_H_INCLUDED */
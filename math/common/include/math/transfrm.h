@@ -100,7 +100,9 @@ class MLMATH_API MlTransform
      *
      * @param trans The other transform to copy from.
      */
-    MlTransform(const MlTransform &trans);
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlTransform(const MlTransform &trans)
+      : matrix(trans.matrix)
+    { }
     
     /**
 	 * @brief A constructor given all 12 elements in row-major order.
@@ -118,17 +120,21 @@ class MLMATH_API MlTransform
 	 * @param a42 The m[4,3] element of the transform.
 	 * @param a43 The m[4,3] element of the transform.
 	 */
-    MlTransform(MlScalar a11, MlScalar a12, MlScalar a13,
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlTransform(MlScalar a11, MlScalar a12, MlScalar a13,
 	        MlScalar a21, MlScalar a22, MlScalar a23,  
 	        MlScalar a31, MlScalar a32, MlScalar a33,  
-	        MlScalar a41, MlScalar a42, MlScalar a43);
+	        MlScalar a41, MlScalar a42, MlScalar a43)
+      : matrix{{{a11, a12, a13}, {a21, a22, a23}, {a31, a32, a33}, {a41, a42, a43}}}
+    { }
     
     /**
 	 * @brief A constructor from a 4x3 array of elements.
 	 *
 	 * @param m A 4x3 array of Magic Lantern Scalars.
 	 */
-    MlTransform(const MlTrans& m);
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlTransform(const MlTrans& m)
+      : matrix(m)
+    { }
     
 	/**
 	 * @brief A constructor from a 4x3 array of elements.
@@ -165,7 +171,11 @@ class MLMATH_API MlTransform
 	 *
 	 * @return A <b>MlTransform</b> is returned.
 	 */
-    static MlTransform identity();
+    MLMATH_ABI_KEEP static ML_SCALAR_CONSTEXPR MlTransform identity()
+    { return MlTransform(ML_SCALAR_ONE, ML_SCALAR_ZERO, ML_SCALAR_ZERO,
+                         ML_SCALAR_ZERO, ML_SCALAR_ONE, ML_SCALAR_ZERO,
+                         ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ONE,
+                         ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ZERO); }
     
     /**
 	 * @brief Determine whether this matrix is an identity matrix.
@@ -173,7 +183,13 @@ class MLMATH_API MlTransform
 	 * @return If this matrix is an identity matrix, then 1 will be returned.
 	 * Otherwise 0 will be returned.
 	 */
-    int isIdentity() const;
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR int isIdentity() const
+    { return (matrix.m[0][0] == ML_SCALAR_ONE) && (matrix.m[0][1] == ML_SCALAR_ZERO) &&
+             (matrix.m[0][2] == ML_SCALAR_ZERO) && (matrix.m[1][0] == ML_SCALAR_ZERO) &&
+             (matrix.m[1][1] == ML_SCALAR_ONE) && (matrix.m[1][2] == ML_SCALAR_ZERO) &&
+             (matrix.m[2][0] == ML_SCALAR_ZERO) && (matrix.m[2][1] == ML_SCALAR_ZERO) &&
+             (matrix.m[2][2] == ML_SCALAR_ONE) && (matrix.m[3][0] == ML_SCALAR_ZERO) &&
+             (matrix.m[3][1] == ML_SCALAR_ZERO) && (matrix.m[3][2] == ML_SCALAR_ZERO); }
     
     /**
 	 * @brief Determine whether this matrix is all zeros.
@@ -194,8 +210,14 @@ class MLMATH_API MlTransform
 	 * @brief Get the value of the transform.
 	 *
 	 * @return The value of the transform is returned as a 4x3 array of elements.
+	 *
+	 * In floating-point mode this is how the elements of a constant
+	 * transform are read at compile time, as in
+	 * <i>MlTransform::identity().getValue().m[3][2]</i>, since the index
+	 * operator returns each row of the array as an <b>MlVector3</b> and
+	 * so cannot be evaluated then.
 	 */
-    const MlTrans &getValue() const
+    ML_SCALAR_CONSTEXPR const MlTrans &getValue() const
 	{ return matrix; }
     
     /**
@@ -297,7 +319,18 @@ class MLMATH_API MlTransform
 	 * @param src The vector to multiply.
 	 * @param dst The resulting vector.
 	 */
-    void multVecMatrix(const MlVector3& src, MlVector3& dst) const;
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR void multVecMatrix(const MlVector3& src, MlVector3& dst) const
+    {
+        MlScalar x = mlMul(src[0], matrix.m[0][0]) + mlMul(src[1], matrix.m[1][0]) +
+                     mlMul(src[2], matrix.m[2][0]) + matrix.m[3][0];
+        MlScalar y = mlMul(src[0], matrix.m[0][1]) + mlMul(src[1], matrix.m[1][1]) +
+                     mlMul(src[2], matrix.m[2][1]) + matrix.m[3][1];
+        MlScalar z = mlMul(src[0], matrix.m[0][2]) + mlMul(src[1], matrix.m[1][2]) +
+                     mlMul(src[2], matrix.m[2][2]) + matrix.m[3][2];
+        dst[0] = x;
+        dst[1] = y;
+        dst[2] = z;
+    }
     
 	/**
 	 * @brief Multiply a vector by this matrix.
@@ -310,8 +343,74 @@ class MLMATH_API MlTransform
 	 * @param dst The resulting vector.
 	 */
     void multDirMatrix(const MlVector3& src, MlVector3& dst) const;
-    
-    
+
+	/**
+	 * @brief Multiply an array of vectors by this matrix.
+	 *
+	 * This method is the batch form of multVecMatrix(). Each row vector
+	 * in <b>src</b> is multiplied by this matrix and the result is stored
+	 * in the corresponding element of <b>dst</b>. In floating-point mode
+	 * the vectors are processed several at a time using the best SIMD
+	 * instruction set of the host processor, with the same results as
+	 * multVecMatrix().
+	 *
+	 * @param src The vectors to multiply.
+	 * @param dst The resulting vectors. May be the same array as <b>src</b>.
+	 * @param count The number of vectors to transform.
+	 */
+    void multVecMatrixBatch(const MlVector3 *src, MlVector3 *dst, int count) const;
+
+	/**
+	 * @brief Multiply a structure-of-arrays set of vectors by this matrix.
+	 *
+	 * This method is the batch form of multVecMatrix() for vectors stored
+	 * as separate x, y and z streams. This is the fastest way to transform
+	 * a large number of points.
+	 *
+	 * @param srcX The x components of the vectors to multiply.
+	 * @param srcY The y components of the vectors to multiply.
+	 * @param srcZ The z components of the vectors to multiply.
+	 * @param dstX The x components of the resulting vectors.
+	 * @param dstY The y components of the resulting vectors.
+	 * @param dstZ The z components of the resulting vectors.
+	 * @param count The number of vectors to transform.
+	 *
+	 * The destination streams may be the same as the source streams.
+	 */
+    void multVecMatrixBatch(const MlScalar *srcX, const MlScalar *srcY, const MlScalar *srcZ,
+                            MlScalar *dstX, MlScalar *dstY, MlScalar *dstZ, int count) const;
+
+	/**
+	 * @brief Multiply an array of direction vectors by this matrix.
+	 *
+	 * This method is the batch form of multDirMatrix(); the translation
+	 * part of the matrix is ignored.
+	 *
+	 * @param src The direction vectors to multiply.
+	 * @param dst The resulting vectors. May be the same array as <b>src</b>.
+	 * @param count The number of vectors to transform.
+	 */
+    void multDirMatrixBatch(const MlVector3 *src, MlVector3 *dst, int count) const;
+
+	/**
+	 * @brief Multiply a structure-of-arrays set of direction vectors by this matrix.
+	 *
+	 * This method is the batch form of multDirMatrix() for vectors stored
+	 * as separate x, y and z streams; the translation part of the matrix
+	 * is ignored.
+	 *
+	 * @param srcX The x components of the vectors to multiply.
+	 * @param srcY The y components of the vectors to multiply.
+	 * @param srcZ The z components of the vectors to multiply.
+	 * @param dstX The x components of the resulting vectors.
+	 * @param dstY The y components of the resulting vectors.
+	 * @param dstZ The z components of the resulting vectors.
+	 * @param count The number of vectors to transform.
+	 */
+    void multDirMatrixBatch(const MlScalar *srcX, const MlScalar *srcY, const MlScalar *srcZ,
+                            MlScalar *dstX, MlScalar *dstY, MlScalar *dstZ, int count) const;
+
+
     // The following methods are miscellaneous Mx functions:
     
 #ifdef ML_REHEARSAL
@@ -394,8 +493,19 @@ class MLMATH_API MlTransform
 	 * @return The product of the multiplication is returned as
 	 * another transform.
 	 */
-    MLMATH_API friend MlTransform	operator * (const MlTransform& m1,
-                                    const MlTransform& m2);
+    MLMATH_API friend ML_SCALAR_CONSTEXPR MlTransform operator * (const MlTransform& m1,
+                                                                 const MlTransform& m2)
+    {
+        // As with multRight(), a product with an identity is the other
+        // matrix exactly.
+        return m2.isIdentity() ? m1 : (m1.isIdentity() ? m2 :
+            MlTransform(multElement(m1, m2, 0, 0), multElement(m1, m2, 0, 1), multElement(m1, m2, 0, 2),
+                        multElement(m1, m2, 1, 0), multElement(m1, m2, 1, 1), multElement(m1, m2, 1, 2),
+                        multElement(m1, m2, 2, 0), multElement(m1, m2, 2, 1), multElement(m1, m2, 2, 2),
+                        multElement(m1, m2, 3, 0) + m2.matrix.m[3][0],
+                        multElement(m1, m2, 3, 1) + m2.matrix.m[3][1],
+                        multElement(m1, m2, 3, 2) + m2.matrix.m[3][2]));
+    }
     
     /**
 	 * @brief Equality comparison operator.
@@ -686,6 +796,13 @@ class MLMATH_API MlTransform
     // Diagonalizes 3x3 matrix.
     void jacobi3(MlScalar evalues[3], MlVector3 evectors[3], int& rots) const;
 
+    // Returns element (i, j) of the product of the 3x3 parts of two
+    // matrices, summed in the order of multRight().
+    static ML_SCALAR_CONSTEXPR MlScalar multElement(const MlTransform &l, const MlTransform &r,
+                                                    int i, int j)
+    { return mlMul(l.matrix.m[i][0], r.matrix.m[0][j]) + mlMul(l.matrix.m[i][1], r.matrix.m[1][j]) +
+             mlMul(l.matrix.m[i][2], r.matrix.m[2][j]); }
+
 };
 
 #endif /* TRANSFRM_H_INCLUDED */
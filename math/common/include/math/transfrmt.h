@@ -0,0 +1,355 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file transfrmt.h
+ * @ingroup MlMath
+ *
+ * This file provides a 3D affine transform templated on its scalar type.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef TRANSFRMT_H_INCLUDED
+#define TRANSFRMT_H_INCLUDED
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/scalart.h>
+#include <math/vectort.h>
+#include <math/rotationt.h>
+#include <math/transfrm.h>
+
+
+/**
+ * @brief A 3D affine transform of scalars of type S.
+ *
+ * S is <i>float</i>, <i>double</i> or an <b>MlFixed</b> type; see
+ * scalart.h. The transform provides the core of <b>MlTransform</b>, with
+ * the same conventions: it is a 4x3 matrix whose last row is the
+ * translation, row vectors are multiplied on the left, and
+ * <i>m1 * m2</i> transforms by <i>m1</i> and then by <i>m2</i>.
+ */
+template <class S>
+class MlTransformT
+{
+  public:
+
+    /**
+	 * @brief The scalar type.
+	 */
+    typedef S Scalar;
+
+    /**
+	 * Default constructor, leaves the matrix uninitialized.
+	 */
+    MlTransformT() {}
+
+    /**
+	 * @brief A constructor given the twelve elements, row by row.
+	 */
+    constexpr MlTransformT(S a11, S a12, S a13,
+                           S a21, S a22, S a23,
+                           S a31, S a32, S a33,
+                           S a41, S a42, S a43)
+      : matrix{{a11, a12, a13}, {a21, a22, a23}, {a31, a32, a33}, {a41, a42, a43}}
+    { }
+
+    /**
+	 * @brief A constructor converting a transform of another scalar type.
+	 */
+    template <class T>
+    explicit MlTransformT(const MlTransformT<T> &m)
+    {
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 3; j++)
+                matrix[i][j] = mlScalarCast<S>(m[i][j]);
+    }
+
+    /**
+	 * @brief A constructor converting an <b>MlTransform</b>.
+	 */
+    explicit MlTransformT(const MlTransform &m)
+    { setValue(m); }
+
+    /**
+	 * @brief Returns the identity matrix.
+	 */
+    static constexpr MlTransformT identity()
+    {
+        return MlTransformT(S(1), S(0), S(0),
+                            S(0), S(1), S(0),
+                            S(0), S(0), S(1),
+                            S(0), S(0), S(0));
+    }
+
+    /**
+	 * @brief Sets the matrix to be the identity matrix.
+	 */
+    void makeIdentity()
+    { *this = identity(); }
+
+    /**
+	 * @brief Set the value from an <b>MlTransform</b>.
+	 */
+    void setValue(const MlTransform &m)
+    {
+        const MlTrans &t = m.getValue();
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 3; j++)
+                matrix[i][j] = mlScalarFromNative<S>(t.m[i][j]);
+    }
+
+    /**
+	 * @brief Get the value as an <b>MlTransform</b>.
+	 */
+    void getValue(MlTransform &m) const
+    {
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 3; j++)
+                m[i][j] = mlScalarToNative(matrix[i][j]);
+    }
+
+    /**
+	 * @brief Accesses the indexed row of the matrix.
+	 */
+    S *operator [](int i)
+    { return matrix[i]; }
+
+    constexpr const S *operator [](int i) const
+    { return matrix[i]; }
+
+    /**
+	 * @brief Sets the matrix to translate by the given vector.
+	 */
+    void setTranslation(const MlVector3T<S> &t)
+    {
+        makeIdentity();
+        setTranslationOnly(t);
+    }
+
+    /**
+	 * @brief Sets the translation, leaving the rest of the matrix as it
+	 * is.
+	 */
+    void setTranslationOnly(const MlVector3T<S> &t)
+    { matrix[3][0] = t[0]; matrix[3][1] = t[1]; matrix[3][2] = t[2]; }
+
+    /**
+	 * @brief Get the translation.
+	 */
+    void getTranslation(MlVector3T<S> &t) const
+    { t.setValue(matrix[3][0], matrix[3][1], matrix[3][2]); }
+
+    /**
+	 * @brief Sets the matrix to the given rotation.
+	 */
+    void setRotation(const MlRotationT<S> &r)
+    { setTransform(MlVector3T<S>(S(0), S(0), S(0)), r, MlVector3T<S>(S(1), S(1), S(1))); }
+
+    /**
+	 * @brief Sets the matrix to scale by the given vector.
+	 */
+    void setScale(const MlVector3T<S> &s)
+    {
+        makeIdentity();
+        matrix[0][0] = s[0];
+        matrix[1][1] = s[1];
+        matrix[2][2] = s[2];
+    }
+
+    /**
+	 * @brief Sets the matrix to scale, then rotate, then translate.
+	 *
+	 * The result is as the same call on an <b>MlTransform</b>, without
+	 * a scale orientation or a center.
+	 */
+    void setTransform(const MlVector3T<S> &translation, const MlRotationT<S> &rotation,
+                      const MlVector3T<S> &scaleFactor)
+    {
+        S r[3][3];
+        rotation.getValue(r);
+
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+                matrix[i][j] = scaleFactor[i] * r[i][j];
+        setTranslationOnly(translation);
+    }
+
+    /**
+	 * @brief Multiplies the matrix by the given matrix on the right,
+	 * <i>this = this * m</i>.
+	 *
+	 * @return A reference to this transform is returned.
+	 */
+    MlTransformT &multRight(const MlTransformT &m)
+    { return *this = *this * m; }
+
+    /**
+	 * @brief Multiplies the matrix by the given matrix on the left,
+	 * <i>this = m * this</i>.
+	 *
+	 * @return A reference to this transform is returned.
+	 */
+    MlTransformT &multLeft(const MlTransformT &m)
+    { return *this = m * *this; }
+
+    /**
+	 * @brief Performs right multiplication with another matrix.
+	 */
+    MlTransformT &operator *=(const MlTransformT &m)
+    { return multRight(m); }
+
+    /**
+	 * @brief Multiplies the given row vector by the matrix.
+	 */
+    void multVecMatrix(const MlVector3T<S> &src, MlVector3T<S> &dst) const
+    {
+        dst.setValue(src[0] * matrix[0][0] + src[1] * matrix[1][0] + src[2] * matrix[2][0] + matrix[3][0],
+                     src[0] * matrix[0][1] + src[1] * matrix[1][1] + src[2] * matrix[2][1] + matrix[3][1],
+                     src[0] * matrix[0][2] + src[1] * matrix[1][2] + src[2] * matrix[2][2] + matrix[3][2]);
+    }
+
+    /**
+	 * @brief Multiplies the given row vector by the matrix, ignoring the
+	 * translation, as for a direction.
+	 */
+    void multDirMatrix(const MlVector3T<S> &src, MlVector3T<S> &dst) const
+    {
+        dst.setValue(src[0] * matrix[0][0] + src[1] * matrix[1][0] + src[2] * matrix[2][0],
+                     src[0] * matrix[0][1] + src[1] * matrix[1][1] + src[2] * matrix[2][1],
+                     src[0] * matrix[0][2] + src[1] * matrix[1][2] + src[2] * matrix[2][2]);
+    }
+
+    /**
+	 * @brief Returns the determinant of the upper 3x3 matrix.
+	 */
+    S det() const
+    {
+        return matrix[0][0] * (matrix[1][1] * matrix[2][2] - matrix[1][2] * matrix[2][1]) -
+               matrix[0][1] * (matrix[1][0] * matrix[2][2] - matrix[1][2] * matrix[2][0]) +
+               matrix[0][2] * (matrix[1][0] * matrix[2][1] - matrix[1][1] * matrix[2][0]);
+    }
+
+    /**
+	 * @brief Returns the inverse of the matrix.
+	 *
+	 * As with <b>MlTransform</b>, a singular matrix is returned
+	 * unchanged.
+	 */
+    MlTransformT inverse() const
+    {
+        S d = det();
+        if (d == S(0))
+            return *this;
+
+        const S (*m)[3] = matrix;
+        MlTransformT result;
+
+        result.matrix[0][0] =  (m[1][1] * m[2][2] - m[1][2] * m[2][1]) / d;
+        result.matrix[1][0] = -(m[1][0] * m[2][2] - m[1][2] * m[2][0]) / d;
+        result.matrix[2][0] =  (m[1][0] * m[2][1] - m[1][1] * m[2][0]) / d;
+        result.matrix[0][1] = -(m[0][1] * m[2][2] - m[0][2] * m[2][1]) / d;
+        result.matrix[1][1] =  (m[0][0] * m[2][2] - m[0][2] * m[2][0]) / d;
+        result.matrix[2][1] = -(m[0][0] * m[2][1] - m[0][1] * m[2][0]) / d;
+        result.matrix[0][2] =  (m[0][1] * m[1][2] - m[0][2] * m[1][1]) / d;
+        result.matrix[1][2] = -(m[0][0] * m[1][2] - m[0][2] * m[1][0]) / d;
+        result.matrix[2][2] =  (m[0][0] * m[1][1] - m[0][1] * m[1][0]) / d;
+
+        // The translation is -C * inverse(A).
+        for (int j = 0; j < 3; j++)
+            result.matrix[3][j] = -(m[3][0] * result.matrix[0][j] +
+                                    m[3][1] * result.matrix[1][j] +
+                                    m[3][2] * result.matrix[2][j]);
+        return result;
+    }
+
+    /**
+	 * @brief Equality comparison within given tolerance, for each
+	 * element.
+	 */
+    bool equals(const MlTransformT &m, S tolerance) const
+    {
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 3; j++) {
+                S d = matrix[i][j] - m.matrix[i][j];
+                if (d > tolerance || -d > tolerance)
+                    return false;
+            }
+        return true;
+    }
+
+    /**
+	 * @brief Binary multiplication of matrices.
+	 */
+    friend MlTransformT operator *(const MlTransformT &l, const MlTransformT &r)
+    {
+        MlTransformT m;
+
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 3; j++)
+                m.matrix[i][j] = l.matrix[i][0] * r.matrix[0][j] +
+                                 l.matrix[i][1] * r.matrix[1][j] +
+                                 l.matrix[i][2] * r.matrix[2][j];
+        for (int j = 0; j < 3; j++)
+            m.matrix[3][j] += r.matrix[3][j];
+        return m;
+    }
+
+    friend bool operator ==(const MlTransformT &m1, const MlTransformT &m2)
+    {
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 3; j++)
+                if (m1.matrix[i][j] != m2.matrix[i][j])
+                    return false;
+        return true;
+    }
+
+    friend bool operator !=(const MlTransformT &m1, const MlTransformT &m2)
+    { return !(m1 == m2); }
+
+  private:
+
+    S matrix[4][3];  // Storage for the matrix.
+};
+
+/**
+ * @brief The transform types of the scalar types in scalart.h.
+ */
+typedef MlTransformT<float> MlTransformf;
+typedef MlTransformT<double> MlTransformd;
+typedef MlTransformT<MlFixed16> MlTransformx16;
+typedef MlTransformT<MlFixed12> MlTransformx12;
+
+#endif /* TRANSFRMT_H_INCLUDED */
@@ -0,0 +1,443 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file vecexpr.h
+ * @ingroup MlMath
+ *
+ * This file provides expression templates for the arithmetic operators of
+ * <b>MlVector2</b>, <b>MlVector3</b> and <b>MlVector4</b>.
+ *
+ * When the library and its clients are built with ML_VECTOR_EXPR set,
+ * the operators +, -, * and / on vectors no longer compute a vector each.
+ * Instead they return a small object describing the operation, and the
+ * whole expression is evaluated in one pass, component by component, when
+ * it is assigned or converted to a vector. So
+ *
+ * <pre>
+ *     MlVector3 v = v0 * (ML_SCALAR_ONE - w) + v1 * w;
+ * </pre>
+ *
+ * builds no intermediate vectors. Each component gets exactly the
+ * arithmetic the plain operators would do, so the results are the same,
+ * and like them the expressions are constexpr in floating-point mode.
+ *
+ * An expression holds references to the vectors it was built from, so it
+ * must be used within the statement that builds it; do not keep one with
+ * <i>auto</i>. Expressions convert to their vector type wherever a vector
+ * is expected, and provide the read only methods <i>dot</i>,
+ * <i>length</i>, <i>equals</i> and <i>operator []</i>. For anything else,
+ * <i>eval()</i> gives the vector.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef VECEXPR_H_INCLUDED
+#define VECEXPR_H_INCLUDED
+
+// Include system header files.
+#include <type_traits>
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/vector.h>
+
+#if ML_VECTOR_EXPR
+
+/**
+ * @brief Describes the operands of vector expressions.
+ *
+ * The traits give the vector type an operand evaluates to, how an
+ * expression stores it (vectors by reference and expressions by value),
+ * and for the vector types, how to build one from an expression. Types
+ * without traits are not vector operands, so the operators below ignore
+ * them.
+ */
+template <class T>
+struct MlVectorExprTraits
+{
+};
+
+template <>
+struct MlVectorExprTraits<MlVector2>
+{
+    typedef MlVector2 Vector;
+    typedef const MlVector2 &Operand;
+
+    template <class E>
+    static ML_SCALAR_CONSTEXPR MlVector2 make(const E &e)
+    { return MlVector2(e[0], e[1]); }
+};
+
+template <>
+struct MlVectorExprTraits<MlVector3>
+{
+    typedef MlVector3 Vector;
+    typedef const MlVector3 &Operand;
+
+    template <class E>
+    static ML_SCALAR_CONSTEXPR MlVector3 make(const E &e)
+    { return MlVector3(e[0], e[1], e[2]); }
+};
+
+template <>
+struct MlVectorExprTraits<MlVector4>
+{
+    typedef MlVector4 Vector;
+    typedef const MlVector4 &Operand;
+
+    template <class E>
+    static ML_SCALAR_CONSTEXPR MlVector4 make(const E &e)
+    { return MlVector4(e[0], e[1], e[2], e[3]); }
+};
+
+// R, if A and B are vector operands of the same type.
+template <class A, class B, class R>
+using MlVectorExprIf = typename std::enable_if<
+    std::is_same<typename MlVectorExprTraits<A>::Vector,
+                 typename MlVectorExprTraits<B>::Vector>::value, R>::type;
+
+
+/**
+ * @brief The value of a vector expression, as returned by getValue().
+ *
+ * It holds the evaluated vector for as long as the full expression it
+ * appears in, just as the temporary vector of a plain operator would,
+ * and converts to a pointer to its components.
+ */
+template <class V>
+class MlVectorExprValue
+{
+  public:
+
+    ML_SCALAR_CONSTEXPR MlVectorExprValue(const V &v)
+      : v(v)
+    { }
+
+    ML_SCALAR_CONSTEXPR operator const MlScalar *() const
+    { return &v[0]; }
+
+  private:
+
+    V v;
+};
+
+
+/**
+ * @brief The base of the vector expressions.
+ *
+ * E is the expression, which provides <i>operator []</i>, and V is the
+ * vector type it evaluates to. Each const method of the vector type is
+ * forwarded to the evaluated vector, so that an expression can be used as
+ * the temporary vector that the plain operators return. A method of one
+ * vector type only, such as cross(), fails to compile on the others, as it
+ * does for the vectors themselves.
+ *
+ * An expression holds its vector operands by reference, so it must not
+ * outlive them. With <i>auto e = f() + v;</i> the vector returned by f()
+ * is destroyed at the end of the statement and e refers to it afterwards;
+ * name the vector type instead, as in <i>MlVector3 e = f() + v;</i>, to
+ * evaluate the expression at once.
+ */
+template <class E, class V>
+class MlVectorExpr
+{
+  public:
+
+    /**
+	 * @brief Evaluate the expression.
+	 *
+	 * @return The vector the expression describes is returned.
+	 */
+    ML_SCALAR_CONSTEXPR V eval() const
+    { return MlVectorExprTraits<V>::make(static_cast<const E &>(*this)); }
+
+    /**
+	 * @brief Evaluate the expression wherever a vector is expected.
+	 */
+    ML_SCALAR_CONSTEXPR operator V() const
+    { return eval(); }
+
+    /**
+	 * @brief Returns whether the expression is the zero vector.
+	 */
+    int isZero() const
+    { return eval().isZero(); }
+
+    /**
+	 * @brief Returns the cross product of the expression and a vector.
+	 */
+    ML_SCALAR_CONSTEXPR V cross(const V &v) const
+    { return eval().cross(v); }
+
+    /**
+	 * @brief Returns the dot (inner) product of the expression and
+	 * a vector.
+	 */
+    ML_SCALAR_CONSTEXPR MlScalar dot(const V &v) const
+    { return eval().dot(v); }
+
+    /**
+	 * @brief Returns the components of the expression.
+	 *
+	 * The components stay valid until the end of the full expression.
+	 */
+    ML_SCALAR_CONSTEXPR MlVectorExprValue<V> getValue() const
+    { return MlVectorExprValue<V>(eval()); }
+
+    /**
+	 * @brief Returns the components of the expression, as for the
+	 * vector type.
+	 */
+    void getValue(MlScalar &x, MlScalar &y) const
+    { eval().getValue(x, y); }
+
+    void getValue(MlScalar &x, MlScalar &y, MlScalar &z) const
+    { eval().getValue(x, y, z); }
+
+    void getValue(MlScalar &x, MlScalar &y, MlScalar &z, MlScalar &w) const
+    { eval().getValue(x, y, z, w); }
+
+    /**
+	 * @brief Returns the real (Cartesian) part of a homogeneous
+	 * expression.
+	 */
+    void getReal(MlVector3 &v) const
+    { eval().getReal(v); }
+
+    /**
+	 * @brief Returns the geometric length of the expression.
+	 */
+    MlScalar length() const
+    { return eval().length(); }
+
+    /**
+	 * @brief Returns an approximation of the length of the expression.
+	 */
+    MlScalar approximateLength() const
+    { return eval().approximateLength(); }
+
+    /**
+	 * @brief Returns the scale of the expression and its reciprocal.
+	 */
+    void getScale(MlScalar &scale, MlScalar &recipScale) const
+    { eval().getScale(scale, recipScale); }
+
+    /**
+	 * @brief Equality comparison within given tolerance.
+	 *
+	 * See the <i>equals</i> method of the vector type.
+	 */
+    int equals(const V &v, MlScalar tolerance) const
+    { return eval().equals(v, tolerance); }
+
+    /**
+	 * @brief Returns the principal axis closest to the expression.
+	 */
+    V getClosestAxis() const
+    { return eval().getClosestAxis(); }
+};
+
+
+/**
+ * @brief The component-wise sum of two vector expressions.
+ */
+template <class A, class B>
+class MlVectorSum
+    : public MlVectorExpr<MlVectorSum<A, B>, typename MlVectorExprTraits<A>::Vector>
+{
+  public:
+
+    ML_SCALAR_CONSTEXPR MlVectorSum(const A &a, const B &b)
+      : a(a), b(b)
+    { }
+
+    ML_SCALAR_CONSTEXPR MlScalar operator [](int i) const
+    { return a[i] + b[i]; }
+
+  private:
+
+    typename MlVectorExprTraits<A>::Operand a;
+    typename MlVectorExprTraits<B>::Operand b;
+};
+
+/**
+ * @brief The component-wise difference of two vector expressions.
+ */
+template <class A, class B>
+class MlVectorDifference
+    : public MlVectorExpr<MlVectorDifference<A, B>, typename MlVectorExprTraits<A>::Vector>
+{
+  public:
+
+    ML_SCALAR_CONSTEXPR MlVectorDifference(const A &a, const B &b)
+      : a(a), b(b)
+    { }
+
+    ML_SCALAR_CONSTEXPR MlScalar operator [](int i) const
+    { return a[i] - b[i]; }
+
+  private:
+
+    typename MlVectorExprTraits<A>::Operand a;
+    typename MlVectorExprTraits<B>::Operand b;
+};
+
+/**
+ * @brief The negation of a vector expression.
+ */
+template <class A>
+class MlVectorNegation
+    : public MlVectorExpr<MlVectorNegation<A>, typename MlVectorExprTraits<A>::Vector>
+{
+  public:
+
+    ML_SCALAR_CONSTEXPR MlVectorNegation(const A &a)
+      : a(a)
+    { }
+
+    ML_SCALAR_CONSTEXPR MlScalar operator [](int i) const
+    { return -a[i]; }
+
+  private:
+
+    typename MlVectorExprTraits<A>::Operand a;
+};
+
+/**
+ * @brief A vector expression multiplied by a scalar.
+ */
+template <class A>
+class MlVectorScaled
+    : public MlVectorExpr<MlVectorScaled<A>, typename MlVectorExprTraits<A>::Vector>
+{
+  public:
+
+    ML_SCALAR_CONSTEXPR MlVectorScaled(const A &a, MlScalar d)
+      : a(a), d(d)
+    { }
+
+    ML_SCALAR_CONSTEXPR MlScalar operator [](int i) const
+    { return mlMul(a[i], d); }
+
+  private:
+
+    typename MlVectorExprTraits<A>::Operand a;
+    MlScalar d;
+};
+
+// The expressions are operands themselves.
+template <class A, class B>
+struct MlVectorExprTraits< MlVectorSum<A, B> >
+{
+    typedef typename MlVectorExprTraits<A>::Vector Vector;
+    typedef MlVectorSum<A, B> Operand;
+};
+
+template <class A, class B>
+struct MlVectorExprTraits< MlVectorDifference<A, B> >
+{
+    typedef typename MlVectorExprTraits<A>::Vector Vector;
+    typedef MlVectorDifference<A, B> Operand;
+};
+
+template <class A>
+struct MlVectorExprTraits< MlVectorNegation<A> >
+{
+    typedef typename MlVectorExprTraits<A>::Vector Vector;
+    typedef MlVectorNegation<A> Operand;
+};
+
+template <class A>
+struct MlVectorExprTraits< MlVectorScaled<A> >
+{
+    typedef typename MlVectorExprTraits<A>::Vector Vector;
+    typedef MlVectorScaled<A> Operand;
+};
+
+
+/**
+ * @brief Binary vector addition operator.
+ */
+template <class A, class B>
+ML_SCALAR_CONSTEXPR MlVectorExprIf<A, B, MlVectorSum<A, B> >
+operator +(const A &a, const B &b)
+{ return MlVectorSum<A, B>(a, b); }
+
+/**
+ * @brief Binary vector subtraction operator.
+ */
+template <class A, class B>
+ML_SCALAR_CONSTEXPR MlVectorExprIf<A, B, MlVectorDifference<A, B> >
+operator -(const A &a, const B &b)
+{ return MlVectorDifference<A, B>(a, b); }
+
+/**
+ * @brief Unary negation operator.
+ */
+template <class A>
+ML_SCALAR_CONSTEXPR MlVectorExprIf<A, A, MlVectorNegation<A> >
+operator -(const A &a)
+{ return MlVectorNegation<A>(a); }
+
+/**
+ * @brief Binary scalar multiplication operator.
+ */
+template <class A>
+ML_SCALAR_CONSTEXPR MlVectorExprIf<A, A, MlVectorScaled<A> >
+operator *(const A &a, MlScalar d)
+{ return MlVectorScaled<A>(a, d); }
+
+/**
+ * @brief Binary scalar multiplication operator.
+ */
+template <class A>
+ML_SCALAR_CONSTEXPR MlVectorExprIf<A, A, MlVectorScaled<A> >
+operator *(MlScalar d, const A &a)
+{ return MlVectorScaled<A>(a, d); }
+
+/**
+ * @brief Binary scalar division operator.
+ *
+ * As with the plain operator, the expression is multiplied by the
+ * reciprocal of <i>d</i>.
+ */
+template <class A>
+ML_SCALAR_CONSTEXPR MlVectorExprIf<A, A, MlVectorScaled<A> >
+operator /(const A &a, MlScalar d)
+{ return MlVectorScaled<A>(a, mlReciprocal(d)); }
+
+#endif /* ML_VECTOR_EXPR */
+
+#endif /* VECEXPR_H_INCLUDED */
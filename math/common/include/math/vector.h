@@ -58,13 +58,18 @@
 #include <math/mlmath.h>
 #include <math/scalar.h>
 
+// ML_VECTOR_EXPR replaces the binary and unary arithmetic operators of
+// MlVector2, MlVector3 and MlVector4 with the expression templates of
+// vecexpr.h. It must be set the same way for the library and its clients.
+#ifndef ML_VECTOR_EXPR
+#define ML_VECTOR_EXPR 0
+#endif
+
 class MlVector4;
 class MlVector3;
 class MlVector2;
-#if 0
 class MlVector3s;
 class MlVector2s;
-#endif
 
 
 /**
@@ -88,8 +93,9 @@ class MLMATH_API MlVector3
 	 * @param v An array of three <b>MlScalar</b>s representing the
 	 * x, y, and z components of the vector to construct.
 	 */
-    MlVector3(const MlScalar v[3])
-    { vec[0] = v[0]; vec[1] = v[1]; vec[2] = v[2]; };
+    ML_SCALAR_CONSTEXPR MlVector3(const MlScalar v[3])
+      : vec{v[0], v[1], v[2]}
+    { }
     
     /**
 	 * @brief A constructor given 3 individual components.
@@ -98,8 +104,9 @@ class MLMATH_API MlVector3
 	 * @param y The second element of the vector.
 	 * @param z The third element of the vector.
 	 */
-    MlVector3(MlScalar x, MlScalar y, MlScalar z)
-    { vec[0] = x; vec[1] = y; vec[2] = z; };
+    ML_SCALAR_CONSTEXPR MlVector3(MlScalar x, MlScalar y, MlScalar z)
+      : vec{x, y, z}
+    { }
     
     /**
 	 * @brief Check whether the vector contains all zeros.
@@ -117,7 +124,10 @@ class MLMATH_API MlVector3
 	 * @return The right-handed cross product of this vector and another vector
 	 * is returned.
 	 */
-    MlVector3 cross(const MlVector3 &v) const;
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlVector3 cross(const MlVector3 &v) const
+    { return MlVector3(mlMul(vec[1], v.vec[2]) - mlMul(vec[2], v.vec[1]),
+                       mlMul(vec[2], v.vec[0]) - mlMul(vec[0], v.vec[2]),
+                       mlMul(vec[0], v.vec[1]) - mlMul(vec[1], v.vec[0])); }
     
     /**
 	 * @brief Compute the dot product of this vector with another.
@@ -125,7 +135,8 @@ class MLMATH_API MlVector3
 	 * @return The dot (inner) product of this vector and another vector
 	 * is returned.
 	 */
-    MlScalar dot(const MlVector3 &v) const;
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlScalar dot(const MlVector3 &v) const
+    { return mlMul(vec[0], v.vec[0]) + mlMul(vec[1], v.vec[1]) + mlMul(vec[2], v.vec[2]); }
     
     /**
 	 * @brief Get the value of the vector as an array.
@@ -266,13 +277,13 @@ class MLMATH_API MlVector3
     /**
 	 * @brief Accesses indexed component of vector.
 	 */
-    MlScalar & operator [](int i)
+    ML_SCALAR_CONSTEXPR MlScalar & operator [](int i)
 	{ return (vec[i]); }
     
     /**
 	 * @brief Accesses indexed component of vector.
 	 */
-    const MlScalar & operator [](int i) const
+    ML_SCALAR_CONSTEXPR const MlScalar & operator [](int i) const
 	{ return (vec[i]); }
     
     /**
@@ -313,6 +324,7 @@ class MLMATH_API MlVector3
 	 */
     MlVector3 &	operator -=(MlVector3 v);
     
+#if !ML_VECTOR_EXPR
     /**
 	 * @brief Unary negation operator.
 	 *
@@ -320,7 +332,8 @@ class MLMATH_API MlVector3
 	 *
 	 * @return The result of the negation is returned as another vector.
 	 */
-    MlVector3 operator -() const;
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlVector3 operator -() const
+    { return MlVector3(-vec[0], -vec[1], -vec[2]); }
     
     /**
 	 * @brief Binary scalar multiplication operator.
@@ -329,7 +342,10 @@ class MLMATH_API MlVector3
 	 *
 	 * @return The result of the multiplication is returned as another vector.
 	 */
-    MLMATH_API friend MlVector3	operator *(const MlVector3 &v, MlScalar d);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR MlVector3 operator *(const MlVector3 &v, MlScalar d)
+    { return MlVector3(mlMul(v.vec[0], d),
+                       mlMul(v.vec[1], d),
+                       mlMul(v.vec[2], d)); }
     
     /**
 	 * @brief Binary scalar multiplication operator.
@@ -338,7 +354,7 @@ class MLMATH_API MlVector3
 	 *
 	 * @return The result of the multiplication is returned as another vector.
 	 */
-    MLMATH_API friend MlVector3 operator *(MlScalar d, const MlVector3 &v)
+    MLMATH_API friend ML_SCALAR_CONSTEXPR MlVector3 operator *(MlScalar d, const MlVector3 &v)
     { return v * d; }
     
     /**
@@ -348,7 +364,7 @@ class MLMATH_API MlVector3
 	 *
 	 * @return The result of the division is returned as another vector.
 	 */
-    MLMATH_API friend MlVector3 operator /(const MlVector3 &v, MlScalar d)
+    MLMATH_API friend ML_SCALAR_CONSTEXPR MlVector3 operator /(const MlVector3 &v, MlScalar d)
     { return v * mlReciprocal(d); }
     
     /**
@@ -358,7 +374,10 @@ class MLMATH_API MlVector3
 	 *
 	 * @return The result of the addition is returned as another vector.
 	 */
-    MLMATH_API friend MlVector3 operator +(const MlVector3 &v1, const MlVector3 &v2);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR MlVector3 operator +(const MlVector3 &v1, const MlVector3 &v2)
+    { return MlVector3(v1.vec[0] + v2.vec[0],
+                       v1.vec[1] + v2.vec[1],
+                       v1.vec[2] + v2.vec[2]); }
     
     /**
 	 * @brief Binary vector subtraction operator.
@@ -367,7 +386,11 @@ class MLMATH_API MlVector3
 	 *
 	 * @return The result of the subtraction is returned as another vector.
 	 */
-    MLMATH_API friend MlVector3 operator -(const MlVector3 &v1, const MlVector3 &v2);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR MlVector3 operator -(const MlVector3 &v1, const MlVector3 &v2)
+    { return MlVector3(v1.vec[0] - v2.vec[0],
+                       v1.vec[1] - v2.vec[1],
+                       v1.vec[2] - v2.vec[2]); }
+#endif /* !ML_VECTOR_EXPR */
     
     /**
 	 * @brief Equality comparison operator.
@@ -377,7 +400,10 @@ class MLMATH_API MlVector3
 	 * @return If the vectors are equal, then 1 will be returned.
 	 * Otherwise 0 will be returned if the vectors are not equal.
 	 */
-    MLMATH_API friend int operator ==(const MlVector3 &v1, const MlVector3 &v2);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR int operator ==(const MlVector3 &v1, const MlVector3 &v2)
+    { return v1.vec[0] == v2.vec[0] &&
+             v1.vec[1] == v2.vec[1] &&
+             v1.vec[2] == v2.vec[2]; }
     
     /**
 	 * @brief Inequality comparison operator.
@@ -387,7 +413,7 @@ class MLMATH_API MlVector3
 	 * @return If the vectors are not equal, then 1 will be returned.
 	 * Oterwise 0 will be returned if the vectors are equal.
 	 */
-    MLMATH_API friend int operator !=(const MlVector3 &v1, const MlVector3 &v2)
+    MLMATH_API friend ML_SCALAR_CONSTEXPR int operator !=(const MlVector3 &v1, const MlVector3 &v2)
     { return !(v1 == v2); }
     
     /**
@@ -414,6 +440,130 @@ class MLMATH_API MlVector3
 	 */
     MlVector3 getClosestAxis() const;
     
+    /**
+	 * @brief Add corresponding vectors of two arrays.
+	 *
+	 * This method is the batch form of the binary vector addition operator.
+	 * When the host processor supports it, the vectors are processed using
+	 * the widest available SIMD instruction set (SSE4.1, AVX2 or AVX-512).
+	 *
+	 * @param a The first array of vectors.
+	 * @param b The second array of vectors.
+	 * @param result The array that receives a[i] + b[i]. It may be the same
+	 * array as <b>a</b> or <b>b</b>.
+	 * @param count The number of vectors in each array.
+	 */
+    static void addBatch(const MlVector3 *a, const MlVector3 *b, MlVector3 *result, int count);
+
+    /**
+	 * @brief Subtract corresponding vectors of two arrays.
+	 *
+	 * This method is the batch form of the binary vector subtraction operator.
+	 *
+	 * @param a The first array of vectors.
+	 * @param b The second array of vectors.
+	 * @param result The array that receives a[i] - b[i]. It may be the same
+	 * array as <b>a</b> or <b>b</b>.
+	 * @param count The number of vectors in each array.
+	 */
+    static void subtractBatch(const MlVector3 *a, const MlVector3 *b, MlVector3 *result, int count);
+
+    /**
+	 * @brief Multiply each vector of an array by a scalar.
+	 *
+	 * This method is the batch form of the binary scalar multiplication operator.
+	 *
+	 * @param v The array of vectors.
+	 * @param d The scalar to multiply by.
+	 * @param result The array that receives v[i] * d. It may be the same
+	 * array as <b>v</b>.
+	 * @param count The number of vectors in the array.
+	 */
+    static void scaleBatch(const MlVector3 *v, MlScalar d, MlVector3 *result, int count);
+
+    /**
+	 * @brief Compute the dot products of corresponding vectors of two arrays.
+	 *
+	 * This method is the batch form of dot().
+	 *
+	 * @param a The first array of vectors.
+	 * @param b The second array of vectors.
+	 * @param result The array that receives a[i].dot(b[i]).
+	 * @param count The number of vectors in each array.
+	 */
+    static void dotBatch(const MlVector3 *a, const MlVector3 *b, MlScalar *result, int count);
+
+    /**
+	 * @brief Compute the cross products of corresponding vectors of two arrays.
+	 *
+	 * This method is the batch form of cross().
+	 *
+	 * @param a The first array of vectors.
+	 * @param b The second array of vectors.
+	 * @param result The array that receives a[i].cross(b[i]). It may be the
+	 * same array as <b>a</b> or <b>b</b>.
+	 * @param count The number of vectors in each array.
+	 */
+    static void crossBatch(const MlVector3 *a, const MlVector3 *b, MlVector3 *result, int count);
+
+    /**
+	 * @brief Compute the geometric lengths of an array of vectors.
+	 *
+	 * This method is the batch form of length().
+	 *
+	 * @param v The array of vectors.
+	 * @param result The array that receives v[i].length().
+	 * @param count The number of vectors in the array.
+	 */
+    static void lengthBatch(const MlVector3 *v, MlScalar *result, int count);
+
+    /**
+	 * @brief Normalize an array of vectors.
+	 *
+	 * This method is the batch form of normalize(). Each vector is changed
+	 * to be unit length.
+	 *
+	 * @param v The array of vectors.
+	 * @param lengths If not NULL, the array that receives the original lengths.
+	 * @param count The number of vectors in the array.
+	 */
+    static void normalizeBatch(MlVector3 *v, MlScalar *lengths, int count);
+
+    /**
+	 * @brief Quantize an array of vectors to short integers.
+	 *
+	 * The bounding box of the vectors is computed, and each vector is
+	 * stored relative to its center, scaled so that the box spans -32767
+	 * to 32767 on each axis. Large arrays, such as meshes or point clouds,
+	 * are best quantized a chunk at a time, each chunk with its own box.
+	 * When the host processor supports it, the vectors are processed
+	 * using SIMD instructions.
+	 *
+	 * Each component decoded by <b>dequantizeBatch()</b> is within
+	 * 1/65534 of the extent of its axis of the original, plus the
+	 * rounding error of an <b>MlScalar</b>.
+	 *
+	 * @param v The array of vectors.
+	 * @param q The array that receives the quantized vectors.
+	 * @param origin Receives the center of the bounding box.
+	 * @param extent Receives the half size of the bounding box on each axis.
+	 * @param count The number of vectors in the arrays.
+	 */
+    static void quantizeBatch(const MlVector3 *v, MlVector3s *q,
+                              MlVector3 &origin, MlVector3 &extent, int count);
+
+    /**
+	 * @brief Decode an array of vectors quantized by <b>quantizeBatch()</b>.
+	 *
+	 * @param q The array of quantized vectors.
+	 * @param origin The center of the bounding box.
+	 * @param extent The half size of the bounding box on each axis.
+	 * @param v The array that receives the decoded vectors.
+	 * @param count The number of vectors in the arrays.
+	 */
+    static void dequantizeBatch(const MlVector3s *q, const MlVector3 &origin,
+                                const MlVector3 &extent, MlVector3 *v, int count);
+
     /**
 	 * @brief Obtain a vector whose elements are zero.
 	 *
@@ -451,8 +601,9 @@ class MLMATH_API MlVector2
 	 * @param v An array of two <b>MlScalar</b>s representing the
 	 * x, and y components of the vector to construct.
 	 */
-    MlVector2(const MlScalar v[2])
-	{ setValue(v); };
+    ML_SCALAR_CONSTEXPR MlVector2(const MlScalar v[2])
+      : vec{v[0], v[1]}
+    { }
     
     /**
 	 * @brief A constructor given 2 individual components.
@@ -460,8 +611,9 @@ class MLMATH_API MlVector2
 	 * @param x The first element of the vector.
 	 * @param y The second element of the vector.
 	 */
-    MlVector2(MlScalar x, MlScalar y)
-	{ setValue(x, y); };
+    ML_SCALAR_CONSTEXPR MlVector2(MlScalar x, MlScalar y)
+      : vec{x, y}
+    { }
     
     /**
 	 * @brief Check whether the vector contains all zeros.
@@ -477,7 +629,8 @@ class MLMATH_API MlVector2
 	 * @return The dot (inner) product of this vector and another vector
 	 * is returned.
 	 */
-    MlScalar dot(const MlVector2 &v) const;
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlScalar dot(const MlVector2 &v) const
+    { return mlMul(vec[0], v.vec[0]) + mlMul(vec[1], v.vec[1]); }
     
     /**
 	 * @brief Get the value of the vector as an array.
@@ -553,13 +706,13 @@ class MLMATH_API MlVector2
     /**
 	 * @brief Accesses indexed component of vector.
 	 */
-    MlScalar & operator [](int i)
+    ML_SCALAR_CONSTEXPR MlScalar & operator [](int i)
 	{ return (vec[i]); }
     
     /**
 	 * @brief Accesses indexed component of vector.
 	 */
-    const MlScalar & operator [](int i) const
+    ML_SCALAR_CONSTEXPR const MlScalar & operator [](int i) const
 	{ return (vec[i]); }
     
     /**
@@ -600,6 +753,7 @@ class MLMATH_API MlVector2
 	 */
     MlVector2 & operator -=(const MlVector2 &u);
     
+#if !ML_VECTOR_EXPR
     /**
 	 * @brief Unary negation operator.
 	 *
@@ -607,7 +761,8 @@ class MLMATH_API MlVector2
 	 *
 	 * @return The result of the negation is returned as another vector.
 	 */
-    MlVector2 operator -() const;
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlVector2 operator -() const
+    { return MlVector2(-vec[0], -vec[1]); }
     
     /**
 	 * @brief Binary scalar multiplication operator.
@@ -616,7 +771,9 @@ class MLMATH_API MlVector2
 	 *
 	 * @return The result of the multiplication is returned as another vector.
 	 */
-    MLMATH_API friend MlVector2	operator *(const MlVector2 &v, MlScalar d);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR MlVector2 operator *(const MlVector2 &v, MlScalar d)
+    { return MlVector2(mlMul(v.vec[0], d),
+                       mlMul(v.vec[1], d)); }
     
     /**
 	 * @brief Binary scalar multiplication operator.
@@ -625,7 +782,7 @@ class MLMATH_API MlVector2
 	 *
 	 * @return The result of the multiplication is returned as another vector.
 	 */
-    MLMATH_API friend MlVector2	operator *(MlScalar d, const MlVector2 &v)
+    MLMATH_API friend ML_SCALAR_CONSTEXPR MlVector2 operator *(MlScalar d, const MlVector2 &v)
     { return v * d; }
     
     /**
@@ -635,7 +792,7 @@ class MLMATH_API MlVector2
 	 *
 	 * @return The result of the division is returned as another vector.
 	 */
-    MLMATH_API friend MlVector2	operator /(const MlVector2 &v, MlScalar d)
+    MLMATH_API friend ML_SCALAR_CONSTEXPR MlVector2 operator /(const MlVector2 &v, MlScalar d)
     { return v * mlReciprocal(d); }
     
     /**
@@ -645,7 +802,9 @@ class MLMATH_API MlVector2
 	 *
 	 * @return The result of the addition is returned as another vector.
 	 */
-    MLMATH_API friend MlVector2 operator +(const MlVector2 &v1, const MlVector2 &v2);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR MlVector2 operator +(const MlVector2 &v1, const MlVector2 &v2)
+    { return MlVector2(v1.vec[0] + v2.vec[0],
+                       v1.vec[1] + v2.vec[1]); }
     
     /**
 	 * @brief Binary vector subtraction operator.
@@ -654,7 +813,10 @@ class MLMATH_API MlVector2
 	 *
 	 * @return The result of the subtraction is returned as another vector.
 	 */
-    MLMATH_API friend MlVector2 operator -(const MlVector2 &v1, const MlVector2 &v2);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR MlVector2 operator -(const MlVector2 &v1, const MlVector2 &v2)
+    { return MlVector2(v1.vec[0] - v2.vec[0],
+                       v1.vec[1] - v2.vec[1]); }
+#endif /* !ML_VECTOR_EXPR */
     
     /**
 	 * @brief Equality comparison operator.
@@ -664,7 +826,9 @@ class MLMATH_API MlVector2
 	 * @return If the vectors are equal, then 1 will be returned.
 	 * Otherwise 0 will be returned if the vectors are not equal.
 	 */
-    MLMATH_API friend int operator ==(const MlVector2 &v1, const MlVector2 &v2);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR int operator ==(const MlVector2 &v1, const MlVector2 &v2)
+    { return v1.vec[0] == v2.vec[0] &&
+             v1.vec[1] == v2.vec[1]; }
     
     /**
 	 * @brief Inequality comparison operator.
@@ -674,7 +838,7 @@ class MLMATH_API MlVector2
 	 * @return If the vectors are not equal, then 1 will be returned.
 	 * Oterwise 0 will be returned if the vectors are equal.
 	 */
-    MLMATH_API friend int operator !=(const MlVector2 &v1, const MlVector2 &v2)
+    MLMATH_API friend ML_SCALAR_CONSTEXPR int operator !=(const MlVector2 &v1, const MlVector2 &v2)
     { return !(v1 == v2); }
     
     /**
@@ -691,6 +855,32 @@ class MLMATH_API MlVector2
 	 */
     int equals(const MlVector2 v, MlScalar tolerance) const;
 
+    /**
+	 * @brief Quantize an array of vectors to short integers.
+	 *
+	 * As <b>MlVector3::quantizeBatch()</b>, for 2D vectors.
+	 *
+	 * @param v The array of vectors.
+	 * @param q The array that receives the quantized vectors.
+	 * @param origin Receives the center of the bounding box.
+	 * @param extent Receives the half size of the bounding box on each axis.
+	 * @param count The number of vectors in the arrays.
+	 */
+    static void quantizeBatch(const MlVector2 *v, MlVector2s *q,
+                              MlVector2 &origin, MlVector2 &extent, int count);
+
+    /**
+	 * @brief Decode an array of vectors quantized by <b>quantizeBatch()</b>.
+	 *
+	 * @param q The array of quantized vectors.
+	 * @param origin The center of the bounding box.
+	 * @param extent The half size of the bounding box on each axis.
+	 * @param v The array that receives the decoded vectors.
+	 * @param count The number of vectors in the arrays.
+	 */
+    static void dequantizeBatch(const MlVector2s *q, const MlVector2 &origin,
+                                const MlVector2 &extent, MlVector2 *v, int count);
+
     /**
 	 * @brief Obtain a vector whose elements are zero.
 	 *
@@ -707,95 +897,179 @@ class MLMATH_API MlVector2
 };
 
 
-#if 0
-//  2D vector used to represet points or directions. Each component of
-//  the vector is a (short) integer.
+/**
+ * @brief A vector of two short integer elements.
+ *
+ * <b>MlVector2s</b> is a 2D vector used to represent points or directions,
+ * typically in a quantized form; see <b>MlVector2::quantizeBatch()</b>.
+ * Each component of the vector is a short integer.
+ */
 class MLMATH_API MlVector2s
 {
   public:
 
-    // Default constructor.
+    /**
+	 * Default constructor.
+	 */
     MlVector2s() { }
 
-    // Constructor given an array of 2 components.
+    /**
+	 * @brief Constructor given an array of 2 components.
+	 *
+	 * @param v An array of 2 short integers.
+	 */
     MlVector2s(const short v[2])
 	{ setValue(v); }
 
-    // Constructor given 2 individual components.
+    /**
+	 * @brief Constructor given 2 individual components.
+	 *
+	 * @param x The first element of the vector.
+	 * @param y The second element of the vector.
+	 */
     MlVector2s(short x, short y)
 	{ setValue(x, y); }
 
-    // Returns dot (inner) product of vector and another vector.
+    /**
+	 * @brief Compute the dot (inner) product of this vector and another vector.
+	 *
+	 * @param v The other vector.
+	 *
+	 * @return The dot product is returned.
+	 */
     int	dot(const MlVector2s &v) const;
 
-    // Returns pointer to array of 2 components.
+    /**
+	 * @brief Get the components of the vector.
+	 *
+	 * @return A pointer to the array of 2 components is returned.
+	 */
     const short	*getValue() const
 	{ return vec; }
 
-    // Returns 2 individual components.
+    /**
+	 * @brief Get the 2 individual components of the vector.
+	 *
+	 * @param x The first element of the vector.
+	 * @param y The second element of the vector.
+	 */
     void getValue(short &x, short &y) const;
 
-    // Negates each component of vector in place.
+    /**
+	 * @brief Negate each component of the vector in place.
+	 */
     void negate();
 
-    // Sets value of vector from array of 2 components.
+    /**
+	 * @brief Set the value of the vector from an array of 2 components.
+	 *
+	 * @param v An array of 2 short integers.
+	 *
+	 * @return A reference to this vector is returned.
+	 */
     MlVector2s & setValue(const short v[2]);
 
-    // Sets value of vector from 2 individual components.
+    /**
+	 * @brief Set the value of the vector from 2 individual components.
+	 *
+	 * @param x The first element of the vector.
+	 * @param y The second element of the vector.
+	 *
+	 * @return A reference to this vector is returned.
+	 */
     MlVector2s & setValue(short x, short y);
 
-    // Accesses indexed component of vector
+    /**
+	 * @brief Access an indexed component of the vector.
+	 *
+	 * @param i The index of the component, 0 or 1.
+	 *
+	 * @return A reference to the component is returned.
+	 */
     short & operator [](int i)
 	{ return (vec[i]); }
     const short & operator [](int i) const
 	{ return (vec[i]); }
 
-    // Component-wise scalar multiplication and division operators.
+    /**
+	 * @brief Component-wise integer multiplication and division operators.
+	 *
+	 * @param d The integer to multiply or divide by.
+	 *
+	 * @return A reference to this vector is returned.
+	 */
     MlVector2s & operator *=(int d);
-    MlVector2s & operator *=(MlScalar d);
-
     MlVector2s & operator /=(int d);
+
+#if 0
+    MlVector2s & operator *=(MlScalar d);
     MlVector2s & operator /=(MlScalar d)
 	{ return *this *= mlReciprocal(d); }
+#endif /* 0 */
 
-    // Component-wise vector addition and subtraction operators.
+    /**
+	 * @brief Component-wise vector addition and subtraction operators.
+	 *
+	 * @param u The vector to add or subtract.
+	 *
+	 * @return A reference to this vector is returned.
+	 */
     MlVector2s & operator +=(const MlVector2s &u);
     MlVector2s & operator -=(const MlVector2s &u);
 
-    // Nondestructive unary negation - returns a new vector.
+    /**
+	 * @brief Nondestructive unary negation.
+	 *
+	 * @return A new vector is returned.
+	 */
     MlVector2s	operator -() const;
 
-    // Component-wise binary scalar multiplication and division operators.
+    /**
+	 * @brief Component-wise binary integer multiplication and division
+	 * operators.
+	 */
     MLMATH_API friend MlVector2s operator *(const MlVector2s &v, int d);
-    MLMATH_API friend MlVector2s operator *(const MlVector2s &v, MlScalar d);
     MLMATH_API friend MlVector2s operator *(int d, const MlVector2s &v)
 	{ return v * d; }
+    MLMATH_API friend MlVector2s operator /(const MlVector2s &v, int d);
+
+#if 0
+    MLMATH_API friend MlVector2s operator *(const MlVector2s &v, MlScalar d);
     MLMATH_API friend MlVector2s operator *(MlScalar d, const MlVector2s &v)
 	{ return v * d; }
-    MLMATH_API friend MlVector2s operator /(const MlVector2s &v, int d);
     MLMATH_API friend MlVector2s operator /(const MlVector2s &v, MlScalar d)
 	{ return v * mlReciprocal(d); }
+#endif /* 0 */
 
-    // Component-wise binary vector addition and subtraction operators.
+    /**
+	 * @brief Component-wise binary vector addition and subtraction operators.
+	 */
     MLMATH_API friend MlVector2s	operator +(const MlVector2s &v1, const MlVector2s &v2);
-
     MLMATH_API friend MlVector2s	operator -(const MlVector2s &v1, const MlVector2s &v2);
 
-    // Equality comparison operator.
+    /**
+	 * @brief Equality comparison operator.
+	 *
+	 * @return If the vectors are equal, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
     MLMATH_API friend int		operator ==(const MlVector2s &v1, const MlVector2s &v2);
 
-    // Inequality comparison operator.
+    /**
+	 * @brief Inequality comparison operator.
+	 *
+	 * @return If the vectors are not equal, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
     MLMATH_API friend int		operator !=(const MlVector2s &v1, const MlVector2s &v2)
 	{ return !(v1 == v2); }
 
   protected:
 
-	// Storage for vector components.
+	/** Storage for vector components. */
     short vec[2];
 };
 
-#endif /* 0 */
-
 
 /**
  * @brief A vector of four elements.
@@ -818,8 +1092,9 @@ class MLMATH_API MlVector4
 	 * @param v An array of four <b>MlScalar</b>s representing the
 	 * x, y, z, and w components of the vector to construct.
 	 */
-    MlVector4(const MlScalar v[4])
-	{ setValue(v); }
+    ML_SCALAR_CONSTEXPR MlVector4(const MlScalar v[4])
+      : vec{v[0], v[1], v[2], v[3]}
+    { }
 
     /**
 	 * @brief A constructor given 4 individual components.
@@ -829,8 +1104,9 @@ class MLMATH_API MlVector4
 	 * @param z The third element of the vector.
 	 * @param w The fourth element of the vector.
 	 */
-    MlVector4(MlScalar x, MlScalar y, MlScalar z, MlScalar w)
-	{ setValue(x, y, z, w); }
+    ML_SCALAR_CONSTEXPR MlVector4(MlScalar x, MlScalar y, MlScalar z, MlScalar w)
+      : vec{x, y, z, w}
+    { }
 
     /**
 	 * @brief Check whether the vector contains all zeros.
@@ -846,7 +1122,8 @@ class MLMATH_API MlVector4
 	 * @return The dot (inner) product of this vector and another vector
 	 * is returned.
 	 */
-    MlScalar dot(const MlVector4 &v) const;
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlScalar dot(const MlVector4 &v) const
+    { return mlMul(vec[0], v.vec[0]) + mlMul(vec[1], v.vec[1]) + mlMul(vec[2], v.vec[2]) + mlMul(vec[3], v.vec[3]); }
 
     /**
 	 * @brief Get the real elements of the vector.
@@ -935,12 +1212,12 @@ class MLMATH_API MlVector4
     /**
 	 * @brief Accesses indexed component of vector.
 	 */
-    MlScalar & operator [](int i) { return (vec[i]); }
+    ML_SCALAR_CONSTEXPR MlScalar & operator [](int i) { return (vec[i]); }
 
     /**
 	 * @brief Accesses indexed component of vector.
 	 */
-    const MlScalar & operator [](int i) const { return (vec[i]); }
+    ML_SCALAR_CONSTEXPR const MlScalar & operator [](int i) const { return (vec[i]); }
 
     /**
 	 * @brief Multiplication operator.
@@ -980,6 +1257,7 @@ class MLMATH_API MlVector4
 	 */
     MlVector4 &	operator -=(const MlVector4 &u);
 
+#if !ML_VECTOR_EXPR
     /**
 	 * @brief Unary negation operator.
 	 *
@@ -987,7 +1265,8 @@ class MLMATH_API MlVector4
 	 *
 	 * @return The result of the negation is returned as another vector.
 	 */
-    MlVector4	operator -() const;
+    MLMATH_ABI_KEEP ML_SCALAR_CONSTEXPR MlVector4 operator -() const
+    { return MlVector4(-vec[0], -vec[1], -vec[2], -vec[3]); }
 
     /**
 	 * @brief Binary scalar multiplication operator.
@@ -996,7 +1275,11 @@ class MLMATH_API MlVector4
 	 *
 	 * @return The result of the multiplication is returned as another vector.
 	 */
-    MLMATH_API friend MlVector4	operator *(const MlVector4 &v, MlScalar d);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR MlVector4 operator *(const MlVector4 &v, MlScalar d)
+    { return MlVector4(mlMul(v.vec[0], d),
+                       mlMul(v.vec[1], d),
+                       mlMul(v.vec[2], d),
+                       mlMul(v.vec[3], d)); }
 
 	/**
 	 * @brief Binary scalar multiplication operator.
@@ -1005,7 +1288,7 @@ class MLMATH_API MlVector4
 	 *
 	 * @return The result of the multiplication is returned as another vector.
 	 */
-    MLMATH_API friend MlVector4	operator *(MlScalar d, const MlVector4 &v)
+    MLMATH_API friend ML_SCALAR_CONSTEXPR MlVector4 operator *(MlScalar d, const MlVector4 &v)
 	{ return v * d; }
 
 	/**
@@ -1015,7 +1298,7 @@ class MLMATH_API MlVector4
 	 *
 	 * @return The result of the division is returned as another vector.
 	 */
-    MLMATH_API friend MlVector4	operator /(const MlVector4 &v, MlScalar d)
+    MLMATH_API friend ML_SCALAR_CONSTEXPR MlVector4 operator /(const MlVector4 &v, MlScalar d)
 	{ return v * mlReciprocal(d); }
 
     /**
@@ -1025,7 +1308,11 @@ class MLMATH_API MlVector4
 	 *
 	 * @return The result of the addition is returned as another vector.
 	 */
-    MLMATH_API friend MlVector4	operator +(const MlVector4 &v1, const MlVector4 &v2);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR MlVector4 operator +(const MlVector4 &v1, const MlVector4 &v2)
+    { return MlVector4(v1.vec[0] + v2.vec[0],
+                       v1.vec[1] + v2.vec[1],
+                       v1.vec[2] + v2.vec[2],
+                       v1.vec[3] + v2.vec[3]); }
 
     /**
 	 * @brief Binary vector subtraction operator.
@@ -1034,7 +1321,12 @@ class MLMATH_API MlVector4
 	 *
 	 * @return The result of the subtraction is returned as another vector.
 	 */
-    MLMATH_API friend MlVector4	operator -(const MlVector4 &v1, const MlVector4 &v2);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR MlVector4 operator -(const MlVector4 &v1, const MlVector4 &v2)
+    { return MlVector4(v1.vec[0] - v2.vec[0],
+                       v1.vec[1] - v2.vec[1],
+                       v1.vec[2] - v2.vec[2],
+                       v1.vec[3] - v2.vec[3]); }
+#endif /* !ML_VECTOR_EXPR */
 
     /**
 	 * @brief Equality comparison operator.
@@ -1044,7 +1336,11 @@ class MLMATH_API MlVector4
 	 * @return If the vectors are equal, then 1 will be returned.
 	 * Otherwise 0 will be returned if the vectors are not equal.
 	 */
-    MLMATH_API friend int operator ==(const MlVector4 &v1, const MlVector4 &v2);
+    MLMATH_API MLMATH_ABI_KEEP friend ML_SCALAR_CONSTEXPR int operator ==(const MlVector4 &v1, const MlVector4 &v2)
+    { return v1.vec[0] == v2.vec[0] &&
+             v1.vec[1] == v2.vec[1] &&
+             v1.vec[2] == v2.vec[2] &&
+             v1.vec[3] == v2.vec[3]; }
 
     /**
 	 * @brief Inequality comparison operator.
@@ -1054,7 +1350,7 @@ class MLMATH_API MlVector4
 	 * @return If the vectors are not equal, then 1 will be returned.
 	 * Oterwise 0 will be returned if the vectors are equal.
 	 */
-    MLMATH_API friend int operator !=(const MlVector4 &v1, const MlVector4 &v2)
+    MLMATH_API friend ML_SCALAR_CONSTEXPR int operator !=(const MlVector4 &v1, const MlVector4 &v2)
 	{ return !(v1 == v2); }
 
     /**
@@ -1071,6 +1367,82 @@ class MLMATH_API MlVector4
 	 */
     int equals(const MlVector4 v, MlScalar tolerance) const;
 
+    /**
+	 * @brief Add corresponding vectors of two arrays.
+	 *
+	 * This method is the batch form of the binary vector addition operator.
+	 * When the host processor supports it, the vectors are processed using
+	 * the widest available SIMD instruction set (SSE4.1, AVX2 or AVX-512).
+	 *
+	 * @param a The first array of vectors.
+	 * @param b The second array of vectors.
+	 * @param result The array that receives a[i] + b[i]. It may be the same
+	 * array as <b>a</b> or <b>b</b>.
+	 * @param count The number of vectors in each array.
+	 */
+    static void addBatch(const MlVector4 *a, const MlVector4 *b, MlVector4 *result, int count);
+
+    /**
+	 * @brief Subtract corresponding vectors of two arrays.
+	 *
+	 * This method is the batch form of the binary vector subtraction operator.
+	 *
+	 * @param a The first array of vectors.
+	 * @param b The second array of vectors.
+	 * @param result The array that receives a[i] - b[i]. It may be the same
+	 * array as <b>a</b> or <b>b</b>.
+	 * @param count The number of vectors in each array.
+	 */
+    static void subtractBatch(const MlVector4 *a, const MlVector4 *b, MlVector4 *result, int count);
+
+    /**
+	 * @brief Multiply each vector of an array by a scalar.
+	 *
+	 * This method is the batch form of the binary scalar multiplication operator.
+	 *
+	 * @param v The array of vectors.
+	 * @param d The scalar to multiply by.
+	 * @param result The array that receives v[i] * d. It may be the same
+	 * array as <b>v</b>.
+	 * @param count The number of vectors in the array.
+	 */
+    static void scaleBatch(const MlVector4 *v, MlScalar d, MlVector4 *result, int count);
+
+    /**
+	 * @brief Compute the dot products of corresponding vectors of two arrays.
+	 *
+	 * This method is the batch form of dot().
+	 *
+	 * @param a The first array of vectors.
+	 * @param b The second array of vectors.
+	 * @param result The array that receives a[i].dot(b[i]).
+	 * @param count The number of vectors in each array.
+	 */
+    static void dotBatch(const MlVector4 *a, const MlVector4 *b, MlScalar *result, int count);
+
+    /**
+	 * @brief Compute the geometric lengths of an array of vectors.
+	 *
+	 * This method is the batch form of length().
+	 *
+	 * @param v The array of vectors.
+	 * @param result The array that receives v[i].length().
+	 * @param count The number of vectors in the array.
+	 */
+    static void lengthBatch(const MlVector4 *v, MlScalar *result, int count);
+
+    /**
+	 * @brief Normalize an array of vectors.
+	 *
+	 * This method is the batch form of normalize(). Each vector is changed
+	 * to be unit length.
+	 *
+	 * @param v The array of vectors.
+	 * @param lengths If not NULL, the array that receives the original lengths.
+	 * @param count The number of vectors in the array.
+	 */
+    static void normalizeBatch(MlVector4 *v, MlScalar *lengths, int count);
+
     /**
 	 * @brief Obtain a vector whose elements are zero.
 	 *
@@ -1086,113 +1458,225 @@ class MLMATH_API MlVector4
 
 
 
-#if 0
-//  3D vector used to represent points or directions. Each component of
-//  the vector is a short integer.
-//
-//  WARNING!!!!!  Transcription of arrays of this class assume that the
-//                only data stored in this class are three consecutive values.
-//                Do not add any extra data members!!!
-
+/**
+ * @brief A vector of three short integer elements.
+ *
+ * <b>MlVector3s</b> is a 3D vector used to represent points or directions,
+ * typically in a quantized form; see <b>MlVector3::quantizeBatch()</b>.
+ * Each component of the vector is a short integer.
+ *
+ * WARNING!!!!!  Transcription of arrays of this class assume that the
+ *               only data stored in this class are three consecutive values.
+ *               Do not add any extra data members!!!
+ */
 class MLMATH_API MlVector3s 
 { 
   public:
 
-    // Default constructor.
+    /**
+	 * Default constructor.
+	 */
     MlVector3s() { }
 
-    // Constructor given an array of 3 components.
+    /**
+	 * @brief Constructor given an array of 3 components.
+	 *
+	 * @param v An array of 3 short integers.
+	 */
     MlVector3s(const short v[3])
 	{ vec[0] = v[0]; vec[1] = v[1]; vec[2] = v[2]; }
 
-    // Constructor given 3 individual components.
+    /**
+	 * @brief Constructor given 3 individual components.
+	 *
+	 * @param x The first element of the vector.
+	 * @param y The second element of the vector.
+	 * @param z The third element of the vector.
+	 */
     MlVector3s(short x, short y, short z)
 	{ vec[0] = x; vec[1] = y; vec[2] = z; }
 
-    // Returns right-handed cross product of vector and another vector.
+    /**
+	 * @brief Compute the right-handed cross product of this vector and
+	 * another vector.
+	 *
+	 * @param v The other vector.
+	 *
+	 * @return The cross product is returned.
+	 */
     MlVector3s	cross(const MlVector3s &v) const;
 
-    // Returns dot (inner) product of vector and another vector.
+    /**
+	 * @brief Compute the dot (inner) product of this vector and another vector.
+	 *
+	 * @param v The other vector.
+	 *
+	 * @return The dot product is returned.
+	 */
     int	dot(const MlVector3s &v) const;
 
-    // Returns pointer to array of 3 components.
+    /**
+	 * @brief Get the components of the vector.
+	 *
+	 * @return A pointer to the array of 3 components is returned.
+	 */
     const short	*getValue() const { return vec; }
 
-    // Returns 3 individual components.
+    /**
+	 * @brief Get the 3 individual components of the vector.
+	 *
+	 * @param x The first element of the vector.
+	 * @param y The second element of the vector.
+	 * @param z The third element of the vector.
+	 */
     void getValue(short &x, short &y, short &z) const;
 
+#if 0
     // Returns geometric length of vector.
     MlScalar length() const;
 
     // Changes vector to be unit length, returns original length.
     int	normalize();
+#endif /* 0 */
 
-    // Negates each component of vector in place.
+    /**
+	 * @brief Negate each component of the vector in place.
+	 */
     void negate();
 
-    // Sets value of vector from array of 3 components.
+    /**
+	 * @brief Set the value of the vector from an array of 3 components.
+	 *
+	 * @param v An array of 3 short integers.
+	 *
+	 * @return A reference to this vector is returned.
+	 */
     MlVector3s & setValue(const short v[3])
 	{ vec[0] = v[0]; vec[1] = v[1]; vec[2] = v[2]; return *this; }
 
-    // Sets value of vector from 3 individual components.
+    /**
+	 * @brief Set the value of the vector from 3 individual components.
+	 *
+	 * @param x The first element of the vector.
+	 * @param y The second element of the vector.
+	 * @param z The third element of the vector.
+	 *
+	 * @return A reference to this vector is returned.
+	 */
     MlVector3s & setValue(short x, short y, short z)
 	{ vec[0] = x; vec[1] = y; vec[2] = z; return *this; }
 
+#if 0
     // Sets value of vector to be convex combination of 3 other.
     // vectors, using barycentic coordinates
     MlVector3s & setValue(const MlVector3s &barycentic,
 		const MlVector3s &v0, const MlVector3s &v1, const MlVector3s &v2);
+#endif /* 0 */
 
-    // Accesses indexed component of vector.
+    /**
+	 * @brief Access an indexed component of the vector.
+	 *
+	 * @param i The index of the component, 0 to 2.
+	 *
+	 * @return A reference to the component is returned.
+	 */
     short & operator [](int i) { return (vec[i]); }
     const short & operator [](int i) const { return (vec[i]); }
 
-    // Component-wise scalar multiplication and division operators.
+    /**
+	 * @brief Component-wise integer multiplication operator.
+	 *
+	 * @param d The integer to multiply by.
+	 *
+	 * @return A reference to this vector is returned.
+	 */
     MlVector3s & operator *=(short d);
 
+#if 0
     MlVector3s & operator /=(short d) 
 	{ return *this *= ((short)(1.0 / d)); } // XXX: THIS IS BOGUS!
+#endif /* 0 */
 
-    // Component-wise vector addition and subtraction operators.
+    /**
+	 * @brief Component-wise vector addition and subtraction operators.
+	 *
+	 * @param v The vector to add or subtract.
+	 *
+	 * @return A reference to this vector is returned.
+	 */
     MlVector3s & operator +=(MlVector3s v);
     MlVector3s & operator -=(MlVector3s v);
 
-    // Nondestructive unary negation - returns a new vector.
+    /**
+	 * @brief Nondestructive unary negation.
+	 *
+	 * @return A new vector is returned.
+	 */
     MlVector3s	operator -() const;
 
-    // Component-wise binary scalar multiplication and division operators.
+    /**
+	 * @brief Component-wise binary integer multiplication operators.
+	 */
     MLMATH_API friend MlVector3s operator *(const MlVector3s &v, short d);
     MLMATH_API friend MlVector3s operator *(short d, const MlVector3s &v)
 	{ return v * d; }
+
+#if 0
     MLMATH_API friend MlVector3s operator /(const MlVector3s &v, short d)
 	{ return v * (1 / d); }
+#endif /* 0 */
 
-    // Component-wise binary vector addition and subtraction operators.
+    /**
+	 * @brief Component-wise binary vector addition and subtraction operators.
+	 */
     MLMATH_API friend MlVector3s operator +(const MlVector3s &v1, const MlVector3s &v2);
-
     MLMATH_API friend MlVector3s operator -(const MlVector3s &v1, const MlVector3s &v2);
 
-    // Equality comparison operator.
+    /**
+	 * @brief Equality comparison operator.
+	 *
+	 * @return If the vectors are equal, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
     MLMATH_API friend int		operator ==(const MlVector3s &v1, const MlVector3s &v2);
 
-    // Inequality comparison operator.
+    /**
+	 * @brief Inequality comparison operator.
+	 *
+	 * @return If the vectors are not equal, then 1 will be returned.
+	 * Otherwise 0 will be returned.
+	 */
     MLMATH_API friend int		operator !=(const MlVector3s &v1, const MlVector3s &v2)
 	{ return !(v1 == v2); }
 
-    // Equality comparison within given tolerance - the square of the
-    // length of the maximum distance between the two vectors.
+    /**
+	 * @brief Equality comparison within given tolerance.
+	 *
+	 * @param v The other vector to compare.
+	 * @param tolerance The square of the length of the maximum distance
+	 * between the two vectors.
+	 *
+	 * @return If the vectors are equal within the tolerance, then 1 will
+	 * be returned. Otherwise 0 will be returned.
+	 */
     int equals(const MlVector3s v, short tolerance) const;
 
-    // Returns principal axis that is closest (based on maximum dot
-    // product) to this vector.
+    /**
+	 * @brief Get the principal axis that is closest (based on maximum dot
+	 * product) to this vector.
+	 *
+	 * @return The axis is returned.
+	 */
     MlVector3s getClosestAxis() const;
 
   protected:
 
-	// Storage for vector components.
+	/** Storage for vector components. */
     short vec[3];
 };
-#endif /* 0 */
 
+#if ML_VECTOR_EXPR
+#include <math/vecexpr.h>
+#endif
 
 #endif /* VECTOR_H_INCLUDED */
@@ -0,0 +1,254 @@
+/** @defgroup MlMath Magic Lantern Math Library API */
+
+/**
+ * @file vectort.h
+ * @ingroup MlMath
+ *
+ * This file provides a 3D vector templated on its scalar type.
+ */
+
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef VECTORT_H_INCLUDED
+#define VECTORT_H_INCLUDED
+
+// Include Magic Lantern math header files.
+#include <math/mlmath.h>
+#include <math/scalar.h>
+#include <math/scalart.h>
+#include <math/vector.h>
+
+
+/**
+ * @brief A 3D vector of scalars of type S.
+ *
+ * S is <i>float</i>, <i>double</i> or an <b>MlFixed</b> type; see
+ * scalart.h. The vector provides the core of <b>MlVector3</b>, with the
+ * same conventions, and converts to and from it and the vectors of the
+ * other scalar types.
+ */
+template <class S>
+class MlVector3T
+{
+  public:
+
+    /**
+	 * @brief The scalar type.
+	 */
+    typedef S Scalar;
+
+    /**
+	 * Default constructor, leaves the components uninitialized.
+	 */
+    MlVector3T() {}
+
+    /**
+	 * @brief A constructor given the three components.
+	 */
+    constexpr MlVector3T(S x, S y, S z)
+      : vec{x, y, z}
+    { }
+
+    /**
+	 * @brief A constructor given an array of three components.
+	 */
+    explicit MlVector3T(const S v[3])
+    { setValue(v[0], v[1], v[2]); }
+
+    /**
+	 * @brief A constructor converting a vector of another scalar type.
+	 */
+    template <class T>
+    explicit MlVector3T(const MlVector3T<T> &v)
+    {
+        setValue(mlScalarCast<S>(v[0]), mlScalarCast<S>(v[1]), mlScalarCast<S>(v[2]));
+    }
+
+    /**
+	 * @brief A constructor converting an <b>MlVector3</b>.
+	 */
+    explicit MlVector3T(const MlVector3 &v)
+    { setValue(v); }
+
+    /**
+	 * @brief Set the three components.
+	 *
+	 * @return A reference to this vector is returned.
+	 */
+    MlVector3T &setValue(S x, S y, S z)
+    { vec[0] = x; vec[1] = y; vec[2] = z; return *this; }
+
+    /**
+	 * @brief Set the value from an <b>MlVector3</b>.
+	 *
+	 * @return A reference to this vector is returned.
+	 */
+    MlVector3T &setValue(const MlVector3 &v)
+    {
+        return setValue(mlScalarFromNative<S>(v[0]), mlScalarFromNative<S>(v[1]),
+                        mlScalarFromNative<S>(v[2]));
+    }
+
+    /**
+	 * @brief Get the value as an <b>MlVector3</b>.
+	 */
+    void getValue(MlVector3 &v) const
+    { v.setValue(mlScalarToNative(vec[0]), mlScalarToNative(vec[1]), mlScalarToNative(vec[2])); }
+
+    /**
+	 * @brief Get the three components.
+	 *
+	 * @return A pointer to the components is returned.
+	 */
+    const S *getValue() const
+    { return vec; }
+
+    /**
+	 * @brief Accesses indexed component of vector.
+	 */
+    S &operator [](int i)
+    { return vec[i]; }
+
+    constexpr const S &operator [](int i) const
+    { return vec[i]; }
+
+    /**
+	 * @brief Returns the dot (inner) product of this vector and
+	 * another vector.
+	 */
+    constexpr S dot(const MlVector3T &v) const
+    { return vec[0] * v.vec[0] + vec[1] * v.vec[1] + vec[2] * v.vec[2]; }
+
+    /**
+	 * @brief Returns the right-handed cross product of this vector and
+	 * another vector.
+	 */
+    constexpr MlVector3T cross(const MlVector3T &v) const
+    {
+        return MlVector3T(vec[1] * v.vec[2] - vec[2] * v.vec[1],
+                          vec[2] * v.vec[0] - vec[0] * v.vec[2],
+                          vec[0] * v.vec[1] - vec[1] * v.vec[0]);
+    }
+
+    /**
+	 * @brief Returns the geometric length of the vector.
+	 */
+    S length() const
+    { return MlScalarTraits<S>::length(vec[0], vec[1], vec[2]); }
+
+    /**
+	 * @brief Changes the vector to be unit length.
+	 *
+	 * A zero vector is left as it is.
+	 *
+	 * @return The length of the vector before normalization is returned.
+	 */
+    S normalize()
+    {
+        S len = length();
+        if (len != S(0))
+            *this /= len;
+        return len;
+    }
+
+    /**
+	 * @brief Negates each component of the vector in place.
+	 */
+    void negate()
+    { vec[0] = -vec[0]; vec[1] = -vec[1]; vec[2] = -vec[2]; }
+
+    /**
+	 * @brief Equality comparison within given tolerance, the square of
+	 * the length of the maximum distance between the two vectors.
+	 */
+    bool equals(const MlVector3T &v, S tolerance) const
+    {
+        MlVector3T diff = *this - v;
+        return diff.dot(diff) <= tolerance;
+    }
+
+    MlVector3T &operator *=(S d)
+    { vec[0] *= d; vec[1] *= d; vec[2] *= d; return *this; }
+
+    /**
+	 * Each component is divided by <i>d</i>, which is more accurate in
+	 * fixed point than multiplying by its reciprocal.
+	 */
+    MlVector3T &operator /=(S d)
+    { vec[0] /= d; vec[1] /= d; vec[2] /= d; return *this; }
+
+    MlVector3T &operator +=(const MlVector3T &v)
+    { vec[0] += v.vec[0]; vec[1] += v.vec[1]; vec[2] += v.vec[2]; return *this; }
+
+    MlVector3T &operator -=(const MlVector3T &v)
+    { vec[0] -= v.vec[0]; vec[1] -= v.vec[1]; vec[2] -= v.vec[2]; return *this; }
+
+    constexpr MlVector3T operator -() const
+    { return MlVector3T(-vec[0], -vec[1], -vec[2]); }
+
+    friend constexpr MlVector3T operator *(const MlVector3T &v, S d)
+    { return MlVector3T(v.vec[0] * d, v.vec[1] * d, v.vec[2] * d); }
+
+    friend constexpr MlVector3T operator *(S d, const MlVector3T &v)
+    { return v * d; }
+
+    friend MlVector3T operator /(const MlVector3T &v, S d)
+    { return MlVector3T(v) /= d; }
+
+    friend constexpr MlVector3T operator +(const MlVector3T &v1, const MlVector3T &v2)
+    { return MlVector3T(v1.vec[0] + v2.vec[0], v1.vec[1] + v2.vec[1], v1.vec[2] + v2.vec[2]); }
+
+    friend constexpr MlVector3T operator -(const MlVector3T &v1, const MlVector3T &v2)
+    { return MlVector3T(v1.vec[0] - v2.vec[0], v1.vec[1] - v2.vec[1], v1.vec[2] - v2.vec[2]); }
+
+    friend constexpr bool operator ==(const MlVector3T &v1, const MlVector3T &v2)
+    { return v1.vec[0] == v2.vec[0] && v1.vec[1] == v2.vec[1] && v1.vec[2] == v2.vec[2]; }
+
+    friend constexpr bool operator !=(const MlVector3T &v1, const MlVector3T &v2)
+    { return !(v1 == v2); }
+
+  protected:
+
+    S vec[3];  // Storage for vector components.
+};
+
+/**
+ * @brief The vector types of the scalar types in scalart.h.
+ */
+typedef MlVector3T<float> MlVector3f;
+typedef MlVector3T<double> MlVector3d;
+typedef MlVector3T<MlFixed16> MlVector3x16;
+typedef MlVector3T<MlFixed12> MlVector3x12;
+
+#endif /* VECTORT_H_INCLUDED */
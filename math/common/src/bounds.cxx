@@ -0,0 +1,410 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// include Magic Lantern math header files
+#include "math/scalar.h"
+#include "math/vector.h"
+#include "math/transfrm.h"
+#include "math/bounds.h"
+#include "vecsimd.h"
+
+#if ML_VECTOR_SIMD
+// The kernels operate on the raw floats of boxes, spheres and transforms.
+static_assert(sizeof(MlAABB) == 6 * sizeof(float), "MlAABB must be 6 floats");
+static_assert(sizeof(MlSphere) == 4 * sizeof(float), "MlSphere must be 4 floats");
+static_assert(sizeof(MlTransform) == 12 * sizeof(float), "MlTransform must be 12 floats");
+#endif
+
+
+////////////////////////////////////////////////////////////////////////
+//
+// MlAABB
+//
+////////////////////////////////////////////////////////////////////////
+
+void MlAABB::makeEmpty()
+{
+    minCorner.setValue(ML_SCALAR_MAX, ML_SCALAR_MAX, ML_SCALAR_MAX);
+    maxCorner.setValue(-ML_SCALAR_MAX, -ML_SCALAR_MAX, -ML_SCALAR_MAX);
+}
+
+
+// Sets the box to the bounds of an array of points.
+
+void MlAABB::setBounds(const MlVector3 *points, int count)
+{
+    if (count <= 0) {
+        makeEmpty();
+        return;
+    }
+
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        MlScalar lo[3], hi[3];
+        k->bounds((const MlScalar *) points, lo, hi, count, 3);
+        minCorner.setValue(lo);
+        maxCorner.setValue(hi);
+        return;
+    }
+#endif
+
+    minCorner = maxCorner = points[0];
+    for (int i = 1; i < count; i++)
+        extendBy(points[i]);
+}
+
+
+void MlAABB::extendBy(const MlVector3 &pt)
+{
+    for (int j = 0; j < 3; j++) {
+        if (pt[j] < minCorner[j])
+            minCorner[j] = pt[j];
+        if (pt[j] > maxCorner[j])
+            maxCorner[j] = pt[j];
+    }
+}
+
+
+void MlAABB::extendBy(const MlAABB &box)
+{
+    if (box.isEmpty())
+        return;
+    for (int j = 0; j < 3; j++) {
+        if (box.minCorner[j] < minCorner[j])
+            minCorner[j] = box.minCorner[j];
+        if (box.maxCorner[j] > maxCorner[j])
+            maxCorner[j] = box.maxCorner[j];
+    }
+}
+
+
+// Returns the bounds of an array of boxes.
+
+MlAABB MlAABB::merge(const MlAABB *boxes, int count)
+{
+    MlAABB result;
+
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        MlScalar r[6];
+        k->mergeBoxes((const MlScalar *) boxes, r, count);
+        if (r[0] <= r[3])
+            result.setBounds(MlVector3(r), MlVector3(r + 3));
+        return result;
+    }
+#endif
+
+    for (int i = 0; i < count; i++)
+        result.extendBy(boxes[i]);
+    return result;
+}
+
+
+int MlAABB::contains(const MlVector3 &pt) const
+{
+    for (int j = 0; j < 3; j++)
+        if (pt[j] < minCorner[j] || pt[j] > maxCorner[j])
+            return FALSE;
+    return TRUE;
+}
+
+
+int MlAABB::overlaps(const MlAABB &box) const
+{
+    if (isEmpty() || box.isEmpty())
+        return FALSE;
+    for (int j = 0; j < 3; j++)
+        if (box.maxCorner[j] < minCorner[j] || box.minCorner[j] > maxCorner[j])
+            return FALSE;
+    return TRUE;
+}
+
+
+void MlAABB::containsBatch(const MlVector3 *points, int count, unsigned int *mask) const
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->boxContains((const MlScalar *) this, (const MlScalar *) points, mask, count);
+        return;
+    }
+#endif
+
+    for (int i = 0; i < count; i++) {
+        if ((i & 31) == 0)
+            mask[i >> 5] = 0;
+        if (contains(points[i]))
+            mask[i >> 5] |= 1u << (i & 31);
+    }
+}
+
+
+void MlAABB::overlapsBatch(const MlAABB *boxes, int count, unsigned int *mask) const
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL && ! isEmpty()) {
+        k->boxOverlaps((const MlScalar *) this, (const MlScalar *) boxes, mask, count);
+        return;
+    }
+#endif
+
+    for (int i = 0; i < count; i++) {
+        if ((i & 31) == 0)
+            mask[i >> 5] = 0;
+        if (overlaps(boxes[i]))
+            mask[i >> 5] |= 1u << (i & 31);
+    }
+}
+
+
+// Transforms the box by Arvo's method. The sums are grouped as in the
+// transformBoxes kernel, so that both give the same results.
+
+void MlAABB::transform(const MlTransform &m)
+{
+    MlScalar c[3], h[3];
+    int j;
+
+    if (isEmpty())
+        return;
+
+    for (j = 0; j < 3; j++) {
+        c[j] = mlMul(minCorner[j] + maxCorner[j], ML_SCALAR_HALF);
+        h[j] = mlMul(maxCorner[j] - minCorner[j], ML_SCALAR_HALF);
+    }
+    for (j = 0; j < 3; j++) {
+        MlScalar tc = (mlMul(c[0], m[0][j]) + mlMul(c[1], m[1][j])) +
+                      (mlMul(c[2], m[2][j]) + m[3][j]);
+        MlScalar th = (mlMul(h[0], mlAbs(m[0][j])) + mlMul(h[1], mlAbs(m[1][j]))) +
+                      mlMul(h[2], mlAbs(m[2][j]));
+        minCorner[j] = tc - th;
+        maxCorner[j] = tc + th;
+    }
+}
+
+
+void MlAABB::transformBatch(const MlTransform &m, const MlAABB *src, MlAABB *dst, int count)
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->transformBoxes((const MlScalar *) &m, 0, (const MlScalar *) src,
+                          (MlScalar *) dst, count);
+        return;
+    }
+#endif
+
+    for (int i = 0; i < count; i++) {
+        dst[i] = src[i];
+        dst[i].transform(m);
+    }
+}
+
+
+void MlAABB::transformBatch(const MlTransform *m, const MlAABB *src, MlAABB *dst, int count)
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->transformBoxes((const MlScalar *) m, 12, (const MlScalar *) src,
+                          (MlScalar *) dst, count);
+        return;
+    }
+#endif
+
+    for (int i = 0; i < count; i++) {
+        dst[i] = src[i];
+        dst[i].transform(m[i]);
+    }
+}
+
+
+////////////////////////////////////////////////////////////////////////
+//
+// MlSphere
+//
+////////////////////////////////////////////////////////////////////////
+
+void MlSphere::circumscribe(const MlAABB &box)
+{
+    if (box.isEmpty()) {
+        makeEmpty();
+        return;
+    }
+    center = box.getCenter();
+    radius = mlMul(box.getSize().length(), ML_SCALAR_HALF);
+}
+
+
+// Extends the sphere by a point: the new sphere has the point and the far
+// side of the old sphere on opposite sides of it.
+
+void MlSphere::extendBy(const MlVector3 &pt)
+{
+    if (isEmpty()) {
+        center = pt;
+        radius = ML_SCALAR_ZERO;
+        return;
+    }
+
+    MlVector3 d = pt - center;
+    MlScalar len = d.length();
+    if (len <= radius)
+        return;
+    MlScalar r = mlMul(radius + len, ML_SCALAR_HALF);
+    center += d * mlDiv(r - radius, len);
+    radius = r;
+}
+
+
+void MlSphere::extendBy(const MlSphere &sphere)
+{
+    if (sphere.isEmpty())
+        return;
+    if (isEmpty()) {
+        *this = sphere;
+        return;
+    }
+
+    MlVector3 d = sphere.center - center;
+    MlScalar len = d.length();
+    if (len + sphere.radius <= radius)
+        return;
+    if (len + radius <= sphere.radius) {
+        *this = sphere;
+        return;
+    }
+    MlScalar r = mlMul(len + radius + sphere.radius, ML_SCALAR_HALF);
+    center += d * mlDiv(r - radius, len);
+    radius = r;
+}
+
+
+// The sphere tests compare squared distances, and group the sums as the
+// kernels do.
+
+int MlSphere::contains(const MlVector3 &pt) const
+{
+    MlVector3 d = pt - center;
+    MlScalar d2 = (mlMul(d[0], d[0]) + mlMul(d[1], d[1])) + mlMul(d[2], d[2]);
+    return radius >= ML_SCALAR_ZERO && mlMul(radius, radius) - d2 >= ML_SCALAR_ZERO;
+}
+
+
+int MlSphere::overlaps(const MlSphere &sphere) const
+{
+    MlVector3 d = sphere.center - center;
+    MlScalar d2 = (mlMul(d[0], d[0]) + mlMul(d[1], d[1])) + mlMul(d[2], d[2]);
+    MlScalar rr = sphere.radius + radius;
+    return radius >= ML_SCALAR_ZERO && sphere.radius >= ML_SCALAR_ZERO &&
+           mlMul(rr, rr) - d2 >= ML_SCALAR_ZERO;
+}
+
+
+int MlSphere::overlaps(const MlAABB &box) const
+{
+    if (isEmpty() || box.isEmpty())
+        return FALSE;
+
+    // The squared distance to the nearest point of the box (Arvo).
+    MlScalar d2 = ML_SCALAR_ZERO;
+    for (int j = 0; j < 3; j++) {
+        MlScalar d = ML_SCALAR_ZERO;
+        if (center[j] < box.getMin()[j])
+            d = center[j] - box.getMin()[j];
+        else if (center[j] > box.getMax()[j])
+            d = center[j] - box.getMax()[j];
+        d2 += mlMul(d, d);
+    }
+    return d2 <= mlMul(radius, radius);
+}
+
+
+void MlSphere::containsBatch(const MlVector3 *points, int count, unsigned int *mask) const
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->sphereContains((const MlScalar *) this, (const MlScalar *) points, mask, count);
+        return;
+    }
+#endif
+
+    for (int i = 0; i < count; i++) {
+        if ((i & 31) == 0)
+            mask[i >> 5] = 0;
+        if (contains(points[i]))
+            mask[i >> 5] |= 1u << (i & 31);
+    }
+}
+
+
+void MlSphere::overlapsBatch(const MlSphere *spheres, int count, unsigned int *mask) const
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->sphereOverlaps((const MlScalar *) this, (const MlScalar *) spheres, mask, count);
+        return;
+    }
+#endif
+
+    for (int i = 0; i < count; i++) {
+        if ((i & 31) == 0)
+            mask[i >> 5] = 0;
+        if (overlaps(spheres[i]))
+            mask[i >> 5] |= 1u << (i & 31);
+    }
+}
+
+
+// Transforms the center, and scales the radius by the greatest scale of the
+// axes of the transform.
+
+void MlSphere::transform(const MlTransform &m)
+{
+    if (isEmpty())
+        return;
+
+    MlScalar scale = m[0].length();
+    for (int i = 1; i < 3; i++) {
+        MlScalar s = m[i].length();
+        if (s > scale)
+            scale = s;
+    }
+    m.multVecMatrix(center, center);
+    radius = mlMul(radius, scale);
+}
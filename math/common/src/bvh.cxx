@@ -0,0 +1,1036 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <float.h>
+#include <math.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+
+// Include Magic Lantern header files.
+#include "mle/mlAssert.h"
+
+// include Magic Lantern math header files
+#include "math/scalar.h"
+#include "math/vector.h"
+#include "math/bounds.h"
+#include "math/bvh.h"
+#include "vecsimd.h"
+#include "parallel.h"
+
+// The number of bins per axis that the triangles of a node are sorted into
+// to choose its split.
+#define BVH_BINS 16
+
+// Leaves hold no more triangles than this, unless they cannot be split.
+#define BVH_LEAF_MAX 8
+
+// The cost of visiting a node, relative to that of testing a triangle.
+#define BVH_TRAVERSAL_COST 1.0f
+
+// The tree is no deeper than this, so that the traversal stack is bounded;
+// the kernels hold the same number of entries.
+#define BVH_DEPTH_MAX 64
+
+// Subtrees with fewer triangles than this are built by a single thread.
+// Passes over the triangles, which cost about 20 to 30 ns each to bound or
+// bin, are not split between threads into parts of fewer than the second.
+#define BVH_TASK_MIN 4096
+#ifndef BVH_BUILD_THREAD_MIN
+#define BVH_BUILD_THREAD_MIN 1024
+#endif
+
+// Batches are not split between threads into parts of fewer rays than the
+// first, a multiple of 32, since a ray costs about 0.4 to 0.7 us to trace.
+// They are traced a block of rays at a time.
+#ifndef BVH_TRACE_THREAD_MIN
+#define BVH_TRACE_THREAD_MIN 64
+#endif
+#define BVH_BLOCK 256
+
+// Direction components smaller than this are replaced by this, with their
+// sign, so that the slabs of every node stay finite. The kernels do the
+// same.
+#define BVH_DIRECTION_MIN 1.0e-30f
+
+// The far distance of each node is scaled up by this, so that rounding
+// never culls a node that a ray only grazes (Ize). The kernels use the
+// same.
+#define BVH_FAR_SCALE 1.0000004f
+
+
+// A node of the tree, 32 bytes. A leaf holds count triangles from offset in
+// leaf order. An inner node has count <= 0, its children at offset and
+// offset + 1, and was split on axis -count; its first child holds the
+// triangles with the lower centroids. The root is at 0 and slot 1 is unused,
+// so that each pair of children starts at an even slot and shares a cache
+// line, since both are usually visited.
+struct MlBvhNode
+{
+    float lo[3];
+    int offset;
+    float hi[3];
+    int count;
+};
+
+static_assert(sizeof(MlBvhNode) == 8 * sizeof(float), "MlBvhNode must be 8 words");
+
+#if ML_VECTOR_SIMD
+// The traversal kernels read the rays as raw floats.
+static_assert(sizeof(MlVector3) == 3 * sizeof(float), "MlVector3 must be 3 floats");
+#endif
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Construction.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// A triangle being sorted into the tree: its bounds and its index in the
+// mesh. Its centroid is taken as lo + hi, twice the center of its bounds,
+// which sorts the same way as the center.
+struct MlBvhRef
+{
+    float lo[3];
+    int index;
+    float hi[3];
+    int pad;
+};
+
+// The triangles of a node being built, refs[first, last), with the bounds
+// of the triangles and of their centroids.
+struct MlBvhRange
+{
+    int first, last;
+    float lo[3], hi[3];
+    float clo[3], chi[3];
+};
+
+// The triangles of a node binned along one axis.
+struct MlBvhBin
+{
+    float lo[3], hi[3];
+    int count;
+};
+
+// A subtree left to be built by one thread, with the slot of its root in
+// the top of the tree, and its own nodes once built.
+struct MlBvhTask
+{
+    MlBvhRange range;
+    int slot;
+    int depth;
+    MlBvhNode *nodes;
+    int numNodes;
+};
+
+// The state of a build. The triangles are partitioned in place, so that
+// the references of each node being built are next to each other and end
+// up in leaf order.
+struct MlBvhBuild
+{
+    const MlVector3 *vertices;
+    const int *indices;
+    int numTriangles;
+    MlBvhRef *refs;
+
+    // The number of parts that passes over the triangles are split into,
+    // and the size of subtree that is left to a task.
+    int numChunks;
+    int taskSize;
+
+    MlBvhTask *tasks;
+    int numTasks;
+    int maxTasks;
+    std::atomic<int> nextTask;
+
+    // The results of each part of a pass.
+    MlBvhRange *chunkRanges;
+    MlBvhBin *chunkBins;
+
+    // The node being binned by a pass.
+    const MlBvhRange *range;
+    const float *scale;
+
+    // The triangles in leaf order, for the final pass.
+    float *triangles;
+    int *triangleIndices;
+};
+
+
+// The lesser and the greater of two values, as single instructions;
+// fminf() and fmaxf() are usually calls, since they must handle NaNs.
+
+static inline float minf(float a, float b)
+{
+    return (a < b) ? a : b;
+}
+
+
+static inline float maxf(float a, float b)
+{
+    return (a > b) ? a : b;
+}
+
+
+// Reads the corners of triangle i of the mesh.
+
+static inline void getTriangle(const MlBvhBuild *b, int i, float *v)
+{
+    for (int k = 0; k < 3; k++) {
+        const MlVector3 &p = b->vertices[b->indices ? b->indices[3*i + k] : 3*i + k];
+        v[3*k] = mlScalarToFloat(p[0]);
+        v[3*k + 1] = mlScalarToFloat(p[1]);
+        v[3*k + 2] = mlScalarToFloat(p[2]);
+    }
+}
+
+
+static inline void emptyRange(MlBvhRange &r)
+{
+    for (int k = 0; k < 3; k++) {
+        r.lo[k] = r.clo[k] = FLT_MAX;
+        r.hi[k] = r.chi[k] = -FLT_MAX;
+    }
+}
+
+
+static inline void extendRange(MlBvhRange &r, const MlBvhRange &s)
+{
+    for (int k = 0; k < 3; k++) {
+        r.lo[k] = minf(r.lo[k], s.lo[k]);
+        r.hi[k] = maxf(r.hi[k], s.hi[k]);
+        r.clo[k] = minf(r.clo[k], s.clo[k]);
+        r.chi[k] = maxf(r.chi[k], s.chi[k]);
+    }
+}
+
+
+// Half the surface area of a box.
+
+static inline float halfArea(const float *lo, const float *hi)
+{
+    float dx = hi[0] - lo[0], dy = hi[1] - lo[1], dz = hi[2] - lo[2];
+    return dx * dy + dy * dz + dz * dx;
+}
+
+
+// The bin of a centroid coordinate c along an axis whose centroids start at
+// lo and are scaled by scale bins per unit.
+
+static inline int binOf(float c, float lo, float scale)
+{
+    int k = (int) ((c - lo) * scale);
+    return (k < 0) ? 0 : ((k >= BVH_BINS) ? BVH_BINS - 1 : k);
+}
+
+
+// Makes the references of the triangles [first, last) of the mesh, and
+// the range of triangles that they make up.
+
+static void boundTriangles(MlBvhBuild *b, int first, int last, MlBvhRange &r)
+{
+    emptyRange(r);
+    for (int i = first; i < last; i++) {
+        float v[9];
+        getTriangle(b, i, v);
+        MlBvhRef &ref = b->refs[i];
+        for (int k = 0; k < 3; k++) {
+            float lo = minf(minf(v[k], v[3 + k]), v[6 + k]);
+            float hi = maxf(maxf(v[k], v[3 + k]), v[6 + k]);
+            ref.lo[k] = lo;
+            ref.hi[k] = hi;
+            float c = lo + hi;
+            r.lo[k] = minf(r.lo[k], lo);
+            r.hi[k] = maxf(r.hi[k], hi);
+            r.clo[k] = minf(r.clo[k], c);
+            r.chi[k] = maxf(r.chi[k], c);
+        }
+        ref.index = i;
+        ref.pad = 0;
+    }
+}
+
+
+// Bins the triangles refs[first, last) of a node along each axis.
+
+static void binTriangles(const MlBvhBuild *b, const MlBvhRange &r, const float *scale,
+                         int first, int last, MlBvhBin *bins)
+{
+    int j, k;
+
+    for (j = 0; j < 3 * BVH_BINS; j++) {
+        for (k = 0; k < 3; k++) {
+            bins[j].lo[k] = FLT_MAX;
+            bins[j].hi[k] = -FLT_MAX;
+        }
+        bins[j].count = 0;
+    }
+
+    for (int i = first; i < last; i++) {
+        const MlBvhRef &ref = b->refs[i];
+        for (j = 0; j < 3; j++) {
+            MlBvhBin &bin = bins[j * BVH_BINS +
+                                 binOf(ref.lo[j] + ref.hi[j], r.clo[j], scale[j])];
+            for (k = 0; k < 3; k++) {
+                bin.lo[k] = minf(bin.lo[k], ref.lo[k]);
+                bin.hi[k] = maxf(bin.hi[k], ref.hi[k]);
+            }
+            bin.count++;
+        }
+    }
+}
+
+
+// The passes that may be split between threads, over parts [first, last)
+// of numChunks.
+
+static void boundChunks(int first, int last, void *data)
+{
+    MlBvhBuild *b = (MlBvhBuild *) data;
+    int n = b->numTriangles;
+
+    for (int c = first; c < last; c++)
+        boundTriangles(b, (int) ((long long) n * c / b->numChunks),
+                       (int) ((long long) n * (c + 1) / b->numChunks), b->chunkRanges[c]);
+}
+
+
+static void binChunks(int first, int last, void *data)
+{
+    MlBvhBuild *b = (MlBvhBuild *) data;
+    const MlBvhRange &r = *b->range;
+    int n = r.last - r.first;
+
+    for (int c = first; c < last; c++)
+        binTriangles(b, r, b->scale,
+                     r.first + (int) ((long long) n * c / b->numChunks),
+                     r.first + (int) ((long long) n * (c + 1) / b->numChunks),
+                     b->chunkBins + c * 3 * BVH_BINS);
+}
+
+
+// Computes the bounds of the triangles and centroids of refs[first, last).
+
+static void boundRange(const MlBvhBuild *b, MlBvhRange &r)
+{
+    MlBvhRange s;
+    emptyRange(s);
+    for (int i = r.first; i < r.last; i++) {
+        const MlBvhRef &ref = b->refs[i];
+        for (int k = 0; k < 3; k++) {
+            float c = ref.lo[k] + ref.hi[k];
+            s.lo[k] = minf(s.lo[k], ref.lo[k]);
+            s.hi[k] = maxf(s.hi[k], ref.hi[k]);
+            s.clo[k] = minf(s.clo[k], c);
+            s.chi[k] = maxf(s.chi[k], c);
+        }
+    }
+    s.first = r.first;
+    s.last = r.last;
+    r = s;
+}
+
+
+// Splits a node into two, choosing the split with the lowest surface area
+// cost. Returns the axis split on, or -1 if the node should be a leaf.
+
+static int splitRange(MlBvhBuild *b, const MlBvhRange &r, int depth, int parallel,
+                      MlBvhRange &left, MlBvhRange &right)
+{
+    int count = r.last - r.first;
+    if (count <= 1 || depth >= BVH_DEPTH_MAX - 1)
+        return -1;
+
+    // Bin the centroids. An axis along which they all lie together has no
+    // split, and all of its triangles fall in its first bin.
+    float scale[3];
+    int j, k;
+    for (j = 0; j < 3; j++) {
+        float extent = r.chi[j] - r.clo[j];
+        scale[j] = (extent > 0.0f) ? BVH_BINS / extent : 0.0f;
+        if (! (scale[j] < FLT_MAX))
+            scale[j] = 0.0f;
+    }
+
+    MlBvhBin bins[3 * BVH_BINS];
+    if (parallel && b->numChunks > 1 && count >= 2 * BVH_BUILD_THREAD_MIN) {
+        b->range = &r;
+        b->scale = scale;
+        mlForEachRange(b->numChunks, 1, b->numChunks, binChunks, b);
+        memcpy(bins, b->chunkBins, sizeof(bins));
+        for (int c = 1; c < b->numChunks; c++) {
+            const MlBvhBin *cb = b->chunkBins + c * 3 * BVH_BINS;
+            for (j = 0; j < 3 * BVH_BINS; j++) {
+                for (k = 0; k < 3; k++) {
+                    bins[j].lo[k] = minf(bins[j].lo[k], cb[j].lo[k]);
+                    bins[j].hi[k] = maxf(bins[j].hi[k], cb[j].hi[k]);
+                }
+                bins[j].count += cb[j].count;
+            }
+        }
+    } else
+        binTriangles(b, r, scale, r.first, r.last, bins);
+
+    // Sweep the bins of each axis from both ends, costing each split as the
+    // areas of its two sides weighted by their numbers of triangles.
+    float bestCost = FLT_MAX;
+    int bestAxis = -1, bestSplit = 0;
+    for (j = 0; j < 3; j++) {
+        const MlBvhBin *axis = bins + j * BVH_BINS;
+        float area[BVH_BINS];
+        int num[BVH_BINS];
+        float lo[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+        float hi[3] = { -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        int n = 0, i;
+
+        for (i = BVH_BINS - 1; i > 0; i--) {
+            for (k = 0; k < 3; k++) {
+                lo[k] = minf(lo[k], axis[i].lo[k]);
+                hi[k] = maxf(hi[k], axis[i].hi[k]);
+            }
+            n += axis[i].count;
+            num[i] = n;
+            area[i] = (n > 0) ? halfArea(lo, hi) : 0.0f;
+        }
+
+        n = 0;
+        for (k = 0; k < 3; k++) {
+            lo[k] = FLT_MAX;
+            hi[k] = -FLT_MAX;
+        }
+        for (i = 0; i < BVH_BINS - 1; i++) {
+            for (k = 0; k < 3; k++) {
+                lo[k] = minf(lo[k], axis[i].lo[k]);
+                hi[k] = maxf(hi[k], axis[i].hi[k]);
+            }
+            n += axis[i].count;
+            if (n == 0 || num[i + 1] == 0)
+                continue;
+            float cost = halfArea(lo, hi) * n + area[i + 1] * num[i + 1];
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestAxis = j;
+                bestSplit = i;
+            }
+        }
+    }
+
+    // Splitting must be cheaper than testing each triangle, unless there
+    // are too many of them.
+    int split = (bestAxis >= 0) &&
+        (bestCost < (count - BVH_TRAVERSAL_COST) * halfArea(r.lo, r.hi));
+    if (! split && count <= BVH_LEAF_MAX)
+        return -1;
+
+    if (bestAxis < 0) {
+        // The centroids all coincide, so split the triangles in two
+        // halves as they are.
+        left.first = r.first;
+        left.last = right.first = r.first + count / 2;
+        right.last = r.last;
+        boundRange(b, left);
+        boundRange(b, right);
+        return 0;
+    }
+
+    // Partition the triangles, collecting the bounds of each side.
+    const MlBvhBin *axis = bins + bestAxis * BVH_BINS;
+    emptyRange(left);
+    emptyRange(right);
+    for (int i = 0; i < BVH_BINS; i++) {
+        MlBvhRange &side = (i <= bestSplit) ? left : right;
+        for (k = 0; k < 3; k++) {
+            side.lo[k] = minf(side.lo[k], axis[i].lo[k]);
+            side.hi[k] = maxf(side.hi[k], axis[i].hi[k]);
+        }
+    }
+
+    MlBvhRef *refs = b->refs;
+    int i = r.first, last = r.last - 1;
+    while (i <= last) {
+        MlBvhRef ref = refs[i];
+        float c[3] = { ref.lo[0] + ref.hi[0], ref.lo[1] + ref.hi[1], ref.lo[2] + ref.hi[2] };
+        MlBvhRange *side;
+        if (binOf(c[bestAxis], r.clo[bestAxis], scale[bestAxis]) <= bestSplit) {
+            side = &left;
+            i++;
+        } else {
+            side = &right;
+            refs[i] = refs[last];
+            refs[last--] = ref;
+        }
+        for (k = 0; k < 3; k++) {
+            side->clo[k] = minf(side->clo[k], c[k]);
+            side->chi[k] = maxf(side->chi[k], c[k]);
+        }
+    }
+    left.first = r.first;
+    left.last = right.first = i;
+    right.last = r.last;
+    return bestAxis;
+}
+
+
+// Builds the subtree of a node into nodes[slot], taking the slots of its
+// descendants from used in pairs. At the top of the tree, subtrees of no more than
+// taskSize triangles are left as tasks.
+
+static void buildNode(MlBvhBuild *b, MlBvhNode *nodes, int &used, int slot,
+                      const MlBvhRange &r, int depth, int top)
+{
+    if (top && r.last - r.first <= b->taskSize) {
+        if (b->numTasks == b->maxTasks) {
+            b->maxTasks *= 2;
+            MlBvhTask *tasks = new MlBvhTask[b->maxTasks];
+            memcpy(tasks, b->tasks, b->numTasks * sizeof(MlBvhTask));
+            delete [] b->tasks;
+            b->tasks = tasks;
+        }
+        MlBvhTask &task = b->tasks[b->numTasks++];
+        task.range = r;
+        task.slot = slot;
+        task.depth = depth;
+        task.nodes = NULL;
+        task.numNodes = 0;
+        return;
+    }
+
+    MlBvhNode &node = nodes[slot];
+    for (int k = 0; k < 3; k++) {
+        node.lo[k] = r.lo[k];
+        node.hi[k] = r.hi[k];
+    }
+
+    MlBvhRange left, right;
+    int axis = splitRange(b, r, depth, top, left, right);
+    if (axis < 0) {
+        node.offset = r.first;
+        node.count = r.last - r.first;
+        return;
+    }
+
+    int child = used;
+    used += 2;
+    node.offset = child;
+    node.count = -axis;
+    buildNode(b, nodes, used, child, left, depth + 1, top);
+    buildNode(b, nodes, used, child + 1, right, depth + 1, top);
+}
+
+
+// Builds the subtrees left as tasks, each thread taking the next in turn.
+
+static void buildTasks(int, int, void *data)
+{
+    MlBvhBuild *b = (MlBvhBuild *) data;
+
+    for (int i = b->nextTask++; i < b->numTasks; i = b->nextTask++) {
+        MlBvhTask &task = b->tasks[i];
+        task.nodes = new MlBvhNode[2 * (task.range.last - task.range.first)];
+        task.numNodes = 2;
+        buildNode(b, task.nodes, task.numNodes, 0, task.range, task.depth, FALSE);
+    }
+}
+
+
+// Copies the triangles [first, last) in leaf order, as their first corners
+// and their edges.
+
+static void copyTriangles(int first, int last, void *data)
+{
+    MlBvhBuild *b = (MlBvhBuild *) data;
+
+    for (int i = first; i < last; i++) {
+        int t = b->refs[i].index;
+        float v[9];
+        getTriangle(b, t, v);
+        float *r = b->triangles + 9*i;
+        for (int k = 0; k < 3; k++) {
+            r[k] = v[k];
+            r[3 + k] = v[3 + k] - v[k];
+            r[6 + k] = v[6 + k] - v[k];
+        }
+        b->triangleIndices[i] = t;
+    }
+}
+
+
+// Allocates nodes aligned to a cache line. The block is allocated with
+// two nodes to spare, since new only aligns it to 16 bytes.
+
+MlBvhNode *MlBvh::newNodes(int n, MlBvhNode *&memory)
+{
+    memory = new MlBvhNode[n + 2];
+    size_t address = (size_t) memory;
+    return (MlBvhNode *) ((address + 63) & ~(size_t) 63);
+}
+
+
+MlBvh::MlBvh()
+  : numTriangles(0), numNodes(0), nodes(NULL), nodeMemory(NULL),
+    triangles(NULL), triangleIndices(NULL)
+{}
+
+
+MlBvh::MlBvh(const MlVector3 *vertices, const int *indices, int numTriangles,
+             int numThreads)
+  : numTriangles(0), numNodes(0), nodes(NULL), nodeMemory(NULL),
+    triangles(NULL), triangleIndices(NULL)
+{
+    build(vertices, indices, numTriangles, numThreads);
+}
+
+
+MlBvh::MlBvh(const MlBvh &bvh)
+  : numTriangles(0), numNodes(0), nodes(NULL), nodeMemory(NULL),
+    triangles(NULL), triangleIndices(NULL)
+{
+    *this = bvh;
+}
+
+
+MlBvh::~MlBvh()
+{
+    delete [] nodeMemory;
+    delete [] triangles;
+    delete [] triangleIndices;
+}
+
+
+MlBvh &MlBvh::operator =(const MlBvh &bvh)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Copies the tree and the triangles of another hierarchy.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    if (this != &bvh) {
+        delete [] nodeMemory;
+        delete [] triangles;
+        delete [] triangleIndices;
+        nodes = NULL;
+        nodeMemory = NULL;
+        triangles = NULL;
+        triangleIndices = NULL;
+        numTriangles = bvh.numTriangles;
+        numNodes = bvh.numNodes;
+
+        if (numNodes > 0) {
+            nodes = newNodes(numNodes, nodeMemory);
+            memcpy(nodes, bvh.nodes, numNodes * sizeof(MlBvhNode));
+            triangles = new float[9 * numTriangles];
+            memcpy(triangles, bvh.triangles, 9 * numTriangles * sizeof(float));
+            triangleIndices = new int[numTriangles];
+            memcpy(triangleIndices, bvh.triangleIndices, numTriangles * sizeof(int));
+        }
+    }
+    return *this;
+}
+
+
+MlBvh &MlBvh::build(const MlVector3 *vertices, const int *indices, int numTriangles,
+                    int numThreads)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Builds the tree over the triangles of a mesh. The top of the tree
+//    is built with the passes over the triangles of each large node
+//    split between threads, down to subtrees small enough to leave to
+//    one thread each, which are then built in parallel and appended
+//    to the top in the order that they were reached.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    delete [] nodeMemory;
+    delete [] triangles;
+    delete [] triangleIndices;
+    nodes = NULL;
+    nodeMemory = NULL;
+    triangles = NULL;
+    triangleIndices = NULL;
+    this->numTriangles = (numTriangles > 0) ? numTriangles : 0;
+    numNodes = 0;
+
+    if (numTriangles <= 0)
+        return *this;
+
+    MLE_ASSERT(vertices != NULL);
+
+    if (numThreads <= 0)
+        numThreads = (int) std::thread::hardware_concurrency();
+    if (numThreads < 1)
+        numThreads = 1;
+
+    MlBvhBuild b;
+    b.vertices = vertices;
+    b.indices = indices;
+    b.numTriangles = numTriangles;
+    b.refs = new MlBvhRef[numTriangles];
+    b.numChunks = (numTriangles + BVH_BUILD_THREAD_MIN - 1) / BVH_BUILD_THREAD_MIN;
+    if (b.numChunks > numThreads)
+        b.numChunks = numThreads;
+    b.chunkRanges = new MlBvhRange[b.numChunks];
+    b.chunkBins = new MlBvhBin[b.numChunks * 3 * BVH_BINS];
+
+    // With one thread the whole tree is one task. Otherwise there are
+    // enough tasks to keep the threads busy while the larger ones finish.
+    b.taskSize = numTriangles;
+    if (numThreads > 1) {
+        b.taskSize = numTriangles / (8 * numThreads);
+        if (b.taskSize < BVH_TASK_MIN)
+            b.taskSize = BVH_TASK_MIN;
+    }
+    b.maxTasks = 64;
+    b.tasks = new MlBvhTask[b.maxTasks];
+    b.numTasks = 0;
+    b.nextTask = 0;
+
+    // Bound the triangles, then build the top of the tree.
+    MlBvhRange root;
+    mlForEachRange(b.numChunks, 1, b.numChunks, boundChunks, &b);
+    emptyRange(root);
+    for (int c = 0; c < b.numChunks; c++)
+        extendRange(root, b.chunkRanges[c]);
+    root.first = 0;
+    root.last = numTriangles;
+
+    MlBvhNode *top = new MlBvhNode[2 * numTriangles];
+    int numTop = 2;
+    memset(top + 1, 0, sizeof(MlBvhNode));
+    buildNode(&b, top, numTop, 0, root, 0, TRUE);
+
+    // Build the subtrees, and append each to the top, moving its root to
+    // its slot there and dropping its unused slot.
+    int taskThreads = (b.numTasks < numThreads) ? b.numTasks : numThreads;
+    mlForEachRange(taskThreads, 1, taskThreads, buildTasks, &b);
+
+    numNodes = numTop;
+    int i;
+    for (i = 0; i < b.numTasks; i++)
+        numNodes += b.tasks[i].numNodes - 2;
+    nodes = newNodes(numNodes, nodeMemory);
+    memcpy(nodes, top, numTop * sizeof(MlBvhNode));
+    delete [] top;
+
+    int base = numTop;
+    for (i = 0; i < b.numTasks; i++) {
+        MlBvhTask &task = b.tasks[i];
+        for (int j = 0; j < task.numNodes; j++) {
+            if (j == 1)
+                continue;
+            MlBvhNode &node = nodes[(j == 0) ? task.slot : base + j - 2];
+            node = task.nodes[j];
+            if (node.count <= 0)
+                node.offset += base - 2;
+        }
+        base += task.numNodes - 2;
+        delete [] task.nodes;
+    }
+
+    // Copy the triangles in leaf order.
+    triangles = new float[9 * numTriangles];
+    triangleIndices = new int[numTriangles];
+    b.triangles = triangles;
+    b.triangleIndices = triangleIndices;
+    mlForEachRange(numTriangles, BVH_BUILD_THREAD_MIN, numThreads, copyTriangles, &b);
+
+    delete [] b.refs;
+    delete [] b.chunkRanges;
+    delete [] b.chunkBins;
+    delete [] b.tasks;
+    return *this;
+}
+
+
+MlAABB MlBvh::getBounds() const
+{
+    MlAABB box;
+    if (numNodes > 0)
+        box.setBounds(MlVector3(mlFloatToScalar(nodes[0].lo[0]),
+                                mlFloatToScalar(nodes[0].lo[1]),
+                                mlFloatToScalar(nodes[0].lo[2])),
+                      MlVector3(mlFloatToScalar(nodes[0].hi[0]),
+                                mlFloatToScalar(nodes[0].hi[1]),
+                                mlFloatToScalar(nodes[0].hi[2])));
+    return box;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Queries.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Traces one ray down the tree, visiting the children of each node nearest
+// first along its split axis. The arithmetic is that of the kernels: slab
+// tests against the reciprocal direction, and Moller and Trumbore's test
+// of each triangle.
+
+int MlBvh::trace(const float *o, const float *d, float &t, float *uv, int any) const
+{
+    if (numNodes == 0)
+        return -1;
+
+    float inv[3];
+    int neg[3], k;
+    for (k = 0; k < 3; k++) {
+        float dk = d[k];
+        if (fabsf(dk) < BVH_DIRECTION_MIN)
+            dk = copysignf(BVH_DIRECTION_MIN, dk);
+        inv[k] = 1.0f / dk;
+        neg[k] = (d[k] < 0.0f);
+    }
+
+    int stack[BVH_DEPTH_MAX];
+    int sp = 0, node = 0, hit = -1;
+    for (;;) {
+        const MlBvhNode &n = nodes[node];
+        float tn = 0.0f, tf = FLT_MAX;
+        for (k = 0; k < 3; k++) {
+            float t0 = (n.lo[k] - o[k]) * inv[k];
+            float t1 = (n.hi[k] - o[k]) * inv[k];
+            tn = maxf(tn, minf(t0, t1));
+            tf = minf(tf, maxf(t0, t1));
+        }
+
+        if (! (tn > minf(t, tf * BVH_FAR_SCALE))) {
+            if (n.count <= 0) {
+                int axis = -n.count;
+                stack[sp++] = n.offset + 1 - neg[axis];
+                node = n.offset + neg[axis];
+                continue;
+            }
+
+            for (int i = n.offset; i < n.offset + n.count; i++) {
+                const float *v0 = triangles + 9*i;
+                const float *e1 = v0 + 3;
+                const float *e2 = v0 + 6;
+                float p[3] = { d[1] * e2[2] - d[2] * e2[1],
+                               d[2] * e2[0] - d[0] * e2[2],
+                               d[0] * e2[1] - d[1] * e2[0] };
+                float det = (e1[0] * p[0] + e1[1] * p[1]) + e1[2] * p[2];
+                if (det == 0.0f)
+                    continue;
+                float r = 1.0f / det;
+                float s[3] = { o[0] - v0[0], o[1] - v0[1], o[2] - v0[2] };
+                float u = ((s[0] * p[0] + s[1] * p[1]) + s[2] * p[2]) * r;
+                float q[3] = { s[1] * e1[2] - s[2] * e1[1],
+                               s[2] * e1[0] - s[0] * e1[2],
+                               s[0] * e1[1] - s[1] * e1[0] };
+                float v = ((d[0] * q[0] + d[1] * q[1]) + d[2] * q[2]) * r;
+                float h = ((e2[0] * q[0] + e2[1] * q[1]) + e2[2] * q[2]) * r;
+                if (! (t > h) || h < 0.0f || u < 0.0f || v < 0.0f || u + v > 1.0f)
+                    continue;
+                t = h;
+                hit = i;
+                if (uv != NULL) {
+                    uv[0] = u;
+                    uv[1] = v;
+                }
+                if (any)
+                    return hit;
+            }
+        }
+
+        if (sp == 0)
+            return hit;
+        node = stack[--sp];
+    }
+}
+
+
+int MlBvh::intersect(const MlVector3 &origin, const MlVector3 &direction,
+                     MlScalar maxDistance, MlBvhHit &hit) const
+{
+    float o[3], d[3], uv[2] = { 0.0f, 0.0f };
+    for (int k = 0; k < 3; k++) {
+        o[k] = mlScalarToFloat(origin[k]);
+        d[k] = mlScalarToFloat(direction[k]);
+    }
+    float t = mlScalarToFloat(maxDistance);
+
+    int i = trace(o, d, t, uv, FALSE);
+    hit.triangle = (i >= 0) ? triangleIndices[i] : -1;
+    hit.t = (i >= 0) ? mlFloatToScalar(t) : maxDistance;
+    hit.u = mlFloatToScalar(uv[0]);
+    hit.v = mlFloatToScalar(uv[1]);
+    return (i >= 0);
+}
+
+
+int MlBvh::occluded(const MlVector3 &origin, const MlVector3 &direction,
+                    MlScalar maxDistance) const
+{
+    float o[3], d[3];
+    for (int k = 0; k < 3; k++) {
+        o[k] = mlScalarToFloat(origin[k]);
+        d[k] = mlScalarToFloat(direction[k]);
+    }
+    float t = mlScalarToFloat(maxDistance);
+
+    return (trace(o, d, t, NULL, TRUE) >= 0);
+}
+
+
+// The arguments of a call to intersectBatch() or occludedBatch(), passed
+// to each of its threads. The mask is NULL for intersectBatch().
+struct MlBvhBatch
+{
+    const MlBvh *bvh;
+    const MlVector3 *origins;
+    const MlVector3 *directions;
+    const MlScalar *maxDistances;
+    MlBvhHit *hits;
+    unsigned int *mask;
+    int count;
+};
+
+void MlBvh::traceRange(int first, int last, void *data)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Traces the rays of the mask words [first, last), a block at a
+//    time, in packets by the kernels if the processor has them.
+//
+// Use: private, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlBvhBatch *batch = (MlBvhBatch *) data;
+    const MlBvh *bvh = batch->bvh;
+    int begin = 32 * first;
+    int end = (32 * last < batch->count) ? 32 * last : batch->count;
+    int any = (batch->mask != NULL);
+
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+#endif
+
+    for (int i = begin; i < end; i += BVH_BLOCK) {
+        int n = (end - i < BVH_BLOCK) ? end - i : BVH_BLOCK;
+        float o[3 * BVH_BLOCK], d[3 * BVH_BLOCK], t[BVH_BLOCK], uv[2 * BVH_BLOCK];
+        int hit[BVH_BLOCK];
+        int j;
+
+        for (j = 0; j < n; j++) {
+            const MlVector3 &oj = batch->origins[i + j];
+            const MlVector3 &dj = batch->directions[i + j];
+            for (int c = 0; c < 3; c++) {
+                o[3*j + c] = mlScalarToFloat(oj[c]);
+                d[3*j + c] = mlScalarToFloat(dj[c]);
+            }
+            t[j] = batch->maxDistances ? mlScalarToFloat(batch->maxDistances[i + j]) : FLT_MAX;
+            uv[2*j] = uv[2*j + 1] = 0.0f;
+            hit[j] = -1;
+        }
+
+        if (bvh->numNodes > 0) {
+#if ML_VECTOR_SIMD
+            if (k != NULL)
+                k->traceRays((const float *) bvh->nodes, bvh->triangles, o, d, t, hit,
+                             any ? NULL : uv, n, any);
+            else
+#endif
+            {
+                for (j = 0; j < n; j++)
+                    hit[j] = bvh->trace(o + 3*j, d + 3*j, t[j], uv + 2*j, any);
+            }
+        }
+
+        for (j = 0; j < n; j++) {
+            if (any) {
+                int w = (i + j) >> 5;
+                if (((i + j) & 31) == 0)
+                    batch->mask[w] = 0;
+                if (hit[j] >= 0)
+                    batch->mask[w] |= 1u << ((i + j) & 31);
+            } else {
+                MlBvhHit &h = batch->hits[i + j];
+                h.triangle = (hit[j] >= 0) ? bvh->triangleIndices[hit[j]] : -1;
+                h.t = (hit[j] >= 0) ? mlFloatToScalar(t[j]) :
+                    (batch->maxDistances ? batch->maxDistances[i + j] : ML_SCALAR_MAX);
+                h.u = mlFloatToScalar(uv[2*j]);
+                h.v = mlFloatToScalar(uv[2*j + 1]);
+            }
+        }
+    }
+}
+
+
+void MlBvh::intersectBatch(const MlVector3 *origins, const MlVector3 *directions,
+                           const MlScalar *maxDistances, MlBvhHit *hits, int count,
+                           int numThreads) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Finds the nearest hits of an array of rays, splitting the rays
+//    between threads in groups of 32.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlBvhBatch batch = { this, origins, directions, maxDistances, hits, NULL, count };
+
+    mlForEachRange((count + 31) / 32, BVH_TRACE_THREAD_MIN / 32, numThreads,
+                   traceRange, &batch);
+}
+
+
+void MlBvh::occludedBatch(const MlVector3 *origins, const MlVector3 *directions,
+                          const MlScalar *maxDistances, int count, unsigned int *mask,
+                          int numThreads) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Tests an array of rays for any hit, splitting the mask words
+//    between threads so that no two threads write the same word.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlBvhBatch batch = { this, origins, directions, maxDistances, NULL, mask, count };
+
+    mlForEachRange((count + 31) / 32, BVH_TRACE_THREAD_MIN / 32, numThreads,
+                   traceRange, &batch);
+}
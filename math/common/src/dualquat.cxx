@@ -0,0 +1,485 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// include Magic Lantern math header files
+#include "math/scalar.h"
+#include "math/trig.h"
+#include "math/vector.h"
+#include "math/rotation.h"
+#include "math/transfrm.h"
+#include "math/dualquat.h"
+
+// Below this sine of half the angle, sclerp() interpolates linearly
+// rather than dividing by it.
+#define SCLERP_MIN_SINE ML_SCALAR(0.001f)
+
+
+// Hamilton product r = a * b of quaternions stored x, y, z, w. Note that
+// the MlDualQuat product of a and b is b * a, since it applies a first.
+static inline void
+quatMul(const MlScalar *a, const MlScalar *b, MlScalar *r)
+{
+    MlScalar x = mlMul(a[3], b[0]) + mlMul(a[0], b[3]) + mlMul(a[1], b[2]) - mlMul(a[2], b[1]);
+    MlScalar y = mlMul(a[3], b[1]) + mlMul(a[1], b[3]) + mlMul(a[2], b[0]) - mlMul(a[0], b[2]);
+    MlScalar z = mlMul(a[3], b[2]) + mlMul(a[2], b[3]) + mlMul(a[0], b[1]) - mlMul(a[1], b[0]);
+    MlScalar w = mlMul(a[3], b[3]) - mlMul(a[0], b[0]) - mlMul(a[1], b[1]) - mlMul(a[2], b[2]);
+    r[0] = x;
+    r[1] = y;
+    r[2] = z;
+    r[3] = w;
+}
+
+
+// The dual parts of the Hamilton product of dual quaternions,
+// ar * bd + ad * br.
+static inline void
+dualMul(const MlScalar *ar, const MlScalar *ad, const MlScalar *br, const MlScalar *bd,
+        MlScalar *r)
+{
+    MlScalar s[4];
+    quatMul(ar, bd, r);
+    quatMul(ad, br, s);
+    r[0] += s[0];
+    r[1] += s[1];
+    r[2] += s[2];
+    r[3] += s[3];
+}
+
+
+MlDualQuat &MlDualQuat::setValue(const MlScalar real[4], const MlScalar dual[4])
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Sets the real and dual parts.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    for (int i = 0; i < 4; i++) {
+        this->real[i] = real[i];
+        this->dual[i] = dual[i];
+    }
+
+    return *this;
+}
+
+
+MlDualQuat &MlDualQuat::setValue(const MlRotation& rotation, const MlVector3& translation)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Sets the transform to a rotation followed by a translation. The
+//    dual part is t * r / 2, with t the translation as a quaternion.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    const MlScalar *q = rotation.getValue();
+    MlScalar t[4];
+
+    t[0] = mlMul(translation[0], ML_SCALAR_HALF);
+    t[1] = mlMul(translation[1], ML_SCALAR_HALF);
+    t[2] = mlMul(translation[2], ML_SCALAR_HALF);
+    t[3] = ML_SCALAR_ZERO;
+
+    real[0] = q[0];
+    real[1] = q[1];
+    real[2] = q[2];
+    real[3] = q[3];
+    quatMul(t, real, dual);
+
+    return *this;
+}
+
+
+MlDualQuat &MlDualQuat::setValue(const MlTransform& m)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Sets the transform from a rotation and translation matrix.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    return setValue(MlRotation(m), m[3]);
+}
+
+
+MlVector3 MlDualQuat::getTranslation() const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Returns the translation, the vector part of 2 * d * conjugate(r).
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlScalar x = mlMul(real[3], dual[0]) - mlMul(dual[3], real[0])
+                 + mlMul(real[1], dual[2]) - mlMul(real[2], dual[1]);
+    MlScalar y = mlMul(real[3], dual[1]) - mlMul(dual[3], real[1])
+                 + mlMul(real[2], dual[0]) - mlMul(real[0], dual[2]);
+    MlScalar z = mlMul(real[3], dual[2]) - mlMul(dual[3], real[2])
+                 + mlMul(real[0], dual[1]) - mlMul(real[1], dual[0]);
+
+    return MlVector3(2 * x, 2 * y, 2 * z);
+}
+
+
+void MlDualQuat::getValue(MlRotation& rotation, MlVector3& translation) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Returns the rotation and the translation.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    rotation.setValue(real);
+    translation = getTranslation();
+}
+
+
+void MlDualQuat::getValue(MlTransform& matrix) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Returns the corresponding rotation and translation matrix.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    getRotation().getValue(matrix);
+    matrix[3] = getTranslation();
+}
+
+
+MlDualQuat &MlDualQuat::operator *=(const MlDualQuat& dq)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Multiplies by another transform, which is applied after this one.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlScalar r[4], d[4];
+
+    quatMul(dq.real, real, r);
+    dualMul(dq.real, dq.dual, real, dual, d);
+    setValue(r, d);
+
+    return normalize();
+}
+
+
+MlDualQuat operator *(const MlDualQuat& dq1, const MlDualQuat& dq2)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Binary multiplication operator.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlDualQuat dq = dq1;
+    dq *= dq2;
+    return dq;
+}
+
+
+int MlDualQuat::equals(const MlDualQuat& dq, MlScalar tolerance) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Equality comparison within given tolerance - the square of the
+//    distance between the eight components.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlScalar dist = ML_SCALAR_ZERO;
+
+    for (int i = 0; i < 4; i++) {
+        dist += mlSquare(real[i] - dq.real[i]);
+        dist += mlSquare(dual[i] - dq.dual[i]);
+    }
+
+    return dist <= tolerance;
+}
+
+
+MlDualQuat &MlDualQuat::normalize()
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Scales the real part to unit length and removes the component of
+//    the dual part along it. A zero real part gives the identity.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlScalar norm = mlSquare(real[0]) + mlSquare(real[1])
+                    + mlSquare(real[2]) + mlSquare(real[3]);
+    int i;
+
+    if (norm <= ML_SCALAR_ZERO) {
+        *this = identity();
+        return *this;
+    }
+
+    MlScalar scale = mlRecipSqrt(norm);
+    for (i = 0; i < 4; i++) {
+        mlMulBy(real[i], scale);
+        mlMulBy(dual[i], scale);
+    }
+
+    MlScalar d = mlMul(real[0], dual[0]) + mlMul(real[1], dual[1])
+                 + mlMul(real[2], dual[2]) + mlMul(real[3], dual[3]);
+    for (i = 0; i < 4; i++)
+        dual[i] -= mlMul(d, real[i]);
+
+    return *this;
+}
+
+
+MlDualQuat &MlDualQuat::invert()
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Changes the transform to its inverse, the conjugate of both parts.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    for (int i = 0; i < 3; i++) {
+        real[i] = -real[i];
+        dual[i] = -dual[i];
+    }
+
+    return *this;
+}
+
+
+void MlDualQuat::multDir(const MlVector3& src, MlVector3& dst) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Rotates a direction, as v + 2 r x (r x v + w v) with r and w the
+//    vector and scalar parts of the real part.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlScalar cx = mlMul(real[1], src[2]) - mlMul(real[2], src[1]) + mlMul(real[3], src[0]);
+    MlScalar cy = mlMul(real[2], src[0]) - mlMul(real[0], src[2]) + mlMul(real[3], src[1]);
+    MlScalar cz = mlMul(real[0], src[1]) - mlMul(real[1], src[0]) + mlMul(real[3], src[2]);
+
+    dst.setValue(src[0] + 2 * (mlMul(real[1], cz) - mlMul(real[2], cy)),
+                 src[1] + 2 * (mlMul(real[2], cx) - mlMul(real[0], cz)),
+                 src[2] + 2 * (mlMul(real[0], cy) - mlMul(real[1], cx)));
+}
+
+
+void MlDualQuat::multVec(const MlVector3& src, MlVector3& dst) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Transforms a point: rotates it and then adds the translation.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlVector3 t = getTranslation();
+
+    multDir(src, dst);
+    dst += t;
+}
+
+
+void MlDualQuat::multVecBatch(const MlVector3 *src, MlVector3 *dst, int count) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Transforms an array of points through the equivalent matrix.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlTransform m;
+
+    getValue(m);
+    m.multVecMatrixBatch(src, dst, count);
+}
+
+
+MlDualQuat MlDualQuat::sclerp(const MlDualQuat& dq0, const MlDualQuat& dq1, MlScalar t)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Screw linear interpolation, dq0 * (conjugate(dq0) * dq1)^t in
+//    Hamilton products. The power is taken by way of the screw
+//    parameters of the difference: the half angle and half pitch are
+//    scaled by t, the axis and moment are kept.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlScalar c0r[4], c0d[4], r[4], d[4];
+    int i;
+
+    for (i = 0; i < 3; i++) {
+        c0r[i] = -dq0.real[i];
+        c0d[i] = -dq0.dual[i];
+    }
+    c0r[3] = dq0.real[3];
+    c0d[3] = dq0.dual[3];
+
+    quatMul(c0r, dq1.real, r);
+    dualMul(c0r, c0d, dq1.real, dq1.dual, d);
+
+    // Take the shorter path.
+    if (r[3] < ML_SCALAR_ZERO) {
+        for (i = 0; i < 4; i++) {
+            r[i] = -r[i];
+            d[i] = -d[i];
+        }
+    }
+
+    MlDualQuat step;
+    MlScalar s = mlSqrt(mlSquare(r[0]) + mlSquare(r[1]) + mlSquare(r[2]));
+
+    if (s < SCLERP_MIN_SINE) {
+        // Nearly a pure translation; blend from the identity.
+        MlScalar u = ML_SCALAR_ONE - t;
+        for (i = 0; i < 4; i++) {
+            step.real[i] = mlMul(t, r[i]);
+            step.dual[i] = mlMul(t, d[i]);
+        }
+        step.real[3] += u;
+        step.normalize();
+    } else {
+        MlScalar recip = mlReciprocal(s);
+        MlScalar halfPitch = -mlMul(d[3], recip);
+        MlScalar axis[3], moment[3];
+
+        for (i = 0; i < 3; i++) {
+            axis[i] = mlMul(r[i], recip);
+            moment[i] = mlMul(d[i] - mlMul(mlMul(axis[i], halfPitch), r[3]), recip);
+        }
+
+        MlScalar angle = mlMul(t, mlAtan2(s, r[3]));
+        MlScalar sine = mlSin(angle);
+        MlScalar cosine = mlCos(angle);
+        halfPitch = mlMul(t, halfPitch);
+
+        for (i = 0; i < 3; i++) {
+            step.real[i] = mlMul(axis[i], sine);
+            step.dual[i] = mlMul(moment[i], sine) + mlMul(mlMul(axis[i], halfPitch), cosine);
+        }
+        step.real[3] = cosine;
+        step.dual[3] = -mlMul(halfPitch, sine);
+    }
+
+    MlDualQuat result;
+    quatMul(dq0.real, step.real, result.real);
+    dualMul(dq0.real, dq0.dual, step.real, step.dual, result.dual);
+
+    return result.normalize();
+}
+
+
+MlDualQuat MlDualQuat::blend(const MlDualQuat *dq, const MlScalar *weights, int count)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Dual quaternion linear blending: the normalized weighted sum, with
+//    each transform taken in the hemisphere of the first.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlDualQuat result;
+    int i, j;
+
+    for (j = 0; j < 4; j++) {
+        result.real[j] = mlMul(weights[0], dq[0].real[j]);
+        result.dual[j] = mlMul(weights[0], dq[0].dual[j]);
+    }
+
+    for (i = 1; i < count; i++) {
+        MlScalar w = weights[i];
+        MlScalar c = mlMul(dq[0].real[0], dq[i].real[0]) + mlMul(dq[0].real[1], dq[i].real[1])
+                     + mlMul(dq[0].real[2], dq[i].real[2]) + mlMul(dq[0].real[3], dq[i].real[3]);
+        if (c < ML_SCALAR_ZERO)
+            w = -w;
+        for (j = 0; j < 4; j++) {
+            result.real[j] += mlMul(w, dq[i].real[j]);
+            result.dual[j] += mlMul(w, dq[i].dual[j]);
+        }
+    }
+
+    return result.normalize();
+}
+
+
+MlDualQuat MlDualQuat::identity()
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Returns the identity transform.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    static const MlScalar r[4] = { ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ONE };
+    static const MlScalar d[4] = { ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ZERO };
+
+    return MlDualQuat(r, d);
+}
@@ -51,6 +51,22 @@
 
 #define _ML_FD_BIGNUM 0x7fffffff
 
+// Use a single 64-bit multiply or divide for FixedMultiply(), FixedDivide()
+// and FixedMulDiv() on processors with native 64-bit integer arithmetic.
+// Elsewhere, fall back on the portable versions built from 16-bit partial
+// products and shift/subtract division (or FixedMultiply.s on the SGI).
+
+#ifndef ML_FIXED_WIDE_ARITH
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || \
+    defined(_M_ARM64) || defined(_WIN64) || defined(__LP64__)
+#define ML_FIXED_WIDE_ARITH 1
+#else
+#define ML_FIXED_WIDE_ARITH 0
+#endif
+#endif /* ML_FIXED_WIDE_ARITH */
+
+#if ! ML_FIXED_WIDE_ARITH
+
 // Find the index of the highest bit set in a ulong integer.  Thus
 // if ind = HighBitIndex(A), then A & (1<<ind) is true, but not true
 // for A & (1<<N), for N > ind.
@@ -86,6 +102,8 @@ HighBitIndex(const unsigned long opA)
     return ind;
 }
 
+#endif /* ! ML_FIXED_WIDE_ARITH */
+
 // Don\'t build this in a runtime title, as it requires the C stdio lib.
 #if defined(ML_DEBUG) 
 void 
@@ -114,8 +132,8 @@ FixedPrint( MlScalar number, char *string=NULL )
 int
 FixedAlmostEqual(const MlScalar valA, const MlScalar valB, const int nBitsTol)
 {
-    register long opA = mlScalarGetValue(valA);
-    register long opB = mlScalarGetValue(valB);
+    long opA = mlScalarGetValue(valA);
+    long opB = mlScalarGetValue(valB);
 #if ML_FIXED_CHECK_UNINITIALIZED
     MLE_ASSERT(opA != 0xdeadbeef);
     MLE_ASSERT(opB != 0xdeadbeef);
@@ -169,8 +187,8 @@ FixedEqual(const MlScalar valA, const MlScalar valB)
 int
 FixedEquiv(const MlScalar valA, const MlScalar valB)
 {
-    register long opA = mlScalarGetValue(valA);
-    register long opB = mlScalarGetValue(valB);
+    long opA = mlScalarGetValue(valA);
+    long opB = mlScalarGetValue(valB);
 #if ML_FIXED_CHECK_UNINITIALIZED
     MLE_ASSERT(opA != 0xdeadbeef);
     MLE_ASSERT(opB != 0xdeadbeef);
@@ -265,6 +283,112 @@ FixedShortTableInterp( const short table[],
 }
 
 
+#if ML_FIXED_WIDE_ARITH
+
+// Reduce a 64-bit intermediate result to the 32-bit fixed point format,
+// applying the ML_FIXED_OVERFLOW policy if it does not fit.
+
+static inline long
+FixedNarrow(const long long val)
+{
+#if ML_FIXED_OVERFLOW == ML_FIXED_OVERFLOW_WRAP
+    return (long) (int) val;
+#else
+    if (val > _ML_FD_BIGNUM) {
+#if ML_FIXED_OVERFLOW == ML_FIXED_OVERFLOW_ASSERT
+        MLE_ASSERT(val <= _ML_FD_BIGNUM); // overflow
+#endif
+        return _ML_FD_BIGNUM;
+    }
+    if (val < -_ML_FD_BIGNUM) {
+#if ML_FIXED_OVERFLOW == ML_FIXED_OVERFLOW_ASSERT
+        MLE_ASSERT(val >= -_ML_FD_BIGNUM); // overflow
+#endif
+        return -_ML_FD_BIGNUM;
+    }
+    return (long) val;
+#endif /* ML_FIXED_OVERFLOW == ML_FIXED_OVERFLOW_WRAP */
+}
+
+
+// Divide a 64-bit intermediate by zero. As with the portable version,
+// 0/0 is 1 and anything else is the largest number of the right sign.
+
+static inline MlScalar
+FixedDivideByZero(const long long opA)
+{
+    MLE_ASSERT(opA == 0); // divide by zero
+    if (opA == 0)
+        return ML_SCALAR_ONE;
+    return mlScalarSetValue((opA < 0) ? -_ML_FD_BIGNUM : _ML_FD_BIGNUM);
+}
+
+
+// Multiplication in fixed point using a 64-bit product. The result is
+// truncated toward zero, which matches the portable version.
+MlScalar
+FixedMultiply(const MlScalar valA, const MlScalar valB)
+{
+    long long opA = mlScalarGetValue(valA);
+    long long opB = mlScalarGetValue(valB);
+
+#if ML_FIXED_CHECK_UNINITIALIZED
+    MLE_ASSERT(opA != 0xdeadbeef);
+    MLE_ASSERT(opB != 0xdeadbeef);
+#endif
+    long long prod = opA * opB;
+
+    // Bias negative products so that the arithmetic shift truncates
+    // toward zero rather than toward minus infinity.
+    prod += (prod >> 63) & ((1 << ML_FIXED_RADIX) - 1);
+
+    return mlScalarSetValue(FixedNarrow(prod >> ML_FIXED_RADIX));
+}
+
+
+// Division in fixed point using a 64-bit dividend. The result is
+// truncated toward zero, which matches the portable version.
+MlScalar
+FixedDivide(const MlScalar valA, const MlScalar valB)
+{
+    long long opA = mlScalarGetValue(valA);
+    long long opB = mlScalarGetValue(valB);
+
+#if ML_FIXED_CHECK_UNINITIALIZED
+    MLE_ASSERT(opA != 0xdeadbeef);
+    MLE_ASSERT(opB != 0xdeadbeef);
+#endif
+    if (opB == 0)
+        return FixedDivideByZero(opA);
+
+    return mlScalarSetValue(FixedNarrow((opA * ML_FIXED_SCALE_I) / opB));
+}
+
+
+// (a*b)/c in fixed point. The 64-bit product cannot overflow, so unlike
+// the portable version there is no intermediate over or underflow to
+// work around.
+MlScalar
+FixedMulDiv(const MlScalar valA, const MlScalar valB, const MlScalar valC)
+{
+    long long opA = mlScalarGetValue(valA);
+    long long opB = mlScalarGetValue(valB);
+    long long opC = mlScalarGetValue(valC);
+
+#if ML_FIXED_CHECK_UNINITIALIZED
+    MLE_ASSERT(opA != 0xdeadbeef);
+    MLE_ASSERT(opB != 0xdeadbeef);
+    MLE_ASSERT(opC != 0xdeadbeef);
+#endif
+    long long prod = opA * opB;
+    if (opC == 0)
+        return FixedDivideByZero(prod);
+
+    return mlScalarSetValue(FixedNarrow(prod / opC));
+}
+
+#else /* ML_FIXED_WIDE_ARITH */
+
 #if !(__sgi && ML_FIXED_POINT && !ML_MATH_DEBUG)
 
 // Multiplication in fixed point, with a little bit of multi-radix
@@ -273,8 +397,8 @@ MlScalar
 FixedMultiply(const MlScalar valA, const MlScalar valB)
 {
     MlScalar ans; 
-    register long opA = mlScalarGetValue(valA);
-    register long opB = mlScalarGetValue(valB);
+    long opA = mlScalarGetValue(valA);
+    long opB = mlScalarGetValue(valB);
 
     ans = ML_SCALAR(0);
 
@@ -395,8 +519,8 @@ FixedMultiply(const MlScalar valA, const MlScalar valB)
 MlScalar
 FixedDivide(const MlScalar valA, const MlScalar valB)
 {
-    register long opA = mlScalarGetValue(valA);
-    register long opB = mlScalarGetValue(valB);
+    long opA = mlScalarGetValue(valA);
+    long opB = mlScalarGetValue(valB);
     MlScalar ans;
 
 #if ML_FIXED_CHECK_UNINITIALIZED
@@ -527,13 +651,13 @@ FixedDivide(const MlScalar valA, const MlScalar valB)
 MlScalar
 FixedMulDiv(const MlScalar valA, const MlScalar valB, const MlScalar valC)
 {
-    register long opA = mlScalarGetValue(valA);
-    register long opB = mlScalarGetValue(valB);
+    long opA = mlScalarGetValue(valA);
+    long opB = mlScalarGetValue(valB);
     MlScalar ans;
 #if ML_FIXED_CHECK_UNINITIALIZED
     MLE_ASSERT(opA != 0xdeadbeef);
     MLE_ASSERT(opB != 0xdeadbeef);
-    register long opC = mlScalarGetValue(valC);
+    long opC = mlScalarGetValue(valC);
     MLE_ASSERT(opC != 0xdeadbeef);
 #endif
     int indA = HighBitIndex( opA );
@@ -559,6 +683,8 @@ FixedMulDiv(const MlScalar valA, const MlScalar valB, const MlScalar valC)
     }
     return ans;
 }
+
+#endif /* ML_FIXED_WIDE_ARITH */
 #undef _ML_FD_BIGNUM 
 
 #define LOWER_BIT_MASK ((1 << ML_FIXED_RADIX) - 1)
@@ -568,7 +694,7 @@ FixedMulDiv(const MlScalar valA, const MlScalar valB, const MlScalar valC)
 MlScalar 
 FixedFloor( const MlScalar val )
 {
-    register long opA = mlScalarGetValue(val);
+    long opA = mlScalarGetValue(val);
 #if ML_FIXED_CHECK_UNINITIALIZED
     MLE_ASSERT(opA != 0xdeadbeef);
 #endif
@@ -584,7 +710,7 @@ FixedFloor( const MlScalar val )
 MlScalar 
 FixedCeil( const MlScalar val )
 {
-    register long opA = mlScalarGetValue(val);
+    long opA = mlScalarGetValue(val);
 #if ML_FIXED_CHECK_UNINITIALIZED
     MLE_ASSERT(opA != 0xdeadbeef);
 #endif
@@ -604,7 +730,7 @@ FixedCeil( const MlScalar val )
 MlScalar 
 FixedTrunc( const MlScalar val )
 {
-    register long opA = mlScalarGetValue(val);
+    long opA = mlScalarGetValue(val);
 #if ML_FIXED_CHECK_UNINITIALIZED
     MLE_ASSERT(opA != 0xdeadbeef);
 #endif
@@ -0,0 +1,303 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <stddef.h>
+
+// include Magic Lantern math header files
+#include "math/scalar.h"
+#include "math/vector.h"
+#include "math/transfrm.h"
+#include "math/matrix4.h"
+#include "math/frustum.h"
+#include "vecsimd.h"
+#include "parallel.h"
+
+// Arrays are not split between threads into parts of fewer volumes than
+// this; culling one costs about 0.7 to 1.5 ns.
+#ifndef FRUSTUM_THREAD_MIN
+#define FRUSTUM_THREAD_MIN (16 * 1024)
+#endif
+
+#if ML_VECTOR_SIMD
+// The culling kernels read the planes as raw floats.
+static_assert(sizeof(MlVector4) == 4 * sizeof(float), "MlVector4 must be 4 floats");
+#endif
+
+
+// Sets the planes from a combined view and projection matrix. With row
+// vectors, clip coordinates are p * m, so each plane is the sum or the
+// difference of the last column and one of the others (Gribb and
+// Hartmann).
+
+void MlFrustum::setValue(const MlMatrix4 &m)
+{
+    for (int i = 0; i < 6; i++) {
+        int j = i / 2;
+        MlScalar sign = (i & 1) ? -ML_SCALAR_ONE : ML_SCALAR_ONE;
+        MlVector4 plane(m[0][3] + mlMul(sign, m[0][j]),
+                        m[1][3] + mlMul(sign, m[1][j]),
+                        m[2][3] + mlMul(sign, m[2][j]),
+                        m[3][3] + mlMul(sign, m[3][j]));
+
+        // Scale the normal to unit length, so that the distances can be
+        // compared with radii.
+        MlScalar len = MlVector3(plane[0], plane[1], plane[2]).length();
+        if (len != ML_SCALAR_ZERO)
+            plane.setValue(mlDiv(plane[0], len), mlDiv(plane[1], len),
+                           mlDiv(plane[2], len), mlDiv(plane[3], len));
+        planes[i] = plane;
+    }
+}
+
+
+// Sets the planes of a perspective view.
+
+void MlFrustum::setPerspective(const MlTransform &view, MlScalar fovy, MlScalar aspect,
+                               MlScalar zNear, MlScalar zFar)
+{
+    MlMatrix4 proj;
+    proj.setPerspective(fovy, aspect, zNear, zFar);
+    setValue(MlMatrix4(view) * proj);
+}
+
+
+// Sets the planes of an orthographic view.
+
+void MlFrustum::setOrthographic(const MlTransform &view, MlScalar left, MlScalar right,
+                                MlScalar bottom, MlScalar top, MlScalar zNear, MlScalar zFar)
+{
+    MlMatrix4 proj;
+    proj.setOrthographic(left, right, bottom, top, zNear, zFar);
+    setValue(MlMatrix4(view) * proj);
+}
+
+
+// Returns whether a sphere is not entirely outside one of the planes. The
+// distances are summed in the same order as by the culling kernels.
+
+int MlFrustum::isVisible(const MlVector3 &center, MlScalar radius) const
+{
+    for (int i = 0; i < 6; i++) {
+        const MlVector4 &p = planes[i];
+        if ((mlMul(center[0], p[0]) + mlMul(center[1], p[1])) +
+            (mlMul(center[2], p[2]) + (p[3] + radius)) < ML_SCALAR_ZERO)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+
+// Returns whether a box is not entirely outside one of the planes, by
+// testing its corner furthest along the normal of each.
+
+int MlFrustum::isVisible(const MlVector3 &min, const MlVector3 &max) const
+{
+    for (int i = 0; i < 6; i++) {
+        const MlVector4 &p = planes[i];
+        MlScalar x = (p[0] >= ML_SCALAR_ZERO) ? max[0] : min[0];
+        MlScalar y = (p[1] >= ML_SCALAR_ZERO) ? max[1] : min[1];
+        MlScalar z = (p[2] >= ML_SCALAR_ZERO) ? max[2] : min[2];
+        if ((mlMul(x, p[0]) + mlMul(y, p[1])) + (mlMul(z, p[2]) + p[3]) < ML_SCALAR_ZERO)
+            return FALSE;
+    }
+    return TRUE;
+}
+
+
+// The arguments of a call to cullSpheres() or cullBoxes(), passed to each
+// of its threads. The streams are x, y, z and radius for spheres, and the
+// lowest then the highest coordinates for boxes.
+struct MlFrustumBatch
+{
+    const MlFrustum *frustum;
+    const MlScalar *s[6];
+    unsigned int *mask;
+    int count;
+};
+
+void MlFrustum::cullSphereRange(int first, int last, void *data)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Culls the spheres of the mask words [first, last).
+//
+// Use: private, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlFrustumBatch *batch = (MlFrustumBatch *) data;
+    const MlScalar *const *s = batch->s;
+    int begin = 32 * first;
+    int end = (32 * last < batch->count) ? 32 * last : batch->count;
+
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->cullSpheres((const MlScalar *) batch->frustum->planes,
+                       s[0] + begin, s[1] + begin, s[2] + begin, s[3] + begin,
+                       batch->mask + first, end - begin);
+        return;
+    }
+#endif
+
+    for (int i = begin; i < end; i++) {
+        if ((i & 31) == 0)
+            batch->mask[i >> 5] = 0;
+        if (batch->frustum->isVisible(MlVector3(s[0][i], s[1][i], s[2][i]), s[3][i]))
+            batch->mask[i >> 5] |= 1u << (i & 31);
+    }
+}
+
+
+void MlFrustum::cullBoxRange(int first, int last, void *data)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Culls the boxes of the mask words [first, last).
+//
+// Use: private, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlFrustumBatch *batch = (MlFrustumBatch *) data;
+    const MlScalar *const *s = batch->s;
+    int begin = 32 * first;
+    int end = (32 * last < batch->count) ? 32 * last : batch->count;
+
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->cullBoxes((const MlScalar *) batch->frustum->planes,
+                     s[0] + begin, s[1] + begin, s[2] + begin,
+                     s[3] + begin, s[4] + begin, s[5] + begin,
+                     batch->mask + first, end - begin);
+        return;
+    }
+#endif
+
+    for (int i = begin; i < end; i++) {
+        if ((i & 31) == 0)
+            batch->mask[i >> 5] = 0;
+        if (batch->frustum->isVisible(MlVector3(s[0][i], s[1][i], s[2][i]),
+                                      MlVector3(s[3][i], s[4][i], s[5][i])))
+            batch->mask[i >> 5] |= 1u << (i & 31);
+    }
+}
+
+
+void MlFrustum::cullSpheres(const MlScalar *x, const MlScalar *y, const MlScalar *z,
+                            const MlScalar *radius, int count, unsigned int *mask,
+                            int numThreads) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Culls an array of spheres, splitting the mask words between
+//    threads so that no two threads write the same word.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlFrustumBatch batch = { this, { x, y, z, radius, NULL, NULL }, mask, count };
+
+    mlForEachRange((count + 31) / 32, FRUSTUM_THREAD_MIN / 32, numThreads,
+                   cullSphereRange, &batch);
+}
+
+
+void MlFrustum::cullBoxes(const MlScalar *minX, const MlScalar *minY, const MlScalar *minZ,
+                          const MlScalar *maxX, const MlScalar *maxY, const MlScalar *maxZ,
+                          int count, unsigned int *mask, int numThreads) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Culls an array of boxes, splitting the mask words between threads.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlFrustumBatch batch = { this, { minX, minY, minZ, maxX, maxY, maxZ }, mask, count };
+
+    mlForEachRange((count + 31) / 32, FRUSTUM_THREAD_MIN / 32, numThreads,
+                   cullBoxRange, &batch);
+}
+
+
+int MlFrustum::cullSpheres(const MlScalar *x, const MlScalar *y, const MlScalar *z,
+                           const MlScalar *radius, int count, int *indices,
+                           int numThreads) const
+{
+    unsigned int *mask = new unsigned int[(count + 31) / 32];
+    cullSpheres(x, y, z, radius, count, mask, numThreads);
+    int n = maskToIndices(mask, count, indices);
+    delete [] mask;
+    return n;
+}
+
+
+int MlFrustum::cullBoxes(const MlScalar *minX, const MlScalar *minY, const MlScalar *minZ,
+                         const MlScalar *maxX, const MlScalar *maxY, const MlScalar *maxZ,
+                         int count, int *indices, int numThreads) const
+{
+    unsigned int *mask = new unsigned int[(count + 31) / 32];
+    cullBoxes(minX, minY, minZ, maxX, maxY, maxZ, count, mask, numThreads);
+    int n = maskToIndices(mask, count, indices);
+    delete [] mask;
+    return n;
+}
+
+
+// Lists the set bits of a mask, skipping whole words that are clear.
+
+int MlFrustum::maskToIndices(const unsigned int *mask, int count, int *indices)
+{
+    int n = 0;
+
+    for (int w = 0; 32 * w < count; w++) {
+        unsigned int bits = mask[w];
+        while (bits != 0) {
+#if defined(__GNUC__)
+            int j = __builtin_ctz(bits);
+#else
+            int j = 0;
+            while (((bits >> j) & 1) == 0)
+                j++;
+#endif
+            indices[n++] = 32 * w + j;
+            bits &= bits - 1;
+        }
+    }
+    return n;
+}
@@ -0,0 +1,537 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// include Magic Lantern math header files
+#include "math/scalar.h"
+#include "math/trig.h"
+#include "math/vector.h"
+#include "math/transfrm.h"
+#include "math/matrix4.h"
+#include "vecsimd.h"
+
+// The product of two matrices is too small to be worth a call through the
+// kernel table, so it uses SSE directly in floating-point mode.
+#if ! ML_FIXED_POINT && ! ML_MATH_DEBUG
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+#define ML_MATRIX4_SSE 1
+#include <xmmintrin.h>
+#endif
+#endif /* ! ML_FIXED_POINT && ! ML_MATH_DEBUG */
+
+#if ML_VECTOR_SIMD
+// The kernels read and write the matrices and vectors as raw floats.
+static_assert(sizeof(MlMatrix4) == 16 * sizeof(float), "MlMatrix4 must be 16 floats");
+static_assert(sizeof(MlVector3) == 3 * sizeof(float), "MlVector3 must be 3 floats");
+static_assert(sizeof(MlVector4) == 4 * sizeof(float), "MlVector4 must be 4 floats");
+#endif
+
+
+// Constructor from a 4x4 array of elements.
+
+MlMatrix4::MlMatrix4(const MlScalar m[4][4])
+{
+    setValue(m);
+}
+
+
+// Constructor from an affine transform.
+
+MlMatrix4::MlMatrix4(const MlTransform &t)
+{
+    setValue(t);
+}
+
+
+////////////////////////////////////////////
+//
+// Setting and getting matrix values
+//
+////////////////////////////////////////////
+
+
+// Sets value from 4x4 array of elements.
+
+void MlMatrix4::setValue(const MlScalar m[4][4])
+{
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            matrix[i][j] = m[i][j];
+}
+
+
+// Sets value from an affine transform, with a last column of 0,0,0,1.
+
+void MlMatrix4::setValue(const MlTransform &t)
+{
+    const MlTrans &m = t.getValue();
+    for (int i = 0; i < 4; i++) {
+        matrix[i][0] = m.m[i][0];
+        matrix[i][1] = m.m[i][1];
+        matrix[i][2] = m.m[i][2];
+        matrix[i][3] = (i == 3) ? ML_SCALAR_ONE : ML_SCALAR_ZERO;
+    }
+}
+
+
+// Returns 4x4 array of elements.
+
+void MlMatrix4::getValue(MlScalar m[4][4]) const
+{
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            m[i][j] = matrix[i][j];
+}
+
+
+// Returns the first three columns as an affine transform.
+
+void MlMatrix4::getValue(MlTransform &t) const
+{
+    t = MlTransform(matrix[0][0], matrix[0][1], matrix[0][2],
+                    matrix[1][0], matrix[1][1], matrix[1][2],
+                    matrix[2][0], matrix[2][1], matrix[2][2],
+                    matrix[3][0], matrix[3][1], matrix[3][2]);
+}
+
+
+// Sets matrix to be identity.
+
+void MlMatrix4::makeIdentity()
+{
+    *this = identity();
+}
+
+
+// Returns whether matrix is identity.
+
+int MlMatrix4::isIdentity() const
+{
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            if (matrix[i][j] != ((i == j) ? ML_SCALAR_ONE : ML_SCALAR_ZERO))
+                return FALSE;
+    return TRUE;
+}
+
+
+// Returns whether the last column is 0,0,0,1.
+
+int MlMatrix4::isAffine() const
+{
+    return (matrix[0][3] == ML_SCALAR_ZERO &&
+            matrix[1][3] == ML_SCALAR_ZERO &&
+            matrix[2][3] == ML_SCALAR_ZERO &&
+            matrix[3][3] == ML_SCALAR_ONE);
+}
+
+
+////////////////////////////////////////////
+//
+// Operators
+//
+////////////////////////////////////////////
+
+
+// Binary multiplication of matrices.
+
+MlMatrix4 operator *(const MlMatrix4 &l, const MlMatrix4 &r)
+{
+    MlMatrix4 m = l;
+
+    m *= r;
+
+    return m;
+}
+
+
+// Equality comparison operator. All componenents must match exactly.
+
+int operator ==(const MlMatrix4 &m1, const MlMatrix4 &m2)
+{
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            if (m1.matrix[i][j] != m2.matrix[i][j])
+                return FALSE;
+    return TRUE;
+}
+
+
+// Equality comparison operator within given tolerance for each component.
+
+int MlMatrix4::equals(const MlMatrix4 &m, MlScalar tolerance) const
+{
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            if (mlAbs(matrix[i][j] - m.matrix[i][j]) > tolerance)
+                return FALSE;
+    return TRUE;
+}
+
+
+////////////////////////////////////////////
+//
+// Determinant, inverse and transpose
+//
+////////////////////////////////////////////
+
+
+// The 2x2 determinants of the upper two rows, s, and of the lower two
+// rows, c, from which the determinant and the cofactors are built. Each
+// is made of the columns given in its comment.
+
+static void subDeterminants(const MlScalar a[4][4], MlScalar s[6], MlScalar c[6])
+{
+    s[0] = mlMul(a[0][0], a[1][1]) - mlMul(a[1][0], a[0][1]);   // 0 1
+    s[1] = mlMul(a[0][0], a[1][2]) - mlMul(a[1][0], a[0][2]);   // 0 2
+    s[2] = mlMul(a[0][0], a[1][3]) - mlMul(a[1][0], a[0][3]);   // 0 3
+    s[3] = mlMul(a[0][1], a[1][2]) - mlMul(a[1][1], a[0][2]);   // 1 2
+    s[4] = mlMul(a[0][1], a[1][3]) - mlMul(a[1][1], a[0][3]);   // 1 3
+    s[5] = mlMul(a[0][2], a[1][3]) - mlMul(a[1][2], a[0][3]);   // 2 3
+
+    c[0] = mlMul(a[2][0], a[3][1]) - mlMul(a[3][0], a[2][1]);   // 0 1
+    c[1] = mlMul(a[2][0], a[3][2]) - mlMul(a[3][0], a[2][2]);   // 0 2
+    c[2] = mlMul(a[2][0], a[3][3]) - mlMul(a[3][0], a[2][3]);   // 0 3
+    c[3] = mlMul(a[2][1], a[3][2]) - mlMul(a[3][1], a[2][2]);   // 1 2
+    c[4] = mlMul(a[2][1], a[3][3]) - mlMul(a[3][1], a[2][3]);   // 1 3
+    c[5] = mlMul(a[2][2], a[3][3]) - mlMul(a[3][2], a[2][3]);   // 2 3
+}
+
+
+// Each product pairs a determinant of the upper rows with the one of the
+// lower rows over the complementary columns (Laplace expansion).
+
+static MlScalar determinant(const MlScalar s[6], const MlScalar c[6])
+{
+    return mlMul(s[0], c[5]) - mlMul(s[1], c[4]) + mlMul(s[2], c[3]) +
+           mlMul(s[3], c[2]) - mlMul(s[4], c[1]) + mlMul(s[5], c[0]);
+}
+
+
+// Returns determinant of matrix.
+
+MlScalar MlMatrix4::det() const
+{
+    MlScalar s[6], c[6];
+    subDeterminants(matrix, s, c);
+    return determinant(s, c);
+}
+
+
+// Returns inverse of matrix. Affine matrices are inverted by
+// MlTransform::inverse(), which handles only the upper-left 3x3 part,
+// and the others by the adjugate built from the 2x2 determinants of
+// subDeterminants(). A singular matrix is returned unchanged.
+
+MlMatrix4 MlMatrix4::inverse() const
+{
+    if (isAffine()) {
+        MlTransform t;
+        getValue(t);
+        return MlMatrix4(t.inverse());
+    }
+
+    MlScalar s[6], c[6];
+    subDeterminants(matrix, s, c);
+    MlScalar d = determinant(s, c);
+    if (d == ML_SCALAR_ZERO)
+        return *this;
+
+    const MlScalar (*a)[4] = matrix;
+    MlScalar r[4][4];
+
+    r[0][0] =  mlMul(a[1][1], c[5]) - mlMul(a[1][2], c[4]) + mlMul(a[1][3], c[3]);
+    r[0][1] = -mlMul(a[0][1], c[5]) + mlMul(a[0][2], c[4]) - mlMul(a[0][3], c[3]);
+    r[0][2] =  mlMul(a[3][1], s[5]) - mlMul(a[3][2], s[4]) + mlMul(a[3][3], s[3]);
+    r[0][3] = -mlMul(a[2][1], s[5]) + mlMul(a[2][2], s[4]) - mlMul(a[2][3], s[3]);
+
+    r[1][0] = -mlMul(a[1][0], c[5]) + mlMul(a[1][2], c[2]) - mlMul(a[1][3], c[1]);
+    r[1][1] =  mlMul(a[0][0], c[5]) - mlMul(a[0][2], c[2]) + mlMul(a[0][3], c[1]);
+    r[1][2] = -mlMul(a[3][0], s[5]) + mlMul(a[3][2], s[2]) - mlMul(a[3][3], s[1]);
+    r[1][3] =  mlMul(a[2][0], s[5]) - mlMul(a[2][2], s[2]) + mlMul(a[2][3], s[1]);
+
+    r[2][0] =  mlMul(a[1][0], c[4]) - mlMul(a[1][1], c[2]) + mlMul(a[1][3], c[0]);
+    r[2][1] = -mlMul(a[0][0], c[4]) + mlMul(a[0][1], c[2]) - mlMul(a[0][3], c[0]);
+    r[2][2] =  mlMul(a[3][0], s[4]) - mlMul(a[3][1], s[2]) + mlMul(a[3][3], s[0]);
+    r[2][3] = -mlMul(a[2][0], s[4]) + mlMul(a[2][1], s[2]) - mlMul(a[2][3], s[0]);
+
+    r[3][0] = -mlMul(a[1][0], c[3]) + mlMul(a[1][1], c[1]) - mlMul(a[1][2], c[0]);
+    r[3][1] =  mlMul(a[0][0], c[3]) - mlMul(a[0][1], c[1]) + mlMul(a[0][2], c[0]);
+    r[3][2] = -mlMul(a[3][0], s[3]) + mlMul(a[3][1], s[1]) - mlMul(a[3][2], s[0]);
+    r[3][3] =  mlMul(a[2][0], s[3]) - mlMul(a[2][1], s[1]) + mlMul(a[2][2], s[0]);
+
+    // In fixed point, divide rather than multiply by the reciprocal, which
+    // loses too much when the determinant is large.
+#if ML_FIXED_POINT
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            r[i][j] = mlDiv(r[i][j], d);
+#else
+    MlScalar dr = mlReciprocal(d);
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            r[i][j] = mlMul(r[i][j], dr);
+#endif
+
+    return MlMatrix4(r);
+}
+
+
+// Returns transpose of matrix.
+
+MlMatrix4 MlMatrix4::transpose() const
+{
+    return MlMatrix4(matrix[0][0], matrix[1][0], matrix[2][0], matrix[3][0],
+                     matrix[0][1], matrix[1][1], matrix[2][1], matrix[3][1],
+                     matrix[0][2], matrix[1][2], matrix[2][2], matrix[3][2],
+                     matrix[0][3], matrix[1][3], matrix[2][3], matrix[3][3]);
+}
+
+
+////////////////////////////////////////////
+//
+// Matrix/matrix and matrix/vector arithmetic
+//
+////////////////////////////////////////////
+
+
+// Multiplies count rows of 4 elements, v, by the matrix m. The result
+// may be stored over v.
+
+static void multRows(const MlScalar m[4][4], const MlScalar *v, MlScalar *r, int count)
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->mult4(&m[0][0], v, r, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++, v += 4, r += 4) {
+        MlScalar a0 = v[0], a1 = v[1], a2 = v[2], a3 = v[3];
+        for (int j = 0; j < 4; j++)
+            r[j] = mlMul(a0, m[0][j]) + mlMul(a1, m[1][j]) +
+                   mlMul(a2, m[2][j]) + mlMul(a3, m[3][j]);
+    }
+}
+
+
+// Multiplies a by b, giving r, which may be the same as either.
+
+static void mult(const MlScalar a[4][4], const MlScalar b[4][4], MlScalar r[4][4])
+{
+#if defined(ML_MATRIX4_SSE)
+    const __m128 b0 = _mm_loadu_ps(b[0]), b1 = _mm_loadu_ps(b[1]);
+    const __m128 b2 = _mm_loadu_ps(b[2]), b3 = _mm_loadu_ps(b[3]);
+    __m128 rows[4];
+
+    for (int i = 0; i < 4; i++)
+        rows[i] = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[i][0]), b0),
+                                        _mm_mul_ps(_mm_set1_ps(a[i][1]), b1)),
+                             _mm_add_ps(_mm_mul_ps(_mm_set1_ps(a[i][2]), b2),
+                                        _mm_mul_ps(_mm_set1_ps(a[i][3]), b3)));
+    for (int i = 0; i < 4; i++)
+        _mm_storeu_ps(r[i], rows[i]);
+#else
+    MlScalar tmp[4][4];
+
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            tmp[i][j] = mlMul(a[i][0], b[0][j]) + mlMul(a[i][1], b[1][j]) +
+                        mlMul(a[i][2], b[2][j]) + mlMul(a[i][3], b[3][j]);
+    for (int i = 0; i < 4; i++)
+        for (int j = 0; j < 4; j++)
+            r[i][j] = tmp[i][j];
+#endif
+}
+
+
+// Multiplies matrix by given matrix on right.
+
+MlMatrix4 &MlMatrix4::multRight(const MlMatrix4 &m)
+{
+    mult(matrix, m.matrix, matrix);
+    return *this;
+}
+
+
+// Multiplies matrix by given matrix on left.
+
+MlMatrix4 &MlMatrix4::multLeft(const MlMatrix4 &m)
+{
+    mult(m.matrix, matrix, matrix);
+    return *this;
+}
+
+
+// Multiplies given row vector, with a w of 1, by matrix and divides the
+// result by its w
+
+void MlMatrix4::multVecMatrix(const MlVector3 &src, MlVector3 &dst) const
+{
+    MlScalar x, y, z, w;
+
+    x = mlMul(src[0], matrix[0][0]) + mlMul(src[1], matrix[1][0]) +
+        mlMul(src[2], matrix[2][0]) + matrix[3][0];
+    y = mlMul(src[0], matrix[0][1]) + mlMul(src[1], matrix[1][1]) +
+        mlMul(src[2], matrix[2][1]) + matrix[3][1];
+    z = mlMul(src[0], matrix[0][2]) + mlMul(src[1], matrix[1][2]) +
+        mlMul(src[2], matrix[2][2]) + matrix[3][2];
+    w = mlMul(src[0], matrix[0][3]) + mlMul(src[1], matrix[1][3]) +
+        mlMul(src[2], matrix[2][3]) + matrix[3][3];
+
+    MlScalar wr = mlReciprocal(w);
+    dst.setValue(mlMul(x, wr), mlMul(y, wr), mlMul(z, wr));
+}
+
+
+// Multiplies given homogeneous row vector by matrix
+
+void MlMatrix4::multVecMatrix(const MlVector4 &src, MlVector4 &dst) const
+{
+    MlScalar v[4] = { src[0], src[1], src[2], src[3] };
+    MlScalar r[4];
+
+    for (int j = 0; j < 4; j++)
+        r[j] = mlMul(v[0], matrix[0][j]) + mlMul(v[1], matrix[1][j]) +
+               mlMul(v[2], matrix[2][j]) + mlMul(v[3], matrix[3][j]);
+
+    dst.setValue(r);
+}
+
+
+// Multiplies given direction vector by the upper-left 3x3 part of the
+// matrix
+
+void MlMatrix4::multDirMatrix(const MlVector3 &src, MlVector3 &dst) const
+{
+    MlScalar x, y, z;
+
+    x = mlMul(src[0], matrix[0][0]) + mlMul(src[1], matrix[1][0]) + mlMul(src[2], matrix[2][0]);
+    y = mlMul(src[0], matrix[0][1]) + mlMul(src[1], matrix[1][1]) + mlMul(src[2], matrix[2][1]);
+    z = mlMul(src[0], matrix[0][2]) + mlMul(src[1], matrix[1][2]) + mlMul(src[2], matrix[2][2]);
+
+    dst.setValue(x, y, z);
+}
+
+
+////////////////////////////////////////////
+//
+// Batch matrix/vector arithmetic
+//
+////////////////////////////////////////////
+
+
+// Multiplies given array of points by matrix, dividing each by its w
+
+void MlMatrix4::multVecMatrixBatch(const MlVector3 *src, MlVector3 *dst, int count) const
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->project(&matrix[0][0], (const MlScalar *) src, (MlScalar *) dst, count, TRUE);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        multVecMatrix(src[i], dst[i]);
+}
+
+
+// Multiplies given array of points by matrix, giving homogeneous results
+
+void MlMatrix4::multVecMatrixBatch(const MlVector3 *src, MlVector4 *dst, int count) const
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->project(&matrix[0][0], (const MlScalar *) src, (MlScalar *) dst, count, FALSE);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        multVecMatrix(MlVector4(src[i][0], src[i][1], src[i][2], ML_SCALAR_ONE), dst[i]);
+}
+
+
+// Multiplies given array of homogeneous vectors by matrix
+
+void MlMatrix4::multVecMatrixBatch(const MlVector4 *src, MlVector4 *dst, int count) const
+{
+    multRows(matrix, (const MlScalar *) src, (MlScalar *) dst, count);
+}
+
+
+////////////////////////////////////////////
+//
+// Projections
+//
+////////////////////////////////////////////
+
+
+// Sets matrix to the perspective projection of gluPerspective(), with the
+// field of view in radians.
+
+void MlMatrix4::setPerspective(MlScalar fovy, MlScalar aspect, MlScalar zNear, MlScalar zFar)
+{
+    MlScalar s, c;
+    mlSinCos(mlRadiansToAngle(mlMul(fovy, ML_SCALAR_HALF)), s, c);
+    MlScalar f = mlDiv(c, s);
+    MlScalar depth = zNear - zFar;
+
+    makeIdentity();
+    matrix[0][0] = mlDiv(f, aspect);
+    matrix[1][1] = f;
+    matrix[2][2] = mlDiv(zFar + zNear, depth);
+    matrix[2][3] = -ML_SCALAR_ONE;
+    matrix[3][2] = mlDiv(mlMul(ML_SCALAR(2.0f), mlMul(zFar, zNear)), depth);
+    matrix[3][3] = ML_SCALAR_ZERO;
+}
+
+
+// Sets matrix to the orthographic projection of glOrtho().
+
+void MlMatrix4::setOrthographic(MlScalar left, MlScalar right, MlScalar bottom, MlScalar top,
+                                MlScalar zNear, MlScalar zFar)
+{
+    MlScalar width = right - left;
+    MlScalar height = top - bottom;
+    MlScalar depth = zFar - zNear;
+
+    makeIdentity();
+    matrix[0][0] = mlDiv(ML_SCALAR(2.0f), width);
+    matrix[1][1] = mlDiv(ML_SCALAR(2.0f), height);
+    matrix[2][2] = -mlDiv(ML_SCALAR(2.0f), depth);
+    matrix[3][0] = -mlDiv(right + left, width);
+    matrix[3][1] = -mlDiv(top + bottom, height);
+    matrix[3][2] = -mlDiv(zFar + zNear, depth);
+}
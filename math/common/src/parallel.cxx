@@ -0,0 +1,181 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+// Include Magic Lantern math header files.
+#include "parallel.h"
+
+
+// A call to mlForEachRange(), split into numRanges ranges of range
+// elements. Threads claim the ranges in turn from next, and count those
+// they have finished in done, under the lock of the pool.
+struct MlRangeJob
+{
+    void (*op)(int first, int last, void *data);
+    void *data;
+    int count;
+    int range;
+    int numRanges;
+    std::atomic<int> next;
+    int done;
+};
+
+// The workers shared by every call, and the jobs with ranges left to
+// claim, oldest first. The pool grows to the most threads asked for, and
+// is never destroyed: its workers wait for jobs until the process exits,
+// so that no call pays to start or join a thread.
+struct MlThreadPool
+{
+    std::mutex lock;
+    std::condition_variable work;
+    std::condition_variable finished;
+    std::deque<MlRangeJob *> jobs;
+    int numWorkers;
+
+    MlThreadPool() : numWorkers(0) {}
+};
+
+static MlThreadPool *
+getPool()
+{
+    static MlThreadPool *pool = new MlThreadPool;
+    return pool;
+}
+
+
+// Runs one range of a job.
+
+static inline void
+runRange(MlRangeJob *job, int i)
+{
+    int first = i * job->range;
+    int last = (first + job->range < job->count) ? first + job->range : job->count;
+    if (first < last)
+        (*job->op)(first, last, job->data);
+}
+
+
+// The loop of each worker, which runs the ranges of the oldest job until
+// they are all claimed, then moves on to the next.
+
+static void
+workerLoop(MlThreadPool *pool)
+{
+    std::unique_lock<std::mutex> guard(pool->lock);
+
+    for (;;) {
+        while (pool->jobs.empty())
+            pool->work.wait(guard);
+
+        MlRangeJob *job = pool->jobs.front();
+        int i = job->next++;
+        if (i >= job->numRanges - 1)
+            pool->jobs.pop_front();
+        if (i >= job->numRanges)
+            continue;
+
+        guard.unlock();
+        runRange(job, i);
+        guard.lock();
+        if (++job->done == job->numRanges)
+            pool->finished.notify_all();
+    }
+}
+
+
+void
+mlForEachRange(int count, int minRange, int numThreads,
+               void (*op)(int first, int last, void *data), void *data)
+{
+    if (numThreads <= 0)
+        numThreads = (int) std::thread::hardware_concurrency();
+    int maxThreads = (count + minRange - 1) / minRange;
+    if (numThreads > maxThreads)
+        numThreads = maxThreads;
+
+    if (numThreads <= 1) {
+        if (count > 0)
+            (*op)(0, count, data);
+        return;
+    }
+
+    MlRangeJob job;
+    job.op = op;
+    job.data = data;
+    job.count = count;
+    job.range = (count + numThreads - 1) / numThreads;
+    job.numRanges = numThreads;
+    job.next = 0;
+    job.done = 0;
+
+    // Queue the job, starting any workers still missing, and wake enough
+    // workers for the ranges this thread will not run itself.
+    MlThreadPool *pool = getPool();
+    int i;
+    {
+        std::lock_guard<std::mutex> guard(pool->lock);
+        while (pool->numWorkers < numThreads - 1) {
+            std::thread(workerLoop, pool).detach();
+            pool->numWorkers++;
+        }
+        pool->jobs.push_back(&job);
+    }
+    for (i = 1; i < numThreads; i++)
+        pool->work.notify_one();
+
+    // Run ranges here too, so that the job finishes even if every worker
+    // is busy, then wait for those the workers claimed.
+    int done = 0;
+    while ((i = job.next++) < job.numRanges) {
+        runRange(&job, i);
+        done++;
+    }
+
+    std::unique_lock<std::mutex> guard(pool->lock);
+    for (std::deque<MlRangeJob *>::iterator it = pool->jobs.begin();
+         it != pool->jobs.end(); ++it) {
+        if (*it == &job) {
+            pool->jobs.erase(it);
+            break;
+        }
+    }
+    job.done += done;
+    while (job.done < job.numRanges)
+        pool->finished.wait(guard);
+}
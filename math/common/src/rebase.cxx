@@ -0,0 +1,89 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// include Magic Lantern math header files
+#include "math/scalar.h"
+#include "math/scalart.h"
+#include "math/vector.h"
+#include "math/transfrm.h"
+#include "math/vectort.h"
+#include "math/transfrmt.h"
+#include "math/rebase.h"
+#include "vecsimd.h"
+
+#if ML_VECTOR_SIMD
+// The rebase kernel reads and writes the arrays as raw doubles and floats.
+static_assert(sizeof(MlVector3d) == 3 * sizeof(double), "MlVector3d must be 3 doubles");
+static_assert(sizeof(MlTransformd) == 12 * sizeof(double), "MlTransformd must be 12 doubles");
+static_assert(sizeof(MlVector3) == 3 * sizeof(float), "MlVector3 must be 3 floats");
+static_assert(sizeof(MlTransform) == 12 * sizeof(float), "MlTransform must be 12 floats");
+#endif
+
+
+void
+mlRebaseBatch( const MlVector3d *src, const MlVector3d &origin, MlVector3 *dst, int count )
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->rebase((const double *) src, origin.getValue(), (float *) dst, count, 3);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        dst[i].setValue(mlScalarToNative(src[i][0] - origin[0]),
+                        mlScalarToNative(src[i][1] - origin[1]),
+                        mlScalarToNative(src[i][2] - origin[2]));
+}
+
+
+void
+mlRebaseBatch( const MlTransformd *src, const MlVector3d &origin, MlTransform *dst, int count )
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        // Only the translation, the last row, is moved.
+        const double o[12] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, origin[0], origin[1], origin[2] };
+        k->rebase((const double *) src, o, (float *) dst, count, 12);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++) {
+        for (int r = 0; r < 3; r++)
+            for (int c = 0; c < 3; c++)
+                dst[i][r][c] = mlScalarToNative(src[i][r][c]);
+        for (int c = 0; c < 3; c++)
+            dst[i][3][c] = mlScalarToNative(src[i][3][c] - origin[c]);
+    }
+}
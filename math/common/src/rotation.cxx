@@ -42,15 +42,7 @@
 #include "math/vector.h"
 #include "math/rotation.h"
 #include "math/transfrm.h"
-
-
- MlRotation::MlRotation(const MlRotation &rot)
- {
-     quat[0] = rot.quat[0];
-     quat[1] = rot.quat[1];
-     quat[2] = rot.quat[2];
-     quat[3] = rot.quat[3];
- }
+#include "vecsimd.h"
 
 
 void MlRotation::getValue(MlScalar& q0, MlScalar& q1, MlScalar& q2, MlScalar& q3) const
@@ -449,23 +441,6 @@ MlRotation& MlRotation::operator *= (const MlRotation& q)
 }
 
 
-int operator == (const MlRotation& q1, const MlRotation& q2)
-////////////////////////////////////////////////////////////////////////
-//
-// Description:
-//    Equality comparison operator.
-//
-// Use: public
-//
-////////////////////////////////////////////////////////////////////////
-{
-    return (q1.quat[0] == q2.quat[0] &&
-            q1.quat[1] == q2.quat[1] &&
-            q1.quat[2] == q2.quat[2] &&
-            q1.quat[3] == q2.quat[3]);
-}
-
-
 int MlRotation::equals(const MlRotation& r, MlScalar tolerance) const
 ////////////////////////////////////////////////////////////////////////
 //
@@ -481,33 +456,6 @@ int MlRotation::equals(const MlRotation& r, MlScalar tolerance) const
 }
 
 
-MlRotation operator* (const MlRotation& q1, const MlRotation& q2)
-////////////////////////////////////////////////////////////////////////
-//
-// Description:
-//    Binary multiplication operator.
-//
-// Use: public
-//
-////////////////////////////////////////////////////////////////////////
-{
-    MlRotation q(mlMul(q2.quat[3], q1.quat[0]) + mlMul(q2.quat[0], q1.quat[3]) +
-                 mlMul(q2.quat[1], q1.quat[2]) - mlMul(q2.quat[2], q1.quat[1]),
-
-                 mlMul(q2.quat[3], q1.quat[1]) + mlMul(q2.quat[1], q1.quat[3]) +
-                 mlMul(q2.quat[2], q1.quat[0]) - mlMul(q2.quat[0], q1.quat[2]),
-
-                 mlMul(q2.quat[3], q1.quat[2]) + mlMul(q2.quat[2], q1.quat[3]) +
-                 mlMul(q2.quat[0], q1.quat[1]) - mlMul(q2.quat[1], q1.quat[0]),
-
-                 mlMul(q2.quat[3], q1.quat[3]) - mlMul(q2.quat[0], q1.quat[0]) -
-                 mlMul(q2.quat[1], q1.quat[1]) - mlMul(q2.quat[2], q1.quat[2]));
-    q.normalize();
-
-    return (q);
-}
-
-
 void MlRotation::multVec(const MlVector3& src, MlVector3& dst) const
 ////////////////////////////////////////////////////////////////////////
 //
@@ -601,38 +549,582 @@ MlRotation MlRotation::slerp(const MlRotation& rot0, const MlRotation& rot1, MlS
 }
 
 
-MlScalar MlRotation::norm() const
+// The coefficients of the slerp polynomial, after "A Fast and Accurate
+// Algorithm for Computing SLERP" by David Eberly. sin(t*a)/sin(a) is
+// approximated in x = cos(a) as t*(1 + b1*(1 + b2*(... (1 + bn)))), with
+// bi = (ui*t*t - vi)*(x - 1), ui = 1/(i*(2*i + 1)) and vi = i/(2*i + 1).
+// The last pair is scaled to balance the error of the truncation, which is
+// 1.5e-7 for 14 terms and 1.9e-5 for 8. The pairs are stored in order,
+// ui before vi.
+#if ML_FIXED_POINT
+
+// Fixed point scalars are evaluated with 30 fraction bits in 64-bit
+// integers, which is both faster and more precise than going through
+// mlMul().
+#define SLERP_TERMS 8
+#define SLERP_ONE   (1LL << 30)
+#define SLERP_Q30(x) ((long long) ((x) * 1073741824.0 + 0.5))
+
+static const long long slerpCoeffs[2 * SLERP_TERMS] =
+{
+    SLERP_Q30(0.333333333), SLERP_Q30(0.333333333),
+    SLERP_Q30(0.1), SLERP_Q30(0.4),
+    SLERP_Q30(0.0476190476), SLERP_Q30(0.428571429),
+    SLERP_Q30(0.0277777778), SLERP_Q30(0.444444444),
+    SLERP_Q30(0.0181818182), SLERP_Q30(0.454545455),
+    SLERP_Q30(0.0128205128), SLERP_Q30(0.461538462),
+    SLERP_Q30(0.00952380952), SLERP_Q30(0.466666667),
+    SLERP_Q30(0.013624861), SLERP_Q30(0.871991101)
+};
+
+
+// Evaluates sin(t*a)/sin(a) for xm1 = cos(a) - 1 with the slerp polynomial;
+// all three have 30 fraction bits.
+static inline long long
+slerpWeight(long long t, long long xm1)
+{
+    long long tt = (t * t) >> 30;
+    const long long *c = slerpCoeffs + 2 * (SLERP_TERMS - 1);
+    long long f = SLERP_ONE + ((((c[0] * tt) >> 30) - c[1]) * xm1 >> 30);
+
+    while (c != slerpCoeffs) {
+        c -= 2;
+        long long b = (((c[0] * tt) >> 30) - c[1]) * xm1 >> 30;
+        f = SLERP_ONE + ((b * f) >> 30);
+    }
+    return (t * f) >> 30;
+}
+
+#else
+
+#define SLERP_TERMS 14
+
+static const MlScalar slerpCoeffs[2 * SLERP_TERMS] =
+{
+    ML_SCALAR(0.333333333f), ML_SCALAR(0.333333333f),
+    ML_SCALAR(0.1f), ML_SCALAR(0.4f),
+    ML_SCALAR(0.0476190476f), ML_SCALAR(0.428571429f),
+    ML_SCALAR(0.0277777778f), ML_SCALAR(0.444444444f),
+    ML_SCALAR(0.0181818182f), ML_SCALAR(0.454545455f),
+    ML_SCALAR(0.0128205128f), ML_SCALAR(0.461538462f),
+    ML_SCALAR(0.00952380952f), ML_SCALAR(0.466666667f),
+    ML_SCALAR(0.00735294118f), ML_SCALAR(0.470588235f),
+    ML_SCALAR(0.00584795322f), ML_SCALAR(0.473684211f),
+    ML_SCALAR(0.00476190476f), ML_SCALAR(0.476190476f),
+    ML_SCALAR(0.00395256917f), ML_SCALAR(0.47826087f),
+    ML_SCALAR(0.00333333333f), ML_SCALAR(0.48f),
+    ML_SCALAR(0.00284900285f), ML_SCALAR(0.481481481f),
+    ML_SCALAR(0.0046960484f), ML_SCALAR(0.920425486f)
+};
+
+
+// Evaluates sin(t*a)/sin(a) for xm1 = cos(a) - 1 with the slerp polynomial.
+static inline MlScalar
+slerpWeight(MlScalar t, MlScalar xm1)
+{
+    MlScalar tt = mlSquare(t);
+    const MlScalar *c = slerpCoeffs + 2 * (SLERP_TERMS - 1);
+    MlScalar f = ML_SCALAR_ONE + mlMul(mlMul(c[0], tt) - c[1], xm1);
+
+    while (c != slerpCoeffs) {
+        c -= 2;
+        f = ML_SCALAR_ONE + mlMul(mlMul(mlMul(c[0], tt) - c[1], xm1), f);
+    }
+    return mlMul(t, f);
+}
+
+#endif /* ML_FIXED_POINT */
+
+
+void MlRotation::slerpBatch(const MlRotation *rot0, const MlRotation *rot1,
+                            const MlScalar *t, MlRotation *result, int count)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Spherical linear interpolation of arrays of rotations, using the
+//    slerp polynomial in place of acos() and sin().
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->slerp((const MlScalar *) rot0, (const MlScalar *) rot1, t,
+                 (MlScalar *) result, count, slerpCoeffs, SLERP_TERMS);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++) {
+        const MlScalar *q0 = rot0[i].quat;
+        const MlScalar *q1 = rot1[i].quat;
+        MlScalar *r = result[i].quat;
+        int j;
+
+#if ML_FIXED_POINT
+        long long a[4], b[4], cosom = 0;
+        for (j = 0; j < 4; j++) {
+            a[j] = mlScalarGetValue(q0[j]);
+            b[j] = mlScalarGetValue(q1[j]);
+            cosom += a[j] * b[j];
+        }
+
+        // Bring the cosine and t to 30 fraction bits.
+#if 2*ML_FIXED_RADIX >= 30
+        cosom >>= 2*ML_FIXED_RADIX - 30;
+#else
+        cosom <<= 30 - 2*ML_FIXED_RADIX;
+#endif
+        long long w = (long long) mlScalarGetValue(t[i]) << (30 - ML_FIXED_RADIX);
+
+        // The weights are computed for the shorter path, and the
+        // sign of rot1 applied to its weight.
+        long long xm1 = ((cosom < 0) ? -cosom : cosom) - SLERP_ONE;
+        if (xm1 > 0)
+            xm1 = 0;
+        long long scalerot0 = slerpWeight(SLERP_ONE - w, xm1);
+        long long scalerot1 = slerpWeight(w, xm1);
+        if (cosom < 0)
+            scalerot1 = -scalerot1;
+
+        for (j = 0; j < 4; j++)
+            r[j] = mlScalarSetValue((long) ((scalerot0 * a[j] + scalerot1 * b[j]
+                                             + (SLERP_ONE >> 1)) >> 30));
+#else
+        MlScalar cosom, scalerot0, scalerot1, q[4];
+
+        cosom = mlMul(q0[0], q1[0]) + mlMul(q0[1], q1[1])
+                + mlMul(q0[2], q1[2]) + mlMul(q0[3], q1[3]);
+
+        // The weights are computed for the shorter path, and the
+        // sign of rot1 applied to its weight.
+        scalerot0 = slerpWeight(ML_SCALAR_ONE - t[i], mlAbs(cosom) - ML_SCALAR_ONE);
+        scalerot1 = slerpWeight(t[i], mlAbs(cosom) - ML_SCALAR_ONE);
+        if (cosom < ML_SCALAR_ZERO)
+            scalerot1 = -scalerot1;
+
+        for (j = 0; j < 4; j++)
+            q[j] = mlMul(scalerot0, q0[j]) + mlMul(scalerot1, q1[j]);
+        for (j = 0; j < 4; j++)
+            r[j] = q[j];
+#endif /* ML_FIXED_POINT */
+    }
+}
+
+
+MlRotation MlRotation::nlerp(const MlRotation& rot0, const MlRotation& rot1, MlScalar t)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Normalized linear interpolation: as t goes from 0 to 1, returned
+//    value goes from rot0 to rot1 along the shorter path.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlRotation  rot;
+    MlScalar    cosom, scalerot0, scalerot1;
+    int         i;
+
+    cosom = mlMul(rot0.quat[0], rot1.quat[0]) + mlMul(rot0.quat[1], rot1.quat[1])
+            + mlMul(rot0.quat[2], rot1.quat[2]) + mlMul(rot0.quat[3], rot1.quat[3]);
+
+    scalerot0 = ML_SCALAR_ONE - t;
+    scalerot1 = (cosom < ML_SCALAR_ZERO) ? -t : t;
+
+    for (i = 0; i < 4; i++)
+        rot.quat[i] = mlMul(scalerot0, rot0.quat[i]) + mlMul(scalerot1, rot1.quat[i]);
+    rot.normalize();
+
+    return rot;
+}
+
+
+void MlRotation::nlerpBatch(const MlRotation *rot0, const MlRotation *rot1,
+                            const MlScalar *t, MlRotation *result, int count)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Normalized linear interpolation of arrays of rotations.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->nlerp((const MlScalar *) rot0, (const MlScalar *) rot1, t,
+                 (MlScalar *) result, count);
+        return;
+    }
+#endif
+#if ML_FIXED_POINT
+    // As slerpBatch(), the interpolation is carried out on the raw
+    // values, leaving one call to mlRecipSqrt() for each rotation.
+    for (int i = 0; i < count; i++) {
+        const MlScalar *q0 = rot0[i].quat;
+        const MlScalar *q1 = rot1[i].quat;
+        MlScalar *r = result[i].quat;
+        long long a[4], b[4], q[4], cosom = 0, n = 0;
+        int j;
+
+        for (j = 0; j < 4; j++) {
+            a[j] = mlScalarGetValue(q0[j]);
+            b[j] = mlScalarGetValue(q1[j]);
+            cosom += a[j] * b[j];
+        }
+
+        long long scalerot1 = mlScalarGetValue(t[i]);
+        long long scalerot0 = (1LL << ML_FIXED_RADIX) - scalerot1;
+        if (cosom < 0)
+            scalerot1 = -scalerot1;
+
+        for (j = 0; j < 4; j++) {
+            q[j] = (scalerot0 * a[j] + scalerot1 * b[j]) >> ML_FIXED_RADIX;
+            n += q[j] * q[j];
+        }
+
+        long long dist = mlScalarGetValue(mlRecipSqrt(mlScalarSetValue((long) (n >> ML_FIXED_RADIX))));
+        for (j = 0; j < 4; j++)
+            r[j] = mlScalarSetValue((long) ((q[j] * dist) >> ML_FIXED_RADIX));
+    }
+#else
+    for (int i = 0; i < count; i++)
+        result[i] = nlerp(rot0[i], rot1[i], t[i]);
+#endif /* ML_FIXED_POINT */
+}
+
+
+// Returns the logarithm of a unit quaternion, which is the vector part
+// scaled to the half angle. The angle is in turns, as are the arguments
+// of the trigonometric functions.
+static MlVector3
+quatLog(const MlScalar q[4])
+{
+    MlVector3 v(q[0], q[1], q[2]);
+    MlScalar len = v.length();
+
+    if (len > ML_SCALAR(0.00001f))
+        v *= mlDiv(mlAtan2(len, q[3]), len);
+    else
+        v *= ML_SCALAR(0.159154943f);   // the limit of atan2(len, 1)/len
+    return v;
+}
+
+
+// Returns the exponential of a vector, the inverse of quatLog().
+static MlRotation
+quatExp(const MlVector3 &v)
+{
+    MlScalar angle = v.length();
+    MlScalar s;
+
+    if (angle > ML_SCALAR(0.00001f))
+        s = mlDiv(mlSin(angle), angle);
+    else
+        s = ML_SCALAR(6.28318531f);     // the limit of sin(angle)/angle
+    return MlRotation(mlMul(v[0], s), mlMul(v[1], s), mlMul(v[2], s), mlCos(angle));
+}
+
+
+MlRotation MlRotation::squad(const MlRotation& rot0, const MlRotation& ctrl0,
+                             const MlRotation& ctrl1, const MlRotation& rot1, MlScalar t)
 ////////////////////////////////////////////////////////////////////////
 //
 // Description:
-//    Returns the norm (square of the 4D length) of the quaternion
-//    defining the rotation.
+//    Spherical quadrangle interpolation: as t goes from 0 to 1, returned
+//    value goes from rot0 to rot1, pulled toward the control points.
 //
-// Use: private
+// Use: public, static
 //
 ////////////////////////////////////////////////////////////////////////
 {
-    return (mlSquare(quat[0]) +
-            mlSquare(quat[1]) +
-            mlSquare(quat[2]) +
-            mlSquare(quat[3]));
+    MlScalar h = mlMul(t, ML_SCALAR_ONE - t);
+
+    return slerp(slerp(rot0, rot1, t), slerp(ctrl0, ctrl1, t), h + h);
 }
 
 
-void MlRotation::normalize()
+MlRotation MlRotation::squadControl(const MlRotation& prev, const MlRotation& rot,
+                                    const MlRotation& next)
 ////////////////////////////////////////////////////////////////////////
 //
 // Description:
-//    Normalizes a rotation quaternion to unit 4D length.
+//    Returns the inner squad control point of rot, between the keys
+//    prev and next.
 //
-// Use: private
+// Use: public, static
 //
 ////////////////////////////////////////////////////////////////////////
 {
-    MlScalar    dist = mlRecipSqrt(norm());
+    // Note that q1 * q2 applies q1 and then q2, which is the quaternion
+    // product q2 q1. So inv * next is written next * inv here.
+    MlRotation inv = rot.inverse();
+    MlVector3 tangent = quatLog((next * inv).quat) + quatLog((prev * inv).quat);
+
+    tangent *= ML_SCALAR(-0.25f);
+    return quatExp(tangent) * rot;
+}
+
+
+// Smallest three encoding. The three stored components are quantized to
+// integers in [0, 2c], where c is PACK_CENTER32 or PACK_CENTER48, so that
+// zero is the integer c and sqrt(1/2) is 2c. The SIMD kernels in
+// vecsimd.inl use the same values.
+#define PACK_CENTER32   511
+#define PACK_CENTER48   16383
+
+#if ML_FIXED_POINT
+
+// The quantization scale c*sqrt(2) is kept at 16 fraction bits, and the
+// step sqrt(1/2)/c at 30.
+#define PACK_SCALE(c)   ((long long) ((c) * 1.4142135623730951 * 65536.0 + 0.5))
+#define PACK_STEP(c)    ((long long) (0.7071067811865476 / (c) * 1073741824.0 + 0.5))
+
+static inline int
+packComponent(MlScalar v, int c)
+{
+    long long s = ((long long) mlScalarGetValue(v) * PACK_SCALE(c)
+                   + (1LL << (ML_FIXED_RADIX + 15))) >> (ML_FIXED_RADIX + 16);
+    if (s < -c)
+        s = -c;
+    else if (s > c)
+        s = c;
+    return (int) s + c;
+}
 
-    mlMulBy(quat[0], dist);
-    mlMulBy(quat[1], dist);
-    mlMulBy(quat[2], dist);
-    mlMulBy(quat[3], dist);
+static inline MlScalar
+unpackComponent(int u, int c)
+{
+    return mlScalarSetValue((long) (((long long) (u - c) * PACK_STEP(c)
+                                     + (1LL << (29 - ML_FIXED_RADIX))) >> (30 - ML_FIXED_RADIX)));
+}
+
+#else
+
+// The SIMD kernels compute the same, with the same rounding, so the
+// batch functions match the single rotation ones.
+static inline int
+packComponent(MlScalar v, int c)
+{
+    float s = mlScalarToFloat(v) * ((float) c * 1.41421356f);
+    if (s < (float) -c)
+        s = (float) -c;
+    else if (s > (float) c)
+        s = (float) c;
+    return (int) lrintf(s + (float) c);
+}
+
+static inline MlScalar
+unpackComponent(int u, int c)
+{
+    return mlFloatToScalar(((float) u - (float) c) * (0.70710678f / (float) c));
+}
+
+#endif /* ML_FIXED_POINT */
+
+
+// Quantizes the three smallest components of q into u, returning the
+// index of the largest.
+static int
+packQuat(const MlScalar q[4], int u[3], int c)
+{
+    int i, j, k;
+
+    // Ties go to the first of the components, as in the SIMD kernels.
+    for (i = 0, j = 1; j < 4; j++) {
+        if (mlAbs(q[j]) > mlAbs(q[i]))
+            i = j;
+    }
+
+    for (j = 0, k = 0; j < 4; j++) {
+        if (j != i)
+            u[k++] = packComponent((q[i] < ML_SCALAR_ZERO) ? -q[j] : q[j], c);
+    }
+    return i;
+}
+
+
+// Dequantizes the three smallest components into q, and recomputes the
+// largest, at index i, from the unit length of the quaternion.
+static void
+unpackQuat(int i, const int u[3], int c, MlScalar q[4])
+{
+    MlScalar v[3], s;
+    int j, k;
+
+    for (k = 0; k < 3; k++)
+        v[k] = unpackComponent(u[k], c);
+
+    s = ML_SCALAR_ONE - (mlSquare(v[0]) + mlSquare(v[1]) + mlSquare(v[2]));
+    for (j = 0, k = 0; j < 4; j++)
+        q[j] = (j == i) ? ((s > ML_SCALAR_ZERO) ? mlSqrt(s) : ML_SCALAR_ZERO) : v[k++];
+}
+
+
+unsigned int MlRotation::pack32() const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Returns the rotation in the 32 bit smallest three encoding.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    int u[3];
+    int i = packQuat(quat, u, PACK_CENTER32);
+
+    return ((unsigned int) i << 30) | ((unsigned int) u[0] << 20)
+           | ((unsigned int) u[1] << 10) | (unsigned int) u[2];
+}
+
+
+MlRotation &MlRotation::unpack32(unsigned int packed)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Sets the rotation from the 32 bit smallest three encoding.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    int u[3];
+
+    u[0] = (packed >> 20) & 0x3ff;
+    u[1] = (packed >> 10) & 0x3ff;
+    u[2] = packed & 0x3ff;
+    unpackQuat(packed >> 30, u, PACK_CENTER32, quat);
+    return *this;
+}
+
+
+void MlRotation::pack48(unsigned short packed[3]) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Returns the rotation in the 48 bit smallest three encoding.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    int u[3];
+    int i = packQuat(quat, u, PACK_CENTER48);
+
+    packed[0] = (unsigned short) (u[0] | ((i & 1) << 15));
+    packed[1] = (unsigned short) (u[1] | ((i >> 1) << 15));
+    packed[2] = (unsigned short) u[2];
+}
+
+
+MlRotation &MlRotation::unpack48(const unsigned short packed[3])
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Sets the rotation from the 48 bit smallest three encoding.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    int u[3];
+
+    u[0] = packed[0] & 0x7fff;
+    u[1] = packed[1] & 0x7fff;
+    u[2] = packed[2] & 0x7fff;
+    unpackQuat((packed[0] >> 15) | ((packed[1] >> 15) << 1), u, PACK_CENTER48, quat);
+    return *this;
+}
+
+
+void MlRotation::pack32Batch(const MlRotation *rot, unsigned int *packed, int count)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Encodes an array of rotations in 32 bits each.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->packRot32((const MlScalar *) rot, packed, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        packed[i] = rot[i].pack32();
+}
+
+
+void MlRotation::unpack32Batch(const unsigned int *packed, MlRotation *rot, int count)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Decodes an array of rotations encoded in 32 bits each.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->unpackRot32(packed, (MlScalar *) rot, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        rot[i].unpack32(packed[i]);
+}
+
+
+void MlRotation::pack48Batch(const MlRotation *rot, unsigned short *packed, int count)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Encodes an array of rotations in 48 bits each.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->packRot48((const MlScalar *) rot, packed, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        rot[i].pack48(packed + 3*i);
+}
+
+
+void MlRotation::unpack48Batch(const unsigned short *packed, MlRotation *rot, int count)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Decodes an array of rotations encoded in 48 bits each.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->unpackRot48(packed, (MlScalar *) rot, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        rot[i].unpack48(packed + 3*i);
 }
@@ -0,0 +1,268 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// include system header files
+#include <stdlib.h>
+
+// include Magic Lantern math header files
+#include "math/scalar.h"
+#include "math/rotation.h"
+#include "math/rotspline.h"
+
+// The number of splines gathered for each call to MlRotation::slerpBatch()
+// in getValueBatch().
+#define SPLINE_BLOCK 64
+
+
+MlRotationSpline::MlRotationSpline()
+  : numKeys(0), numSegments(0), segments(NULL)
+{}
+
+
+MlRotationSpline::MlRotationSpline(const MlRotation *keys, int numKeys)
+  : numKeys(0), numSegments(0), segments(NULL)
+{
+    setValue(keys, numKeys);
+}
+
+
+MlRotationSpline::MlRotationSpline(const MlRotationSpline &spline)
+  : numKeys(0), numSegments(0), segments(NULL)
+{
+    *this = spline;
+}
+
+
+MlRotationSpline::~MlRotationSpline()
+{
+    delete [] segments;
+}
+
+
+MlRotationSpline &MlRotationSpline::operator =(const MlRotationSpline &spline)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Copies the keys and control points of another spline.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    if (this != &spline) {
+        int length = (spline.numSegments > 0) ? 4 * spline.numSegments : spline.numKeys;
+
+        delete [] segments;
+        segments = (length > 0) ? new MlRotation[length] : NULL;
+        for (int i = 0; i < length; i++)
+            segments[i] = spline.segments[i];
+        numKeys = spline.numKeys;
+        numSegments = spline.numSegments;
+    }
+
+    return *this;
+}
+
+
+MlRotationSpline &MlRotationSpline::setValue(const MlRotation *keys, int numKeys)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Sets the keys of the spline, and computes the control points of
+//    each segment.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    int i;
+
+    delete [] segments;
+    segments = NULL;
+    this->numKeys = (numKeys > 0) ? numKeys : 0;
+    numSegments = (numKeys > 1) ? numKeys - 1 : 0;
+
+    if (numKeys == 1) {
+        segments = new MlRotation[1];
+        segments[0] = keys[0];
+    }
+    if (numSegments == 0)
+        return *this;
+
+    // Bring each key into the hemisphere of the one before it, so that
+    // every segment takes the shorter path.
+    MlRotation *q = new MlRotation[numKeys];
+    MlRotation *ctrl = new MlRotation[numKeys];
+
+    q[0] = keys[0];
+    for (i = 1; i < numKeys; i++) {
+        const MlScalar *p = q[i - 1].getValue();
+        const MlScalar *k = keys[i].getValue();
+        MlScalar cosom = mlMul(p[0], k[0]) + mlMul(p[1], k[1])
+                         + mlMul(p[2], k[2]) + mlMul(p[3], k[3]);
+
+        if (cosom < ML_SCALAR_ZERO)
+            q[i].setValue(-k[0], -k[1], -k[2], -k[3]);
+        else
+            q[i] = keys[i];
+    }
+
+    // The end keys are their own control points.
+    ctrl[0] = q[0];
+    ctrl[numKeys - 1] = q[numKeys - 1];
+    for (i = 1; i < numKeys - 1; i++)
+        ctrl[i] = MlRotation::squadControl(q[i - 1], q[i], q[i + 1]);
+
+    segments = new MlRotation[4 * numSegments];
+    for (i = 0; i < numSegments; i++) {
+        segments[4*i] = q[i];
+        segments[4*i + 1] = ctrl[i];
+        segments[4*i + 2] = ctrl[i + 1];
+        segments[4*i + 3] = q[i + 1];
+    }
+
+    delete [] q;
+    delete [] ctrl;
+
+    return *this;
+}
+
+
+int MlRotationSpline::findSegment(MlScalar u, MlScalar &t) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Returns the segment holding position u, clamped to the ends of the
+//    spline, and sets t to the position in that segment.
+//
+// Use: private
+//
+////////////////////////////////////////////////////////////////////////
+{
+    if (u <= ML_SCALAR_ZERO) {
+        t = ML_SCALAR_ZERO;
+        return 0;
+    }
+    if (u >= mlLongToScalar(numSegments)) {
+        t = ML_SCALAR_ONE;
+        return numSegments - 1;
+    }
+
+    int segment = (int) mlScalarToLong(u);
+    t = u - mlLongToScalar(segment);
+    return segment;
+}
+
+
+MlRotation MlRotationSpline::getValue(int segment, MlScalar t) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Evaluates a segment of the spline at position t.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    const MlRotation *s = &segments[4 * segment];
+
+    return MlRotation::squad(s[0], s[1], s[2], s[3], t);
+}
+
+
+MlRotation MlRotationSpline::getValue(MlScalar u) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Evaluates the spline at position u, where key i is at u = i.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    if (numSegments == 0)
+        return (numKeys > 0) ? segments[0] : MlRotation::identity();
+
+    MlScalar t;
+    int segment = findSegment(u, t);
+
+    return getValue(segment, t);
+}
+
+
+void MlRotationSpline::getValueBatch(const MlRotationSpline *splines, int count,
+                                     MlScalar u, MlRotation *result)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Evaluates an array of splines at the same position u. The segments
+//    are gathered into blocks and each of the three interpolations of
+//    squad is carried out over the whole block.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlRotation rot0[SPLINE_BLOCK], ctrl0[SPLINE_BLOCK];
+    MlRotation ctrl1[SPLINE_BLOCK], rot1[SPLINE_BLOCK];
+    MlRotation outer[SPLINE_BLOCK], inner[SPLINE_BLOCK];
+    MlScalar t[SPLINE_BLOCK], h[SPLINE_BLOCK];
+
+    for (int base = 0; base < count; base += SPLINE_BLOCK) {
+        int m = (count - base < SPLINE_BLOCK) ? count - base : SPLINE_BLOCK;
+        int i;
+
+        for (i = 0; i < m; i++) {
+            const MlRotationSpline &spline = splines[base + i];
+
+            if (spline.numSegments > 0) {
+                const MlRotation *s = &spline.segments[4 * spline.findSegment(u, t[i])];
+                rot0[i] = s[0];
+                ctrl0[i] = s[1];
+                ctrl1[i] = s[2];
+                rot1[i] = s[3];
+            } else {
+                // A constant spline; every interpolation gives its key.
+                rot0[i] = (spline.numKeys > 0) ? spline.segments[0] : MlRotation::identity();
+                ctrl0[i] = ctrl1[i] = rot1[i] = rot0[i];
+                t[i] = ML_SCALAR_ZERO;
+            }
+            h[i] = mlMul(t[i], ML_SCALAR_ONE - t[i]);
+            h[i] += h[i];
+        }
+
+        MlRotation::slerpBatch(rot0, rot1, t, outer, m);
+        MlRotation::slerpBatch(ctrl0, ctrl1, t, inner, m);
+        MlRotation::slerpBatch(outer, inner, h, result + base, m);
+    }
+}
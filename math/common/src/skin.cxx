@@ -0,0 +1,347 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// include system header files
+#include <stdlib.h>
+
+// include Magic Lantern math header files
+#include "math/scalar.h"
+#include "math/vector.h"
+#include "math/transfrm.h"
+#include "math/dualquat.h"
+#include "math/skin.h"
+#include "vecsimd.h"
+#include "parallel.h"
+
+// include Magic Lantern kernel header files
+#include "mle/mlAssert.h"
+
+// Meshes are not split between threads into parts of fewer vertices than
+// this; skinning one costs about 8 to 16 ns.
+#ifndef SKIN_THREAD_MIN
+#define SKIN_THREAD_MIN 1024
+#endif
+
+#if ML_VECTOR_SIMD
+// The skinning kernel reads the palette and the influences as raw floats.
+static_assert(sizeof(MlTransform) == 12 * sizeof(float), "MlTransform must be 12 floats");
+static_assert(sizeof(MlDualQuat) == 8 * sizeof(float), "MlDualQuat must be 8 floats");
+static_assert(sizeof(MlSkinInfluence) == 8 * sizeof(float), "MlSkinInfluence must be 8 words");
+#endif
+
+
+MlSkin::MlSkin()
+  : numVertices(0), numBones(0), positions(NULL), normals(NULL), influences(NULL)
+{}
+
+
+MlSkin::MlSkin(const MlVector3 *positions, const MlVector3 *normals,
+               const MlSkinInfluence *influences, int numVertices)
+  : numVertices(0), numBones(0), positions(NULL), normals(NULL), influences(NULL)
+{
+    setValue(positions, normals, influences, numVertices);
+}
+
+
+MlSkin::MlSkin(const MlSkin &skin)
+  : numVertices(0), numBones(0), positions(NULL), normals(NULL), influences(NULL)
+{
+    *this = skin;
+}
+
+
+MlSkin::~MlSkin()
+{
+    delete [] positions;
+    delete [] normals;
+    delete [] influences;
+}
+
+
+MlSkin &MlSkin::operator =(const MlSkin &skin)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Copies the bind pose of another skin.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    if (this != &skin) {
+        delete [] positions;
+        delete [] normals;
+        delete [] influences;
+        positions = NULL;
+        normals = NULL;
+        influences = NULL;
+        numVertices = skin.numVertices;
+        numBones = skin.numBones;
+
+        if (numVertices > 0) {
+            positions = new MlVector3[numVertices];
+            influences = new MlSkinInfluence[numVertices];
+            if (skin.normals != NULL)
+                normals = new MlVector3[numVertices];
+            for (int i = 0; i < numVertices; i++) {
+                positions[i] = skin.positions[i];
+                influences[i] = skin.influences[i];
+                if (normals != NULL)
+                    normals[i] = skin.normals[i];
+            }
+        }
+    }
+
+    return *this;
+}
+
+
+MlSkin &MlSkin::setValue(const MlVector3 *positions, const MlVector3 *normals,
+                         const MlSkinInfluence *influences, int numVertices)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Copies the bind pose of a mesh, scaling the weights of each vertex
+//    to add up to one.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    delete [] this->positions;
+    delete [] this->normals;
+    delete [] this->influences;
+    this->positions = NULL;
+    this->normals = NULL;
+    this->influences = NULL;
+    this->numVertices = (numVertices > 0) ? numVertices : 0;
+    numBones = 0;
+
+    if (numVertices <= 0)
+        return *this;
+
+    this->positions = new MlVector3[numVertices];
+    this->influences = new MlSkinInfluence[numVertices];
+    if (normals != NULL)
+        this->normals = new MlVector3[numVertices];
+
+    for (int i = 0; i < numVertices; i++) {
+        const MlSkinInfluence &src = influences[i];
+        MlSkinInfluence &dst = this->influences[i];
+        MlScalar sum = src.weight[0] + src.weight[1] + src.weight[2] + src.weight[3];
+        int j;
+
+        MLE_ASSERT(sum > ML_SCALAR_ZERO);
+        MlScalar scale = (sum > ML_SCALAR_ZERO) ? mlReciprocal(sum) : ML_SCALAR_ZERO;
+
+        // Unused slots point at bone 0, so that the kernels may read
+        // them without checking.
+        for (j = 0; j < 4; j++) {
+            if (src.weight[j] != ML_SCALAR_ZERO) {
+                MLE_ASSERT(src.bone[j] >= 0);
+                dst.weight[j] = mlMul(src.weight[j], scale);
+                dst.bone[j] = src.bone[j];
+                if (src.bone[j] >= numBones)
+                    numBones = src.bone[j] + 1;
+            } else {
+                dst.weight[j] = ML_SCALAR_ZERO;
+                dst.bone[j] = 0;
+            }
+        }
+
+        this->positions[i] = positions[i];
+        if (normals != NULL)
+            this->normals[i] = normals[i];
+    }
+    if (numBones == 0)
+        numBones = 1;
+
+    return *this;
+}
+
+
+// The arguments of a call to apply(), passed to each of its threads. One
+// of the palettes is set.
+struct MlSkinBatch
+{
+    const MlSkin *skin;
+    const MlTransform *palette;
+    const MlDualQuat *dualPalette;
+    MlVector3 *positions;
+    MlVector3 *normals;
+};
+
+void MlSkin::skinRange(int first, int last, void *data)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Skins the vertices [first, last), blending the bone matrices of
+//    each vertex and transforming its position and normal by the result.
+//
+// Use: private, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlSkinBatch *batch = (MlSkinBatch *) data;
+    const MlSkin *skin = batch->skin;
+    const MlVector3 *normals = (batch->normals != NULL) ? skin->normals : NULL;
+
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->skin((const MlScalar *) batch->palette,
+                (const MlScalar *) (skin->influences + first),
+                (const MlScalar *) (skin->positions + first),
+                (normals != NULL) ? (const MlScalar *) (normals + first) : NULL,
+                (MlScalar *) (batch->positions + first),
+                (normals != NULL) ? (MlScalar *) (batch->normals + first) : NULL,
+                last - first);
+        return;
+    }
+#endif
+
+    MlTransform blend;
+    MlTrans &b = blend;
+    int i, j, r, c;
+
+    for (i = first; i < last; i++) {
+        const MlSkinInfluence &inf = skin->influences[i];
+        const MlTrans &m = batch->palette[inf.bone[0]].getValue();
+
+        for (r = 0; r < 4; r++)
+            for (c = 0; c < 3; c++)
+                b.m[r][c] = mlMul(inf.weight[0], m.m[r][c]);
+        for (j = 1; j < 4; j++) {
+            if (inf.weight[j] == ML_SCALAR_ZERO)
+                continue;
+            const MlTrans &mj = batch->palette[inf.bone[j]].getValue();
+            for (r = 0; r < 4; r++)
+                for (c = 0; c < 3; c++)
+                    b.m[r][c] += mlMul(inf.weight[j], mj.m[r][c]);
+        }
+
+        blend.multVecMatrix(skin->positions[i], batch->positions[i]);
+        if (normals != NULL) {
+            blend.multDirMatrix(normals[i], batch->normals[i]);
+            batch->normals[i].normalize();
+        }
+    }
+}
+
+
+void MlSkin::skinDualRange(int first, int last, void *data)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Skins the vertices [first, last), blending the dual quaternions of
+//    each vertex and transforming its position and normal by the result.
+//
+// Use: private, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlSkinBatch *batch = (MlSkinBatch *) data;
+    const MlSkin *skin = batch->skin;
+    const MlVector3 *normals = (batch->normals != NULL) ? skin->normals : NULL;
+
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->skinDual((const MlScalar *) batch->dualPalette,
+                    (const MlScalar *) (skin->influences + first),
+                    (const MlScalar *) (skin->positions + first),
+                    (normals != NULL) ? (const MlScalar *) (normals + first) : NULL,
+                    (MlScalar *) (batch->positions + first),
+                    (normals != NULL) ? (MlScalar *) (batch->normals + first) : NULL,
+                    last - first);
+        return;
+    }
+#endif
+
+    MlDualQuat bones[4];
+    int i, j;
+
+    for (i = first; i < last; i++) {
+        const MlSkinInfluence &inf = skin->influences[i];
+
+        for (j = 0; j < 4; j++)
+            bones[j] = batch->dualPalette[inf.bone[j]];
+        MlDualQuat blend = MlDualQuat::blend(bones, inf.weight, 4);
+
+        blend.multVec(skin->positions[i], batch->positions[i]);
+        if (normals != NULL)
+            blend.multDir(normals[i], batch->normals[i]);
+    }
+}
+
+
+void MlSkin::apply(const MlTransform *palette, int numBones,
+                   MlVector3 *positions, MlVector3 *normals, int numThreads) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Deforms the mesh by a palette of bone transforms, splitting the
+//    vertices between threads.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MLE_ASSERT(numVertices == 0 || numBones >= this->numBones);
+    (void) numBones;
+
+    MlSkinBatch batch = { this, palette, NULL, positions, normals };
+
+    mlForEachRange(numVertices, SKIN_THREAD_MIN, numThreads, skinRange, &batch);
+}
+
+
+void MlSkin::apply(const MlDualQuat *palette, int numBones,
+                   MlVector3 *positions, MlVector3 *normals, int numThreads) const
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Deforms the mesh by a palette of dual quaternion bone transforms,
+//    splitting the vertices between threads.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MLE_ASSERT(numVertices == 0 || numBones >= this->numBones);
+    (void) numBones;
+
+    MlSkinBatch batch = { this, NULL, palette, positions, normals };
+
+    mlForEachRange(numVertices, SKIN_THREAD_MIN, numThreads, skinDualRange, &batch);
+}
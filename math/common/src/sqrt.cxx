@@ -38,1413 +38,179 @@
 
 // include Magic Lantern kernel header files
 #include "mle/mlAssert.h"
+#include "math/fixedlut.h"
 
 #if ML_FIXED_POINT
 
-#if WRITE_LUT
-const unsigned long sqrtLUT[] = {0x800000,0x800000,0x800000,0x800000};
-#else  /* WRITE_LUT */
-// Insert auto-generated LUT here...
-// Use the command make SqrtLUT to write this table, then include it
-// here.
+// The table holds sqrt(x) for x in [1..4), indexed by the high
+// ML_FIXED_SQRT_LUT_BITS bits of the normalized argument. Arguments in [0..1)
+// never occur, so their quarter of the index range is not stored. The table
+// is generated at compile time; see fixedlut.h.
+#define SQRT_LUT_LENGTH     (3 << (ML_FIXED_SQRT_LUT_BITS - 2))
 
-#if ML_FIXED_RADIX == 16
-static unsigned long sqrtLUT[] = { 
-    0x800000, 0x800fff, 0x801ffc, 0x802ff7, 0x803ff0, 
-    0x804fe7, 0x805fdc, 0x806fcf, 0x807fc0, 0x808faf, 
-    0x809f9c, 0x80af88, 0x80bf71, 0x80cf58, 0x80df3d, 
-    0x80ef21, 0x80ff02, 0x810ee1, 0x811ebf, 0x812e9a, 
-    0x813e74, 0x814e4b, 0x815e21, 0x816df5, 0x817dc7, 
-    0x818d97, 0x819d64, 0x81ad30, 0x81bcfb, 0x81ccc3, 
-    0x81dc89, 0x81ec4d, 0x81fc10, 0x820bd0, 0x821b8f, 
-    0x822b4b, 0x823b06, 0x824abf, 0x825a76, 0x826a2b, 
-    0x8279df, 0x828990, 0x82993f, 0x82a8ed, 0x82b899, 
-    0x82c842, 0x82d7ea, 0x82e790, 0x82f734, 0x8306d7, 
-    0x831677, 0x832616, 0x8335b3, 0x83454d, 0x8354e6, 
-    0x83647e, 0x837413, 0x8383a6, 0x839338, 0x83a2c8, 
-    0x83b256, 0x83c1e2, 0x83d16c, 0x83e0f5, 0x83f07b, 
-    0x840000, 0x840f83, 0x841f04, 0x842e83, 0x843e01, 
-    0x844d7d, 0x845cf7, 0x846c6f, 0x847be5, 0x848b59, 
-    0x849acc, 0x84aa3d, 0x84b9ac, 0x84c919, 0x84d885, 
-    0x84e7ee, 0x84f756, 0x8506bc, 0x851621, 0x852583, 
-    0x8534e4, 0x854443, 0x8553a0, 0x8562fc, 0x857256, 
-    0x8581ae, 0x859104, 0x85a058, 0x85afab, 0x85befc, 
-    0x85ce4b, 0x85dd98, 0x85ece4, 0x85fc2e, 0x860b76, 
-    0x861abc, 0x862a01, 0x863944, 0x864885, 0x8657c5, 
-    0x866702, 0x86763e, 0x868579, 0x8694b1, 0x86a3e8, 
-    0x86b31d, 0x86c251, 0x86d182, 0x86e0b2, 0x86efe1, 
-    0x86ff0d, 0x870e38, 0x871d61, 0x872c89, 0x873baf, 
-    0x874ad3, 0x8759f5, 0x876916, 0x877835, 0x878752, 
-    0x87966e, 0x87a588, 0x87b4a0, 0x87c3b6, 0x87d2cb, 
-    0x87e1df, 0x87f0f0, 0x880000, 0x880f0e, 0x881e1b, 
-    0x882d26, 0x883c2f, 0x884b36, 0x885a3c, 0x886941, 
-    0x887843, 0x888744, 0x889644, 0x88a541, 0x88b43d, 
-    0x88c338, 0x88d230, 0x88e128, 0x88f01d, 0x88ff11, 
-    0x890e03, 0x891cf4, 0x892be3, 0x893ad0, 0x8949bc, 
-    0x8958a6, 0x89678e, 0x897675, 0x89855a, 0x89943e, 
-    0x89a320, 0x89b200, 0x89c0df, 0x89cfbc, 0x89de98, 
-    0x89ed72, 0x89fc4a, 0x8a0b21, 0x8a19f6, 0x8a28ca, 
-    0x8a379c, 0x8a466c, 0x8a553b, 0x8a6408, 0x8a72d4, 
-    0x8a819e, 0x8a9067, 0x8a9f2d, 0x8aadf3, 0x8abcb7, 
-    0x8acb79, 0x8ada39, 0x8ae8f9, 0x8af7b6, 0x8b0672, 
-    0x8b152c, 0x8b23e5, 0x8b329d, 0x8b4152, 0x8b5006, 
-    0x8b5eb9, 0x8b6d6a, 0x8b7c1a, 0x8b8ac8, 0x8b9974, 
-    0x8ba81f, 0x8bb6c8, 0x8bc570, 0x8bd416, 0x8be2bb, 
-    0x8bf15e, 0x8c0000, 0x8c0ea0, 0x8c1d3f, 0x8c2bdc, 
-    0x8c3a77, 0x8c4912, 0x8c57aa, 0x8c6641, 0x8c74d7, 
-    0x8c836b, 0x8c91fd, 0x8ca08e, 0x8caf1d, 0x8cbdab, 
-    0x8ccc38, 0x8cdac3, 0x8ce94c, 0x8cf7d4, 0x8d065b, 
-    0x8d14e0, 0x8d2363, 0x8d31e5, 0x8d4065, 0x8d4ee4, 
-    0x8d5d62, 0x8d6bde, 0x8d7a59, 0x8d88d2, 0x8d9749, 
-    0x8da5bf, 0x8db434, 0x8dc2a7, 0x8dd119, 0x8ddf89, 
-    0x8dedf8, 0x8dfc65, 0x8e0ad1, 0x8e193b, 0x8e27a4, 
-    0x8e360b, 0x8e4471, 0x8e52d6, 0x8e6139, 0x8e6f9a, 
-    0x8e7dfb, 0x8e8c59, 0x8e9ab7, 0x8ea912, 0x8eb76d, 
-    0x8ec5c6, 0x8ed41d, 0x8ee273, 0x8ef0c8, 0x8eff1b, 
-    0x8f0d6d, 0x8f1bbd, 0x8f2a0c, 0x8f3859, 0x8f46a5, 
-    0x8f54f0, 0x8f6339, 0x8f7181, 0x8f7fc7, 0x8f8e0c, 
-    0x8f9c4f, 0x8faa91, 0x8fb8d2, 0x8fc711, 0x8fd54f, 
-    0x8fe38b, 0x8ff1c6, 0x900000, 0x900e38, 0x901c6f, 
-    0x902aa4, 0x9038d8, 0x90470b, 0x90553c, 0x90636c, 
-    0x90719a, 0x907fc7, 0x908df3, 0x909c1d, 0x90aa46, 
-    0x90b86d, 0x90c694, 0x90d4b8, 0x90e2dc, 0x90f0fd, 
-    0x90ff1e, 0x910d3d, 0x911b5b, 0x912977, 0x913792, 
-    0x9145ac, 0x9153c4, 0x9161db, 0x916ff1, 0x917e05, 
-    0x918c18, 0x919a2a, 0x91a83a, 0x91b649, 0x91c456, 
-    0x91d262, 0x91e06d, 0x91ee76, 0x91fc7e, 0x920a85, 
-    0x92188a, 0x92268e, 0x923491, 0x924292, 0x925092, 
-    0x925e91, 0x926c8e, 0x927a8a, 0x928885, 0x92967e, 
-    0x92a476, 0x92b26c, 0x92c062, 0x92ce56, 0x92dc48, 
-    0x92ea3a, 0x92f82a, 0x930618, 0x931406, 0x9321f2, 
-    0x932fdc, 0x933dc6, 0x934bae, 0x935995, 0x93677a, 
-    0x93755e, 0x938341, 0x939123, 0x939f03, 0x93ace2, 
-    0x93babf, 0x93c89c, 0x93d677, 0x93e450, 0x93f229, 
-    0x940000, 0x940dd6, 0x941baa, 0x94297e, 0x943750, 
-    0x944520, 0x9452f0, 0x9460be, 0x946e8b, 0x947c56, 
-    0x948a20, 0x9497e9, 0x94a5b1, 0x94b378, 0x94c13d, 
-    0x94cf01, 0x94dcc3, 0x94ea84, 0x94f845, 0x950603, 
-    0x9513c1, 0x95217d, 0x952f38, 0x953cf2, 0x954aaa, 
-    0x955861, 0x956617, 0x9573cc, 0x958180, 0x958f32, 
-    0x959ce3, 0x95aa92, 0x95b841, 0x95c5ee, 0x95d39a, 
-    0x95e145, 0x95eeee, 0x95fc96, 0x960a3d, 0x9617e3, 
-    0x962587, 0x96332a, 0x9640cc, 0x964e6d, 0x965c0d, 
-    0x9669ab, 0x967748, 0x9684e4, 0x96927e, 0x96a018, 
-    0x96adb0, 0x96bb47, 0x96c8dd, 0x96d671, 0x96e404, 
-    0x96f196, 0x96ff27, 0x970cb7, 0x971a45, 0x9727d2, 
-    0x97355e, 0x9742e9, 0x975072, 0x975dfa, 0x976b82, 
-    0x977907, 0x97868c, 0x979410, 0x97a192, 0x97af13, 
-    0x97bc93, 0x97ca11, 0x97d78f, 0x97e50b, 0x97f286, 
-    0x980000, 0x980d79, 0x981af0, 0x982866, 0x9835dc, 
-    0x98434f, 0x9850c2, 0x985e34, 0x986ba4, 0x987913, 
-    0x988681, 0x9893ee, 0x98a15a, 0x98aec4, 0x98bc2d, 
-    0x98c995, 0x98d6fc, 0x98e462, 0x98f1c6, 0x98ff2a, 
-    0x990c8c, 0x9919ed, 0x99274d, 0x9934ac, 0x994209, 
-    0x994f66, 0x995cc1, 0x996a1b, 0x997774, 0x9984cb, 
-    0x999222, 0x999f77, 0x99accc, 0x99ba1f, 0x99c771, 
-    0x99d4c1, 0x99e211, 0x99ef60, 0x99fcad, 0x9a09f9, 
-    0x9a1744, 0x9a248e, 0x9a31d7, 0x9a3f1e, 0x9a4c65, 
-    0x9a59aa, 0x9a66ee, 0x9a7431, 0x9a8173, 0x9a8eb4, 
-    0x9a9bf4, 0x9aa932, 0x9ab66f, 0x9ac3ac, 0x9ad0e7, 
-    0x9ade21, 0x9aeb59, 0x9af891, 0x9b05c8, 0x9b12fd, 
-    0x9b2032, 0x9b2d65, 0x9b3a97, 0x9b47c8, 0x9b54f8, 
-    0x9b6226, 0x9b6f54, 0x9b7c80, 0x9b89ac, 0x9b96d6, 
-    0x9ba3ff, 0x9bb127, 0x9bbe4e, 0x9bcb74, 0x9bd899, 
-    0x9be5bc, 0x9bf2df, 0x9c0000, 0x9c0d20, 0x9c1a3f, 
-    0x9c275d, 0x9c347a, 0x9c4196, 0x9c4eb1, 0x9c5bcb, 
-    0x9c68e3, 0x9c75fb, 0x9c8311, 0x9c9026, 0x9c9d3b, 
-    0x9caa4e, 0x9cb760, 0x9cc471, 0x9cd180, 0x9cde8f, 
-    0x9ceb9d, 0x9cf8a9, 0x9d05b5, 0x9d12bf, 0x9d1fc9, 
-    0x9d2cd1, 0x9d39d8, 0x9d46de, 0x9d53e3, 0x9d60e7, 
-    0x9d6dea, 0x9d7aec, 0x9d87ec, 0x9d94ec, 0x9da1ea, 
-    0x9daee8, 0x9dbbe4, 0x9dc8e0, 0x9dd5da, 0x9de2d3, 
-    0x9defcb, 0x9dfcc2, 0x9e09b8, 0x9e16ad, 0x9e23a1, 
-    0x9e3094, 0x9e3d86, 0x9e4a77, 0x9e5766, 0x9e6455, 
-    0x9e7142, 0x9e7e2f, 0x9e8b1a, 0x9e9805, 0x9ea4ee, 
-    0x9eb1d6, 0x9ebebd, 0x9ecba4, 0x9ed889, 0x9ee56d, 
-    0x9ef250, 0x9eff32, 0x9f0c13, 0x9f18f3, 0x9f25d2, 
-    0x9f32af, 0x9f3f8c, 0x9f4c68, 0x9f5943, 0x9f661c, 
-    0x9f72f5, 0x9f7fcd, 0x9f8ca3, 0x9f9979, 0x9fa64d, 
-    0x9fb321, 0x9fbff3, 0x9fccc5, 0x9fd995, 0x9fe664, 
-    0x9ff333, 0xa00000, 0xa00ccc, 0xa01998, 0xa02662, 
-    0xa0332b, 0xa03ff3, 0xa04cba, 0xa05981, 0xa06646, 
-    0xa0730a, 0xa07fcd, 0xa08c8f, 0xa09950, 0xa0a610, 
-    0xa0b2cf, 0xa0bf8d, 0xa0cc4a, 0xa0d906, 0xa0e5c1, 
-    0xa0f27b, 0xa0ff34, 0xa10bec, 0xa118a3, 0xa12559, 
-    0xa1320e, 0xa13ec2, 0xa14b75, 0xa15827, 0xa164d8, 
-    0xa17188, 0xa17e37, 0xa18ae5, 0xa19792, 0xa1a43f, 
-    0xa1b0ea, 0xa1bd94, 0xa1ca3d, 0xa1d6e5, 0xa1e38c, 
-    0xa1f032, 0xa1fcd7, 0xa2097b, 0xa2161e, 0xa222c0, 
-    0xa22f61, 0xa23c02, 0xa248a1, 0xa2553f, 0xa261dc, 
-    0xa26e78, 0xa27b14, 0xa287ae, 0xa29447, 0xa2a0e0, 
-    0xa2ad77, 0xa2ba0d, 0xa2c6a3, 0xa2d337, 0xa2dfcb, 
-    0xa2ec5d, 0xa2f8ef, 0xa3057f, 0xa3120f, 0xa31e9d, 
-    0xa32b2b, 0xa337b8, 0xa34443, 0xa350ce, 0xa35d58, 
-    0xa369e1, 0xa37669, 0xa382f0, 0xa38f75, 0xa39bfa, 
-    0xa3a87f, 0xa3b502, 0xa3c184, 0xa3ce05, 0xa3da85, 
-    0xa3e704, 0xa3f383, 0xa40000, 0xa40c7c, 0xa418f8, 
-    0xa42572, 0xa431ec, 0xa43e65, 0xa44adc, 0xa45753, 
-    0xa463c9, 0xa4703d, 0xa47cb1, 0xa48924, 0xa49596, 
-    0xa4a207, 0xa4ae77, 0xa4bae7, 0xa4c755, 0xa4d3c2, 
-    0xa4e02f, 0xa4ec9a, 0xa4f905, 0xa5056e, 0xa511d7, 
-    0xa51e3e, 0xa52aa5, 0xa5370b, 0xa54370, 0xa54fd4, 
-    0xa55c37, 0xa56899, 0xa574fa, 0xa5815a, 0xa58dba, 
-    0xa59a18, 0xa5a676, 0xa5b2d2, 0xa5bf2e, 0xa5cb89, 
-    0xa5d7e2, 0xa5e43b, 0xa5f093, 0xa5fcea, 0xa60941, 
-    0xa61596, 0xa621ea, 0xa62e3d, 0xa63a90, 0xa646e1, 
-    0xa65332, 0xa65f82, 0xa66bd1, 0xa6781f, 0xa6846c, 
-    0xa690b8, 0xa69d03, 0xa6a94d, 0xa6b597, 0xa6c1df, 
-    0xa6ce27, 0xa6da6d, 0xa6e6b3, 0xa6f2f8, 0xa6ff3c, 
-    0xa70b7f, 0xa717c1, 0xa72402, 0xa73043, 0xa73c82, 
-    0xa748c1, 0xa754fe, 0xa7613b, 0xa76d77, 0xa779b2, 
-    0xa785ec, 0xa79225, 0xa79e5e, 0xa7aa95, 0xa7b6cb, 
-    0xa7c301, 0xa7cf36, 0xa7db6a, 0xa7e79d, 0xa7f3cf, 
-    0xa80000, 0xa80c30, 0xa81860, 0xa8248e, 0xa830bc, 
-    0xa83ce9, 0xa84915, 0xa85540, 0xa8616a, 0xa86d93, 
-    0xa879bc, 0xa885e3, 0xa8920a, 0xa89e2f, 0xa8aa54, 
-    0xa8b678, 0xa8c29b, 0xa8cebe, 0xa8dadf, 0xa8e700, 
-    0xa8f31f, 0xa8ff3e, 0xa90b5c, 0xa91779, 0xa92395, 
-    0xa92fb1, 0xa93bcb, 0xa947e5, 0xa953fd, 0xa96015, 
-    0xa96c2c, 0xa97842, 0xa98458, 0xa9906c, 0xa99c7f, 
-    0xa9a892, 0xa9b4a4, 0xa9c0b5, 0xa9ccc5, 0xa9d8d4, 
-    0xa9e4e3, 0xa9f0f0, 0xa9fcfd, 0xaa0909, 0xaa1514, 
-    0xaa211e, 0xaa2d27, 0xaa3930, 0xaa4537, 0xaa513e, 
-    0xaa5d44, 0xaa6949, 0xaa754d, 0xaa8150, 0xaa8d53, 
-    0xaa9954, 0xaaa555, 0xaab155, 0xaabd54, 0xaac953, 
-    0xaad550, 0xaae14d, 0xaaed48, 0xaaf943, 0xab053d, 
-    0xab1137, 0xab1d2f, 0xab2926, 0xab351d, 0xab4113, 
-    0xab4d08, 0xab58fc, 0xab64f0, 0xab70e2, 0xab7cd4, 
-    0xab88c5, 0xab94b5, 0xaba0a4, 0xabac92, 0xabb880, 
-    0xabc46d, 0xabd059, 0xabdc44, 0xabe82e, 0xabf417, 
-    0xac0000, 0xac0be8, 0xac17cf, 0xac23b5, 0xac2f9a, 
-    0xac3b7f, 0xac4762, 0xac5345, 0xac5f27, 0xac6b08, 
-    0xac76e9, 0xac82c8, 0xac8ea7, 0xac9a85, 0xaca662, 
-    0xacb23e, 0xacbe1a, 0xacc9f5, 0xacd5ce, 0xace1a8, 
-    0xaced80, 0xacf957, 0xad052e, 0xad1104, 0xad1cd9, 
-    0xad28ad, 0xad3480, 0xad4053, 0xad4c25, 0xad57f5, 
-    0xad63c6, 0xad6f95, 0xad7b64, 0xad8731, 0xad92fe, 
-    0xad9eca, 0xadaa96, 0xadb660, 0xadc22a, 0xadcdf3, 
-    0xadd9bb, 0xade582, 0xadf149, 0xadfd0f, 0xae08d4, 
-    0xae1498, 0xae205b, 0xae2c1e, 0xae37df, 0xae43a0, 
-    0xae4f61, 0xae5b20, 0xae66df, 0xae729c, 0xae7e59, 
-    0xae8a16, 0xae95d1, 0xaea18c, 0xaead46, 0xaeb8ff, 
-    0xaec4b7, 0xaed06f, 0xaedc25, 0xaee7db, 0xaef390, 
-    0xaeff45, 0xaf0af8, 0xaf16ab, 0xaf225d, 0xaf2e0e, 
-    0xaf39bf, 0xaf456f, 0xaf511d, 0xaf5ccc, 0xaf6879, 
-    0xaf7426, 0xaf7fd1, 0xaf8b7c, 0xaf9727, 0xafa2d0, 
-    0xafae79, 0xafba21, 0xafc5c8, 0xafd16e, 0xafdd14, 
-    0xafe8b9, 0xaff45d, 0xb00000, 0xb00ba3, 0xb01744, 
-    0xb022e5, 0xb02e85, 0xb03a25, 0xb045c4, 0xb05162, 
-    0xb05cff, 0xb0689b, 0xb07437, 0xb07fd2, 0xb08b6c, 
-    0xb09705, 0xb0a29e, 0xb0ae35, 0xb0b9cc, 0xb0c563, 
-    0xb0d0f8, 0xb0dc8d, 0xb0e821, 0xb0f3b4, 0xb0ff47, 
-    0xb10ad9, 0xb1166a, 0xb121fa, 0xb12d89, 0xb13918, 
-    0xb144a6, 0xb15033, 0xb15bc0, 0xb1674b, 0xb172d6, 
-    0xb17e61, 0xb189ea, 0xb19573, 0xb1a0fb, 0xb1ac82, 
-    0xb1b808, 0xb1c38e, 0xb1cf13, 0xb1da97, 0xb1e61b, 
-    0xb1f19e, 0xb1fd20, 0xb208a1, 0xb21421, 0xb21fa1, 
-    0xb22b20, 0xb2369e, 0xb2421c, 0xb24d99, 0xb25915, 
-    0xb26490, 0xb2700b, 0xb27b85, 0xb286fe, 0xb29276, 
-    0xb29dee, 0xb2a965, 0xb2b4db, 0xb2c050, 0xb2cbc5, 
-    0xb2d739, 0xb2e2ac, 0xb2ee1f, 0xb2f990, 0xb30501, 
-    0xb31072, 0xb31be1, 0xb32750, 0xb332be, 0xb33e2c, 
-    0xb34998, 0xb35504, 0xb3606f, 0xb36bda, 0xb37744, 
-    0xb382ad, 0xb38e15, 0xb3997c, 0xb3a4e3, 0xb3b049, 
-    0xb3bbaf, 0xb3c713, 0xb3d277, 0xb3dddb, 0xb3e93d, 
-    0xb3f49f, 0xb40000, 0xb40b60, 0xb416c0, 0xb4221f, 
-    0xb42d7d, 0xb438db, 0xb44437, 0xb44f93, 0xb45aef, 
-    0xb46649, 0xb471a3, 0xb47cfc, 0xb48855, 0xb493ad, 
-    0xb49f04, 0xb4aa5a, 0xb4b5b0, 0xb4c105, 0xb4cc59, 
-    0xb4d7ac, 0xb4e2ff, 0xb4ee51, 0xb4f9a3, 0xb504f3, 
-    0xb51043, 0xb51b92, 0xb526e1, 0xb5322f, 0xb53d7c, 
-    0xb548c8, 0xb55414, 0xb55f5f, 0xb56aa9, 0xb575f3, 
-    0xb5813c, 0xb58c84, 0xb597cc, 0xb5a312, 0xb5ae59, 
-    0xb5b99e, 0xb5c4e3, 0xb5d027, 0xb5db6a, 0xb5e6ad, 
-    0xb5f1ef, 0xb5fd30, 0xb60870, 0xb613b0, 0xb61eef, 
-    0xb62a2e, 0xb6356c, 0xb640a9, 0xb64be5, 0xb65721, 
-    0xb6625c, 0xb66d96, 0xb678cf, 0xb68408, 0xb68f41, 
-    0xb69a78, 0xb6a5af, 0xb6b0e5, 0xb6bc1b, 0xb6c74f, 
-    0xb6d283, 0xb6ddb7, 0xb6e8ea, 0xb6f41c, 0xb6ff4d, 
-    0xb70a7e, 0xb715ae, 0xb720dd, 0xb72c0b, 0xb73739, 
-    0xb74267, 0xb74d93, 0xb758bf, 0xb763ea, 0xb76f15, 
-    0xb77a3f, 0xb78568, 0xb79090, 0xb79bb8, 0xb7a6df, 
-    0xb7b206, 0xb7bd2c, 0xb7c851, 0xb7d375, 0xb7de99, 
-    0xb7e9bc, 0xb7f4de, 0xb80000, 0xb80b21, 0xb81641, 
-    0xb82161, 0xb82c80, 0xb8379f, 0xb842bc, 0xb84dd9, 
-    0xb858f6, 0xb86411, 0xb86f2c, 0xb87a47, 0xb88560, 
-    0xb89079, 0xb89b92, 0xb8a6a9, 0xb8b1c0, 0xb8bcd7, 
-    0xb8c7ec, 0xb8d301, 0xb8de16, 0xb8e929, 0xb8f43d, 
-    0xb8ff4f, 0xb90a61, 0xb91572, 0xb92082, 0xb92b92, 
-    0xb936a1, 0xb941af, 0xb94cbd, 0xb957ca, 0xb962d6, 
-    0xb96de2, 0xb978ed, 0xb983f8, 0xb98f01, 0xb99a0b, 
-    0xb9a513, 0xb9b01b, 0xb9bb22, 0xb9c629, 0xb9d12e, 
-    0xb9dc34, 0xb9e738, 0xb9f23c, 0xb9fd3f, 0xba0842, 
-    0xba1344, 0xba1e45, 0xba2946, 0xba3446, 0xba3f45, 
-    0xba4a44, 0xba5542, 0xba603f, 0xba6b3c, 0xba7638, 
-    0xba8133, 0xba8c2e, 0xba9728, 0xbaa222, 0xbaad1b, 
-    0xbab813, 0xbac30b, 0xbace02, 0xbad8f8, 0xbae3ed, 
-    0xbaeee2, 0xbaf9d7, 0xbb04cb, 0xbb0fbe, 0xbb1ab0, 
-    0xbb25a2, 0xbb3093, 0xbb3b84, 0xbb4673, 0xbb5163, 
-    0xbb5c51, 0xbb673f, 0xbb722d, 0xbb7d19, 0xbb8805, 
-    0xbb92f1, 0xbb9ddb, 0xbba8c6, 0xbbb3af, 0xbbbe98, 
-    0xbbc980, 0xbbd468, 0xbbdf4f, 0xbbea35, 0xbbf51b, 
-    0xbc0000, 0xbc0ae4, 0xbc15c8, 0xbc20ab, 0xbc2b8e, 
-    0xbc3670, 0xbc4151, 0xbc4c32, 0xbc5712, 0xbc61f1, 
-    0xbc6cd0, 0xbc77ae, 0xbc828c, 0xbc8d69, 0xbc9845, 
-    0xbca321, 0xbcadfc, 0xbcb8d6, 0xbcc3b0, 0xbcce89, 
-    0xbcd962, 0xbce43a, 0xbcef11, 0xbcf9e8, 0xbd04be, 
-    0xbd0f93, 0xbd1a68, 0xbd253c, 0xbd3010, 0xbd3ae3, 
-    0xbd45b5, 0xbd5087, 0xbd5b58, 0xbd6628, 0xbd70f8, 
-    0xbd7bc7, 0xbd8696, 0xbd9164, 0xbd9c31, 0xbda6fe, 
-    0xbdb1ca, 0xbdbc96, 0xbdc761, 0xbdd22b, 0xbddcf5, 
-    0xbde7be, 0xbdf286, 0xbdfd4e, 0xbe0815, 0xbe12dc, 
-    0xbe1da2, 0xbe2867, 0xbe332c, 0xbe3df1, 0xbe48b4, 
-    0xbe5377, 0xbe5e39, 0xbe68fb, 0xbe73bc, 0xbe7e7d, 
-    0xbe893d, 0xbe93fc, 0xbe9ebb, 0xbea979, 0xbeb437, 
-    0xbebef4, 0xbec9b0, 0xbed46c, 0xbedf27, 0xbee9e1, 
-    0xbef49b, 0xbeff54, 0xbf0a0d, 0xbf14c5, 0xbf1f7d, 
-    0xbf2a34, 0xbf34ea, 0xbf3fa0, 0xbf4a55, 0xbf5509, 
-    0xbf5fbd, 0xbf6a70, 0xbf7523, 0xbf7fd5, 0xbf8a87, 
-    0xbf9538, 0xbf9fe8, 0xbfaa98, 0xbfb547, 0xbfbff5, 
-    0xbfcaa3, 0xbfd551, 0xbfdffd, 0xbfeaa9, 0xbff555, 
-    0xc00000, 0xc00aaa, 0xc01554, 0xc01ffd, 0xc02aa6, 
-    0xc0354e, 0xc03ff5, 0xc04a9c, 0xc05542, 0xc05fe8, 
-    0xc06a8d, 0xc07532, 0xc07fd5, 0xc08a79, 0xc0951b, 
-    0xc09fbe, 0xc0aa5f, 0xc0b500, 0xc0bfa0, 0xc0ca40, 
-    0xc0d4df, 0xc0df7e, 0xc0ea1c, 0xc0f4b9, 0xc0ff56, 
-    0xc109f2, 0xc1148e, 0xc11f29, 0xc129c4, 0xc1345e, 
-    0xc13ef7, 0xc14990, 0xc15428, 0xc15ec0, 0xc16957, 
-    0xc173ed, 0xc17e83, 0xc18918, 0xc193ad, 0xc19e41, 
-    0xc1a8d5, 0xc1b368, 0xc1bdfa, 0xc1c88c, 0xc1d31d, 
-    0xc1ddae, 0xc1e83e, 0xc1f2cd, 0xc1fd5c, 0xc207eb, 
-    0xc21279, 0xc21d06, 0xc22792, 0xc2321e, 0xc23caa, 
-    0xc24735, 0xc251bf, 0xc25c49, 0xc266d2, 0xc2715b, 
-    0xc27be3, 0xc2866b, 0xc290f1, 0xc29b78, 0xc2a5fe, 
-    0xc2b083, 0xc2bb07, 0xc2c58c, 0xc2d00f, 0xc2da92, 
-    0xc2e514, 0xc2ef96, 0xc2fa18, 0xc30498, 0xc30f18, 
-    0xc31998, 0xc32417, 0xc32e95, 0xc33913, 0xc34391, 
-    0xc34e0d, 0xc35889, 0xc36305, 0xc36d80, 0xc377fb, 
-    0xc38275, 0xc38cee, 0xc39767, 0xc3a1df, 0xc3ac57, 
-    0xc3b6ce, 0xc3c144, 0xc3cbba, 0xc3d630, 0xc3e0a5, 
-    0xc3eb19, 0xc3f58d, 0xc40000, 0xc40a73, 0xc414e5, 
-    0xc41f56, 0xc429c7, 0xc43438, 0xc43ea8, 0xc44917, 
-    0xc45386, 0xc45df4, 0xc46862, 0xc472cf, 0xc47d3b, 
-    0xc487a7, 0xc49213, 0xc49c7e, 0xc4a6e8, 0xc4b152, 
-    0xc4bbbb, 0xc4c624, 0xc4d08c, 0xc4daf3, 0xc4e55a, 
-    0xc4efc1, 0xc4fa27, 0xc5048c, 0xc50ef1, 0xc51955, 
-    0xc523b9, 0xc52e1c, 0xc5387f, 0xc542e1, 0xc54d43, 
-    0xc557a4, 0xc56204, 0xc56c64, 0xc576c4, 0xc58122, 
-    0xc58b81, 0xc595de, 0xc5a03c, 0xc5aa98, 0xc5b4f4, 
-    0xc5bf50, 0xc5c9ab, 0xc5d405, 0xc5de5f, 0xc5e8b9, 
-    0xc5f312, 0xc5fd6a, 0xc607c2, 0xc61219, 0xc61c70, 
-    0xc626c6, 0xc6311c, 0xc63b71, 0xc645c5, 0xc65019, 
-    0xc65a6d, 0xc664c0, 0xc66f12, 0xc67964, 0xc683b5, 
-    0xc68e06, 0xc69856, 0xc6a2a6, 0xc6acf5, 0xc6b744, 
-    0xc6c192, 0xc6cbdf, 0xc6d62c, 0xc6e079, 0xc6eac5, 
-    0xc6f510, 0xc6ff5b, 0xc709a6, 0xc713f0, 0xc71e39, 
-    0xc72882, 0xc732ca, 0xc73d12, 0xc74759, 0xc751a0, 
-    0xc75be6, 0xc7662b, 0xc77070, 0xc77ab5, 0xc784f9, 
-    0xc78f3c, 0xc7997f, 0xc7a3c2, 0xc7ae04, 0xc7b845, 
-    0xc7c286, 0xc7ccc6, 0xc7d706, 0xc7e145, 0xc7eb84, 
-    0xc7f5c2, 0xc80000, 0xc80a3d, 0xc8147a, 0xc81eb6, 
-    0xc828f2, 0xc8332d, 0xc83d67, 0xc847a1, 0xc851db, 
-    0xc85c14, 0xc8664c, 0xc87084, 0xc87abc, 0xc884f3, 
-    0xc88f29, 0xc8995f, 0xc8a394, 0xc8adc9, 0xc8b7fd, 
-    0xc8c231, 0xc8cc64, 0xc8d697, 0xc8e0c9, 0xc8eafb, 
-    0xc8f52c, 0xc8ff5d, 0xc9098d, 0xc913bd, 0xc91dec, 
-    0xc9281b, 0xc93249, 0xc93c76, 0xc946a3, 0xc950d0, 
-    0xc95afc, 0xc96528, 0xc96f53, 0xc9797d, 0xc983a7, 
-    0xc98dd1, 0xc997f9, 0xc9a222, 0xc9ac4a, 0xc9b671, 
-    0xc9c098, 0xc9cabf, 0xc9d4e5, 0xc9df0a, 0xc9e92f, 
-    0xc9f353, 0xc9fd77, 0xca079a, 0xca11bd, 0xca1be0, 
-    0xca2601, 0xca3023, 0xca3a44, 0xca4464, 0xca4e84, 
-    0xca58a3, 0xca62c2, 0xca6ce0, 0xca76fe, 0xca811b, 
-    0xca8b38, 0xca9554, 0xca9f70, 0xcaa98b, 0xcab3a6, 
-    0xcabdc0, 0xcac7da, 0xcad1f3, 0xcadc0c, 0xcae624, 
-    0xcaf03c, 0xcafa53, 0xcb046a, 0xcb0e80, 0xcb1896, 
-    0xcb22ab, 0xcb2cc0, 0xcb36d4, 0xcb40e8, 0xcb4afb, 
-    0xcb550e, 0xcb5f20, 0xcb6932, 0xcb7343, 0xcb7d54, 
-    0xcb8764, 0xcb9174, 0xcb9b83, 0xcba592, 0xcbafa0, 
-    0xcbb9ae, 0xcbc3bb, 0xcbcdc8, 0xcbd7d4, 0xcbe1e0, 
-    0xcbebeb, 0xcbf5f6, 0xcc0000, 0xcc0a0a, 0xcc1413, 
-    0xcc1e1c, 0xcc2824, 0xcc322c, 0xcc3c33, 0xcc463a, 
-    0xcc5041, 0xcc5a46, 0xcc644c, 0xcc6e51, 0xcc7855, 
-    0xcc8259, 0xcc8c5c, 0xcc965f, 0xcca062, 0xccaa64, 
-    0xccb465, 0xccbe66, 0xccc866, 0xccd266, 0xccdc66, 
-    0xcce665, 0xccf063, 0xccfa61, 0xcd045f, 0xcd0e5c, 
-    0xcd1858, 0xcd2255, 0xcd2c50, 0xcd364b, 0xcd4046, 
-    0xcd4a40, 0xcd543a, 0xcd5e33, 0xcd682b, 0xcd7224, 
-    0xcd7c1b, 0xcd8613, 0xcd9009, 0xcd9a00, 0xcda3f5, 
-    0xcdadeb, 0xcdb7df, 0xcdc1d4, 0xcdcbc8, 0xcdd5bb, 
-    0xcddfae, 0xcde9a0, 0xcdf392, 0xcdfd84, 0xce0775, 
-    0xce1165, 0xce1b55, 0xce2545, 0xce2f34, 0xce3922, 
-    0xce4310, 0xce4cfe, 0xce56eb, 0xce60d8, 0xce6ac4, 
-    0xce74b0, 0xce7e9b, 0xce8886, 0xce9270, 0xce9c5a, 
-    0xcea643, 0xceb02c, 0xceba14, 0xcec3fc, 0xcecde4, 
-    0xced7cb, 0xcee1b1, 0xceeb97, 0xcef57d, 0xceff62, 
-    0xcf0946, 0xcf132a, 0xcf1d0e, 0xcf26f1, 0xcf30d4, 
-    0xcf3ab6, 0xcf4498, 0xcf4e79, 0xcf585a, 0xcf623a, 
-    0xcf6c1a, 0xcf75fa, 0xcf7fd9, 0xcf89b7, 0xcf9395, 
-    0xcf9d72, 0xcfa750, 0xcfb12c, 0xcfbb08, 0xcfc4e4, 
-    0xcfcebf, 0xcfd89a, 0xcfe274, 0xcfec4e, 0xcff627, 
-    0xd00000, 0xd009d8, 0xd013b0, 0xd01d88, 0xd0275f, 
-    0xd03135, 0xd03b0b, 0xd044e1, 0xd04eb6, 0xd0588b, 
-    0xd0625f, 0xd06c33, 0xd07606, 0xd07fd9, 0xd089ab, 
-    0xd0937d, 0xd09d4e, 0xd0a71f, 0xd0b0f0, 0xd0bac0, 
-    0xd0c48f, 0xd0ce5f, 0xd0d82d, 0xd0e1fb, 0xd0ebc9, 
-    0xd0f596, 0xd0ff63, 0xd10930, 0xd112fb, 0xd11cc7, 
-    0xd12692, 0xd1305c, 0xd13a26, 0xd143f0, 0xd14db9, 
-    0xd15782, 0xd1614a, 0xd16b12, 0xd174d9, 0xd17ea0, 
-    0xd18866, 0xd1922c, 0xd19bf2, 0xd1a5b7, 0xd1af7c, 
-    0xd1b940, 0xd1c303, 0xd1ccc7, 0xd1d689, 0xd1e04c, 
-    0xd1ea0d, 0xd1f3cf, 0xd1fd90, 0xd20750, 0xd21110, 
-    0xd21ad0, 0xd2248f, 0xd22e4e, 0xd2380c, 0xd241ca, 
-    0xd24b87, 0xd25544, 0xd25f00, 0xd268bc, 0xd27278, 
-    0xd27c33, 0xd285ee, 0xd28fa8, 0xd29962, 0xd2a31b, 
-    0xd2acd4, 0xd2b68c, 0xd2c044, 0xd2c9fc, 0xd2d3b3, 
-    0xd2dd69, 0xd2e71f, 0xd2f0d5, 0xd2fa8a, 0xd3043f, 
-    0xd30df3, 0xd317a7, 0xd3215b, 0xd32b0e, 0xd334c0, 
-    0xd33e73, 0xd34824, 0xd351d5, 0xd35b86, 0xd36537, 
-    0xd36ee6, 0xd37896, 0xd38245, 0xd38bf4, 0xd395a2, 
-    0xd39f4f, 0xd3a8fd, 0xd3b2a9, 0xd3bc56, 0xd3c602, 
-    0xd3cfad, 0xd3d958, 0xd3e303, 0xd3ecad, 0xd3f657, 
-    0xd40000, 0xd409a9, 0xd41351, 0xd41cf9, 0xd426a1, 
-    0xd43048, 0xd439ee, 0xd44395, 0xd44d3a, 0xd456e0, 
-    0xd46085, 0xd46a29, 0xd473cd, 0xd47d71, 0xd48714, 
-    0xd490b6, 0xd49a59, 0xd4a3fb, 0xd4ad9c, 0xd4b73d, 
-    0xd4c0dd, 0xd4ca7d, 0xd4d41d, 0xd4ddbc, 0xd4e75b, 
-    0xd4f0f9, 0xd4fa97, 0xd50435, 0xd50dd2, 0xd5176e, 
-    0xd5210b, 0xd52aa6, 0xd53442, 0xd53ddd, 0xd54777, 
-    0xd55111, 0xd55aab, 0xd56444, 0xd56ddc, 0xd57775, 
-    0xd5810d, 0xd58aa4, 0xd5943b, 0xd59dd2, 0xd5a768, 
-    0xd5b0fd, 0xd5ba93, 0xd5c427, 0xd5cdbc, 0xd5d750, 
-    0xd5e0e3, 0xd5ea77, 0xd5f409, 0xd5fd9c, 0xd6072d, 
-    0xd610bf, 0xd61a50, 0xd623e0, 0xd62d70, 0xd63700, 
-    0xd6408f, 0xd64a1e, 0xd653ad, 0xd65d3b, 0xd666c8, 
-    0xd67055, 0xd679e2, 0xd6836e, 0xd68cfa, 0xd69686, 
-    0xd6a011, 0xd6a99b, 0xd6b325, 0xd6bcaf, 0xd6c639, 
-    0xd6cfc1, 0xd6d94a, 0xd6e2d2, 0xd6ec5a, 0xd6f5e1, 
-    0xd6ff68, 0xd708ee, 0xd71274, 0xd71bf9, 0xd7257f, 
-    0xd72f03, 0xd73887, 0xd7420b, 0xd74b8f, 0xd75512, 
-    0xd75e94, 0xd76816, 0xd77198, 0xd77b19, 0xd7849a, 
-    0xd78e1b, 0xd7979b, 0xd7a11b, 0xd7aa9a, 0xd7b419, 
-    0xd7bd97, 0xd7c715, 0xd7d092, 0xd7da10, 0xd7e38c, 
-    0xd7ed09, 0xd7f685, 0xd80000, 0xd8097b, 0xd812f6, 
-    0xd81c70, 0xd825ea, 0xd82f63, 0xd838dc, 0xd84255, 
-    0xd84bcd, 0xd85545, 0xd85ebc, 0xd86833, 0xd871a9, 
-    0xd87b1f, 0xd88495, 0xd88e0a, 0xd8977f, 0xd8a0f3, 
-    0xd8aa67, 0xd8b3db, 0xd8bd4e, 0xd8c6c1, 0xd8d033, 
-    0xd8d9a5, 0xd8e317, 0xd8ec88, 0xd8f5f9, 0xd8ff69, 
-    0xd908d9, 0xd91248, 0xd91bb7, 0xd92526, 0xd92e94, 
-    0xd93802, 0xd94170, 0xd94add, 0xd95449, 0xd95db5, 
-    0xd96721, 0xd9708d, 0xd979f8, 0xd98362, 0xd98ccc, 
-    0xd99636, 0xd99fa0, 0xd9a908, 0xd9b271, 0xd9bbd9, 
-    0xd9c541, 0xd9cea8, 0xd9d80f, 0xd9e176, 0xd9eadc, 
-    0xd9f441, 0xd9fda7, 0xda070c, 0xda1070, 0xda19d4, 
-    0xda2338, 0xda2c9b, 0xda35fe, 0xda3f60, 0xda48c3, 
-    0xda5224, 0xda5b85, 0xda64e6, 0xda6e47, 0xda77a7, 
-    0xda8106, 0xda8a66, 0xda93c5, 0xda9d23, 0xdaa681, 
-    0xdaafdf, 0xdab93c, 0xdac299, 0xdacbf5, 0xdad551, 
-    0xdadead, 0xdae808, 0xdaf163, 0xdafabd, 0xdb0417, 
-    0xdb0d71, 0xdb16ca, 0xdb2023, 0xdb297b, 0xdb32d4, 
-    0xdb3c2b, 0xdb4582, 0xdb4ed9, 0xdb5830, 0xdb6186, 
-    0xdb6adb, 0xdb7431, 0xdb7d86, 0xdb86da, 0xdb902e, 
-    0xdb9982, 0xdba2d5, 0xdbac28, 0xdbb57a, 0xdbbecc, 
-    0xdbc81e, 0xdbd16f, 0xdbdac0, 0xdbe411, 0xdbed61, 
-    0xdbf6b1, 0xdc0000, 0xdc094f, 0xdc129d, 0xdc1bec, 
-    0xdc2539, 0xdc2e87, 0xdc37d4, 0xdc4120, 0xdc4a6c, 
-    0xdc53b8, 0xdc5d04, 0xdc664f, 0xdc6f99, 0xdc78e3, 
-    0xdc822d, 0xdc8b77, 0xdc94c0, 0xdc9e08, 0xdca751, 
-    0xdcb099, 0xdcb9e0, 0xdcc327, 0xdccc6e, 0xdcd5b4, 
-    0xdcdefa, 0xdce840, 0xdcf185, 0xdcfac9, 0xdd040e, 
-    0xdd0d52, 0xdd1695, 0xdd1fd9, 0xdd291b, 0xdd325e, 
-    0xdd3ba0, 0xdd44e2, 0xdd4e23, 0xdd5764, 0xdd60a4, 
-    0xdd69e4, 0xdd7324, 0xdd7c63, 0xdd85a2, 0xdd8ee1, 
-    0xdd981f, 0xdda15d, 0xddaa9a, 0xddb3d7, 0xddbd14, 
-    0xddc650, 0xddcf8c, 0xddd8c7, 0xdde203, 0xddeb3d, 
-    0xddf478, 0xddfdb2, 0xde06eb, 0xde1024, 0xde195d, 
-    0xde2296, 0xde2bce, 0xde3505, 0xde3e3c, 0xde4773, 
-    0xde50aa, 0xde59e0, 0xde6316, 0xde6c4b, 0xde7580, 
-    0xde7eb5, 0xde87e9, 0xde911d, 0xde9a50, 0xdea383, 
-    0xdeacb6, 0xdeb5e8, 0xdebf1a, 0xdec84c, 0xded17d, 
-    0xdedaae, 0xdee3de, 0xdeed0e, 0xdef63e, 0xdeff6d, 
-    0xdf089c, 0xdf11ca, 0xdf1af9, 0xdf2426, 0xdf2d54, 
-    0xdf3681, 0xdf3fad, 0xdf48da, 0xdf5206, 0xdf5b31, 
-    0xdf645c, 0xdf6d87, 0xdf76b1, 0xdf7fdb, 0xdf8905, 
-    0xdf922e, 0xdf9b57, 0xdfa480, 0xdfada8, 0xdfb6cf, 
-    0xdfbff7, 0xdfc91e, 0xdfd244, 0xdfdb6b, 0xdfe491, 
-    0xdfedb6, 0xdff6db, 0xe00000, 0xe00924, 0xe01248, 
-    0xe01b6c, 0xe0248f, 0xe02db2, 0xe036d5, 0xe03ff7, 
-    0xe04919, 0xe0523a, 0xe05b5b, 0xe0647c, 0xe06d9c, 
-    0xe076bc, 0xe07fdc, 0xe088fb, 0xe09219, 0xe09b38, 
-    0xe0a456, 0xe0ad74, 0xe0b691, 0xe0bfae, 0xe0c8cb, 
-    0xe0d1e7, 0xe0db03, 0xe0e41e, 0xe0ed39, 0xe0f654, 
-    0xe0ff6e, 0xe10888, 0xe111a2, 0xe11abb, 0xe123d4, 
-    0xe12ced, 0xe13605, 0xe13f1d, 0xe14834, 0xe1514b, 
-    0xe15a62, 0xe16378, 0xe16c8e, 0xe175a4, 0xe17eb9, 
-    0xe187ce, 0xe190e2, 0xe199f7, 0xe1a30a, 0xe1ac1e, 
-    0xe1b531, 0xe1be43, 0xe1c756, 0xe1d068, 0xe1d979, 
-    0xe1e28b, 0xe1eb9b, 0xe1f4ac, 0xe1fdbc, 0xe206cc, 
-    0xe20fdb, 0xe218ea, 0xe221f9, 0xe22b07, 0xe23415, 
-    0xe23d23, 0xe24630, 0xe24f3d, 0xe25849, 0xe26156, 
-    0xe26a61, 0xe2736d, 0xe27c78, 0xe28582, 0xe28e8d, 
-    0xe29797, 0xe2a0a0, 0xe2a9aa, 0xe2b2b3, 0xe2bbbb, 
-    0xe2c4c3, 0xe2cdcb, 0xe2d6d3, 0xe2dfda, 0xe2e8e0, 
-    0xe2f1e7, 0xe2faed, 0xe303f2, 0xe30cf8, 0xe315fd, 
-    0xe31f01, 0xe32805, 0xe33109, 0xe33a0d, 0xe34310, 
-    0xe34c13, 0xe35515, 0xe35e17, 0xe36719, 0xe3701a, 
-    0xe3791b, 0xe3821c, 0xe38b1c, 0xe3941c, 0xe39d1c, 
-    0xe3a61b, 0xe3af1a, 0xe3b819, 0xe3c117, 0xe3ca15, 
-    0xe3d312, 0xe3dc0f, 0xe3e50c, 0xe3ee08, 0xe3f704, 
-    0xe40000, 0xe408fb, 0xe411f6, 0xe41af1, 0xe423eb, 
-    0xe42ce5, 0xe435df, 0xe43ed8, 0xe447d1, 0xe450c9, 
-    0xe459c1, 0xe462b9, 0xe46bb1, 0xe474a8, 0xe47d9f, 
-    0xe48695, 0xe48f8b, 0xe49881, 0xe4a176, 0xe4aa6b, 
-    0xe4b360, 0xe4bc54, 0xe4c548, 0xe4ce3b, 0xe4d72f, 
-    0xe4e022, 0xe4e914, 0xe4f206, 0xe4faf8, 0xe503ea, 
-    0xe50cdb, 0xe515cc, 0xe51ebc, 0xe527ac, 0xe5309c, 
-    0xe5398b, 0xe5427a, 0xe54b69, 0xe55457, 0xe55d45, 
-    0xe56633, 0xe56f20, 0xe5780d, 0xe580fa, 0xe589e6, 
-    0xe592d2, 0xe59bbe, 0xe5a4a9, 0xe5ad94, 0xe5b67e, 
-    0xe5bf68, 0xe5c852, 0xe5d13c, 0xe5da25, 0xe5e30e, 
-    0xe5ebf6, 0xe5f4de, 0xe5fdc6, 0xe606ae, 0xe60f95, 
-    0xe6187b, 0xe62162, 0xe62a48, 0xe6332e, 0xe63c13, 
-    0xe644f8, 0xe64ddd, 0xe656c1, 0xe65fa5, 0xe66889, 
-    0xe6716c, 0xe67a4f, 0xe68331, 0xe68c14, 0xe694f6, 
-    0xe69dd7, 0xe6a6b8, 0xe6af99, 0xe6b87a, 0xe6c15a, 
-    0xe6ca3a, 0xe6d31a, 0xe6dbf9, 0xe6e4d8, 0xe6edb6, 
-    0xe6f694, 0xe6ff72, 0xe70850, 0xe7112d, 0xe71a0a, 
-    0xe722e6, 0xe72bc2, 0xe7349e, 0xe73d79, 0xe74655, 
-    0xe74f2f, 0xe7580a, 0xe760e4, 0xe769be, 0xe77297, 
-    0xe77b70, 0xe78449, 0xe78d21, 0xe795f9, 0xe79ed1, 
-    0xe7a7a9, 0xe7b080, 0xe7b956, 0xe7c22d, 0xe7cb03, 
-    0xe7d3d8, 0xe7dcae, 0xe7e583, 0xe7ee58, 0xe7f72c, 
-    0xe80000, 0xe808d4, 0xe811a7, 0xe81a7a, 0xe8234d, 
-    0xe82c1f, 0xe834f1, 0xe83dc3, 0xe84694, 0xe84f65, 
-    0xe85836, 0xe86106, 0xe869d6, 0xe872a6, 0xe87b75, 
-    0xe88444, 0xe88d13, 0xe895e1, 0xe89eaf, 0xe8a77d, 
-    0xe8b04a, 0xe8b917, 0xe8c1e4, 0xe8cab0, 0xe8d37c, 
-    0xe8dc48, 0xe8e513, 0xe8edde, 0xe8f6a9, 0xe8ff73, 
-    0xe9083d, 0xe91107, 0xe919d0, 0xe92299, 0xe92b62, 
-    0xe9342b, 0xe93cf3, 0xe945ba, 0xe94e82, 0xe95749, 
-    0xe9600f, 0xe968d6, 0xe9719c, 0xe97a62, 0xe98327, 
-    0xe98bec, 0xe994b1, 0xe99d75, 0xe9a639, 0xe9aefd, 
-    0xe9b7c0, 0xe9c083, 0xe9c946, 0xe9d209, 0xe9dacb, 
-    0xe9e38c, 0xe9ec4e, 0xe9f50f, 0xe9fdd0, 0xea0690, 
-    0xea0f50, 0xea1810, 0xea20d0, 0xea298f, 0xea324e, 
-    0xea3b0c, 0xea43ca, 0xea4c88, 0xea5546, 0xea5e03, 
-    0xea66c0, 0xea6f7c, 0xea7839, 0xea80f5, 0xea89b0, 
-    0xea926b, 0xea9b26, 0xeaa3e1, 0xeaac9b, 0xeab555, 
-    0xeabe0f, 0xeac6c8, 0xeacf81, 0xead83a, 0xeae0f2, 
-    0xeae9aa, 0xeaf262, 0xeafb19, 0xeb03d0, 0xeb0c87, 
-    0xeb153d, 0xeb1df3, 0xeb26a9, 0xeb2f5e, 0xeb3813, 
-    0xeb40c8, 0xeb497d, 0xeb5231, 0xeb5ae5, 0xeb6398, 
-    0xeb6c4b, 0xeb74fe, 0xeb7db1, 0xeb8663, 0xeb8f15, 
-    0xeb97c6, 0xeba078, 0xeba928, 0xebb1d9, 0xebba89, 
-    0xebc339, 0xebcbe9, 0xebd498, 0xebdd47, 0xebe5f6, 
-    0xebeea4, 0xebf752, 0xec0000, 0xec08ad, 0xec115a, 
-    0xec1a07, 0xec22b4, 0xec2b60, 0xec340c, 0xec3cb7, 
-    0xec4562, 0xec4e0d, 0xec56b8, 0xec5f62, 0xec680c, 
-    0xec70b5, 0xec795f, 0xec8208, 0xec8ab0, 0xec9359, 
-    0xec9c01, 0xeca4a8, 0xecad50, 0xecb5f7, 0xecbe9d, 
-    0xecc744, 0xeccfea, 0xecd890, 0xece135, 0xece9da, 
-    0xecf27f, 0xecfb24, 0xed03c8, 0xed0c6c, 0xed150f, 
-    0xed1db3, 0xed2655, 0xed2ef8, 0xed379a, 0xed403c, 
-    0xed48de, 0xed517f, 0xed5a21, 0xed62c1, 0xed6b62, 
-    0xed7402, 0xed7ca2, 0xed8541, 0xed8de0, 0xed967f, 
-    0xed9f1e, 0xeda7bc, 0xedb05a, 0xedb8f8, 0xedc195, 
-    0xedca32, 0xedd2cf, 0xeddb6b, 0xede407, 0xedeca3, 
-    0xedf53e, 0xedfdd9, 0xee0674, 0xee0f0f, 0xee17a9, 
-    0xee2043, 0xee28dc, 0xee3175, 0xee3a0e, 0xee42a7, 
-    0xee4b3f, 0xee53d7, 0xee5c6f, 0xee6507, 0xee6d9e, 
-    0xee7634, 0xee7ecb, 0xee8761, 0xee8ff7, 0xee988c, 
-    0xeea122, 0xeea9b7, 0xeeb24b, 0xeebae0, 0xeec374, 
-    0xeecc07, 0xeed49b, 0xeedd2e, 0xeee5c0, 0xeeee53, 
-    0xeef6e5, 0xeeff77, 0xef0808, 0xef109a, 0xef192b, 
-    0xef21bb, 0xef2a4c, 0xef32dc, 0xef3b6b, 0xef43fb, 
-    0xef4c8a, 0xef5518, 0xef5da7, 0xef6635, 0xef6ec3, 
-    0xef7751, 0xef7fde, 0xef886b, 0xef90f7, 0xef9984, 
-    0xefa210, 0xefaa9b, 0xefb327, 0xefbbb2, 0xefc43d, 
-    0xefccc7, 0xefd552, 0xefdddb, 0xefe665, 0xefeeee, 
-    0xeff777, 0xf00000, 0xf00888, 0xf01110, 0xf01998, 
-    0xf02220, 0xf02aa7, 0xf0332e, 0xf03bb4, 0xf0443b, 
-    0xf04cc1, 0xf05546, 0xf05dcc, 0xf06651, 0xf06ed5, 
-    0xf0775a, 0xf07fde, 0xf08862, 0xf090e5, 0xf09969, 
-    0xf0a1ec, 0xf0aa6e, 0xf0b2f0, 0xf0bb73, 0xf0c3f4, 
-    0xf0cc76, 0xf0d4f7, 0xf0dd78, 0xf0e5f8, 0xf0ee78, 
-    0xf0f6f8, 0xf0ff78, 0xf107f7, 0xf11076, 0xf118f5, 
-    0xf12174, 0xf129f2, 0xf13270, 0xf13aed, 0xf1436a, 
-    0xf14be7, 0xf15464, 0xf15ce0, 0xf1655c, 0xf16dd8, 
-    0xf17654, 0xf17ecf, 0xf1874a, 0xf18fc4, 0xf1983e, 
-    0xf1a0b8, 0xf1a932, 0xf1b1ab, 0xf1ba24, 0xf1c29d, 
-    0xf1cb16, 0xf1d38e, 0xf1dc06, 0xf1e47d, 0xf1ecf5, 
-    0xf1f56c, 0xf1fde2, 0xf20659, 0xf20ecf, 0xf21745, 
-    0xf21fba, 0xf2282f, 0xf230a4, 0xf23919, 0xf2418d, 
-    0xf24a01, 0xf25275, 0xf25ae9, 0xf2635c, 0xf26bcf, 
-    0xf27441, 0xf27cb3, 0xf28525, 0xf28d97, 0xf29609, 
-    0xf29e7a, 0xf2a6ea, 0xf2af5b, 0xf2b7cb, 0xf2c03b, 
-    0xf2c8ab, 0xf2d11a, 0xf2d989, 0xf2e1f8, 0xf2ea66, 
-    0xf2f2d4, 0xf2fb42, 0xf303b0, 0xf30c1d, 0xf3148a, 
-    0xf31cf7, 0xf32563, 0xf32dcf, 0xf3363b, 0xf33ea7, 
-    0xf34712, 0xf34f7d, 0xf357e8, 0xf36052, 0xf368bc, 
-    0xf37126, 0xf3798f, 0xf381f9, 0xf38a62, 0xf392ca, 
-    0xf39b33, 0xf3a39b, 0xf3ac02, 0xf3b46a, 0xf3bcd1, 
-    0xf3c538, 0xf3cd9e, 0xf3d605, 0xf3de6b, 0xf3e6d1, 
-    0xf3ef36, 0xf3f79b, 0xf40000, 0xf40865, 0xf410c9, 
-    0xf4192d, 0xf42191, 0xf429f4, 0xf43257, 0xf43aba, 
-    0xf4431d, 0xf44b7f, 0xf453e1, 0xf45c42, 0xf464a4, 
-    0xf46d05, 0xf47566, 0xf47dc6, 0xf48627, 0xf48e87, 
-    0xf496e6, 0xf49f46, 0xf4a7a5, 0xf4b004, 0xf4b862, 
-    0xf4c0c0, 0xf4c91e, 0xf4d17c, 0xf4d9da, 0xf4e237, 
-    0xf4ea93, 0xf4f2f0, 0xf4fb4c, 0xf503a8, 0xf50c04, 
-    0xf5145f, 0xf51cba, 0xf52515, 0xf52d70, 0xf535ca, 
-    0xf53e24, 0xf5467e, 0xf54ed7, 0xf55730, 0xf55f89, 
-    0xf567e2, 0xf5703a, 0xf57892, 0xf580ea, 0xf58941, 
-    0xf59198, 0xf599ef, 0xf5a246, 0xf5aa9c, 0xf5b2f2, 
-    0xf5bb48, 0xf5c39d, 0xf5cbf2, 0xf5d447, 0xf5dc9c, 
-    0xf5e4f0, 0xf5ed44, 0xf5f598, 0xf5fdeb, 0xf6063e, 
-    0xf60e91, 0xf616e4, 0xf61f36, 0xf62788, 0xf62fda, 
-    0xf6382c, 0xf6407d, 0xf648ce, 0xf6511e, 0xf6596f, 
-    0xf661bf, 0xf66a0f, 0xf6725e, 0xf67aad, 0xf682fc, 
-    0xf68b4b, 0xf69399, 0xf69be8, 0xf6a435, 0xf6ac83, 
-    0xf6b4d0, 0xf6bd1d, 0xf6c56a, 0xf6cdb6, 0xf6d603, 
-    0xf6de4f, 0xf6e69a, 0xf6eee5, 0xf6f731, 0xf6ff7b, 
-    0xf707c6, 0xf71010, 0xf7185a, 0xf720a4, 0xf728ed, 
-    0xf73136, 0xf7397f, 0xf741c8, 0xf74a10, 0xf75258, 
-    0xf75aa0, 0xf762e7, 0xf76b2e, 0xf77375, 0xf77bbc, 
-    0xf78402, 0xf78c48, 0xf7948e, 0xf79cd3, 0xf7a519, 
-    0xf7ad5e, 0xf7b5a2, 0xf7bde7, 0xf7c62b, 0xf7ce6f, 
-    0xf7d6b2, 0xf7def6, 0xf7e739, 0xf7ef7b, 0xf7f7be, 
-    0xf80000, 0xf80842, 0xf81084, 0xf818c5, 0xf82106, 
-    0xf82947, 0xf83187, 0xf839c8, 0xf84208, 0xf84a47, 
-    0xf85287, 0xf85ac6, 0xf86305, 0xf86b44, 0xf87382, 
-    0xf87bc0, 0xf883fe, 0xf88c3b, 0xf89479, 0xf89cb6, 
-    0xf8a4f2, 0xf8ad2f, 0xf8b56b, 0xf8bda7, 0xf8c5e3, 
-    0xf8ce1e, 0xf8d659, 0xf8de94, 0xf8e6ce, 0xf8ef09, 
-    0xf8f743, 0xf8ff7c, 0xf907b6, 0xf90fef, 0xf91828, 
-    0xf92061, 0xf92899, 0xf930d1, 0xf93909, 0xf94140, 
-    0xf94978, 0xf951af, 0xf959e5, 0xf9621c, 0xf96a52, 
-    0xf97288, 0xf97abe, 0xf982f3, 0xf98b28, 0xf9935d, 
-    0xf99b92, 0xf9a3c6, 0xf9abfa, 0xf9b42e, 0xf9bc61, 
-    0xf9c495, 0xf9ccc8, 0xf9d4fa, 0xf9dd2d, 0xf9e55f, 
-    0xf9ed91, 0xf9f5c2, 0xf9fdf4, 0xfa0625, 0xfa0e56, 
-    0xfa1686, 0xfa1eb6, 0xfa26e6, 0xfa2f16, 0xfa3746, 
-    0xfa3f75, 0xfa47a4, 0xfa4fd2, 0xfa5801, 0xfa602f, 
-    0xfa685d, 0xfa708b, 0xfa78b8, 0xfa80e5, 0xfa8912, 
-    0xfa913e, 0xfa996b, 0xfaa197, 0xfaa9c2, 0xfab1ee, 
-    0xfaba19, 0xfac244, 0xfaca6f, 0xfad299, 0xfadac3, 
-    0xfae2ed, 0xfaeb17, 0xfaf340, 0xfafb69, 0xfb0392, 
-    0xfb0bba, 0xfb13e3, 0xfb1c0b, 0xfb2432, 0xfb2c5a, 
-    0xfb3481, 0xfb3ca8, 0xfb44cf, 0xfb4cf5, 0xfb551b, 
-    0xfb5d41, 0xfb6567, 0xfb6d8c, 0xfb75b1, 0xfb7dd6, 
-    0xfb85fb, 0xfb8e1f, 0xfb9643, 0xfb9e67, 0xfba68b, 
-    0xfbaeae, 0xfbb6d1, 0xfbbef4, 0xfbc716, 0xfbcf38, 
-    0xfbd75a, 0xfbdf7c, 0xfbe79d, 0xfbefbe, 0xfbf7df, 
-    0xfc0000, 0xfc0820, 0xfc1040, 0xfc1860, 0xfc2080, 
-    0xfc289f, 0xfc30be, 0xfc38dd, 0xfc40fc, 0xfc491a, 
-    0xfc5138, 0xfc5956, 0xfc6173, 0xfc6990, 0xfc71ad, 
-    0xfc79ca, 0xfc81e7, 0xfc8a03, 0xfc921f, 0xfc9a3a, 
-    0xfca256, 0xfcaa71, 0xfcb28c, 0xfcbaa7, 0xfcc2c1, 
-    0xfccadb, 0xfcd2f5, 0xfcdb0f, 0xfce328, 0xfceb41, 
-    0xfcf35a, 0xfcfb72, 0xfd038b, 0xfd0ba3, 0xfd13ba, 
-    0xfd1bd2, 0xfd23e9, 0xfd2c00, 0xfd3417, 0xfd3c2d, 
-    0xfd4444, 0xfd4c5a, 0xfd546f, 0xfd5c85, 0xfd649a, 
-    0xfd6caf, 0xfd74c4, 0xfd7cd8, 0xfd84ec, 0xfd8d00, 
-    0xfd9514, 0xfd9d27, 0xfda53a, 0xfdad4d, 0xfdb560, 
-    0xfdbd72, 0xfdc584, 0xfdcd96, 0xfdd5a8, 0xfdddb9, 
-    0xfde5ca, 0xfdeddb, 0xfdf5ec, 0xfdfdfc, 0xfe060c, 
-    0xfe0e1c, 0xfe162b, 0xfe1e3b, 0xfe264a, 0xfe2e58, 
-    0xfe3667, 0xfe3e75, 0xfe4683, 0xfe4e91, 0xfe569f, 
-    0xfe5eac, 0xfe66b9, 0xfe6ec6, 0xfe76d2, 0xfe7ede, 
-    0xfe86ea, 0xfe8ef6, 0xfe9701, 0xfe9f0d, 0xfea718, 
-    0xfeaf22, 0xfeb72d, 0xfebf37, 0xfec741, 0xfecf4b, 
-    0xfed754, 0xfedf5d, 0xfee766, 0xfeef6f, 0xfef777, 
-    0xfeff7f, 0xff0787, 0xff0f8f, 0xff1797, 0xff1f9e, 
-    0xff27a5, 0xff2fab, 0xff37b2, 0xff3fb8, 0xff47be, 
-    0xff4fc3, 0xff57c9, 0xff5fce, 0xff67d3, 0xff6fd7, 
-    0xff77dc, 0xff7fe0, 0xff87e4, 0xff8fe7, 0xff97eb, 
-    0xff9fee, 0xffa7f1, 0xffaff3, 0xffb7f6, 0xffbff8, 
-    0xffc7fa, 0xffcffb, 0xffd7fd, 0xffdffe, 0xffe7ff, 
-    0xffefff, 0xfff800
-};
-#else
-#if ML_FIXED_RADIX == 12
-static unsigned long sqrtLUT[] = { 
-    0x80000, 0x800ff, 0x801ff, 0x802ff, 0x803ff, 
-    0x804fe, 0x805fd, 0x806fc, 0x807fc, 0x808fa, 
-    0x809f9, 0x80af8, 0x80bf7, 0x80cf5, 0x80df3, 
-    0x80ef2, 0x80ff0, 0x810ee, 0x811eb, 0x812e9, 
-    0x813e7, 0x814e4, 0x815e2, 0x816df, 0x817dc, 
-    0x818d9, 0x819d6, 0x81ad3, 0x81bcf, 0x81ccc, 
-    0x81dc8, 0x81ec4, 0x81fc1, 0x820bd, 0x821b8, 
-    0x822b4, 0x823b0, 0x824ab, 0x825a7, 0x826a2, 
-    0x8279d, 0x82899, 0x82993, 0x82a8e, 0x82b89, 
-    0x82c84, 0x82d7e, 0x82e79, 0x82f73, 0x8306d, 
-    0x83167, 0x83261, 0x8335b, 0x83454, 0x8354e, 
-    0x83647, 0x83741, 0x8383a, 0x83933, 0x83a2c, 
-    0x83b25, 0x83c1e, 0x83d16, 0x83e0f, 0x83f07, 
-    0x84000, 0x840f8, 0x841f0, 0x842e8, 0x843e0, 
-    0x844d7, 0x845cf, 0x846c6, 0x847be, 0x848b5, 
-    0x849ac, 0x84aa3, 0x84b9a, 0x84c91, 0x84d88, 
-    0x84e7e, 0x84f75, 0x8506b, 0x85162, 0x85258, 
-    0x8534e, 0x85444, 0x8553a, 0x8562f, 0x85725, 
-    0x8581a, 0x85910, 0x85a05, 0x85afa, 0x85bef, 
-    0x85ce4, 0x85dd9, 0x85ece, 0x85fc2, 0x860b7, 
-    0x861ab, 0x862a0, 0x86394, 0x86488, 0x8657c, 
-    0x86670, 0x86763, 0x86857, 0x8694b, 0x86a3e, 
-    0x86b31, 0x86c25, 0x86d18, 0x86e0b, 0x86efe, 
-    0x86ff0, 0x870e3, 0x871d6, 0x872c8, 0x873ba, 
-    0x874ad, 0x8759f, 0x87691, 0x87783, 0x87875, 
-    0x87966, 0x87a58, 0x87b4a, 0x87c3b, 0x87d2c, 
-    0x87e1d, 0x87f0f, 0x88000, 0x880f0, 0x881e1, 
-    0x882d2, 0x883c2, 0x884b3, 0x885a3, 0x88694, 
-    0x88784, 0x88874, 0x88964, 0x88a54, 0x88b43, 
-    0x88c33, 0x88d23, 0x88e12, 0x88f01, 0x88ff1, 
-    0x890e0, 0x891cf, 0x892be, 0x893ad, 0x8949b, 
-    0x8958a, 0x89678, 0x89767, 0x89855, 0x89943, 
-    0x89a32, 0x89b20, 0x89c0d, 0x89cfb, 0x89de9, 
-    0x89ed7, 0x89fc4, 0x8a0b2, 0x8a19f, 0x8a28c, 
-    0x8a379, 0x8a466, 0x8a553, 0x8a640, 0x8a72d, 
-    0x8a819, 0x8a906, 0x8a9f2, 0x8aadf, 0x8abcb, 
-    0x8acb7, 0x8ada3, 0x8ae8f, 0x8af7b, 0x8b067, 
-    0x8b152, 0x8b23e, 0x8b329, 0x8b415, 0x8b500, 
-    0x8b5eb, 0x8b6d6, 0x8b7c1, 0x8b8ac, 0x8b997, 
-    0x8ba81, 0x8bb6c, 0x8bc57, 0x8bd41, 0x8be2b, 
-    0x8bf15, 0x8c000, 0x8c0ea, 0x8c1d3, 0x8c2bd, 
-    0x8c3a7, 0x8c491, 0x8c57a, 0x8c664, 0x8c74d, 
-    0x8c836, 0x8c91f, 0x8ca08, 0x8caf1, 0x8cbda, 
-    0x8ccc3, 0x8cdac, 0x8ce94, 0x8cf7d, 0x8d065, 
-    0x8d14e, 0x8d236, 0x8d31e, 0x8d406, 0x8d4ee, 
-    0x8d5d6, 0x8d6bd, 0x8d7a5, 0x8d88d, 0x8d974, 
-    0x8da5b, 0x8db43, 0x8dc2a, 0x8dd11, 0x8ddf8, 
-    0x8dedf, 0x8dfc6, 0x8e0ad, 0x8e193, 0x8e27a, 
-    0x8e360, 0x8e447, 0x8e52d, 0x8e613, 0x8e6f9, 
-    0x8e7df, 0x8e8c5, 0x8e9ab, 0x8ea91, 0x8eb76, 
-    0x8ec5c, 0x8ed41, 0x8ee27, 0x8ef0c, 0x8eff1, 
-    0x8f0d6, 0x8f1bb, 0x8f2a0, 0x8f385, 0x8f46a, 
-    0x8f54f, 0x8f633, 0x8f718, 0x8f7fc, 0x8f8e0, 
-    0x8f9c4, 0x8faa9, 0x8fb8d, 0x8fc71, 0x8fd54, 
-    0x8fe38, 0x8ff1c, 0x90000, 0x900e3, 0x901c6, 
-    0x902aa, 0x9038d, 0x90470, 0x90553, 0x90636, 
-    0x90719, 0x907fc, 0x908df, 0x909c1, 0x90aa4, 
-    0x90b86, 0x90c69, 0x90d4b, 0x90e2d, 0x90f0f, 
-    0x90ff1, 0x910d3, 0x911b5, 0x91297, 0x91379, 
-    0x9145a, 0x9153c, 0x9161d, 0x916ff, 0x917e0, 
-    0x918c1, 0x919a2, 0x91a83, 0x91b64, 0x91c45, 
-    0x91d26, 0x91e06, 0x91ee7, 0x91fc7, 0x920a8, 
-    0x92188, 0x92268, 0x92349, 0x92429, 0x92509, 
-    0x925e9, 0x926c8, 0x927a8, 0x92888, 0x92967, 
-    0x92a47, 0x92b26, 0x92c06, 0x92ce5, 0x92dc4, 
-    0x92ea3, 0x92f82, 0x93061, 0x93140, 0x9321f, 
-    0x932fd, 0x933dc, 0x934ba, 0x93599, 0x93677, 
-    0x93755, 0x93834, 0x93912, 0x939f0, 0x93ace, 
-    0x93bab, 0x93c89, 0x93d67, 0x93e45, 0x93f22, 
-    0x94000, 0x940dd, 0x941ba, 0x94297, 0x94375, 
-    0x94452, 0x9452f, 0x9460b, 0x946e8, 0x947c5, 
-    0x948a2, 0x9497e, 0x94a5b, 0x94b37, 0x94c13, 
-    0x94cf0, 0x94dcc, 0x94ea8, 0x94f84, 0x95060, 
-    0x9513c, 0x95217, 0x952f3, 0x953cf, 0x954aa, 
-    0x95586, 0x95661, 0x9573c, 0x95818, 0x958f3, 
-    0x959ce, 0x95aa9, 0x95b84, 0x95c5e, 0x95d39, 
-    0x95e14, 0x95eee, 0x95fc9, 0x960a3, 0x9617e, 
-    0x96258, 0x96332, 0x9640c, 0x964e6, 0x965c0, 
-    0x9669a, 0x96774, 0x9684e, 0x96927, 0x96a01, 
-    0x96adb, 0x96bb4, 0x96c8d, 0x96d67, 0x96e40, 
-    0x96f19, 0x96ff2, 0x970cb, 0x971a4, 0x9727d, 
-    0x97355, 0x9742e, 0x97507, 0x975df, 0x976b8, 
-    0x97790, 0x97868, 0x97941, 0x97a19, 0x97af1, 
-    0x97bc9, 0x97ca1, 0x97d78, 0x97e50, 0x97f28, 
-    0x98000, 0x980d7, 0x981af, 0x98286, 0x9835d, 
-    0x98434, 0x9850c, 0x985e3, 0x986ba, 0x98791, 
-    0x98868, 0x9893e, 0x98a15, 0x98aec, 0x98bc2, 
-    0x98c99, 0x98d6f, 0x98e46, 0x98f1c, 0x98ff2, 
-    0x990c8, 0x9919e, 0x99274, 0x9934a, 0x99420, 
-    0x994f6, 0x995cc, 0x996a1, 0x99777, 0x9984c, 
-    0x99922, 0x999f7, 0x99acc, 0x99ba1, 0x99c77, 
-    0x99d4c, 0x99e21, 0x99ef6, 0x99fca, 0x9a09f, 
-    0x9a174, 0x9a248, 0x9a31d, 0x9a3f1, 0x9a4c6, 
-    0x9a59a, 0x9a66e, 0x9a743, 0x9a817, 0x9a8eb, 
-    0x9a9bf, 0x9aa93, 0x9ab66, 0x9ac3a, 0x9ad0e, 
-    0x9ade2, 0x9aeb5, 0x9af89, 0x9b05c, 0x9b12f, 
-    0x9b203, 0x9b2d6, 0x9b3a9, 0x9b47c, 0x9b54f, 
-    0x9b622, 0x9b6f5, 0x9b7c8, 0x9b89a, 0x9b96d, 
-    0x9ba3f, 0x9bb12, 0x9bbe4, 0x9bcb7, 0x9bd89, 
-    0x9be5b, 0x9bf2d, 0x9c000, 0x9c0d2, 0x9c1a3, 
-    0x9c275, 0x9c347, 0x9c419, 0x9c4eb, 0x9c5bc, 
-    0x9c68e, 0x9c75f, 0x9c831, 0x9c902, 0x9c9d3, 
-    0x9caa4, 0x9cb76, 0x9cc47, 0x9cd18, 0x9cde8, 
-    0x9ceb9, 0x9cf8a, 0x9d05b, 0x9d12b, 0x9d1fc, 
-    0x9d2cd, 0x9d39d, 0x9d46d, 0x9d53e, 0x9d60e, 
-    0x9d6de, 0x9d7ae, 0x9d87e, 0x9d94e, 0x9da1e, 
-    0x9daee, 0x9dbbe, 0x9dc8e, 0x9dd5d, 0x9de2d, 
-    0x9defc, 0x9dfcc, 0x9e09b, 0x9e16a, 0x9e23a, 
-    0x9e309, 0x9e3d8, 0x9e4a7, 0x9e576, 0x9e645, 
-    0x9e714, 0x9e7e2, 0x9e8b1, 0x9e980, 0x9ea4e, 
-    0x9eb1d, 0x9ebeb, 0x9ecba, 0x9ed88, 0x9ee56, 
-    0x9ef25, 0x9eff3, 0x9f0c1, 0x9f18f, 0x9f25d, 
-    0x9f32a, 0x9f3f8, 0x9f4c6, 0x9f594, 0x9f661, 
-    0x9f72f, 0x9f7fc, 0x9f8ca, 0x9f997, 0x9fa64, 
-    0x9fb32, 0x9fbff, 0x9fccc, 0x9fd99, 0x9fe66, 
-    0x9ff33, 0xa0000, 0xa00cc, 0xa0199, 0xa0266, 
-    0xa0332, 0xa03ff, 0xa04cb, 0xa0598, 0xa0664, 
-    0xa0730, 0xa07fc, 0xa08c8, 0xa0995, 0xa0a61, 
-    0xa0b2c, 0xa0bf8, 0xa0cc4, 0xa0d90, 0xa0e5c, 
-    0xa0f27, 0xa0ff3, 0xa10be, 0xa118a, 0xa1255, 
-    0xa1320, 0xa13ec, 0xa14b7, 0xa1582, 0xa164d, 
-    0xa1718, 0xa17e3, 0xa18ae, 0xa1979, 0xa1a43, 
-    0xa1b0e, 0xa1bd9, 0xa1ca3, 0xa1d6e, 0xa1e38, 
-    0xa1f03, 0xa1fcd, 0xa2097, 0xa2161, 0xa222c, 
-    0xa22f6, 0xa23c0, 0xa248a, 0xa2553, 0xa261d, 
-    0xa26e7, 0xa27b1, 0xa287a, 0xa2944, 0xa2a0e, 
-    0xa2ad7, 0xa2ba0, 0xa2c6a, 0xa2d33, 0xa2dfc, 
-    0xa2ec5, 0xa2f8e, 0xa3057, 0xa3120, 0xa31e9, 
-    0xa32b2, 0xa337b, 0xa3444, 0xa350c, 0xa35d5, 
-    0xa369e, 0xa3766, 0xa382f, 0xa38f7, 0xa39bf, 
-    0xa3a87, 0xa3b50, 0xa3c18, 0xa3ce0, 0xa3da8, 
-    0xa3e70, 0xa3f38, 0xa4000, 0xa40c7, 0xa418f, 
-    0xa4257, 0xa431e, 0xa43e6, 0xa44ad, 0xa4575, 
-    0xa463c, 0xa4703, 0xa47cb, 0xa4892, 0xa4959, 
-    0xa4a20, 0xa4ae7, 0xa4bae, 0xa4c75, 0xa4d3c, 
-    0xa4e02, 0xa4ec9, 0xa4f90, 0xa5056, 0xa511d, 
-    0xa51e3, 0xa52aa, 0xa5370, 0xa5437, 0xa54fd, 
-    0xa55c3, 0xa5689, 0xa574f, 0xa5815, 0xa58db, 
-    0xa59a1, 0xa5a67, 0xa5b2d, 0xa5bf2, 0xa5cb8, 
-    0xa5d7e, 0xa5e43, 0xa5f09, 0xa5fce, 0xa6094, 
-    0xa6159, 0xa621e, 0xa62e3, 0xa63a9, 0xa646e, 
-    0xa6533, 0xa65f8, 0xa66bd, 0xa6781, 0xa6846, 
-    0xa690b, 0xa69d0, 0xa6a94, 0xa6b59, 0xa6c1d, 
-    0xa6ce2, 0xa6da6, 0xa6e6b, 0xa6f2f, 0xa6ff3, 
-    0xa70b7, 0xa717c, 0xa7240, 0xa7304, 0xa73c8, 
-    0xa748c, 0xa754f, 0xa7613, 0xa76d7, 0xa779b, 
-    0xa785e, 0xa7922, 0xa79e5, 0xa7aa9, 0xa7b6c, 
-    0xa7c30, 0xa7cf3, 0xa7db6, 0xa7e79, 0xa7f3c, 
-    0xa8000, 0xa80c3, 0xa8186, 0xa8248, 0xa830b, 
-    0xa83ce, 0xa8491, 0xa8554, 0xa8616, 0xa86d9, 
-    0xa879b, 0xa885e, 0xa8920, 0xa89e2, 0xa8aa5, 
-    0xa8b67, 0xa8c29, 0xa8ceb, 0xa8dad, 0xa8e70, 
-    0xa8f31, 0xa8ff3, 0xa90b5, 0xa9177, 0xa9239, 
-    0xa92fb, 0xa93bc, 0xa947e, 0xa953f, 0xa9601, 
-    0xa96c2, 0xa9784, 0xa9845, 0xa9906, 0xa99c7, 
-    0xa9a89, 0xa9b4a, 0xa9c0b, 0xa9ccc, 0xa9d8d, 
-    0xa9e4e, 0xa9f0f, 0xa9fcf, 0xaa090, 0xaa151, 
-    0xaa211, 0xaa2d2, 0xaa393, 0xaa453, 0xaa513, 
-    0xaa5d4, 0xaa694, 0xaa754, 0xaa815, 0xaa8d5, 
-    0xaa995, 0xaaa55, 0xaab15, 0xaabd5, 0xaac95, 
-    0xaad55, 0xaae14, 0xaaed4, 0xaaf94, 0xab053, 
-    0xab113, 0xab1d2, 0xab292, 0xab351, 0xab411, 
-    0xab4d0, 0xab58f, 0xab64f, 0xab70e, 0xab7cd, 
-    0xab88c, 0xab94b, 0xaba0a, 0xabac9, 0xabb88, 
-    0xabc46, 0xabd05, 0xabdc4, 0xabe82, 0xabf41, 
-    0xac000, 0xac0be, 0xac17c, 0xac23b, 0xac2f9, 
-    0xac3b7, 0xac476, 0xac534, 0xac5f2, 0xac6b0, 
-    0xac76e, 0xac82c, 0xac8ea, 0xac9a8, 0xaca66, 
-    0xacb23, 0xacbe1, 0xacc9f, 0xacd5c, 0xace1a, 
-    0xaced8, 0xacf95, 0xad052, 0xad110, 0xad1cd, 
-    0xad28a, 0xad348, 0xad405, 0xad4c2, 0xad57f, 
-    0xad63c, 0xad6f9, 0xad7b6, 0xad873, 0xad92f, 
-    0xad9ec, 0xadaa9, 0xadb66, 0xadc22, 0xadcdf, 
-    0xadd9b, 0xade58, 0xadf14, 0xadfd0, 0xae08d, 
-    0xae149, 0xae205, 0xae2c1, 0xae37d, 0xae43a, 
-    0xae4f6, 0xae5b2, 0xae66d, 0xae729, 0xae7e5, 
-    0xae8a1, 0xae95d, 0xaea18, 0xaead4, 0xaeb8f, 
-    0xaec4b, 0xaed06, 0xaedc2, 0xaee7d, 0xaef39, 
-    0xaeff4, 0xaf0af, 0xaf16a, 0xaf225, 0xaf2e0, 
-    0xaf39b, 0xaf456, 0xaf511, 0xaf5cc, 0xaf687, 
-    0xaf742, 0xaf7fd, 0xaf8b7, 0xaf972, 0xafa2d, 
-    0xafae7, 0xafba2, 0xafc5c, 0xafd16, 0xafdd1, 
-    0xafe8b, 0xaff45, 0xb0000, 0xb00ba, 0xb0174, 
-    0xb022e, 0xb02e8, 0xb03a2, 0xb045c, 0xb0516, 
-    0xb05cf, 0xb0689, 0xb0743, 0xb07fd, 0xb08b6, 
-    0xb0970, 0xb0a29, 0xb0ae3, 0xb0b9c, 0xb0c56, 
-    0xb0d0f, 0xb0dc8, 0xb0e82, 0xb0f3b, 0xb0ff4, 
-    0xb10ad, 0xb1166, 0xb121f, 0xb12d8, 0xb1391, 
-    0xb144a, 0xb1503, 0xb15bc, 0xb1674, 0xb172d, 
-    0xb17e6, 0xb189e, 0xb1957, 0xb1a0f, 0xb1ac8, 
-    0xb1b80, 0xb1c38, 0xb1cf1, 0xb1da9, 0xb1e61, 
-    0xb1f19, 0xb1fd2, 0xb208a, 0xb2142, 0xb21fa, 
-    0xb22b2, 0xb2369, 0xb2421, 0xb24d9, 0xb2591, 
-    0xb2649, 0xb2700, 0xb27b8, 0xb286f, 0xb2927, 
-    0xb29de, 0xb2a96, 0xb2b4d, 0xb2c05, 0xb2cbc, 
-    0xb2d73, 0xb2e2a, 0xb2ee1, 0xb2f99, 0xb3050, 
-    0xb3107, 0xb31be, 0xb3275, 0xb332b, 0xb33e2, 
-    0xb3499, 0xb3550, 0xb3606, 0xb36bd, 0xb3774, 
-    0xb382a, 0xb38e1, 0xb3997, 0xb3a4e, 0xb3b04, 
-    0xb3bba, 0xb3c71, 0xb3d27, 0xb3ddd, 0xb3e93, 
-    0xb3f49, 0xb4000, 0xb40b6, 0xb416c, 0xb4221, 
-    0xb42d7, 0xb438d, 0xb4443, 0xb44f9, 0xb45ae, 
-    0xb4664, 0xb471a, 0xb47cf, 0xb4885, 0xb493a, 
-    0xb49f0, 0xb4aa5, 0xb4b5b, 0xb4c10, 0xb4cc5, 
-    0xb4d7a, 0xb4e2f, 0xb4ee5, 0xb4f9a, 0xb504f, 
-    0xb5104, 0xb51b9, 0xb526e, 0xb5322, 0xb53d7, 
-    0xb548c, 0xb5541, 0xb55f5, 0xb56aa, 0xb575f, 
-    0xb5813, 0xb58c8, 0xb597c, 0xb5a31, 0xb5ae5, 
-    0xb5b99, 0xb5c4e, 0xb5d02, 0xb5db6, 0xb5e6a, 
-    0xb5f1e, 0xb5fd3, 0xb6087, 0xb613b, 0xb61ee, 
-    0xb62a2, 0xb6356, 0xb640a, 0xb64be, 0xb6572, 
-    0xb6625, 0xb66d9, 0xb678c, 0xb6840, 0xb68f4, 
-    0xb69a7, 0xb6a5a, 0xb6b0e, 0xb6bc1, 0xb6c74, 
-    0xb6d28, 0xb6ddb, 0xb6e8e, 0xb6f41, 0xb6ff4, 
-    0xb70a7, 0xb715a, 0xb720d, 0xb72c0, 0xb7373, 
-    0xb7426, 0xb74d9, 0xb758b, 0xb763e, 0xb76f1, 
-    0xb77a3, 0xb7856, 0xb7909, 0xb79bb, 0xb7a6d, 
-    0xb7b20, 0xb7bd2, 0xb7c85, 0xb7d37, 0xb7de9, 
-    0xb7e9b, 0xb7f4d, 0xb8000, 0xb80b2, 0xb8164, 
-    0xb8216, 0xb82c8, 0xb8379, 0xb842b, 0xb84dd, 
-    0xb858f, 0xb8641, 0xb86f2, 0xb87a4, 0xb8856, 
-    0xb8907, 0xb89b9, 0xb8a6a, 0xb8b1c, 0xb8bcd, 
-    0xb8c7e, 0xb8d30, 0xb8de1, 0xb8e92, 0xb8f43, 
-    0xb8ff4, 0xb90a6, 0xb9157, 0xb9208, 0xb92b9, 
-    0xb936a, 0xb941a, 0xb94cb, 0xb957c, 0xb962d, 
-    0xb96de, 0xb978e, 0xb983f, 0xb98f0, 0xb99a0, 
-    0xb9a51, 0xb9b01, 0xb9bb2, 0xb9c62, 0xb9d12, 
-    0xb9dc3, 0xb9e73, 0xb9f23, 0xb9fd3, 0xba084, 
-    0xba134, 0xba1e4, 0xba294, 0xba344, 0xba3f4, 
-    0xba4a4, 0xba554, 0xba603, 0xba6b3, 0xba763, 
-    0xba813, 0xba8c2, 0xba972, 0xbaa22, 0xbaad1, 
-    0xbab81, 0xbac30, 0xbace0, 0xbad8f, 0xbae3e, 
-    0xbaeee, 0xbaf9d, 0xbb04c, 0xbb0fb, 0xbb1ab, 
-    0xbb25a, 0xbb309, 0xbb3b8, 0xbb467, 0xbb516, 
-    0xbb5c5, 0xbb673, 0xbb722, 0xbb7d1, 0xbb880, 
-    0xbb92f, 0xbb9dd, 0xbba8c, 0xbbb3a, 0xbbbe9, 
-    0xbbc98, 0xbbd46, 0xbbdf4, 0xbbea3, 0xbbf51, 
-    0xbc000, 0xbc0ae, 0xbc15c, 0xbc20a, 0xbc2b8, 
-    0xbc367, 0xbc415, 0xbc4c3, 0xbc571, 0xbc61f, 
-    0xbc6cd, 0xbc77a, 0xbc828, 0xbc8d6, 0xbc984, 
-    0xbca32, 0xbcadf, 0xbcb8d, 0xbcc3b, 0xbcce8, 
-    0xbcd96, 0xbce43, 0xbcef1, 0xbcf9e, 0xbd04b, 
-    0xbd0f9, 0xbd1a6, 0xbd253, 0xbd301, 0xbd3ae, 
-    0xbd45b, 0xbd508, 0xbd5b5, 0xbd662, 0xbd70f, 
-    0xbd7bc, 0xbd869, 0xbd916, 0xbd9c3, 0xbda6f, 
-    0xbdb1c, 0xbdbc9, 0xbdc76, 0xbdd22, 0xbddcf, 
-    0xbde7b, 0xbdf28, 0xbdfd4, 0xbe081, 0xbe12d, 
-    0xbe1da, 0xbe286, 0xbe332, 0xbe3df, 0xbe48b, 
-    0xbe537, 0xbe5e3, 0xbe68f, 0xbe73b, 0xbe7e7, 
-    0xbe893, 0xbe93f, 0xbe9eb, 0xbea97, 0xbeb43, 
-    0xbebef, 0xbec9b, 0xbed46, 0xbedf2, 0xbee9e, 
-    0xbef49, 0xbeff5, 0xbf0a0, 0xbf14c, 0xbf1f7, 
-    0xbf2a3, 0xbf34e, 0xbf3fa, 0xbf4a5, 0xbf550, 
-    0xbf5fb, 0xbf6a7, 0xbf752, 0xbf7fd, 0xbf8a8, 
-    0xbf953, 0xbf9fe, 0xbfaa9, 0xbfb54, 0xbfbff, 
-    0xbfcaa, 0xbfd55, 0xbfdff, 0xbfeaa, 0xbff55, 
-    0xc0000, 0xc00aa, 0xc0155, 0xc01ff, 0xc02aa, 
-    0xc0354, 0xc03ff, 0xc04a9, 0xc0554, 0xc05fe, 
-    0xc06a8, 0xc0753, 0xc07fd, 0xc08a7, 0xc0951, 
-    0xc09fb, 0xc0aa5, 0xc0b50, 0xc0bfa, 0xc0ca4, 
-    0xc0d4d, 0xc0df7, 0xc0ea1, 0xc0f4b, 0xc0ff5, 
-    0xc109f, 0xc1148, 0xc11f2, 0xc129c, 0xc1345, 
-    0xc13ef, 0xc1499, 0xc1542, 0xc15ec, 0xc1695, 
-    0xc173e, 0xc17e8, 0xc1891, 0xc193a, 0xc19e4, 
-    0xc1a8d, 0xc1b36, 0xc1bdf, 0xc1c88, 0xc1d31, 
-    0xc1dda, 0xc1e83, 0xc1f2c, 0xc1fd5, 0xc207e, 
-    0xc2127, 0xc21d0, 0xc2279, 0xc2321, 0xc23ca, 
-    0xc2473, 0xc251b, 0xc25c4, 0xc266d, 0xc2715, 
-    0xc27be, 0xc2866, 0xc290f, 0xc29b7, 0xc2a5f, 
-    0xc2b08, 0xc2bb0, 0xc2c58, 0xc2d00, 0xc2da9, 
-    0xc2e51, 0xc2ef9, 0xc2fa1, 0xc3049, 0xc30f1, 
-    0xc3199, 0xc3241, 0xc32e9, 0xc3391, 0xc3439, 
-    0xc34e0, 0xc3588, 0xc3630, 0xc36d8, 0xc377f, 
-    0xc3827, 0xc38ce, 0xc3976, 0xc3a1d, 0xc3ac5, 
-    0xc3b6c, 0xc3c14, 0xc3cbb, 0xc3d63, 0xc3e0a, 
-    0xc3eb1, 0xc3f58, 0xc4000, 0xc40a7, 0xc414e, 
-    0xc41f5, 0xc429c, 0xc4343, 0xc43ea, 0xc4491, 
-    0xc4538, 0xc45df, 0xc4686, 0xc472c, 0xc47d3, 
-    0xc487a, 0xc4921, 0xc49c7, 0xc4a6e, 0xc4b15, 
-    0xc4bbb, 0xc4c62, 0xc4d08, 0xc4daf, 0xc4e55, 
-    0xc4efc, 0xc4fa2, 0xc5048, 0xc50ef, 0xc5195, 
-    0xc523b, 0xc52e1, 0xc5387, 0xc542e, 0xc54d4, 
-    0xc557a, 0xc5620, 0xc56c6, 0xc576c, 0xc5812, 
-    0xc58b8, 0xc595d, 0xc5a03, 0xc5aa9, 0xc5b4f, 
-    0xc5bf5, 0xc5c9a, 0xc5d40, 0xc5de5, 0xc5e8b, 
-    0xc5f31, 0xc5fd6, 0xc607c, 0xc6121, 0xc61c7, 
-    0xc626c, 0xc6311, 0xc63b7, 0xc645c, 0xc6501, 
-    0xc65a6, 0xc664c, 0xc66f1, 0xc6796, 0xc683b, 
-    0xc68e0, 0xc6985, 0xc6a2a, 0xc6acf, 0xc6b74, 
-    0xc6c19, 0xc6cbd, 0xc6d62, 0xc6e07, 0xc6eac, 
-    0xc6f51, 0xc6ff5, 0xc709a, 0xc713f, 0xc71e3, 
-    0xc7288, 0xc732c, 0xc73d1, 0xc7475, 0xc751a, 
-    0xc75be, 0xc7662, 0xc7707, 0xc77ab, 0xc784f, 
-    0xc78f3, 0xc7997, 0xc7a3c, 0xc7ae0, 0xc7b84, 
-    0xc7c28, 0xc7ccc, 0xc7d70, 0xc7e14, 0xc7eb8, 
-    0xc7f5c, 0xc8000, 0xc80a3, 0xc8147, 0xc81eb, 
-    0xc828f, 0xc8332, 0xc83d6, 0xc847a, 0xc851d, 
-    0xc85c1, 0xc8664, 0xc8708, 0xc87ab, 0xc884f, 
-    0xc88f2, 0xc8995, 0xc8a39, 0xc8adc, 0xc8b7f, 
-    0xc8c23, 0xc8cc6, 0xc8d69, 0xc8e0c, 0xc8eaf, 
-    0xc8f52, 0xc8ff5, 0xc9098, 0xc913b, 0xc91de, 
-    0xc9281, 0xc9324, 0xc93c7, 0xc946a, 0xc950d, 
-    0xc95af, 0xc9652, 0xc96f5, 0xc9797, 0xc983a, 
-    0xc98dd, 0xc997f, 0xc9a22, 0xc9ac4, 0xc9b67, 
-    0xc9c09, 0xc9cab, 0xc9d4e, 0xc9df0, 0xc9e92, 
-    0xc9f35, 0xc9fd7, 0xca079, 0xca11b, 0xca1be, 
-    0xca260, 0xca302, 0xca3a4, 0xca446, 0xca4e8, 
-    0xca58a, 0xca62c, 0xca6ce, 0xca76f, 0xca811, 
-    0xca8b3, 0xca955, 0xca9f7, 0xcaa98, 0xcab3a, 
-    0xcabdc, 0xcac7d, 0xcad1f, 0xcadc0, 0xcae62, 
-    0xcaf03, 0xcafa5, 0xcb046, 0xcb0e8, 0xcb189, 
-    0xcb22a, 0xcb2cc, 0xcb36d, 0xcb40e, 0xcb4af, 
-    0xcb550, 0xcb5f2, 0xcb693, 0xcb734, 0xcb7d5, 
-    0xcb876, 0xcb917, 0xcb9b8, 0xcba59, 0xcbafa, 
-    0xcbb9a, 0xcbc3b, 0xcbcdc, 0xcbd7d, 0xcbe1e, 
-    0xcbebe, 0xcbf5f, 0xcc000, 0xcc0a0, 0xcc141, 
-    0xcc1e1, 0xcc282, 0xcc322, 0xcc3c3, 0xcc463, 
-    0xcc504, 0xcc5a4, 0xcc644, 0xcc6e5, 0xcc785, 
-    0xcc825, 0xcc8c5, 0xcc965, 0xcca06, 0xccaa6, 
-    0xccb46, 0xccbe6, 0xccc86, 0xccd26, 0xccdc6, 
-    0xcce66, 0xccf06, 0xccfa6, 0xcd045, 0xcd0e5, 
-    0xcd185, 0xcd225, 0xcd2c5, 0xcd364, 0xcd404, 
-    0xcd4a4, 0xcd543, 0xcd5e3, 0xcd682, 0xcd722, 
-    0xcd7c1, 0xcd861, 0xcd900, 0xcd9a0, 0xcda3f, 
-    0xcdade, 0xcdb7d, 0xcdc1d, 0xcdcbc, 0xcdd5b, 
-    0xcddfa, 0xcde9a, 0xcdf39, 0xcdfd8, 0xce077, 
-    0xce116, 0xce1b5, 0xce254, 0xce2f3, 0xce392, 
-    0xce431, 0xce4cf, 0xce56e, 0xce60d, 0xce6ac, 
-    0xce74b, 0xce7e9, 0xce888, 0xce927, 0xce9c5, 
-    0xcea64, 0xceb02, 0xceba1, 0xcec3f, 0xcecde, 
-    0xced7c, 0xcee1b, 0xceeb9, 0xcef57, 0xceff6, 
-    0xcf094, 0xcf132, 0xcf1d0, 0xcf26f, 0xcf30d, 
-    0xcf3ab, 0xcf449, 0xcf4e7, 0xcf585, 0xcf623, 
-    0xcf6c1, 0xcf75f, 0xcf7fd, 0xcf89b, 0xcf939, 
-    0xcf9d7, 0xcfa75, 0xcfb12, 0xcfbb0, 0xcfc4e, 
-    0xcfceb, 0xcfd89, 0xcfe27, 0xcfec4, 0xcff62, 
-    0xd0000, 0xd009d, 0xd013b, 0xd01d8, 0xd0275, 
-    0xd0313, 0xd03b0, 0xd044e, 0xd04eb, 0xd0588, 
-    0xd0625, 0xd06c3, 0xd0760, 0xd07fd, 0xd089a, 
-    0xd0937, 0xd09d4, 0xd0a71, 0xd0b0f, 0xd0bac, 
-    0xd0c48, 0xd0ce5, 0xd0d82, 0xd0e1f, 0xd0ebc, 
-    0xd0f59, 0xd0ff6, 0xd1093, 0xd112f, 0xd11cc, 
-    0xd1269, 0xd1305, 0xd13a2, 0xd143f, 0xd14db, 
-    0xd1578, 0xd1614, 0xd16b1, 0xd174d, 0xd17ea, 
-    0xd1886, 0xd1922, 0xd19bf, 0xd1a5b, 0xd1af7, 
-    0xd1b94, 0xd1c30, 0xd1ccc, 0xd1d68, 0xd1e04, 
-    0xd1ea0, 0xd1f3c, 0xd1fd9, 0xd2075, 0xd2111, 
-    0xd21ad, 0xd2248, 0xd22e4, 0xd2380, 0xd241c, 
-    0xd24b8, 0xd2554, 0xd25f0, 0xd268b, 0xd2727, 
-    0xd27c3, 0xd285e, 0xd28fa, 0xd2996, 0xd2a31, 
-    0xd2acd, 0xd2b68, 0xd2c04, 0xd2c9f, 0xd2d3b, 
-    0xd2dd6, 0xd2e71, 0xd2f0d, 0xd2fa8, 0xd3043, 
-    0xd30df, 0xd317a, 0xd3215, 0xd32b0, 0xd334c, 
-    0xd33e7, 0xd3482, 0xd351d, 0xd35b8, 0xd3653, 
-    0xd36ee, 0xd3789, 0xd3824, 0xd38bf, 0xd395a, 
-    0xd39f4, 0xd3a8f, 0xd3b2a, 0xd3bc5, 0xd3c60, 
-    0xd3cfa, 0xd3d95, 0xd3e30, 0xd3eca, 0xd3f65, 
-    0xd4000, 0xd409a, 0xd4135, 0xd41cf, 0xd426a, 
-    0xd4304, 0xd439e, 0xd4439, 0xd44d3, 0xd456e, 
-    0xd4608, 0xd46a2, 0xd473c, 0xd47d7, 0xd4871, 
-    0xd490b, 0xd49a5, 0xd4a3f, 0xd4ad9, 0xd4b73, 
-    0xd4c0d, 0xd4ca7, 0xd4d41, 0xd4ddb, 0xd4e75, 
-    0xd4f0f, 0xd4fa9, 0xd5043, 0xd50dd, 0xd5176, 
-    0xd5210, 0xd52aa, 0xd5344, 0xd53dd, 0xd5477, 
-    0xd5511, 0xd55aa, 0xd5644, 0xd56dd, 0xd5777, 
-    0xd5810, 0xd58aa, 0xd5943, 0xd59dd, 0xd5a76, 
-    0xd5b0f, 0xd5ba9, 0xd5c42, 0xd5cdb, 0xd5d75, 
-    0xd5e0e, 0xd5ea7, 0xd5f40, 0xd5fd9, 0xd6072, 
-    0xd610b, 0xd61a5, 0xd623e, 0xd62d7, 0xd6370, 
-    0xd6408, 0xd64a1, 0xd653a, 0xd65d3, 0xd666c, 
-    0xd6705, 0xd679e, 0xd6836, 0xd68cf, 0xd6968, 
-    0xd6a01, 0xd6a99, 0xd6b32, 0xd6bca, 0xd6c63, 
-    0xd6cfc, 0xd6d94, 0xd6e2d, 0xd6ec5, 0xd6f5e, 
-    0xd6ff6, 0xd708e, 0xd7127, 0xd71bf, 0xd7257, 
-    0xd72f0, 0xd7388, 0xd7420, 0xd74b8, 0xd7551, 
-    0xd75e9, 0xd7681, 0xd7719, 0xd77b1, 0xd7849, 
-    0xd78e1, 0xd7979, 0xd7a11, 0xd7aa9, 0xd7b41, 
-    0xd7bd9, 0xd7c71, 0xd7d09, 0xd7da1, 0xd7e38, 
-    0xd7ed0, 0xd7f68, 0xd8000, 0xd8097, 0xd812f, 
-    0xd81c7, 0xd825e, 0xd82f6, 0xd838d, 0xd8425, 
-    0xd84bc, 0xd8554, 0xd85eb, 0xd8683, 0xd871a, 
-    0xd87b1, 0xd8849, 0xd88e0, 0xd8977, 0xd8a0f, 
-    0xd8aa6, 0xd8b3d, 0xd8bd4, 0xd8c6c, 0xd8d03, 
-    0xd8d9a, 0xd8e31, 0xd8ec8, 0xd8f5f, 0xd8ff6, 
-    0xd908d, 0xd9124, 0xd91bb, 0xd9252, 0xd92e9, 
-    0xd9380, 0xd9417, 0xd94ad, 0xd9544, 0xd95db, 
-    0xd9672, 0xd9708, 0xd979f, 0xd9836, 0xd98cc, 
-    0xd9963, 0xd99fa, 0xd9a90, 0xd9b27, 0xd9bbd, 
-    0xd9c54, 0xd9cea, 0xd9d80, 0xd9e17, 0xd9ead, 
-    0xd9f44, 0xd9fda, 0xda070, 0xda107, 0xda19d, 
-    0xda233, 0xda2c9, 0xda35f, 0xda3f6, 0xda48c, 
-    0xda522, 0xda5b8, 0xda64e, 0xda6e4, 0xda77a, 
-    0xda810, 0xda8a6, 0xda93c, 0xda9d2, 0xdaa68, 
-    0xdaafd, 0xdab93, 0xdac29, 0xdacbf, 0xdad55, 
-    0xdadea, 0xdae80, 0xdaf16, 0xdafab, 0xdb041, 
-    0xdb0d7, 0xdb16c, 0xdb202, 0xdb297, 0xdb32d, 
-    0xdb3c2, 0xdb458, 0xdb4ed, 0xdb583, 0xdb618, 
-    0xdb6ad, 0xdb743, 0xdb7d8, 0xdb86d, 0xdb902, 
-    0xdb998, 0xdba2d, 0xdbac2, 0xdbb57, 0xdbbec, 
-    0xdbc81, 0xdbd16, 0xdbdac, 0xdbe41, 0xdbed6, 
-    0xdbf6b, 0xdc000, 0xdc094, 0xdc129, 0xdc1be, 
-    0xdc253, 0xdc2e8, 0xdc37d, 0xdc412, 0xdc4a6, 
-    0xdc53b, 0xdc5d0, 0xdc664, 0xdc6f9, 0xdc78e, 
-    0xdc822, 0xdc8b7, 0xdc94c, 0xdc9e0, 0xdca75, 
-    0xdcb09, 0xdcb9e, 0xdcc32, 0xdccc6, 0xdcd5b, 
-    0xdcdef, 0xdce84, 0xdcf18, 0xdcfac, 0xdd040, 
-    0xdd0d5, 0xdd169, 0xdd1fd, 0xdd291, 0xdd325, 
-    0xdd3ba, 0xdd44e, 0xdd4e2, 0xdd576, 0xdd60a, 
-    0xdd69e, 0xdd732, 0xdd7c6, 0xdd85a, 0xdd8ee, 
-    0xdd981, 0xdda15, 0xddaa9, 0xddb3d, 0xddbd1, 
-    0xddc65, 0xddcf8, 0xddd8c, 0xdde20, 0xddeb3, 
-    0xddf47, 0xddfdb, 0xde06e, 0xde102, 0xde195, 
-    0xde229, 0xde2bc, 0xde350, 0xde3e3, 0xde477, 
-    0xde50a, 0xde59e, 0xde631, 0xde6c4, 0xde758, 
-    0xde7eb, 0xde87e, 0xde911, 0xde9a5, 0xdea38, 
-    0xdeacb, 0xdeb5e, 0xdebf1, 0xdec84, 0xded17, 
-    0xdedaa, 0xdee3d, 0xdeed0, 0xdef63, 0xdeff6, 
-    0xdf089, 0xdf11c, 0xdf1af, 0xdf242, 0xdf2d5, 
-    0xdf368, 0xdf3fa, 0xdf48d, 0xdf520, 0xdf5b3, 
-    0xdf645, 0xdf6d8, 0xdf76b, 0xdf7fd, 0xdf890, 
-    0xdf922, 0xdf9b5, 0xdfa48, 0xdfada, 0xdfb6c, 
-    0xdfbff, 0xdfc91, 0xdfd24, 0xdfdb6, 0xdfe49, 
-    0xdfedb, 0xdff6d, 0xe0000, 0xe0092, 0xe0124, 
-    0xe01b6, 0xe0248, 0xe02db, 0xe036d, 0xe03ff, 
-    0xe0491, 0xe0523, 0xe05b5, 0xe0647, 0xe06d9, 
-    0xe076b, 0xe07fd, 0xe088f, 0xe0921, 0xe09b3, 
-    0xe0a45, 0xe0ad7, 0xe0b69, 0xe0bfa, 0xe0c8c, 
-    0xe0d1e, 0xe0db0, 0xe0e41, 0xe0ed3, 0xe0f65, 
-    0xe0ff6, 0xe1088, 0xe111a, 0xe11ab, 0xe123d, 
-    0xe12ce, 0xe1360, 0xe13f1, 0xe1483, 0xe1514, 
-    0xe15a6, 0xe1637, 0xe16c8, 0xe175a, 0xe17eb, 
-    0xe187c, 0xe190e, 0xe199f, 0xe1a30, 0xe1ac1, 
-    0xe1b53, 0xe1be4, 0xe1c75, 0xe1d06, 0xe1d97, 
-    0xe1e28, 0xe1eb9, 0xe1f4a, 0xe1fdb, 0xe206c, 
-    0xe20fd, 0xe218e, 0xe221f, 0xe22b0, 0xe2341, 
-    0xe23d2, 0xe2463, 0xe24f3, 0xe2584, 0xe2615, 
-    0xe26a6, 0xe2736, 0xe27c7, 0xe2858, 0xe28e8, 
-    0xe2979, 0xe2a0a, 0xe2a9a, 0xe2b2b, 0xe2bbb, 
-    0xe2c4c, 0xe2cdc, 0xe2d6d, 0xe2dfd, 0xe2e8e, 
-    0xe2f1e, 0xe2fae, 0xe303f, 0xe30cf, 0xe315f, 
-    0xe31f0, 0xe3280, 0xe3310, 0xe33a0, 0xe3431, 
-    0xe34c1, 0xe3551, 0xe35e1, 0xe3671, 0xe3701, 
-    0xe3791, 0xe3821, 0xe38b1, 0xe3941, 0xe39d1, 
-    0xe3a61, 0xe3af1, 0xe3b81, 0xe3c11, 0xe3ca1, 
-    0xe3d31, 0xe3dc0, 0xe3e50, 0xe3ee0, 0xe3f70, 
-    0xe4000, 0xe408f, 0xe411f, 0xe41af, 0xe423e, 
-    0xe42ce, 0xe435d, 0xe43ed, 0xe447d, 0xe450c, 
-    0xe459c, 0xe462b, 0xe46bb, 0xe474a, 0xe47d9, 
-    0xe4869, 0xe48f8, 0xe4988, 0xe4a17, 0xe4aa6, 
-    0xe4b36, 0xe4bc5, 0xe4c54, 0xe4ce3, 0xe4d72, 
-    0xe4e02, 0xe4e91, 0xe4f20, 0xe4faf, 0xe503e, 
-    0xe50cd, 0xe515c, 0xe51eb, 0xe527a, 0xe5309, 
-    0xe5398, 0xe5427, 0xe54b6, 0xe5545, 0xe55d4, 
-    0xe5663, 0xe56f2, 0xe5780, 0xe580f, 0xe589e, 
-    0xe592d, 0xe59bb, 0xe5a4a, 0xe5ad9, 0xe5b67, 
-    0xe5bf6, 0xe5c85, 0xe5d13, 0xe5da2, 0xe5e30, 
-    0xe5ebf, 0xe5f4d, 0xe5fdc, 0xe606a, 0xe60f9, 
-    0xe6187, 0xe6216, 0xe62a4, 0xe6332, 0xe63c1, 
-    0xe644f, 0xe64dd, 0xe656c, 0xe65fa, 0xe6688, 
-    0xe6716, 0xe67a4, 0xe6833, 0xe68c1, 0xe694f, 
-    0xe69dd, 0xe6a6b, 0xe6af9, 0xe6b87, 0xe6c15, 
-    0xe6ca3, 0xe6d31, 0xe6dbf, 0xe6e4d, 0xe6edb, 
-    0xe6f69, 0xe6ff7, 0xe7085, 0xe7112, 0xe71a0, 
-    0xe722e, 0xe72bc, 0xe7349, 0xe73d7, 0xe7465, 
-    0xe74f2, 0xe7580, 0xe760e, 0xe769b, 0xe7729, 
-    0xe77b7, 0xe7844, 0xe78d2, 0xe795f, 0xe79ed, 
-    0xe7a7a, 0xe7b08, 0xe7b95, 0xe7c22, 0xe7cb0, 
-    0xe7d3d, 0xe7dca, 0xe7e58, 0xe7ee5, 0xe7f72, 
-    0xe8000, 0xe808d, 0xe811a, 0xe81a7, 0xe8234, 
-    0xe82c1, 0xe834f, 0xe83dc, 0xe8469, 0xe84f6, 
-    0xe8583, 0xe8610, 0xe869d, 0xe872a, 0xe87b7, 
-    0xe8844, 0xe88d1, 0xe895e, 0xe89ea, 0xe8a77, 
-    0xe8b04, 0xe8b91, 0xe8c1e, 0xe8cab, 0xe8d37, 
-    0xe8dc4, 0xe8e51, 0xe8edd, 0xe8f6a, 0xe8ff7, 
-    0xe9083, 0xe9110, 0xe919d, 0xe9229, 0xe92b6, 
-    0xe9342, 0xe93cf, 0xe945b, 0xe94e8, 0xe9574, 
-    0xe9600, 0xe968d, 0xe9719, 0xe97a6, 0xe9832, 
-    0xe98be, 0xe994b, 0xe99d7, 0xe9a63, 0xe9aef, 
-    0xe9b7c, 0xe9c08, 0xe9c94, 0xe9d20, 0xe9dac, 
-    0xe9e38, 0xe9ec4, 0xe9f50, 0xe9fdd, 0xea069, 
-    0xea0f5, 0xea181, 0xea20d, 0xea298, 0xea324, 
-    0xea3b0, 0xea43c, 0xea4c8, 0xea554, 0xea5e0, 
-    0xea66c, 0xea6f7, 0xea783, 0xea80f, 0xea89b, 
-    0xea926, 0xea9b2, 0xeaa3e, 0xeaac9, 0xeab55, 
-    0xeabe0, 0xeac6c, 0xeacf8, 0xead83, 0xeae0f, 
-    0xeae9a, 0xeaf26, 0xeafb1, 0xeb03d, 0xeb0c8, 
-    0xeb153, 0xeb1df, 0xeb26a, 0xeb2f5, 0xeb381, 
-    0xeb40c, 0xeb497, 0xeb523, 0xeb5ae, 0xeb639, 
-    0xeb6c4, 0xeb74f, 0xeb7db, 0xeb866, 0xeb8f1, 
-    0xeb97c, 0xeba07, 0xeba92, 0xebb1d, 0xebba8, 
-    0xebc33, 0xebcbe, 0xebd49, 0xebdd4, 0xebe5f, 
-    0xebeea, 0xebf75, 0xec000, 0xec08a, 0xec115, 
-    0xec1a0, 0xec22b, 0xec2b6, 0xec340, 0xec3cb, 
-    0xec456, 0xec4e0, 0xec56b, 0xec5f6, 0xec680, 
-    0xec70b, 0xec795, 0xec820, 0xec8ab, 0xec935, 
-    0xec9c0, 0xeca4a, 0xecad5, 0xecb5f, 0xecbe9, 
-    0xecc74, 0xeccfe, 0xecd89, 0xece13, 0xece9d, 
-    0xecf27, 0xecfb2, 0xed03c, 0xed0c6, 0xed150, 
-    0xed1db, 0xed265, 0xed2ef, 0xed379, 0xed403, 
-    0xed48d, 0xed517, 0xed5a2, 0xed62c, 0xed6b6, 
-    0xed740, 0xed7ca, 0xed854, 0xed8de, 0xed967, 
-    0xed9f1, 0xeda7b, 0xedb05, 0xedb8f, 0xedc19, 
-    0xedca3, 0xedd2c, 0xeddb6, 0xede40, 0xedeca, 
-    0xedf53, 0xedfdd, 0xee067, 0xee0f0, 0xee17a, 
-    0xee204, 0xee28d, 0xee317, 0xee3a0, 0xee42a, 
-    0xee4b3, 0xee53d, 0xee5c6, 0xee650, 0xee6d9, 
-    0xee763, 0xee7ec, 0xee876, 0xee8ff, 0xee988, 
-    0xeea12, 0xeea9b, 0xeeb24, 0xeebae, 0xeec37, 
-    0xeecc0, 0xeed49, 0xeedd2, 0xeee5c, 0xeeee5, 
-    0xeef6e, 0xeeff7, 0xef080, 0xef109, 0xef192, 
-    0xef21b, 0xef2a4, 0xef32d, 0xef3b6, 0xef43f, 
-    0xef4c8, 0xef551, 0xef5da, 0xef663, 0xef6ec, 
-    0xef775, 0xef7fd, 0xef886, 0xef90f, 0xef998, 
-    0xefa21, 0xefaa9, 0xefb32, 0xefbbb, 0xefc43, 
-    0xefccc, 0xefd55, 0xefddd, 0xefe66, 0xefeee, 
-    0xeff77, 0xf0000, 0xf0088, 0xf0111, 0xf0199, 
-    0xf0222, 0xf02aa, 0xf0332, 0xf03bb, 0xf0443, 
-    0xf04cc, 0xf0554, 0xf05dc, 0xf0665, 0xf06ed, 
-    0xf0775, 0xf07fd, 0xf0886, 0xf090e, 0xf0996, 
-    0xf0a1e, 0xf0aa6, 0xf0b2f, 0xf0bb7, 0xf0c3f, 
-    0xf0cc7, 0xf0d4f, 0xf0dd7, 0xf0e5f, 0xf0ee7, 
-    0xf0f6f, 0xf0ff7, 0xf107f, 0xf1107, 0xf118f, 
-    0xf1217, 0xf129f, 0xf1327, 0xf13ae, 0xf1436, 
-    0xf14be, 0xf1546, 0xf15ce, 0xf1655, 0xf16dd, 
-    0xf1765, 0xf17ec, 0xf1874, 0xf18fc, 0xf1983, 
-    0xf1a0b, 0xf1a93, 0xf1b1a, 0xf1ba2, 0xf1c29, 
-    0xf1cb1, 0xf1d38, 0xf1dc0, 0xf1e47, 0xf1ecf, 
-    0xf1f56, 0xf1fde, 0xf2065, 0xf20ec, 0xf2174, 
-    0xf21fb, 0xf2282, 0xf230a, 0xf2391, 0xf2418, 
-    0xf24a0, 0xf2527, 0xf25ae, 0xf2635, 0xf26bc, 
-    0xf2744, 0xf27cb, 0xf2852, 0xf28d9, 0xf2960, 
-    0xf29e7, 0xf2a6e, 0xf2af5, 0xf2b7c, 0xf2c03, 
-    0xf2c8a, 0xf2d11, 0xf2d98, 0xf2e1f, 0xf2ea6, 
-    0xf2f2d, 0xf2fb4, 0xf303b, 0xf30c1, 0xf3148, 
-    0xf31cf, 0xf3256, 0xf32dc, 0xf3363, 0xf33ea, 
-    0xf3471, 0xf34f7, 0xf357e, 0xf3605, 0xf368b, 
-    0xf3712, 0xf3798, 0xf381f, 0xf38a6, 0xf392c, 
-    0xf39b3, 0xf3a39, 0xf3ac0, 0xf3b46, 0xf3bcd, 
-    0xf3c53, 0xf3cd9, 0xf3d60, 0xf3de6, 0xf3e6d, 
-    0xf3ef3, 0xf3f79, 0xf4000, 0xf4086, 0xf410c, 
-    0xf4192, 0xf4219, 0xf429f, 0xf4325, 0xf43ab, 
-    0xf4431, 0xf44b7, 0xf453e, 0xf45c4, 0xf464a, 
-    0xf46d0, 0xf4756, 0xf47dc, 0xf4862, 0xf48e8, 
-    0xf496e, 0xf49f4, 0xf4a7a, 0xf4b00, 0xf4b86, 
-    0xf4c0c, 0xf4c91, 0xf4d17, 0xf4d9d, 0xf4e23, 
-    0xf4ea9, 0xf4f2f, 0xf4fb4, 0xf503a, 0xf50c0, 
-    0xf5145, 0xf51cb, 0xf5251, 0xf52d7, 0xf535c, 
-    0xf53e2, 0xf5467, 0xf54ed, 0xf5573, 0xf55f8, 
-    0xf567e, 0xf5703, 0xf5789, 0xf580e, 0xf5894, 
-    0xf5919, 0xf599e, 0xf5a24, 0xf5aa9, 0xf5b2f, 
-    0xf5bb4, 0xf5c39, 0xf5cbf, 0xf5d44, 0xf5dc9, 
-    0xf5e4f, 0xf5ed4, 0xf5f59, 0xf5fde, 0xf6063, 
-    0xf60e9, 0xf616e, 0xf61f3, 0xf6278, 0xf62fd, 
-    0xf6382, 0xf6407, 0xf648c, 0xf6511, 0xf6596, 
-    0xf661b, 0xf66a0, 0xf6725, 0xf67aa, 0xf682f, 
-    0xf68b4, 0xf6939, 0xf69be, 0xf6a43, 0xf6ac8, 
-    0xf6b4d, 0xf6bd1, 0xf6c56, 0xf6cdb, 0xf6d60, 
-    0xf6de4, 0xf6e69, 0xf6eee, 0xf6f73, 0xf6ff7, 
-    0xf707c, 0xf7101, 0xf7185, 0xf720a, 0xf728e, 
-    0xf7313, 0xf7397, 0xf741c, 0xf74a1, 0xf7525, 
-    0xf75aa, 0xf762e, 0xf76b2, 0xf7737, 0xf77bb, 
-    0xf7840, 0xf78c4, 0xf7948, 0xf79cd, 0xf7a51, 
-    0xf7ad5, 0xf7b5a, 0xf7bde, 0xf7c62, 0xf7ce6, 
-    0xf7d6b, 0xf7def, 0xf7e73, 0xf7ef7, 0xf7f7b, 
-    0xf8000, 0xf8084, 0xf8108, 0xf818c, 0xf8210, 
-    0xf8294, 0xf8318, 0xf839c, 0xf8420, 0xf84a4, 
-    0xf8528, 0xf85ac, 0xf8630, 0xf86b4, 0xf8738, 
-    0xf87bc, 0xf883f, 0xf88c3, 0xf8947, 0xf89cb, 
-    0xf8a4f, 0xf8ad2, 0xf8b56, 0xf8bda, 0xf8c5e, 
-    0xf8ce1, 0xf8d65, 0xf8de9, 0xf8e6c, 0xf8ef0, 
-    0xf8f74, 0xf8ff7, 0xf907b, 0xf90fe, 0xf9182, 
-    0xf9206, 0xf9289, 0xf930d, 0xf9390, 0xf9414, 
-    0xf9497, 0xf951a, 0xf959e, 0xf9621, 0xf96a5, 
-    0xf9728, 0xf97ab, 0xf982f, 0xf98b2, 0xf9935, 
-    0xf99b9, 0xf9a3c, 0xf9abf, 0xf9b42, 0xf9bc6, 
-    0xf9c49, 0xf9ccc, 0xf9d4f, 0xf9dd2, 0xf9e55, 
-    0xf9ed9, 0xf9f5c, 0xf9fdf, 0xfa062, 0xfa0e5, 
-    0xfa168, 0xfa1eb, 0xfa26e, 0xfa2f1, 0xfa374, 
-    0xfa3f7, 0xfa47a, 0xfa4fd, 0xfa580, 0xfa602, 
-    0xfa685, 0xfa708, 0xfa78b, 0xfa80e, 0xfa891, 
-    0xfa913, 0xfa996, 0xfaa19, 0xfaa9c, 0xfab1e, 
-    0xfaba1, 0xfac24, 0xfaca6, 0xfad29, 0xfadac, 
-    0xfae2e, 0xfaeb1, 0xfaf34, 0xfafb6, 0xfb039, 
-    0xfb0bb, 0xfb13e, 0xfb1c0, 0xfb243, 0xfb2c5, 
-    0xfb348, 0xfb3ca, 0xfb44c, 0xfb4cf, 0xfb551, 
-    0xfb5d4, 0xfb656, 0xfb6d8, 0xfb75b, 0xfb7dd, 
-    0xfb85f, 0xfb8e1, 0xfb964, 0xfb9e6, 0xfba68, 
-    0xfbaea, 0xfbb6d, 0xfbbef, 0xfbc71, 0xfbcf3, 
-    0xfbd75, 0xfbdf7, 0xfbe79, 0xfbefb, 0xfbf7d, 
-    0xfc000, 0xfc082, 0xfc104, 0xfc186, 0xfc208, 
-    0xfc289, 0xfc30b, 0xfc38d, 0xfc40f, 0xfc491, 
-    0xfc513, 0xfc595, 0xfc617, 0xfc699, 0xfc71a, 
-    0xfc79c, 0xfc81e, 0xfc8a0, 0xfc921, 0xfc9a3, 
-    0xfca25, 0xfcaa7, 0xfcb28, 0xfcbaa, 0xfcc2c, 
-    0xfccad, 0xfcd2f, 0xfcdb0, 0xfce32, 0xfceb4, 
-    0xfcf35, 0xfcfb7, 0xfd038, 0xfd0ba, 0xfd13b, 
-    0xfd1bd, 0xfd23e, 0xfd2c0, 0xfd341, 0xfd3c2, 
-    0xfd444, 0xfd4c5, 0xfd546, 0xfd5c8, 0xfd649, 
-    0xfd6ca, 0xfd74c, 0xfd7cd, 0xfd84e, 0xfd8d0, 
-    0xfd951, 0xfd9d2, 0xfda53, 0xfdad4, 0xfdb56, 
-    0xfdbd7, 0xfdc58, 0xfdcd9, 0xfdd5a, 0xfdddb, 
-    0xfde5c, 0xfdedd, 0xfdf5e, 0xfdfdf, 0xfe060, 
-    0xfe0e1, 0xfe162, 0xfe1e3, 0xfe264, 0xfe2e5, 
-    0xfe366, 0xfe3e7, 0xfe468, 0xfe4e9, 0xfe569, 
-    0xfe5ea, 0xfe66b, 0xfe6ec, 0xfe76d, 0xfe7ed, 
-    0xfe86e, 0xfe8ef, 0xfe970, 0xfe9f0, 0xfea71, 
-    0xfeaf2, 0xfeb72, 0xfebf3, 0xfec74, 0xfecf4, 
-    0xfed75, 0xfedf5, 0xfee76, 0xfeef6, 0xfef77, 
-    0xfeff7, 0xff078, 0xff0f8, 0xff179, 0xff1f9, 
-    0xff27a, 0xff2fa, 0xff37b, 0xff3fb, 0xff47b, 
-    0xff4fc, 0xff57c, 0xff5fc, 0xff67d, 0xff6fd, 
-    0xff77d, 0xff7fe, 0xff87e, 0xff8fe, 0xff97e, 
-    0xff9fe, 0xffa7f, 0xffaff, 0xffb7f, 0xffbff, 
-    0xffc7f, 0xffcff, 0xffd7f, 0xffdff, 0xffe7f, 
-    0xffeff, 0xfff80
-};
-#endif
-#endif
-// ... to here
-#endif /* WRITE_LUT */
+static constexpr MlFixedLut<unsigned long, SQRT_LUT_LENGTH> sqrtTable =
+    mlSqrtLut<ML_FIXED_SQRT_LUT_BITS, ML_FIXED_RADIX>();
+static const unsigned long (&sqrtLUT)[SQRT_LUT_LENGTH] = sqrtTable.value;
 
-#define HIGH_FOUR_BIT_MASK  0xf0000000
-#define HIGH_TWO_BIT_MASK   0xc0000000
-#define SQRT_INDEX_MASK     0xfff00000
-#define SQRT_INDEX_SHIFT    20    /* Shift off the trailing 0s of MASK */
-#define SQRT_INDEX_OFFSET   0x400 /* 0x01... and enough 0s to cover MASK */
+#define SQRT_INDEX_SHIFT    (32 - ML_FIXED_SQRT_LUT_BITS)
+#define SQRT_INDEX_MASK     (((1UL << ML_FIXED_SQRT_LUT_BITS) - 1) << SQRT_INDEX_SHIFT)
+#define SQRT_INDEX_OFFSET   (1 << (ML_FIXED_SQRT_LUT_BITS - 2)) /* 0x01 prefix */
 
-MlScalar
-FixedSqrt(const MlScalar val)
+// The reciprocal square root table covers the same arguments, with its own
+// index size, and holds 1/sqrt(x) scaled by 2^31.
+#define RSQRT_LUT_LENGTH    (3 << (ML_FIXED_RSQRT_LUT_BITS - 2))
+
+static constexpr MlFixedLut<unsigned long, RSQRT_LUT_LENGTH> rsqrtTable =
+    mlRecipSqrtLut<ML_FIXED_RSQRT_LUT_BITS>();
+static const unsigned long (&rsqrtLUT)[RSQRT_LUT_LENGTH] = rsqrtTable.value;
+
+#define RSQRT_INDEX_SHIFT   (32 - ML_FIXED_RSQRT_LUT_BITS)
+#define RSQRT_INDEX_MASK    (((1UL << ML_FIXED_RSQRT_LUT_BITS) - 1) << RSQRT_INDEX_SHIFT)
+#define RSQRT_INDEX_OFFSET  (1 << (ML_FIXED_RSQRT_LUT_BITS - 2))
+
+// FixedRecipSqrt() halves the exponent of its argument, which must come
+// out even.
+static_assert((ML_FIXED_RADIX & 1) == 0, "ML_FIXED_RADIX must be even");
+
+
+// Shift a positive argument left by an even number of bits so that it is
+// bumped up against the end of the word. This gives us a fully precise
+// lookup index. The top two bits are then 0x[123], but not 0x0, so the
+// tables save space by not storing entries for the 0x0 prefix. Returns
+// half the number of bits shifted.
+static inline int
+normalizeSqrtArgument(uint32_t &op)
 {
-    unsigned long index, estimate, op;
-    register long sqrtArgument = mlScalarGetValue(val);
+    int shift = mlFixedClz(op) >> 1;
+    op <<= 2 * shift;
+    return shift;
+}
 
-#if ML_FIXED_CHECK_UNINITIALIZED
-    MLE_ASSERT(sqrtArgument != 0xdeadbeef);
-#endif
-    MLE_ASSERT(sqrtArgument >= 0);
-    if (sqrtArgument <= 0) {
-        return ML_SCALAR_ZERO;
-    }
 
-    // Shift left by an even number of bits until we\'re bumped
-    // up against the end of the word.  This gives us a fully 
-    // precise lookup index.  Then the top two bits are 0x[123], 
-    // but not 0x0, so we can save space by not storing table
-    // entries for 0x0 prefix.
+// The square root of a positive raw fixed point value.
+static inline unsigned long
+fixedSqrt(uint32_t op)
+{
+    int shift = normalizeSqrtArgument(op);
 
-    int shift = 0;
-    op = (unsigned long) sqrtArgument;
-    while (0 == (HIGH_FOUR_BIT_MASK & op)) {
-        shift += 2;
-        op <<= 4;
-    }
-    if (0 == (HIGH_TWO_BIT_MASK & op)) {
-        shift += 1;
-        op <<= 2;
-    }
-    index = ((SQRT_INDEX_MASK & op) >> SQRT_INDEX_SHIFT) - SQRT_INDEX_OFFSET;
     // Note this is already shifted left by the required amount.
-    // Thus we pretend that we\'re using a 8.24 format for the moment.
-    estimate = sqrtLUT[index];
+    // Thus we pretend that we're using a (15 + ML_FIXED_RADIX/2)
+    // bit fraction for the moment.
+    unsigned long index = ((SQRT_INDEX_MASK & op) >> SQRT_INDEX_SHIFT) - SQRT_INDEX_OFFSET;
+    unsigned long estimate = sqrtLUT[index];
 
     //
     // Newton iteration for f(x) = x^2 - a == 0 is
     // 1. estimate x0 ~= sqrt(a)
     // 2. x0 += (a/x0 - x0)/2
     //
-    
-    MlScalar sOp, sEst, sDiv;
-    unsigned long div;
+    // The quotient is formed as FixedDivide() would, from op shifted
+    // right one bit (rounding) in case op has the high bit set.
 
-    // shift right one bit (rounding) in case op has high bit set.
-    sOp = mlScalarSetValue(((op+1)>>1));
-    sEst = mlScalarSetValue(estimate);
-    sDiv = FixedDivide(sOp, sEst);
-    div = mlScalarGetValue(sDiv) << 1;
+    uint64_t sOp = ((uint64_t) op + 1) >> 1;
+    unsigned long div = (unsigned long) ((sOp << ML_FIXED_RADIX) / estimate) << 1;
 
     if (div > estimate) {
         estimate += (div - estimate) >> 1;
     } else {
         estimate -= (estimate - div) >> 1;
     }
-        
-    
-    // Now correct for our working at the high end of the word
-    // by shifting values back to the right location.  Add one
-    // for rounding.
 
-    estimate += 1<<(shift-1);
-    estimate >>= shift;
-
-    MlScalar ans;
-    ans = mlScalarSetValue(estimate);
-    return ans;
+    // Now correct for our working at the high end of the word
+    // by shifting values back to the right location, rounding.
+    return (estimate + ((1UL << shift) >> 1)) >> shift;
 }
 
-MlScalar
-FixedRecipSqrt(const MlScalar val)
+
+// The reciprocal of the square root of a positive raw fixed point value.
+static inline unsigned long
+fixedRecipSqrt(uint32_t op)
 {
-    register long op = mlScalarGetValue(val);
-#if ML_FIXED_CHECK_UNINITIALIZED
-    MLE_ASSERT(op != 0xdeadbeef);
-#endif
+    int shift = normalizeSqrtArgument(op);
 
-    // To do the reciprocal sqrt by table lookup and Newton\'s 
-    // method appears to be as expensive as doing the sqrt
-    // and a divide.  So reduce code size/table size and use
-    // that approach.
+    // op is now m*2^30 with m in [1..4), and the table gives 1/sqrt(m)
+    // scaled by 2^31.
+    unsigned long index = ((RSQRT_INDEX_MASK & op) >> RSQRT_INDEX_SHIFT) - RSQRT_INDEX_OFFSET;
+    uint64_t y = rsqrtLUT[index];
 
-    MLE_ASSERT(op > 0);
-    if (op <= 0) {
-        return mlScalarSetValue(0x7fffffff);
+    //
+    // Newton iteration for f(y) = 1/y^2 - m == 0 is
+    // y += y(1 - m*y^2)/2, that is, y = y(3 - m*y^2)/2.
+    //
+    // Every intermediate is kept at 31 fraction bits; none of the
+    // products reach 2^64.
+
+    uint64_t y2 = (y * y) >> 31;
+    uint64_t my2 = ((uint64_t) op * y2) >> 30;
+    y = (y * ((3ULL << 31) - my2)) >> 32;
+
+    // The argument was m*2^(30 - 2*shift - ML_FIXED_RADIX), so its
+    // reciprocal square root is y*2^(shift + ML_FIXED_RADIX/2 - 46).
+    // Convert to fixed point, rounding.
+    int backShift = 46 - 3*ML_FIXED_RADIX/2 - shift;
+    if (backShift > 0) {
+        y = (y + (1ULL << (backShift - 1))) >> backShift;
     }
-
-    return FixedDivide(ML_SCALAR_ONE, FixedSqrt(val));
+    else {
+        y <<= -backShift;
+    }
+    return (unsigned long) y;
 }
 
-#endif /* ML_FIXED_POINT */
 
-//////////////////////////////////////////////////////////////////////////
-//  Write out the lookup table for use in fixed point sqrt computations.
-//////////////////////////////////////////////////////////////////////////
-
-#if WRITE_LUT
-#include <stdio.h>
-
-// Make sure we do it with the fixed point flag on so that 
-// mlScalarGetValue() returns a long.
+MlScalar
+FixedSqrt(const MlScalar val)
+{
+    long sqrtArgument = mlScalarGetValue(val);
 
-#undef ML_FIXED_POINT
-#define ML_FIXED_POINT 1
+#if ML_FIXED_CHECK_UNINITIALIZED
+    MLE_ASSERT(sqrtArgument != 0xdeadbeef);
+#endif
+    MLE_ASSERT(sqrtArgument >= 0);
+    if (sqrtArgument <= 0) {
+        return ML_SCALAR_ZERO;
+    }
 
-#include <math.h>
+    return mlScalarSetValue(fixedSqrt((uint32_t) sqrtArgument));
+}
 
-void writeLUT( int nIndexBits, int shift )
+void
+FixedSqrtBatch(const MlScalar *val, MlScalar *result, int count)
 {
-    int power = 1 << (nIndexBits - 2);
-    int length = 3 << (nIndexBits - 2);
-    unsigned long *lut = new unsigned long[length];
-    int i;
-    float x, arg;
-    MlScalar scalar;
-    
-    for (i=0; i<length; i++) {
-        arg = (float)(1.0f + i / (float) power);
-        x = sqrtf(arg);
-        x *= 1 << (15 - ML_FIXED_RADIX/2);
-        scalar = mlFloatToScalar(x);
-        lut[i] = mlScalarGetValue(scalar);
+    for (int i = 0; i < count; i++) {
+        long op = mlScalarGetValue(val[i]);
+        MLE_ASSERT(op >= 0);
+        result[i] = mlScalarSetValue((op > 0) ? fixedSqrt((uint32_t) op) : 0);
     }
+}
 
-    printf( "static unsigned long sqrtLUT[] = { \n\t" );
-    for (i=0; i<length-1; i++) {
-        printf("0x%lx, ", lut[i]>>shift);
-        if (4 == (i % 5)) {
-            printf("\n\t");
-        }
+MlScalar
+FixedRecipSqrt(const MlScalar val)
+{
+    long op = mlScalarGetValue(val);
+#if ML_FIXED_CHECK_UNINITIALIZED
+    MLE_ASSERT(op != 0xdeadbeef);
+#endif
+
+    MLE_ASSERT(op > 0);
+    if (op <= 0) {
+        return mlScalarSetValue(0x7fffffff);
     }
-    printf("0x%lx", lut[length-1]>>shift);
-    printf( "\n};\n" );
 
-    return;
+    return mlScalarSetValue(fixedRecipSqrt((uint32_t) op));
 }
 
-int main ()
+void
+FixedRecipSqrtBatch(const MlScalar *val, MlScalar *result, int count)
 {
-    printf("#if ML_FIXED_RADIX == %d\n", 16);
-    writeLUT( 12, 16-16 );
-    printf("#else\n#if ML_FIXED_RADIX == %d\n", 12);
-    writeLUT( 12, 16-12 );
-    printf("#endif\n#endif\n");    
-
-    return 0;
+    for (int i = 0; i < count; i++) {
+        long op = mlScalarGetValue(val[i]);
+        MLE_ASSERT(op > 0);
+        result[i] = mlScalarSetValue((op > 0) ? fixedRecipSqrt((uint32_t) op) : 0x7fffffff);
+    }
 }
 
-#endif /* WRITE_LUT */
+#endif /* ML_FIXED_POINT */
 
 //////////////////////////////////////////////////////////////////////////
 //  Test the sqrt functions
@@ -1520,6 +286,29 @@ int main ()
         printf("Max sqrt[0:2:1/%d] error == 0.0f\n", N);
     }
 
+    N = 10000;
+    printf("\nTesting RecipSqrt function on N values in (0..2]\n");
+    err = 0.0f;
+    for (i=1; i<=N; i++) {
+        x = (float)(2.0f * i / (float)N);
+        scalar = mlFloatToScalar(x);
+        sx = 1.0f / sqrtf(mlScalarToFloat(scalar));
+        ans = FixedRecipSqrt(scalar);
+        ansval = mlScalarToFloat(ans);
+        e = fabsf(sx-ansval);
+        if (e > err) {
+            err = e;
+            xerr = x;
+        }
+    }
+
+    if (err != 0.0f) {
+        printf("Max recipsqrt(0:2:1/%d] error of %f at %f.\n", N, err, xerr);
+    }
+    else {
+        printf("Max recipsqrt(0:2:1/%d] error == 0.0f\n", N);
+    }
+
 #if TEST_SQRT_NEGATIVE
     (void) FixedSqrt(-ML_SCALAR_ONE);
 #endif
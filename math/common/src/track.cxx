@@ -0,0 +1,436 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// include system header files
+#include <stdlib.h>
+
+// include Magic Lantern math header files
+#include "math/scalar.h"
+#include "math/vector.h"
+#include "math/rotation.h"
+#include "math/track.h"
+#include "parallel.h"
+
+// Batches are not split between threads into parts of fewer tracks than
+// this; sampling one costs about 13 to 16 ns.
+#ifndef TRACK_THREAD_MIN
+#define TRACK_THREAD_MIN 1024
+#endif
+
+// The number of rotations gathered for each call to
+// MlRotation::slerpBatch() in MlRotationTrack::getValueBatch().
+#define TRACK_BLOCK 64
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlTrack
+//////////////////////////////////////////////////////////////////////////
+
+MlTrack::MlTrack()
+  : numKeys(0), cursor(0), times(NULL)
+{}
+
+
+MlTrack::MlTrack(const MlTrack &track)
+  : numKeys(0), cursor(0), times(NULL)
+{
+    setTimes(track.times, track.numKeys);
+    cursor = track.cursor;
+}
+
+
+MlTrack::~MlTrack()
+{
+    delete [] times;
+}
+
+
+void MlTrack::setTimes(const MlScalar *times, int numKeys)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Copies the key times and resets the cursor.
+//
+// Use: protected
+//
+////////////////////////////////////////////////////////////////////////
+{
+    delete [] this->times;
+    this->times = NULL;
+    this->numKeys = (numKeys > 0) ? numKeys : 0;
+    cursor = 0;
+
+    if (this->numKeys > 0) {
+        this->times = new MlScalar[numKeys];
+        for (int i = 0; i < numKeys; i++)
+            this->times[i] = times[i];
+    }
+}
+
+
+int MlTrack::findKey(MlScalar time, MlScalar &weight)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Finds the segment of the track holding time, starting from the
+//    segment of the last sample.
+//
+// Use: protected
+//
+////////////////////////////////////////////////////////////////////////
+{
+    int last = numKeys - 2;
+    int key = cursor;
+
+    // Clamp to the ends of the track.
+    if (time <= times[0]) {
+        cursor = 0;
+        weight = ML_SCALAR_ZERO;
+        return 0;
+    }
+    if (time >= times[numKeys - 1]) {
+        cursor = last;
+        weight = ML_SCALAR_ONE;
+        return last;
+    }
+
+    // Try the segment under the cursor and its neighbours, which is
+    // where playback will usually be, before searching all of them.
+    // Here key < last if time is past the segment, since time is before
+    // the last key.
+    if (time < times[key]) {
+        if (key > 0 && time >= times[key - 1]) {
+            key--;
+        }
+        else {
+            key = -1;
+        }
+    }
+    else if (time >= times[key + 1]) {
+        if (time < times[key + 2]) {
+            key++;
+        }
+        else {
+            key = -1;
+        }
+    }
+
+    if (key < 0) {
+        // Keep times[lo] <= time < times[hi].
+        int lo = 0, hi = numKeys - 1;
+        while (hi - lo > 1) {
+            int mid = (lo + hi) >> 1;
+            if (times[mid] <= time)
+                lo = mid;
+            else
+                hi = mid;
+        }
+        key = lo;
+    }
+
+    cursor = key;
+    weight = mlDiv(time - times[key], times[key + 1] - times[key]);
+    return key;
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlVector3Track
+//////////////////////////////////////////////////////////////////////////
+
+MlVector3Track::MlVector3Track()
+  : values(NULL)
+{}
+
+
+MlVector3Track::MlVector3Track(const MlScalar *times, const MlVector3 *values, int numKeys)
+  : values(NULL)
+{
+    setValue(times, values, numKeys);
+}
+
+
+MlVector3Track::MlVector3Track(const MlVector3Track &track)
+  : MlTrack(track), values(NULL)
+{
+    if (numKeys > 0) {
+        values = new MlVector3[numKeys];
+        for (int i = 0; i < numKeys; i++)
+            values[i] = track.values[i];
+    }
+}
+
+
+MlVector3Track::~MlVector3Track()
+{
+    delete [] values;
+}
+
+
+MlVector3Track &MlVector3Track::operator =(const MlVector3Track &track)
+{
+    if (this != &track) {
+        setValue(track.times, track.values, track.numKeys);
+        cursor = track.cursor;
+    }
+    return *this;
+}
+
+
+MlVector3Track &MlVector3Track::setValue(const MlScalar *times, const MlVector3 *values,
+                                         int numKeys)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Sets the keys of the track.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    setTimes(times, numKeys);
+
+    delete [] this->values;
+    this->values = NULL;
+    if (this->numKeys > 0) {
+        this->values = new MlVector3[numKeys];
+        for (int i = 0; i < numKeys; i++)
+            this->values[i] = values[i];
+    }
+
+    return *this;
+}
+
+
+MlVector3 MlVector3Track::getValue(MlScalar time)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Samples the track, interpolating linearly between keys.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    if (numKeys < 2) {
+        return (numKeys > 0) ? values[0] :
+            MlVector3(ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ZERO);
+    }
+
+    MlScalar weight;
+    int key = findKey(time, weight);
+    MlVector3 result;
+
+    MlVector3::interpolate(weight, &values[key], &values[key + 1], &result);
+    return result;
+}
+
+
+// The arguments of a batch, passed to each of its threads.
+struct MlVector3TrackBatch
+{
+    MlVector3Track *tracks;
+    MlScalar time;
+    MlVector3 *result;
+};
+
+void MlVector3Track::sampleRange(int first, int last, void *data)
+{
+    MlVector3TrackBatch *batch = (MlVector3TrackBatch *) data;
+
+    for (int i = first; i < last; i++)
+        batch->result[i] = batch->tracks[i].getValue(batch->time);
+}
+
+
+void MlVector3Track::getValueBatch(MlVector3Track *tracks, int count, MlScalar time,
+                                   MlVector3 *result, int numThreads)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Samples an array of tracks at the same time.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlVector3TrackBatch batch = { tracks, time, result };
+
+    mlForEachRange(count, TRACK_THREAD_MIN, numThreads, sampleRange, &batch);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlRotationTrack
+//////////////////////////////////////////////////////////////////////////
+
+MlRotationTrack::MlRotationTrack()
+  : values(NULL)
+{}
+
+
+MlRotationTrack::MlRotationTrack(const MlScalar *times, const MlRotation *values, int numKeys)
+  : values(NULL)
+{
+    setValue(times, values, numKeys);
+}
+
+
+MlRotationTrack::MlRotationTrack(const MlRotationTrack &track)
+  : MlTrack(track), values(NULL)
+{
+    if (numKeys > 0) {
+        values = new MlRotation[numKeys];
+        for (int i = 0; i < numKeys; i++)
+            values[i] = track.values[i];
+    }
+}
+
+
+MlRotationTrack::~MlRotationTrack()
+{
+    delete [] values;
+}
+
+
+MlRotationTrack &MlRotationTrack::operator =(const MlRotationTrack &track)
+{
+    if (this != &track) {
+        setValue(track.times, track.values, track.numKeys);
+        cursor = track.cursor;
+    }
+    return *this;
+}
+
+
+MlRotationTrack &MlRotationTrack::setValue(const MlScalar *times, const MlRotation *values,
+                                           int numKeys)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Sets the keys of the track.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    setTimes(times, numKeys);
+
+    delete [] this->values;
+    this->values = NULL;
+    if (this->numKeys > 0) {
+        this->values = new MlRotation[numKeys];
+        for (int i = 0; i < numKeys; i++)
+            this->values[i] = values[i];
+    }
+
+    return *this;
+}
+
+
+MlRotation MlRotationTrack::getValue(MlScalar time)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Samples the track, interpolating spherically between keys.
+//
+// Use: public
+//
+////////////////////////////////////////////////////////////////////////
+{
+    if (numKeys < 2)
+        return (numKeys > 0) ? values[0] : MlRotation::identity();
+
+    MlScalar weight;
+    int key = findKey(time, weight);
+
+    return MlRotation::slerp(values[key], values[key + 1], weight);
+}
+
+
+// The arguments of a batch, passed to each of its threads.
+struct MlRotationTrackBatch
+{
+    MlRotationTrack *tracks;
+    MlScalar time;
+    MlRotation *result;
+};
+
+void MlRotationTrack::sampleRange(int first, int last, void *data)
+{
+    MlRotationTrackBatch *batch = (MlRotationTrackBatch *) data;
+    const MlRotation identity = MlRotation::identity();
+    MlRotation rot0[TRACK_BLOCK], rot1[TRACK_BLOCK];
+    MlScalar weight[TRACK_BLOCK];
+
+    // Gather the keys around the sample time, then interpolate the
+    // whole block at once.
+    for (int base = first; base < last; base += TRACK_BLOCK) {
+        int m = (last - base < TRACK_BLOCK) ? last - base : TRACK_BLOCK;
+
+        for (int i = 0; i < m; i++) {
+            MlRotationTrack &track = batch->tracks[base + i];
+            int numKeys = track.getNumKeys();
+            const MlRotation *values = track.getValues();
+
+            if (numKeys < 2) {
+                rot0[i] = rot1[i] = (numKeys > 0) ? values[0] : identity;
+                weight[i] = ML_SCALAR_ZERO;
+            }
+            else {
+                int key = track.findKey(batch->time, weight[i]);
+                rot0[i] = values[key];
+                rot1[i] = values[key + 1];
+            }
+        }
+
+        MlRotation::slerpBatch(rot0, rot1, weight, batch->result + base, m);
+    }
+}
+
+
+void MlRotationTrack::getValueBatch(MlRotationTrack *tracks, int count, MlScalar time,
+                                    MlRotation *result, int numThreads)
+////////////////////////////////////////////////////////////////////////
+//
+// Description:
+//    Samples an array of tracks at the same time.
+//
+// Use: public, static
+//
+////////////////////////////////////////////////////////////////////////
+{
+    MlRotationTrackBatch batch = { tracks, time, result };
+
+    mlForEachRange(count, TRACK_THREAD_MIN, numThreads, sampleRange, &batch);
+}
@@ -42,6 +42,7 @@
 #include "math/vector.h"
 #include "math/rotation.h"
 #include "math/transfrm.h"
+#include "vecsimd.h"
 
 
 // Handy absolute value macro:
@@ -80,73 +81,6 @@
     (matrix[3][2] == ML_SCALAR_ZERO))
 
 
-// Copy constructor.
-
-MlTransform::MlTransform(const MlTransform &trans)
-{
-    matrix.m[0][0] = trans.matrix.m[0][0];
-    matrix.m[0][1] = trans.matrix.m[0][1];
-    matrix.m[0][2] = trans.matrix.m[0][2];
-
-    matrix.m[1][0] = trans.matrix.m[1][0];
-    matrix.m[1][1] = trans.matrix.m[1][1];
-    matrix.m[1][2] = trans.matrix.m[1][2];
-
-    matrix.m[2][0] = trans.matrix.m[2][0];
-    matrix.m[2][1] = trans.matrix.m[2][1];
-    matrix.m[2][2] = trans.matrix.m[2][2];
-
-    matrix.m[3][0] = trans.matrix.m[3][0];
-    matrix.m[3][1] = trans.matrix.m[3][1];
-    matrix.m[3][2] = trans.matrix.m[3][2];
-}
-
-
-// Constructor given all 12 elements in row-major order.
-
-MlTransform::MlTransform(MlScalar a11, MlScalar a12, MlScalar a13, 
-                         MlScalar a21, MlScalar a22, MlScalar a23, 
-                         MlScalar a31, MlScalar a32, MlScalar a33, 
-                         MlScalar a41, MlScalar a42, MlScalar a43)
-{
-    matrix.m[0][0] = a11;
-    matrix.m[0][1] = a12;
-    matrix.m[0][2] = a13;
-
-    matrix.m[1][0] = a21;
-    matrix.m[1][1] = a22;
-    matrix.m[1][2] = a23;
-
-    matrix.m[2][0] = a31;
-    matrix.m[2][1] = a32;
-    matrix.m[2][2] = a33;
-
-    matrix.m[3][0] = a41;
-    matrix.m[3][1] = a42;
-    matrix.m[3][2] = a43;
-}
-
-
-// Constructor from a 4x3 array of float elements.
-
-MlTransform::MlTransform(const MlTrans &m)
-
-{
-    matrix.m[0][0] = m.m[0][0];
-    matrix.m[0][1] = m.m[0][1];
-    matrix.m[0][2] = m.m[0][2];
-    matrix.m[1][0] = m.m[1][0];
-    matrix.m[1][1] = m.m[1][1];
-    matrix.m[1][2] = m.m[1][2];
-    matrix.m[2][0] = m.m[2][0];
-    matrix.m[2][1] = m.m[2][1];
-    matrix.m[2][2] = m.m[2][2];
-    matrix.m[3][0] = m.m[3][0];
-    matrix.m[3][1] = m.m[3][1];
-    matrix.m[3][2] = m.m[3][2];
-}
-
-
 // Constructor from a 4x4 array of double elements .
 // Warning: The input better be an affine matrix (with last column
 //          being 0,0,0,1) because this last column is thrown away!
@@ -250,19 +184,6 @@ MlTransform& MlTransform::operator =(const MlTransform &m)
 }
 
 
-// Binary multiplication of matrices.
-
-MlTransform operator *(const MlTransform &l, const MlTransform &r)
-
-{
-    MlTransform m = l;
-    
-    m *= r;
-    
-    return m;
-}
-
-
 // Equality comparison operator. All componenents must match exactly.
 
 int operator ==(const MlTransform &m1, const MlTransform &m2)
@@ -332,17 +253,6 @@ int MlTransform::equals(const MlTransform &m, MlScalar tolerance) const
 }
 
 
-// Return an identity matrix.
-
-MlTransform MlTransform::identity()    
-{
-    return MlTransform(ML_SCALAR_ONE, ML_SCALAR_ZERO, ML_SCALAR_ZERO,
-                       ML_SCALAR_ZERO, ML_SCALAR_ONE, ML_SCALAR_ZERO, 
-                       ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ONE,  
-                       ML_SCALAR_ZERO, ML_SCALAR_ZERO, ML_SCALAR_ZERO );
-}
-
-
 // Sets matrix to be identity,.
 
 void MlTransform::makeIdentity()
@@ -362,14 +272,6 @@ void MlTransform::makeIdentity()
 }
 
 
-// Returns whether matrix is identity.
-
-int MlTransform::isIdentity() const
-{
-    return IS_IDENTITY(matrix.m);
-}
-
-
 // Returns whether matrix is all zeros.
 
 int MlTransform::isZero() const
@@ -819,29 +721,6 @@ void MlTransform::multMatrixVec(const MlVector3& src, MlVector3& dst) const
 }
 
 
-// Multiplies given row vector by matrix, giving vector result
-
-void MlTransform::multVecMatrix(const MlVector3& src, MlVector3& dst) const
-{
-    MlScalar x,y,z;
-    
-    x = mlMul(src[0], matrix.m[0][0]) + mlMul(src[1], matrix.m[1][0]) +
-        mlMul(src[2], matrix.m[2][0]) + matrix.m[3][0];
-    y = mlMul(src[0], matrix.m[0][1]) + mlMul(src[1], matrix.m[1][1]) +
-        mlMul(src[2], matrix.m[2][1]) + matrix.m[3][1];
-    z = mlMul(src[0], matrix.m[0][2]) + mlMul(src[1], matrix.m[1][2]) +
-        mlMul(src[2], matrix.m[2][2]) + matrix.m[3][2];
-
-//    w = mlMul(src[0], matrix.m[0][3]) + mlMul(src[1], matrix.m[1][3]) +
-//    mlMul(src[2], matrix.m[2][3]) + ML_SCALAR_ONE;
-//    
-//    MlScalar wr = mlReciprocal(w);
-//    dst.setValue(mlMul(x,wr), mlMul(y,wr), mlMul(z,wr));
-
-    dst.setValue(x,y,z);
-}
-
-
 // Multiplies given row vector by matrix, giving vector result
 // src is assumed to be a direction vector, so translation part of
 // matrix is ignored.
@@ -853,11 +732,121 @@ void MlTransform::multDirMatrix(const MlVector3& src, MlVector3& dst) const
     x = mlMul(src[0], matrix.m[0][0]) + mlMul(src[1], matrix.m[1][0]) + mlMul(src[2], matrix.m[2][0]);
     y = mlMul(src[0], matrix.m[0][1]) + mlMul(src[1], matrix.m[1][1]) + mlMul(src[2], matrix.m[2][1]);
     z = mlMul(src[0], matrix.m[0][2]) + mlMul(src[1], matrix.m[1][2]) + mlMul(src[2], matrix.m[2][2]);
-    
+
     dst.setValue(x, y, z);
 }
 
 
+////////////////////////////////////////////
+//
+// Batch matrix/vector arithmetic
+//
+////////////////////////////////////////////
+
+
+// Number of vectors gathered into structure-of-arrays form at a time
+// by the MlVector3 array versions of the batch transforms.
+#define BATCH_BLOCK 64
+
+
+// Multiplies count row vectors, given as separate x, y and z streams,
+// by the matrix. If translate is FALSE, the translation part of the
+// matrix is ignored. Each vector is completely read before its result
+// is stored, so the destination streams may alias the source streams.
+
+static void multBatch(const MlTrans &mat, int translate,
+                      const MlScalar *sx, const MlScalar *sy, const MlScalar *sz,
+                      MlScalar *dx, MlScalar *dy, MlScalar *dz, int count)
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->transform3(&mat.m[0][0], sx, sy, sz, dx, dy, dz, count, translate);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+    {
+        MlScalar x = sx[i], y = sy[i], z = sz[i];
+        MlScalar rx = mlMul(x, mat.m[0][0]) + mlMul(y, mat.m[1][0]) + mlMul(z, mat.m[2][0]);
+        MlScalar ry = mlMul(x, mat.m[0][1]) + mlMul(y, mat.m[1][1]) + mlMul(z, mat.m[2][1]);
+        MlScalar rz = mlMul(x, mat.m[0][2]) + mlMul(y, mat.m[1][2]) + mlMul(z, mat.m[2][2]);
+
+        if (translate) {
+            rx += mat.m[3][0];
+            ry += mat.m[3][1];
+            rz += mat.m[3][2];
+        }
+        dx[i] = rx;
+        dy[i] = ry;
+        dz[i] = rz;
+    }
+}
+
+
+// Multiplies an array of MlVector3 by the matrix, gathering the
+// vectors into structure-of-arrays blocks so that the SIMD kernel
+// can be used.
+
+static void multBatch(const MlTrans &mat, int translate,
+                      const MlVector3 *src, MlVector3 *dst, int count)
+{
+    MlScalar x[BATCH_BLOCK], y[BATCH_BLOCK], z[BATCH_BLOCK];
+
+    for (int base = 0; base < count; base += BATCH_BLOCK)
+    {
+        int n = count - base;
+        if (n > BATCH_BLOCK)
+            n = BATCH_BLOCK;
+
+        for (int i = 0; i < n; i++)
+            src[base + i].getValue(x[i], y[i], z[i]);
+
+        multBatch(mat, translate, x, y, z, x, y, z, n);
+
+        for (int i = 0; i < n; i++)
+            dst[base + i].setValue(x[i], y[i], z[i]);
+    }
+}
+
+
+// Multiplies given array of row vectors by matrix, giving vector results
+
+void MlTransform::multVecMatrixBatch(const MlVector3 *src, MlVector3 *dst, int count) const
+{
+    multBatch(matrix, TRUE, src, dst, count);
+}
+
+
+// Multiplies given x, y and z streams of row vectors by matrix, giving
+// vector results in the destination streams
+
+void MlTransform::multVecMatrixBatch(const MlScalar *srcX, const MlScalar *srcY, const MlScalar *srcZ,
+                                     MlScalar *dstX, MlScalar *dstY, MlScalar *dstZ, int count) const
+{
+    multBatch(matrix, TRUE, srcX, srcY, srcZ, dstX, dstY, dstZ, count);
+}
+
+
+// Multiplies given array of direction vectors by matrix, ignoring the
+// translation part of the matrix
+
+void MlTransform::multDirMatrixBatch(const MlVector3 *src, MlVector3 *dst, int count) const
+{
+    multBatch(matrix, FALSE, src, dst, count);
+}
+
+
+// Multiplies given x, y and z streams of direction vectors by matrix,
+// ignoring the translation part of the matrix
+
+void MlTransform::multDirMatrixBatch(const MlScalar *srcX, const MlScalar *srcY, const MlScalar *srcZ,
+                                     MlScalar *dstX, MlScalar *dstY, MlScalar *dstZ, int count) const
+{
+    multBatch(matrix, FALSE, srcX, srcY, srcZ, dstX, dstY, dstZ, count);
+}
+
+
 //////////////////////////////////////////////////////////////////
 //
 // Miscellaneous get/set convenience routines for translations
@@ -1026,8 +1015,8 @@ void MlTransform::applyRotation(const MlVector3 rotation)
     // Apply Z Rotation
     if (rotation[2]!=ML_SCALAR_ZERO) {
         MlScalar angle = mlDegreesToAngle(rotation[2]);
-        MlScalar sz=mlSin(angle);
-        MlScalar cz=mlCos(angle);
+        MlScalar sz,cz;
+        mlSinCos(angle,sz,cz);
         mat[0][0]=cz;
         mat[0][1]=sz;
         mat[1][0]=-sz;
@@ -1041,8 +1030,8 @@ void MlTransform::applyRotation(const MlVector3 rotation)
     // Apply Y Rotation
     if (rotation[1]!=ML_SCALAR_ZERO) {
         MlScalar angle = mlDegreesToAngle(rotation[1]);
-        MlScalar sy=mlSin(angle);
-        MlScalar cy=mlCos(angle);
+        MlScalar sy,cy;
+        mlSinCos(angle,sy,cy);
         mat[0][0]=cy;
         mat[0][2]=-sy;
         mat[1][1]=ML_SCALAR_ONE;
@@ -1056,8 +1045,8 @@ void MlTransform::applyRotation(const MlVector3 rotation)
     // Apply X Rotation
     if (rotation[0]!=ML_SCALAR_ZERO) {
         MlScalar angle = mlDegreesToAngle(rotation[0]);
-        MlScalar sx=mlSin(angle);
-        MlScalar cx=mlCos(angle);
+        MlScalar sx,cx;
+        mlSinCos(angle,sx,cx);
         mat[0][0]=ML_SCALAR_ONE;
         mat[1][1]=cx;
         mat[1][2]=sx;
@@ -0,0 +1,226 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// include system header files
+#include <math.h>
+
+// include Magic Lantern math header files
+#include "math/scalar.h"
+#include "math/angle.h"
+#include "math/sine.h"
+#include "math/atan.h"
+#include "math/asine.h"
+#include "vecsimd.h"
+
+
+#if ML_VECTOR_SIMD
+// The coefficients of mlFloatSinCos() for each accuracy tier, padded with
+// zeros to the degree of the full tier: sin(2*pi*r)/r, then cos(2*pi*r),
+// both in powers of r*r.
+static const float sinCosCoeffs[3][9] =
+{
+    {   // ML_SINCOS_FULL
+        6.28318522f, -41.3416277f, 81.5880701f, -75.2377388f,
+        1.0f, -19.7392086f, 64.9393158f, -85.4428076f, 59.2187807f
+    },
+    {   // ML_SINCOS_MEDIUM
+        6.28315373f, -41.3255161f, 79.5281292f, 0.0f,
+        0.999989987f, -19.7276501f, 62.9598332f, 0.0f, 0.0f
+    },
+    {   // ML_SINCOS_FAST
+        6.27708028f, -39.7708978f, 0.0f, 0.0f,
+        0.998072438f, -18.7436076f, 0.0f, 0.0f, 0.0f
+    }
+};
+#endif /* ML_VECTOR_SIMD */
+
+
+void
+mlSinCosBatch( const MlScalar *angles, MlScalar *s, MlScalar *c,
+    int count, const int accuracy )
+{
+#if ML_FIXED_POINT
+    // The fixed-point functions have only one accuracy.
+    (void) accuracy;
+#endif
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        int tier = ((accuracy == ML_SINCOS_MEDIUM) || (accuracy == ML_SINCOS_FAST)) ?
+            accuracy : ML_SINCOS_FULL;
+        k->sinCos(angles, s, c, count, sinCosCoeffs[tier]);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++) {
+#if ML_FIXED_POINT
+        mlSinCos(angles[i], s[i], c[i]);
+#else
+        float sf, cf;
+        mlFloatSinCos(mlScalarToFloat(angles[i]), sf, cf, accuracy);
+        s[i] = mlFloatToScalar(sf);
+        c[i] = mlFloatToScalar(cf);
+#endif
+    }
+}
+
+
+void
+mlAtan2Batch( const MlScalar *y, const MlScalar *x, MlScalar *angles, int count )
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->atan2(y, x, angles, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        angles[i] = mlAtan2(y[i], x[i]);
+}
+
+
+void
+mlAsinBatch( const MlScalar *x, MlScalar *angles, int count )
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->asin(x, angles, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        angles[i] = mlAsin(x[i]);
+}
+
+
+void
+mlAcosBatch( const MlScalar *x, MlScalar *angles, int count )
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->acos(x, angles, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        angles[i] = mlAcos(x[i]);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//  Measure the throughput of the batch functions against the scalar
+//  functions, in elements per second. Set MLMATH_SIMD to compare the
+//  instruction sets.
+//////////////////////////////////////////////////////////////////////////
+
+#ifdef TEST_TRIG_BATCH
+
+#include <stdio.h>
+#include <time.h>
+
+#define N 4096
+#define PASSES 2000
+
+static MlScalar in0[N], in1[N], out0[N], out1[N];
+
+static double rate( clock_t start )
+{
+    double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    return (seconds > 0.0) ? ((double)N * PASSES) / seconds : 0.0;
+}
+
+int main ()
+{
+    int i, pass;
+    clock_t start;
+    double scalar, batch;
+
+    for (i = 0; i < N; i++) {
+        float f = (float)i / (float)N;
+        in0[i] = mlFloatToScalar(f * 2.0f - 1.0f);
+        in1[i] = mlFloatToScalar(1.0f - f * 0.5f);
+    }
+
+    printf("%-10s %16s %16s\n", "function", "scalar elem/s", "batch elem/s");
+
+    start = clock();
+    for (pass = 0; pass < PASSES; pass++)
+        for (i = 0; i < N; i++)
+            mlSinCos(in0[i], out0[i], out1[i]);
+    scalar = rate(start);
+    start = clock();
+    for (pass = 0; pass < PASSES; pass++)
+        mlSinCosBatch(in0, out0, out1, N);
+    batch = rate(start);
+    printf("%-10s %16.4g %16.4g\n", "sincos", scalar, batch);
+
+    start = clock();
+    for (pass = 0; pass < PASSES; pass++)
+        for (i = 0; i < N; i++)
+            out0[i] = mlAtan2(in0[i], in1[i]);
+    scalar = rate(start);
+    start = clock();
+    for (pass = 0; pass < PASSES; pass++)
+        mlAtan2Batch(in0, in1, out0, N);
+    batch = rate(start);
+    printf("%-10s %16.4g %16.4g\n", "atan2", scalar, batch);
+
+    start = clock();
+    for (pass = 0; pass < PASSES; pass++)
+        for (i = 0; i < N; i++)
+            out0[i] = mlAsin(in0[i]);
+    scalar = rate(start);
+    start = clock();
+    for (pass = 0; pass < PASSES; pass++)
+        mlAsinBatch(in0, out0, N);
+    batch = rate(start);
+    printf("%-10s %16.4g %16.4g\n", "asin", scalar, batch);
+
+    start = clock();
+    for (pass = 0; pass < PASSES; pass++)
+        for (i = 0; i < N; i++)
+            out0[i] = mlAcos(in0[i]);
+    scalar = rate(start);
+    start = clock();
+    for (pass = 0; pass < PASSES; pass++)
+        mlAcosBatch(in0, out0, N);
+    batch = rate(start);
+    printf("%-10s %16.4g %16.4g\n", "acos", scalar, batch);
+
+    return 0;
+}
+
+#endif
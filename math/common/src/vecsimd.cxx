@@ -0,0 +1,553 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Include Magic Lantern math header files.
+#include "vecsimd.h"
+
+#if ML_VECTOR_SIMD
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// SSE4.1 kernels, 4 floats wide.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse4.1"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#endif
+
+// SSE4.1 has no gather instruction, so the elements are loaded one at a
+// time.
+static inline __m128i gatherSse41(const void *p, int s)
+{
+    const char *b = (const char *) p;
+    int v[4];
+    for (int k = 0; k < 4; k++)
+        memcpy(&v[k], b + k*s, 4);
+    return _mm_setr_epi32(v[0], v[1], v[2], v[3]);
+}
+
+#define ML_SIMD_KERNEL(name) name##Sse41
+#define ML_SIMD_LEVEL ML_SIMD_SSE4_1
+#define VF __m128
+#define VW 4
+#define VLOADU(p) _mm_loadu_ps(p)
+#define VSTOREU(p, v) _mm_storeu_ps(p, v)
+#define VADD(a, b) _mm_add_ps(a, b)
+#define VSUB(a, b) _mm_sub_ps(a, b)
+#define VMUL(a, b) _mm_mul_ps(a, b)
+#define VDIV(a, b) _mm_div_ps(a, b)
+#define VSQRT(a) _mm_sqrt_ps(a)
+#define VSET1(s) _mm_set1_ps(s)
+#define VSHUF(a, b, i) _mm_shuffle_ps(a, b, i)
+#define VUNPLO(a, b) _mm_unpacklo_ps(a, b)
+#define VUNPHI(a, b) _mm_unpackhi_ps(a, b)
+// With one lane there is no stride, but s is still referenced so that
+// kernels taking it as a parameter compile without warnings.
+#define VLOADLANES(p, s) ((void) (s), _mm_loadu_ps(p))
+#define VSTORELANES(p, s, v) ((void) (s), _mm_storeu_ps(p, v))
+#define VLOADLANEPTRS(pp) _mm_loadu_ps((pp)[0])
+#define VRECIP_NONZERO(v) \
+    _mm_and_ps(_mm_cmpneq_ps(v, _mm_setzero_ps()), _mm_div_ps(_mm_set1_ps(1.0f), v))
+#define VMIN(a, b) _mm_min_ps(a, b)
+#define VMAX(a, b) _mm_max_ps(a, b)
+#define VAND(a, b) _mm_and_ps(a, b)
+#define VANDNOT(a, b) _mm_andnot_ps(a, b)
+#define VXOR(a, b) _mm_xor_ps(a, b)
+#define VROUND(a) _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define VMASK __m128
+#define VCMPEQ(a, b) _mm_cmpeq_ps(a, b)
+#define VCMPGT(a, b) _mm_cmpgt_ps(a, b)
+#define VSIGNMASK(a) (a)
+#define VBLEND(m, a, b) _mm_blendv_ps(a, b, m)
+#define VMASKBITS(m) _mm_movemask_ps(m)
+#define VI __m128i
+#define VCVTI(a) _mm_cvtps_epi32(a)
+#define VIBIT1SIGN(i, k) \
+    _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(i, _mm_set1_epi32(k)), 30))
+#define VIODD(i) _mm_castsi128_ps(_mm_slli_epi32(i, 31))
+#define VCVTIF(i) _mm_cvtepi32_ps(i)
+#define VILOADU(p) _mm_loadu_si128((const __m128i *) (p))
+#define VISTOREU(p, i) _mm_storeu_si128((__m128i *) (p), i)
+#define VISET1(s) _mm_set1_epi32(s)
+#define VIAND(a, b) _mm_and_si128(a, b)
+#define VIOR(a, b) _mm_or_si128(a, b)
+#define VISLLI(i, n) _mm_slli_epi32(i, n)
+#define VISRLI(i, n) _mm_srli_epi32(i, n)
+#define VIGATHER(p, s) gatherSse41(p, s)
+#define VILOADS16(p) _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *) (p)))
+#define VISTORES16(p, i) _mm_storel_epi64((__m128i *) (p), _mm_packs_epi32(i, i))
+#define VDSUBF(p, o) \
+    _mm_movelh_ps(_mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(p), _mm_loadu_pd(o))), \
+        _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd((p) + 2), _mm_loadu_pd((o) + 2))))
+
+#include "vecsimd.inl"
+
+#undef ML_SIMD_KERNEL
+#undef ML_SIMD_LEVEL
+#undef VF
+#undef VW
+#undef VLOADU
+#undef VSTOREU
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VDIV
+#undef VSQRT
+#undef VSET1
+#undef VSHUF
+#undef VUNPLO
+#undef VUNPHI
+#undef VLOADLANES
+#undef VSTORELANES
+#undef VLOADLANEPTRS
+#undef VRECIP_NONZERO
+#undef VMIN
+#undef VMAX
+#undef VAND
+#undef VANDNOT
+#undef VXOR
+#undef VROUND
+#undef VMASK
+#undef VCMPEQ
+#undef VCMPGT
+#undef VSIGNMASK
+#undef VBLEND
+#undef VMASKBITS
+#undef VI
+#undef VCVTI
+#undef VIBIT1SIGN
+#undef VIODD
+#undef VCVTIF
+#undef VILOADU
+#undef VISTOREU
+#undef VISET1
+#undef VIAND
+#undef VIOR
+#undef VISLLI
+#undef VISRLI
+#undef VIGATHER
+#undef VILOADS16
+#undef VISTORES16
+#undef VDSUBF
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// AVX2 kernels, 8 floats wide.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+#define ML_SIMD_KERNEL(name) name##Avx2
+#define ML_SIMD_LEVEL ML_SIMD_AVX2
+#define VF __m256
+#define VW 8
+#define VLOADU(p) _mm256_loadu_ps(p)
+#define VSTOREU(p, v) _mm256_storeu_ps(p, v)
+#define VADD(a, b) _mm256_add_ps(a, b)
+#define VSUB(a, b) _mm256_sub_ps(a, b)
+#define VMUL(a, b) _mm256_mul_ps(a, b)
+#define VDIV(a, b) _mm256_div_ps(a, b)
+#define VSQRT(a) _mm256_sqrt_ps(a)
+#define VSET1(s) _mm256_set1_ps(s)
+#define VSHUF(a, b, i) _mm256_shuffle_ps(a, b, i)
+#define VUNPLO(a, b) _mm256_unpacklo_ps(a, b)
+#define VUNPHI(a, b) _mm256_unpackhi_ps(a, b)
+#define VLOADLANES(p, s) \
+    _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps((p) + (s)), 1)
+#define VSTORELANES(p, s, v) \
+    (_mm_storeu_ps(p, _mm256_castps256_ps128(v)), _mm_storeu_ps((p) + (s), _mm256_extractf128_ps(v, 1)))
+#define VLOADLANEPTRS(pp) \
+    _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps((pp)[0])), _mm_loadu_ps((pp)[1]), 1)
+#define VRECIP_NONZERO(v) \
+    _mm256_and_ps(_mm256_cmp_ps(v, _mm256_setzero_ps(), _CMP_NEQ_UQ), _mm256_div_ps(_mm256_set1_ps(1.0f), v))
+#define VMIN(a, b) _mm256_min_ps(a, b)
+#define VMAX(a, b) _mm256_max_ps(a, b)
+#define VAND(a, b) _mm256_and_ps(a, b)
+#define VANDNOT(a, b) _mm256_andnot_ps(a, b)
+#define VXOR(a, b) _mm256_xor_ps(a, b)
+#define VROUND(a) _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define VMASK __m256
+#define VCMPEQ(a, b) _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+#define VCMPGT(a, b) _mm256_cmp_ps(a, b, _CMP_GT_OQ)
+#define VSIGNMASK(a) (a)
+#define VBLEND(m, a, b) _mm256_blendv_ps(a, b, m)
+#define VMASKBITS(m) _mm256_movemask_ps(m)
+#define VI __m256i
+#define VCVTI(a) _mm256_cvtps_epi32(a)
+#define VIBIT1SIGN(i, k) \
+    _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(i, _mm256_set1_epi32(k)), 30))
+#define VIODD(i) _mm256_castsi256_ps(_mm256_slli_epi32(i, 31))
+#define VCVTIF(i) _mm256_cvtepi32_ps(i)
+#define VILOADU(p) _mm256_loadu_si256((const __m256i *) (p))
+#define VISTOREU(p, i) _mm256_storeu_si256((__m256i *) (p), i)
+#define VISET1(s) _mm256_set1_epi32(s)
+#define VIAND(a, b) _mm256_and_si256(a, b)
+#define VIOR(a, b) _mm256_or_si256(a, b)
+#define VISLLI(i, n) _mm256_slli_epi32(i, n)
+#define VISRLI(i, n) _mm256_srli_epi32(i, n)
+#define VIGATHER(p, s) \
+    _mm256_i32gather_epi32((const int *) (p), \
+        _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(s)), 1)
+#define VILOADS16(p) _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) (p)))
+#define VISTORES16(p, i) \
+    _mm_storeu_si128((__m128i *) (p), \
+        _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packs_epi32(i, i), 0x08)))
+#define VDSUBF(p, o) \
+    _mm256_insertf128_ps(_mm256_castps128_ps256( \
+        _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(p), _mm256_loadu_pd(o)))), \
+        _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd((p) + 4), _mm256_loadu_pd((o) + 4))), 1)
+
+#include "vecsimd.inl"
+
+#undef ML_SIMD_KERNEL
+#undef ML_SIMD_LEVEL
+#undef VF
+#undef VW
+#undef VLOADU
+#undef VSTOREU
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VDIV
+#undef VSQRT
+#undef VSET1
+#undef VSHUF
+#undef VUNPLO
+#undef VUNPHI
+#undef VLOADLANES
+#undef VSTORELANES
+#undef VLOADLANEPTRS
+#undef VRECIP_NONZERO
+#undef VMIN
+#undef VMAX
+#undef VAND
+#undef VANDNOT
+#undef VXOR
+#undef VROUND
+#undef VMASK
+#undef VCMPEQ
+#undef VCMPGT
+#undef VSIGNMASK
+#undef VBLEND
+#undef VMASKBITS
+#undef VI
+#undef VCVTI
+#undef VIBIT1SIGN
+#undef VIODD
+#undef VCVTIF
+#undef VILOADU
+#undef VISTOREU
+#undef VISET1
+#undef VIAND
+#undef VIOR
+#undef VISLLI
+#undef VISRLI
+#undef VIGATHER
+#undef VILOADS16
+#undef VISTORES16
+#undef VDSUBF
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// AVX-512 kernels, 16 floats wide.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx512f"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+// GCC 12 warns that the undefined vectors the AVX-512 intrinsics start
+// from may be used uninitialized.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#define ML_SIMD_KERNEL(name) name##Avx512
+#define ML_SIMD_LEVEL ML_SIMD_AVX512
+#define VF __m512
+#define VW 16
+#define VLOADU(p) _mm512_loadu_ps(p)
+#define VSTOREU(p, v) _mm512_storeu_ps(p, v)
+#define VADD(a, b) _mm512_add_ps(a, b)
+#define VSUB(a, b) _mm512_sub_ps(a, b)
+#define VMUL(a, b) _mm512_mul_ps(a, b)
+#define VDIV(a, b) _mm512_div_ps(a, b)
+#define VSQRT(a) _mm512_sqrt_ps(a)
+#define VSET1(s) _mm512_set1_ps(s)
+#define VSHUF(a, b, i) _mm512_shuffle_ps(a, b, i)
+#define VUNPLO(a, b) _mm512_unpacklo_ps(a, b)
+#define VUNPHI(a, b) _mm512_unpackhi_ps(a, b)
+#define VLOADLANES(p, s) \
+    _mm512_insertf32x4(_mm512_insertf32x4(_mm512_insertf32x4( \
+        _mm512_castps128_ps512(_mm_loadu_ps(p)), \
+        _mm_loadu_ps((p) + (s)), 1), \
+        _mm_loadu_ps((p) + 2*(s)), 2), \
+        _mm_loadu_ps((p) + 3*(s)), 3)
+#define VSTORELANES(p, s, v) \
+    (_mm_storeu_ps(p, _mm512_castps512_ps128(v)), \
+     _mm_storeu_ps((p) + (s), _mm512_extractf32x4_ps(v, 1)), \
+     _mm_storeu_ps((p) + 2*(s), _mm512_extractf32x4_ps(v, 2)), \
+     _mm_storeu_ps((p) + 3*(s), _mm512_extractf32x4_ps(v, 3)))
+#define VLOADLANEPTRS(pp) \
+    _mm512_insertf32x4(_mm512_insertf32x4(_mm512_insertf32x4( \
+        _mm512_castps128_ps512(_mm_loadu_ps((pp)[0])), \
+        _mm_loadu_ps((pp)[1]), 1), \
+        _mm_loadu_ps((pp)[2]), 2), \
+        _mm_loadu_ps((pp)[3]), 3)
+#define VRECIP_NONZERO(v) \
+    _mm512_maskz_div_ps(_mm512_cmp_ps_mask(v, _mm512_setzero_ps(), _CMP_NEQ_UQ), _mm512_set1_ps(1.0f), v)
+#define VMIN(a, b) _mm512_min_ps(a, b)
+#define VMAX(a, b) _mm512_max_ps(a, b)
+#define VAND(a, b) \
+    _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)))
+#define VANDNOT(a, b) \
+    _mm512_castsi512_ps(_mm512_andnot_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)))
+#define VXOR(a, b) \
+    _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_castps_si512(b)))
+#define VROUND(a) _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define VMASK __mmask16
+#define VCMPEQ(a, b) _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ)
+#define VCMPGT(a, b) _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ)
+#define VSIGNMASK(a) _mm512_cmplt_epi32_mask(_mm512_castps_si512(a), _mm512_setzero_si512())
+#define VBLEND(m, a, b) _mm512_mask_blend_ps(m, a, b)
+#define VMASKBITS(m) ((int) (m))
+#define VI __m512i
+#define VCVTI(a) _mm512_cvtps_epi32(a)
+#define VIBIT1SIGN(i, k) \
+    _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(i, _mm512_set1_epi32(k)), 30))
+#define VIODD(i) _mm512_test_epi32_mask(i, _mm512_set1_epi32(1))
+#define VCVTIF(i) _mm512_cvtepi32_ps(i)
+#define VILOADU(p) _mm512_loadu_si512((const void *) (p))
+#define VISTOREU(p, i) _mm512_storeu_si512((void *) (p), i)
+#define VISET1(s) _mm512_set1_epi32(s)
+#define VIAND(a, b) _mm512_and_si512(a, b)
+#define VIOR(a, b) _mm512_or_si512(a, b)
+#define VISLLI(i, n) _mm512_slli_epi32(i, n)
+#define VISRLI(i, n) _mm512_srli_epi32(i, n)
+#define VIGATHER(p, s) \
+    _mm512_i32gather_epi32(_mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, \
+        8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(s)), (const void *) (p), 1)
+#define VILOADS16(p) _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *) (p)))
+#define VISTORES16(p, i) _mm256_storeu_si256((__m256i *) (p), _mm512_cvtsepi32_epi16(i))
+#define VDSUBF(p, o) \
+    _mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512( \
+        _mm512_cvtpd_ps(_mm512_sub_pd(_mm512_loadu_pd(p), _mm512_loadu_pd(o))))), \
+        _mm256_castps_pd(_mm512_cvtpd_ps( \
+            _mm512_sub_pd(_mm512_loadu_pd((p) + 8), _mm512_loadu_pd((o) + 8)))), 1))
+
+#include "vecsimd.inl"
+
+#undef ML_SIMD_KERNEL
+#undef ML_SIMD_LEVEL
+#undef VF
+#undef VW
+#undef VLOADU
+#undef VSTOREU
+#undef VADD
+#undef VSUB
+#undef VMUL
+#undef VDIV
+#undef VSQRT
+#undef VSET1
+#undef VSHUF
+#undef VUNPLO
+#undef VUNPHI
+#undef VLOADLANES
+#undef VSTORELANES
+#undef VLOADLANEPTRS
+#undef VRECIP_NONZERO
+#undef VMIN
+#undef VMAX
+#undef VAND
+#undef VANDNOT
+#undef VXOR
+#undef VROUND
+#undef VMASK
+#undef VCMPEQ
+#undef VCMPGT
+#undef VSIGNMASK
+#undef VBLEND
+#undef VMASKBITS
+#undef VI
+#undef VCVTI
+#undef VIBIT1SIGN
+#undef VIODD
+#undef VCVTIF
+#undef VILOADU
+#undef VISTOREU
+#undef VISET1
+#undef VIAND
+#undef VIOR
+#undef VISLLI
+#undef VISRLI
+#undef VIGATHER
+#undef VILOADS16
+#undef VISTORES16
+#undef VDSUBF
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Processor detection.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+// Determine the widest instruction set supported by both the processor
+// and the operating system.
+
+static MlSimdLevel hostSimdLevel()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    if (maxLeaf < 1)
+        return ML_SIMD_NONE;
+
+    __cpuid(info, 1);
+    if (! (info[2] & (1 << 19)))            // SSE4.1
+        return ML_SIMD_NONE;
+    if (! (info[2] & (1 << 27)) || ! (info[2] & (1 << 28)) || maxLeaf < 7)
+        return ML_SIMD_SSE4_1;              // No OSXSAVE or no AVX
+
+    unsigned long long xcr0 = _xgetbv(0);
+    if ((xcr0 & 0x6) != 0x6)                // XMM and YMM state
+        return ML_SIMD_SSE4_1;
+
+    __cpuidex(info, 7, 0);
+    if (! (info[1] & (1 << 5)))             // AVX2
+        return ML_SIMD_SSE4_1;
+    if ((info[1] & (1 << 16)) && ((xcr0 & 0xe6) == 0xe6))
+        return ML_SIMD_AVX512;              // AVX-512F and ZMM state
+    return ML_SIMD_AVX2;
+#else
+    // The GNU builtins check operating system support as well.
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return ML_SIMD_AVX512;
+    if (__builtin_cpu_supports("avx2"))
+        return ML_SIMD_AVX2;
+    if (__builtin_cpu_supports("sse4.1"))
+        return ML_SIMD_SSE4_1;
+    return ML_SIMD_NONE;
+#endif
+}
+
+
+static const MlVectorKernels *selectKernels()
+{
+    MlSimdLevel level = hostSimdLevel();
+
+    // Allow the selection to be limited, for testing and for working
+    // around processors that down-clock on wide instructions.
+    const char *limit = getenv("MLMATH_SIMD");
+    if (limit != NULL)
+    {
+        MlSimdLevel max = level;
+        if (strcmp(limit, "none") == 0)
+            max = ML_SIMD_NONE;
+        else if (strcmp(limit, "sse4.1") == 0)
+            max = ML_SIMD_SSE4_1;
+        else if (strcmp(limit, "avx2") == 0)
+            max = ML_SIMD_AVX2;
+        if (max < level)
+            level = max;
+    }
+
+    switch (level)
+    {
+        case ML_SIMD_AVX512:
+            return &kernelsAvx512;
+        case ML_SIMD_AVX2:
+            return &kernelsAvx2;
+        case ML_SIMD_SSE4_1:
+            return &kernelsSse41;
+        default:
+            return NULL;
+    }
+}
+
+
+const MlVectorKernels *mlVectorKernels()
+{
+    static const MlVectorKernels *kernels = selectKernels();
+    return kernels;
+}
+
+#endif /* ML_VECTOR_SIMD */
@@ -0,0 +1,202 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+#ifndef VECSIMD_H_INCLUDED
+#define VECSIMD_H_INCLUDED
+
+// Internal to the Magic Lantern math library; this header is not installed.
+//
+// The batch vector operations in vector.cxx and the batch trigonometric
+// functions in trigbatch.cxx are backed by a table of SIMD kernels that is
+// selected at run time from the instruction sets supported by the host
+// processor (SSE4.1, AVX2 or AVX-512). The kernels operate on the raw float
+// storage of MlScalar, MlVector3 and MlVector4 arrays, so they are only
+// available in the floating-point, non-debug version of the library on
+// x86 processors.
+
+// Include Magic Lantern math header files.
+#include "math/scalar.h"
+
+#if ! ML_FIXED_POINT && ! ML_MATH_DEBUG && \
+    (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+#define ML_VECTOR_SIMD 1
+#else
+#define ML_VECTOR_SIMD 0
+#endif
+
+#if ML_VECTOR_SIMD
+
+// SIMD instruction set levels, in increasing order of preference.
+typedef enum
+{
+    ML_SIMD_NONE = 0,
+    ML_SIMD_SSE4_1,
+    ML_SIMD_AVX2,
+    ML_SIMD_AVX512
+} MlSimdLevel;
+
+// The kernel table. Element-wise kernels take the number of floats, n;
+// the others take the number of vectors, count. Source and destination
+// arrays may be the same.
+typedef struct
+{
+    MlSimdLevel level;
+
+    // r = a + b, r = a - b and r = a * d over n floats.
+    void (*add)(const float *a, const float *b, float *r, int n);
+    void (*subtract)(const float *a, const float *b, float *r, int n);
+    void (*scale)(const float *a, float d, float *r, int n);
+
+    // Operations on arrays of 3 element vectors.
+    void (*dot3)(const float *a, const float *b, float *r, int count);
+    void (*cross3)(const float *a, const float *b, float *r, int count);
+    void (*length3)(const float *v, float *r, int count);
+    void (*normalize3)(float *v, float *len, int count);
+
+    // Operations on arrays of 4 element vectors.
+    void (*dot4)(const float *a, const float *b, float *r, int count);
+    void (*length4)(const float *v, float *r, int count);
+    void (*normalize4)(float *v, float *len, int count);
+
+    // Trigonometric functions over n floats, with angles in turns. The
+    // sinCos coefficients are the 4 sine and 5 cosine polynomial
+    // coefficients of an accuracy tier, see trigbatch.cxx.
+    void (*sinCos)(const float *t, float *s, float *c, int n, const float *coeffs);
+    void (*atan2)(const float *y, const float *x, float *r, int n);
+    void (*asin)(const float *v, float *r, int n);
+    void (*acos)(const float *v, float *r, int n);
+
+    // Interpolation of arrays of quaternions, with one control per pair.
+    // The slerp coefficients are the terms pairs of the slerp polynomial,
+    // see rotation.cxx.
+    void (*slerp)(const float *q0, const float *q1, const float *t, float *r,
+                  int count, const float *coeffs, int terms);
+    void (*nlerp)(const float *q0, const float *q1, const float *t, float *r,
+                  int count);
+
+    // Linear blend skinning of arrays of 3 element positions and normals
+    // by a palette of 4x3 matrices, 12 floats each. Each vertex has an
+    // influence of 4 weights followed by 4 int bone indices. The normals
+    // are normalized, and are skipped if n is NULL.
+    void (*skin)(const float *palette, const float *inf, const float *p,
+                 const float *n, float *rp, float *rn, int count);
+
+    // The same with a palette of dual quaternions, 8 floats each, blended
+    // by dual quaternion linear blending. The normals are rotated.
+    void (*skinDual)(const float *palette, const float *inf, const float *p,
+                     const float *n, float *rp, float *rn, int count);
+
+    // Smallest three encoding of arrays of quaternions, in 32 bits or in
+    // 3 16 bit words each, see rotation.cxx.
+    void (*packRot32)(const float *q, unsigned int *r, int count);
+    void (*unpackRot32)(const unsigned int *p, float *q, int count);
+    void (*packRot48)(const float *q, unsigned short *r, int count);
+    void (*unpackRot48)(const unsigned short *p, float *q, int count);
+
+    // Quantization of arrays of vectors of n (2 or 3) elements to shorts,
+    // see vector.cxx. The bounds kernel returns the lowest and highest
+    // value of each element; the others scale each element about its
+    // origin, by the scale on the way in and by the step on the way out.
+    void (*bounds)(const float *v, float *lo, float *hi, int count, int n);
+    void (*quantize)(const float *v, short *q, const float *origin,
+                     const float *scale, int count, int n);
+    void (*dequantize)(const short *q, const float *origin, const float *step,
+                       float *v, int count, int n);
+
+    // Conversion of arrays of n (3 or 12) doubles to floats relative to an
+    // origin of n doubles, which is subtracted before rounding, see
+    // rebase.cxx.
+    void (*rebase)(const double *v, const double *origin, float *r, int count, int n);
+
+    // Products with a 4x4 matrix m of 16 floats, see matrix4.cxx. The mult4
+    // kernel multiplies count rows of 4 floats by m; r may be the same as v
+    // but not m. The project kernel multiplies 3 element points, with a w of 1,
+    // by m and stores 3 element points divided by w if divide is non-zero,
+    // otherwise 4 element vectors.
+    void (*mult4)(const float *m, const float *v, float *r, int count);
+    void (*project)(const float *m, const float *v, float *r, int count, int divide);
+
+    // Products of streams of 3 element row vectors x, y and z with a 4x3
+    // matrix m of 12 floats, see transfrm.cxx. The last row of m is added
+    // only if translate is non-zero. The results may be stored over the
+    // sources.
+    void (*transform3)(const float *m, const float *x, const float *y, const float *z,
+                       float *rx, float *ry, float *rz, int count, int translate);
+
+    // Culling of streams of spheres and of boxes by 6 planes of 4 floats,
+    // see frustum.cxx. Bit (i % 32) of mask word (i / 32) is set if volume
+    // i is not entirely outside one of the planes; unused bits of the last
+    // word are cleared.
+    void (*cullSpheres)(const float *planes, const float *x, const float *y,
+                        const float *z, const float *r, unsigned int *mask, int count);
+    void (*cullBoxes)(const float *planes, const float *minX, const float *minY,
+                      const float *minZ, const float *maxX, const float *maxY,
+                      const float *maxZ, unsigned int *mask, int count);
+
+    // Bounding volumes, see bounds.cxx. A box is 6 floats, its lowest then
+    // its highest corner, and a sphere is 4 floats, its center then its
+    // radius. The transformBoxes kernel bounds each box transformed by a
+    // 4x3 matrix of 12 floats, stepping mstride (0 or 12) floats through m
+    // per box; empty boxes are copied. The mergeBoxes kernel returns the
+    // box bounding those that are not empty, or an empty box of FLT_MAX and
+    // -FLT_MAX corners if there are none. The others test an array of boxes,
+    // spheres or 3 element points against the one volume v, and set mask
+    // bits as the culling kernels do.
+    void (*transformBoxes)(const float *m, int mstride, const float *b, float *r, int count);
+    void (*mergeBoxes)(const float *b, float *r, int count);
+    void (*boxOverlaps)(const float *v, const float *b, unsigned int *mask, int count);
+    void (*boxContains)(const float *v, const float *p, unsigned int *mask, int count);
+    void (*sphereOverlaps)(const float *v, const float *s, unsigned int *mask, int count);
+    void (*sphereContains)(const float *v, const float *p, unsigned int *mask, int count);
+
+    // Ray queries of a bounding volume hierarchy, see bvh.cxx. Each node is
+    // 8 words: its lowest corner, an int offset, its highest corner and an
+    // int count. Each triangle is 9 floats, its first corner and its two
+    // edges from it. The rays are traced in packets of consecutive rays from
+    // 3 element origins o and directions d. On the way in t holds the
+    // greatest distance of each ray; hit gets the index of the triangle hit,
+    // or -1, with its distance in t and its barycentric coordinates in uv,
+    // which may be NULL. If any is non-zero, each ray stops at its first hit.
+    void (*traceRays)(const float *nodes, const float *tris, const float *o,
+                      const float *d, float *t, int *hit, float *uv, int count, int any);
+} MlVectorKernels;
+
+// Returns the kernel table for the host processor, or NULL if the processor
+// does not support at least SSE4.1. The selection is made once, on first
+// use. Setting the environment variable MLMATH_SIMD to "none", "sse4.1" or
+// "avx2" limits the instruction set that will be selected.
+extern const MlVectorKernels *mlVectorKernels();
+
+#endif /* ML_VECTOR_SIMD */
+
+#endif /* VECSIMD_H_INCLUDED */
@@ -0,0 +1,1874 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Kernel bodies for the SIMD vector operations. This file is included once
+// per instruction set by vecsimd.cxx, which defines the following macros
+// beforehand:
+//
+//   ML_SIMD_KERNEL(name)   Name of the kernel for this instruction set.
+//   ML_SIMD_LEVEL          The MlSimdLevel of this instruction set.
+//   VF, VW                 The vector type and the number of floats in it.
+//   VLOADU, VSTOREU        Unaligned load and store of VW floats.
+//   VADD, VSUB, VMUL, VDIV, VSQRT, VSET1
+//                          Arithmetic and broadcast.
+//   VSHUF, VUNPLO, VUNPHI  Shuffles that operate within each 128-bit lane.
+//   VLOADLANES(p, s)       Load 4 floats at p + k*s into 128-bit lane k.
+//   VSTORELANES(p, s, v)   Store 128-bit lane k to p + k*s.
+//   VLOADLANEPTRS(pp)      Load 4 floats at pp[k] into 128-bit lane k.
+//   VRECIP_NONZERO(v)      1/v in each element, or 0 where v is 0.
+//   VMIN, VMAX, VAND, VANDNOT, VXOR, VROUND
+//                          Minimum, maximum, bitwise operations and rounding
+//                          to the nearest integer.
+//   VMASK                  The type of an element mask.
+//   VCMPEQ, VCMPGT         Ordered comparisons, producing a VMASK.
+//   VSIGNMASK(v)           A VMASK of the elements whose sign bit is set.
+//   VBLEND(m, a, b)        b where m is set, otherwise a.
+//   VMASKBITS(m)           The VW elements of a VMASK as the low bits of an int.
+//   VI, VCVTI              The integer vector type, and rounding conversion.
+//   VIBIT1SIGN(i, k)       Bit 1 of i + k moved to the sign bit (bit 30 is
+//                          also set from bit 0, so mask with -0.0f).
+//   VIODD(i)               A VMASK of the elements where i is odd.
+//   VCVTIF(i)              Conversion of integers to floats.
+//   VILOADU, VISTOREU      Unaligned load and store of VW ints.
+//   VISET1, VIAND, VIOR, VISLLI, VISRLI
+//                          Integer broadcast, bitwise operations and
+//                          logical shifts by a constant.
+//   VIGATHER(p, s)         Load the int at p + k*s bytes into element k.
+//   VILOADS16(p)           Load VW shorts, sign extended to ints.
+//   VISTORES16(p, i)       Store VW ints as shorts, with saturation.
+//   VDSUBF(p, o)           The VW doubles at p less those at o, rounded to
+//                          floats.
+//
+// Because all of the shuffles stay within a 128-bit lane, groups of four
+// vectors are deinterleaved independently in each lane, and the result
+// holds the components of VW consecutive vectors in order.
+
+
+static void ML_SIMD_KERNEL(add)(const float *a, const float *b, float *r, int n)
+{
+    int i = 0;
+    for (; i + VW <= n; i += VW)
+        VSTOREU(r + i, VADD(VLOADU(a + i), VLOADU(b + i)));
+    for (; i < n; i++)
+        r[i] = a[i] + b[i];
+}
+
+
+static void ML_SIMD_KERNEL(subtract)(const float *a, const float *b, float *r, int n)
+{
+    int i = 0;
+    for (; i + VW <= n; i += VW)
+        VSTOREU(r + i, VSUB(VLOADU(a + i), VLOADU(b + i)));
+    for (; i < n; i++)
+        r[i] = a[i] - b[i];
+}
+
+
+static void ML_SIMD_KERNEL(scale)(const float *a, float d, float *r, int n)
+{
+    const VF vd = VSET1(d);
+    int i = 0;
+    for (; i + VW <= n; i += VW)
+        VSTOREU(r + i, VMUL(VLOADU(a + i), vd));
+    for (; i < n; i++)
+        r[i] = a[i] * d;
+}
+
+
+// Deinterleave VW consecutive 3 element vectors into x, y and z. The
+// groups of four vectors of the 128-bit lanes are s floats apart, which is
+// 12 unless the vectors are interleaved with others.
+
+static inline void ML_SIMD_KERNEL(load3s)(const float *p, int s, VF &x, VF &y, VF &z)
+{
+    VF a = VLOADLANES(p, s);        // x0 y0 z0 x1
+    VF b = VLOADLANES(p + 4, s);    // y1 z1 x2 y2
+    VF c = VLOADLANES(p + 8, s);    // z2 x3 y3 z3
+
+    VF t0 = VSHUF(b, c, _MM_SHUFFLE(2,1,3,2));   // x2 y2 x3 y3
+    VF t1 = VSHUF(a, b, _MM_SHUFFLE(1,0,2,1));   // y0 z0 y1 z1
+    x = VSHUF(a, t0, _MM_SHUFFLE(2,0,3,0));
+    y = VSHUF(t1, t0, _MM_SHUFFLE(3,1,2,0));
+    z = VSHUF(t1, c, _MM_SHUFFLE(3,0,3,1));
+}
+
+
+static inline void ML_SIMD_KERNEL(load3)(const float *p, VF &x, VF &y, VF &z)
+{
+    ML_SIMD_KERNEL(load3s)(p, 12, x, y, z);
+}
+
+
+// Interleave x, y and z back into VW consecutive 3 element vectors, with
+// the groups of the 128-bit lanes s floats apart.
+
+static inline void ML_SIMD_KERNEL(store3s)(float *p, int s, VF x, VF y, VF z)
+{
+    VF xy0 = VUNPLO(x, y);                       // x0 y0 x1 y1
+    VF xy1 = VUNPHI(x, y);                       // x2 y2 x3 y3
+
+    VF t = VSHUF(z, xy0, _MM_SHUFFLE(2,2,0,0));  // z0 z0 x1 x1
+    VSTORELANES(p, s, VSHUF(xy0, t, _MM_SHUFFLE(2,0,1,0)));
+    t = VSHUF(xy0, z, _MM_SHUFFLE(1,1,3,3));     // y1 y1 z1 z1
+    VSTORELANES(p + 4, s, VSHUF(t, xy1, _MM_SHUFFLE(1,0,2,0)));
+    t = VSHUF(z, xy1, _MM_SHUFFLE(2,2,2,2));     // z2 z2 x3 x3
+    VF u = VSHUF(xy1, z, _MM_SHUFFLE(3,3,3,3));  // y3 y3 z3 z3
+    VSTORELANES(p + 8, s, VSHUF(t, u, _MM_SHUFFLE(2,0,2,0)));
+}
+
+
+static inline void ML_SIMD_KERNEL(store3)(float *p, VF x, VF y, VF z)
+{
+    ML_SIMD_KERNEL(store3s)(p, 12, x, y, z);
+}
+
+
+// Transpose VW consecutive 4 element vectors to or from x, y, z and w.
+// The transpose is its own inverse, so it is used for both directions.
+
+static inline void ML_SIMD_KERNEL(transpose4)(VF &r0, VF &r1, VF &r2, VF &r3)
+{
+    VF t0 = VUNPLO(r0, r1);
+    VF t1 = VUNPLO(r2, r3);
+    VF t2 = VUNPHI(r0, r1);
+    VF t3 = VUNPHI(r2, r3);
+    r0 = VSHUF(t0, t1, _MM_SHUFFLE(1,0,1,0));
+    r1 = VSHUF(t0, t1, _MM_SHUFFLE(3,2,3,2));
+    r2 = VSHUF(t2, t3, _MM_SHUFFLE(1,0,1,0));
+    r3 = VSHUF(t2, t3, _MM_SHUFFLE(3,2,3,2));
+}
+
+
+static inline void ML_SIMD_KERNEL(load4)(const float *p, VF &x, VF &y, VF &z, VF &w)
+{
+    x = VLOADLANES(p, 16);
+    y = VLOADLANES(p + 4, 16);
+    z = VLOADLANES(p + 8, 16);
+    w = VLOADLANES(p + 12, 16);
+    ML_SIMD_KERNEL(transpose4)(x, y, z, w);
+}
+
+
+static inline void ML_SIMD_KERNEL(store4)(float *p, VF x, VF y, VF z, VF w)
+{
+    ML_SIMD_KERNEL(transpose4)(x, y, z, w);
+    VSTORELANES(p, 16, x);
+    VSTORELANES(p + 4, 16, y);
+    VSTORELANES(p + 8, 16, z);
+    VSTORELANES(p + 12, 16, w);
+}
+
+
+static void ML_SIMD_KERNEL(dot3)(const float *a, const float *b, float *r, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        VF ax, ay, az, bx, by, bz;
+        ML_SIMD_KERNEL(load3)(a + 3*i, ax, ay, az);
+        ML_SIMD_KERNEL(load3)(b + 3*i, bx, by, bz);
+        VSTOREU(r + i, VADD(VADD(VMUL(ax, bx), VMUL(ay, by)), VMUL(az, bz)));
+    }
+    for (; i < count; i++)
+    {
+        const float *u = a + 3*i, *v = b + 3*i;
+        r[i] = u[0]*v[0] + u[1]*v[1] + u[2]*v[2];
+    }
+}
+
+
+static void ML_SIMD_KERNEL(cross3)(const float *a, const float *b, float *r, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        VF ax, ay, az, bx, by, bz;
+        ML_SIMD_KERNEL(load3)(a + 3*i, ax, ay, az);
+        ML_SIMD_KERNEL(load3)(b + 3*i, bx, by, bz);
+        ML_SIMD_KERNEL(store3)(r + 3*i,
+                               VSUB(VMUL(ay, bz), VMUL(az, by)),
+                               VSUB(VMUL(az, bx), VMUL(ax, bz)),
+                               VSUB(VMUL(ax, by), VMUL(ay, bx)));
+    }
+    for (; i < count; i++)
+    {
+        const float *u = a + 3*i, *v = b + 3*i;
+        float x = u[1]*v[2] - u[2]*v[1];
+        float y = u[2]*v[0] - u[0]*v[2];
+        float z = u[0]*v[1] - u[1]*v[0];
+        r[3*i] = x; r[3*i + 1] = y; r[3*i + 2] = z;
+    }
+}
+
+
+static void ML_SIMD_KERNEL(length3)(const float *v, float *r, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        VF x, y, z;
+        ML_SIMD_KERNEL(load3)(v + 3*i, x, y, z);
+        VSTOREU(r + i, VSQRT(VADD(VADD(VMUL(x, x), VMUL(y, y)), VMUL(z, z))));
+    }
+    for (; i < count; i++)
+    {
+        const float *u = v + 3*i;
+        r[i] = sqrtf(u[0]*u[0] + u[1]*u[1] + u[2]*u[2]);
+    }
+}
+
+
+static void ML_SIMD_KERNEL(normalize3)(float *v, float *len, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        VF x, y, z;
+        ML_SIMD_KERNEL(load3)(v + 3*i, x, y, z);
+        VF l = VSQRT(VADD(VADD(VMUL(x, x), VMUL(y, y)), VMUL(z, z)));
+        VF s = VRECIP_NONZERO(l);
+        ML_SIMD_KERNEL(store3)(v + 3*i, VMUL(x, s), VMUL(y, s), VMUL(z, s));
+        if (len)
+            VSTOREU(len + i, l);
+    }
+    for (; i < count; i++)
+    {
+        float *u = v + 3*i;
+        float l = sqrtf(u[0]*u[0] + u[1]*u[1] + u[2]*u[2]);
+        float s = (l != 0.0f) ? 1.0f / l : 0.0f;
+        u[0] *= s; u[1] *= s; u[2] *= s;
+        if (len)
+            len[i] = l;
+    }
+}
+
+
+static void ML_SIMD_KERNEL(dot4)(const float *a, const float *b, float *r, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        VF ax, ay, az, aw, bx, by, bz, bw;
+        ML_SIMD_KERNEL(load4)(a + 4*i, ax, ay, az, aw);
+        ML_SIMD_KERNEL(load4)(b + 4*i, bx, by, bz, bw);
+        VSTOREU(r + i, VADD(VADD(VADD(VMUL(ax, bx), VMUL(ay, by)), VMUL(az, bz)), VMUL(aw, bw)));
+    }
+    for (; i < count; i++)
+    {
+        const float *u = a + 4*i, *v = b + 4*i;
+        r[i] = u[0]*v[0] + u[1]*v[1] + u[2]*v[2] + u[3]*v[3];
+    }
+}
+
+
+static void ML_SIMD_KERNEL(length4)(const float *v, float *r, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        VF x, y, z, w;
+        ML_SIMD_KERNEL(load4)(v + 4*i, x, y, z, w);
+        VSTOREU(r + i, VSQRT(VADD(VADD(VADD(VMUL(x, x), VMUL(y, y)), VMUL(z, z)), VMUL(w, w))));
+    }
+    for (; i < count; i++)
+    {
+        const float *u = v + 4*i;
+        r[i] = sqrtf(u[0]*u[0] + u[1]*u[1] + u[2]*u[2] + u[3]*u[3]);
+    }
+}
+
+
+static void ML_SIMD_KERNEL(normalize4)(float *v, float *len, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        VF x, y, z, w;
+        ML_SIMD_KERNEL(load4)(v + 4*i, x, y, z, w);
+        VF l = VSQRT(VADD(VADD(VADD(VMUL(x, x), VMUL(y, y)), VMUL(z, z)), VMUL(w, w)));
+        VF s = VRECIP_NONZERO(l);
+        ML_SIMD_KERNEL(store4)(v + 4*i, VMUL(x, s), VMUL(y, s), VMUL(z, s), VMUL(w, s));
+        if (len)
+            VSTOREU(len + i, l);
+    }
+    for (; i < count; i++)
+    {
+        float *u = v + 4*i;
+        float l = sqrtf(u[0]*u[0] + u[1]*u[1] + u[2]*u[2] + u[3]*u[3]);
+        float s = (l != 0.0f) ? 1.0f / l : 0.0f;
+        u[0] *= s; u[1] *= s; u[2] *= s; u[3] *= s;
+        if (len)
+            len[i] = l;
+    }
+}
+
+
+// Sine and cosine of VW angles in turns, reduced to the nearest quarter turn
+// as in mlFloatSinCos(). The coefficients are those of sin(2*pi*r)/r and
+// cos(2*pi*r) in r*r, lowest order first.
+
+static inline void ML_SIMD_KERNEL(sinCosBlock)(const float *t, float *s, float *c, const float *k)
+{
+    const VF sign = VSET1(-0.0f);
+    VF x = VLOADU(t);
+    VF q = VROUND(VMUL(x, VSET1(4.0f)));
+    VF r = VSUB(x, VMUL(q, VSET1(0.25f)));
+    VI n = VCVTI(q);
+
+    VF u = VMUL(r, r);
+    VF sr = VMUL(r, VADD(VSET1(k[0]), VMUL(u, VADD(VSET1(k[1]),
+                VMUL(u, VADD(VSET1(k[2]), VMUL(u, VSET1(k[3]))))))));
+    VF cr = VADD(VSET1(k[4]), VMUL(u, VADD(VSET1(k[5]), VMUL(u, VADD(VSET1(k[6]),
+                VMUL(u, VADD(VSET1(k[7]), VMUL(u, VSET1(k[8])))))))));
+
+    // Swap the results in odd quadrants, then negate the sine in quadrants
+    // 2 and 3 and the cosine in quadrants 1 and 2.
+    VMASK odd = VIODD(n);
+    VSTOREU(s, VXOR(VBLEND(odd, sr, cr), VAND(VIBIT1SIGN(n, 0), sign)));
+    VSTOREU(c, VXOR(VBLEND(odd, cr, sr), VAND(VIBIT1SIGN(n, 1), sign)));
+}
+
+
+// Arc tangent of VW pairs, in turns. The ratio of the smaller to the larger
+// magnitude is reduced below tan(pi/8), and the octant is restored from the
+// magnitudes and signs of the arguments.
+
+static inline void ML_SIMD_KERNEL(atan2Block)(const float *py, const float *px, float *r)
+{
+    const VF sign = VSET1(-0.0f);
+    const VF zero = VSET1(0.0f);
+    const VF one = VSET1(1.0f);
+    VF y = VLOADU(py);
+    VF x = VLOADU(px);
+    VF ay = VANDNOT(sign, y);
+    VF ax = VANDNOT(sign, x);
+    VF mx = VMAX(ax, ay);
+    VF mn = VMIN(ax, ay);
+
+    // The ratio is 1 when the magnitudes are equal, including two
+    // infinities, and 0 when both are zero.
+    VF a = VBLEND(VCMPEQ(mn, mx), VDIV(mn, mx), one);
+    a = VBLEND(VCMPEQ(mx, zero), a, zero);
+
+    VMASK big = VCMPGT(a, VSET1(0.414213562f));
+    a = VBLEND(big, a, VDIV(VSUB(a, one), VADD(a, one)));
+    VF u = VMUL(a, a);
+    VF p = VADD(VBLEND(big, zero, VSET1(0.125f)),
+                VMUL(a, VADD(VSET1(0.159154943f), VMUL(u, VADD(VSET1(-0.0530508113f),
+                    VMUL(u, VADD(VSET1(0.0317907578f), VMUL(u, VADD(VSET1(-0.0220500178f),
+                    VMUL(u, VSET1(0.0127221579f)))))))))));
+
+    p = VBLEND(VCMPGT(ay, ax), p, VSUB(VSET1(0.25f), p));
+    p = VBLEND(VSIGNMASK(x), p, VSUB(VSET1(0.5f), p));
+    p = VXOR(p, VAND(y, sign));
+
+    // The minimum and maximum above drop NaNs, so propagate them here.
+    VF nan = VADD(x, y);
+    VSTOREU(r, VBLEND(VCMPEQ(nan, nan), nan, p));
+}
+
+
+// Arc sine of VW values, in turns, as a magnitude and the argument's sign.
+// Above 1/2, asin(x) = pi/2 - 2*asin(sqrt((1 - x)/2)); big is set there and
+// p holds the arc sine of the reduced argument.
+
+static inline VF ML_SIMD_KERNEL(asinReduced)(VF ax, VMASK &big)
+{
+    const VF half = VSET1(0.5f);
+    big = VCMPGT(ax, half);
+    VF z = VBLEND(big, VMUL(ax, ax), VMUL(VSUB(VSET1(1.0f), ax), half));
+    VF v = VBLEND(big, ax, VSQRT(z));
+    return VMUL(v, VADD(VSET1(0.159154942f), VMUL(z, VADD(VSET1(0.0265260241f),
+               VMUL(z, VADD(VSET1(0.0119276391f), VMUL(z, VADD(VSET1(0.00725094985f),
+               VMUL(z, VADD(VSET1(0.00379058615f), VMUL(z, VSET1(0.00679633533f))))))))))));
+}
+
+
+static inline void ML_SIMD_KERNEL(asinBlock)(const float *pv, float *r)
+{
+    const VF sign = VSET1(-0.0f);
+    VF x = VLOADU(pv);
+    VMASK big;
+    VF p = ML_SIMD_KERNEL(asinReduced)(VANDNOT(sign, x), big);
+    p = VBLEND(big, p, VSUB(VSET1(0.25f), VADD(p, p)));
+    VSTOREU(r, VXOR(p, VAND(x, sign)));
+}
+
+
+static inline void ML_SIMD_KERNEL(acosBlock)(const float *pv, float *r)
+{
+    const VF sign = VSET1(-0.0f);
+    VF x = VLOADU(pv);
+    VMASK big;
+    VF p = ML_SIMD_KERNEL(asinReduced)(VANDNOT(sign, x), big);
+
+    // acos(x) = pi/2 - asin(x) near zero, 2*asin(sqrt((1 - x)/2)) near one
+    // and pi - 2*asin(sqrt((1 + x)/2)) near minus one.
+    VF p2 = VADD(p, p);
+    VF mid = VSUB(VSET1(0.25f), VXOR(p, VAND(x, sign)));
+    VF edge = VBLEND(VSIGNMASK(x), p2, VSUB(VSET1(0.5f), p2));
+    VSTOREU(r, VBLEND(big, mid, edge));
+}
+
+
+// The array versions. A remainder of fewer than VW elements is run through
+// a zero padded block, so every element gets the same result whatever its
+// position in the array.
+
+static void ML_SIMD_KERNEL(sinCos)(const float *t, float *s, float *c, int n, const float *coeffs)
+{
+    int i = 0;
+    for (; i + VW <= n; i += VW)
+        ML_SIMD_KERNEL(sinCosBlock)(t + i, s + i, c + i, coeffs);
+    if (i < n)
+    {
+        float tb[VW], sb[VW], cb[VW];
+        int m = n - i;
+        for (int j = 0; j < VW; j++)
+            tb[j] = (j < m) ? t[i + j] : 0.0f;
+        ML_SIMD_KERNEL(sinCosBlock)(tb, sb, cb, coeffs);
+        for (int j = 0; j < m; j++)
+        {
+            s[i + j] = sb[j];
+            c[i + j] = cb[j];
+        }
+    }
+}
+
+
+static void ML_SIMD_KERNEL(atan2)(const float *y, const float *x, float *r, int n)
+{
+    int i = 0;
+    for (; i + VW <= n; i += VW)
+        ML_SIMD_KERNEL(atan2Block)(y + i, x + i, r + i);
+    if (i < n)
+    {
+        float yb[VW], xb[VW], rb[VW];
+        int m = n - i;
+        for (int j = 0; j < VW; j++)
+        {
+            yb[j] = (j < m) ? y[i + j] : 0.0f;
+            xb[j] = (j < m) ? x[i + j] : 0.0f;
+        }
+        ML_SIMD_KERNEL(atan2Block)(yb, xb, rb);
+        for (int j = 0; j < m; j++)
+            r[i + j] = rb[j];
+    }
+}
+
+
+static void ML_SIMD_KERNEL(asin)(const float *v, float *r, int n)
+{
+    int i = 0;
+    for (; i + VW <= n; i += VW)
+        ML_SIMD_KERNEL(asinBlock)(v + i, r + i);
+    if (i < n)
+    {
+        float vb[VW], rb[VW];
+        int m = n - i;
+        for (int j = 0; j < VW; j++)
+            vb[j] = (j < m) ? v[i + j] : 0.0f;
+        ML_SIMD_KERNEL(asinBlock)(vb, rb);
+        for (int j = 0; j < m; j++)
+            r[i + j] = rb[j];
+    }
+}
+
+
+static void ML_SIMD_KERNEL(acos)(const float *v, float *r, int n)
+{
+    int i = 0;
+    for (; i + VW <= n; i += VW)
+        ML_SIMD_KERNEL(acosBlock)(v + i, r + i);
+    if (i < n)
+    {
+        float vb[VW], rb[VW];
+        int m = n - i;
+        for (int j = 0; j < VW; j++)
+            vb[j] = (j < m) ? v[i + j] : 0.0f;
+        ML_SIMD_KERNEL(acosBlock)(vb, rb);
+        for (int j = 0; j < m; j++)
+            r[i + j] = rb[j];
+    }
+}
+
+
+// Interpolation of VW quaternion pairs. The controls are applied to the
+// shorter path: the weight of q1 takes the sign of the dot product, and the
+// slerp polynomial is evaluated at its magnitude.
+
+static inline void ML_SIMD_KERNEL(slerpBlock)(const float *q0, const float *q1,
+    const float *pt, float *r, const float *k, int terms)
+{
+    const VF sign = VSET1(-0.0f);
+    const VF one = VSET1(1.0f);
+    VF x0, y0, z0, w0, x1, y1, z1, w1;
+    ML_SIMD_KERNEL(load4)(q0, x0, y0, z0, w0);
+    ML_SIMD_KERNEL(load4)(q1, x1, y1, z1, w1);
+    VF t = VLOADU(pt);
+    VF d = VSUB(one, t);
+
+    VF c = VADD(VADD(VADD(VMUL(x0, x1), VMUL(y0, y1)), VMUL(z0, z1)), VMUL(w0, w1));
+    VF s = VAND(c, sign);
+    VF xm1 = VSUB(VANDNOT(sign, c), one);
+
+    VF tt = VMUL(t, t);
+    VF dd = VMUL(d, d);
+    const float *kp = k + 2 * (terms - 1);
+    VF ft = VADD(one, VMUL(VSUB(VMUL(VSET1(kp[0]), tt), VSET1(kp[1])), xm1));
+    VF fd = VADD(one, VMUL(VSUB(VMUL(VSET1(kp[0]), dd), VSET1(kp[1])), xm1));
+    while (kp != k)
+    {
+        kp -= 2;
+        VF u = VSET1(kp[0]);
+        VF v = VSET1(kp[1]);
+        ft = VADD(one, VMUL(VMUL(VSUB(VMUL(u, tt), v), xm1), ft));
+        fd = VADD(one, VMUL(VMUL(VSUB(VMUL(u, dd), v), xm1), fd));
+    }
+    VF f0 = VMUL(d, fd);
+    VF f1 = VXOR(VMUL(t, ft), s);
+
+    ML_SIMD_KERNEL(store4)(r, VADD(VMUL(f0, x0), VMUL(f1, x1)),
+        VADD(VMUL(f0, y0), VMUL(f1, y1)), VADD(VMUL(f0, z0), VMUL(f1, z1)),
+        VADD(VMUL(f0, w0), VMUL(f1, w1)));
+}
+
+
+static inline void ML_SIMD_KERNEL(nlerpBlock)(const float *q0, const float *q1,
+    const float *pt, float *r)
+{
+    const VF sign = VSET1(-0.0f);
+    VF x0, y0, z0, w0, x1, y1, z1, w1;
+    ML_SIMD_KERNEL(load4)(q0, x0, y0, z0, w0);
+    ML_SIMD_KERNEL(load4)(q1, x1, y1, z1, w1);
+    VF t = VLOADU(pt);
+
+    VF c = VADD(VADD(VADD(VMUL(x0, x1), VMUL(y0, y1)), VMUL(z0, z1)), VMUL(w0, w1));
+    VF f0 = VSUB(VSET1(1.0f), t);
+    VF f1 = VXOR(t, VAND(c, sign));
+    VF x = VADD(VMUL(f0, x0), VMUL(f1, x1));
+    VF y = VADD(VMUL(f0, y0), VMUL(f1, y1));
+    VF z = VADD(VMUL(f0, z0), VMUL(f1, z1));
+    VF w = VADD(VMUL(f0, w0), VMUL(f1, w1));
+
+    VF l = VSQRT(VADD(VADD(VADD(VMUL(x, x), VMUL(y, y)), VMUL(z, z)), VMUL(w, w)));
+    VF n = VRECIP_NONZERO(l);
+    ML_SIMD_KERNEL(store4)(r, VMUL(x, n), VMUL(y, n), VMUL(z, n), VMUL(w, n));
+}
+
+
+static void ML_SIMD_KERNEL(slerp)(const float *q0, const float *q1, const float *t,
+    float *r, int count, const float *coeffs, int terms)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+        ML_SIMD_KERNEL(slerpBlock)(q0 + 4*i, q1 + 4*i, t + i, r + 4*i, coeffs, terms);
+    if (i < count)
+    {
+        float q0b[4*VW], q1b[4*VW], tb[VW], rb[4*VW];
+        int m = count - i;
+        for (int j = 0; j < 4*VW; j++)
+        {
+            q0b[j] = (j < 4*m) ? q0[4*i + j] : 0.0f;
+            q1b[j] = (j < 4*m) ? q1[4*i + j] : 0.0f;
+        }
+        for (int j = 0; j < VW; j++)
+            tb[j] = (j < m) ? t[i + j] : 0.0f;
+        ML_SIMD_KERNEL(slerpBlock)(q0b, q1b, tb, rb, coeffs, terms);
+        for (int j = 0; j < 4*m; j++)
+            r[4*i + j] = rb[j];
+    }
+}
+
+
+static void ML_SIMD_KERNEL(nlerp)(const float *q0, const float *q1, const float *t,
+    float *r, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+        ML_SIMD_KERNEL(nlerpBlock)(q0 + 4*i, q1 + 4*i, t + i, r + 4*i);
+    if (i < count)
+    {
+        float q0b[4*VW], q1b[4*VW], tb[VW], rb[4*VW];
+        int m = count - i;
+        for (int j = 0; j < 4*VW; j++)
+        {
+            q0b[j] = (j < 4*m) ? q0[4*i + j] : 0.0f;
+            q1b[j] = (j < 4*m) ? q1[4*i + j] : 0.0f;
+        }
+        for (int j = 0; j < VW; j++)
+            tb[j] = (j < m) ? t[i + j] : 0.0f;
+        ML_SIMD_KERNEL(nlerpBlock)(q0b, q1b, tb, rb);
+        for (int j = 0; j < 4*m; j++)
+            r[4*i + j] = rb[j];
+    }
+}
+
+
+// Linear blend skinning of VW vertices. Each influence is 4 weights and
+// 4 bone indices, 8 words in all. The bone matrices are gathered 4 floats
+// at a time, one vertex to a 128-bit lane, and transposed so that each
+// vector holds one element of the matrices of 4 consecutive vertices.
+
+static inline void ML_SIMD_KERNEL(skinBlock)(const float *palette, const float *inf,
+    const float *p, const float *n, float *rp, float *rn)
+{
+    const int *bone = (const int *) (inf + 4);
+    VF w[4], m[12];
+    int i, j, k, l;
+
+    w[0] = VLOADLANES(inf, 32);
+    w[1] = VLOADLANES(inf + 8, 32);
+    w[2] = VLOADLANES(inf + 16, 32);
+    w[3] = VLOADLANES(inf + 24, 32);
+    ML_SIMD_KERNEL(transpose4)(w[0], w[1], w[2], w[3]);
+
+    for (i = 0; i < 12; i++)
+        m[i] = VSET1(0.0f);
+    for (k = 0; k < 4; k++)
+    {
+        for (i = 0; i < 12; i += 4)
+        {
+            VF e[4];
+            for (j = 0; j < 4; j++)
+            {
+                const float *pp[VW / 4];
+                for (l = 0; l < VW / 4; l++)
+                    pp[l] = palette + 12 * bone[8 * (4*l + j) + k] + i;
+                e[j] = VLOADLANEPTRS(pp);
+            }
+            ML_SIMD_KERNEL(transpose4)(e[0], e[1], e[2], e[3]);
+            for (j = 0; j < 4; j++)
+                m[i + j] = VADD(m[i + j], VMUL(w[k], e[j]));
+        }
+    }
+
+    // The rows of the blended matrix are m[0..2], m[3..5], m[6..8] and,
+    // for the translation, m[9..11].
+    VF x, y, z;
+    ML_SIMD_KERNEL(load3)(p, x, y, z);
+    ML_SIMD_KERNEL(store3)(rp,
+        VADD(VADD(VADD(VMUL(x, m[0]), VMUL(y, m[3])), VMUL(z, m[6])), m[9]),
+        VADD(VADD(VADD(VMUL(x, m[1]), VMUL(y, m[4])), VMUL(z, m[7])), m[10]),
+        VADD(VADD(VADD(VMUL(x, m[2]), VMUL(y, m[5])), VMUL(z, m[8])), m[11]));
+
+    if (n != NULL)
+    {
+        ML_SIMD_KERNEL(load3)(n, x, y, z);
+        VF nx = VADD(VADD(VMUL(x, m[0]), VMUL(y, m[3])), VMUL(z, m[6]));
+        VF ny = VADD(VADD(VMUL(x, m[1]), VMUL(y, m[4])), VMUL(z, m[7]));
+        VF nz = VADD(VADD(VMUL(x, m[2]), VMUL(y, m[5])), VMUL(z, m[8]));
+        VF s = VRECIP_NONZERO(VSQRT(VADD(VADD(VMUL(nx, nx), VMUL(ny, ny)), VMUL(nz, nz))));
+        ML_SIMD_KERNEL(store3)(rn, VMUL(nx, s), VMUL(ny, s), VMUL(nz, s));
+    }
+}
+
+
+// Dual quaternion blend skinning of VW vertices. The real and dual parts of
+// the bones are gathered as in skinBlock(); each bone after the first is
+// weighted with the sign that brings it into the hemisphere of the first.
+
+static inline void ML_SIMD_KERNEL(skinDualBlock)(const float *palette, const float *inf,
+    const float *p, const float *n, float *rp, float *rn)
+{
+    const VF sign = VSET1(-0.0f);
+    const int *bone = (const int *) (inf + 4);
+    VF w[4], q[8], first[4];
+    int i, j, k, l;
+
+    w[0] = VLOADLANES(inf, 32);
+    w[1] = VLOADLANES(inf + 8, 32);
+    w[2] = VLOADLANES(inf + 16, 32);
+    w[3] = VLOADLANES(inf + 24, 32);
+    ML_SIMD_KERNEL(transpose4)(w[0], w[1], w[2], w[3]);
+
+    for (i = 0; i < 8; i++)
+        q[i] = VSET1(0.0f);
+    for (k = 0; k < 4; k++)
+    {
+        VF e[8];
+        for (i = 0; i < 8; i += 4)
+        {
+            for (j = 0; j < 4; j++)
+            {
+                const float *pp[VW / 4];
+                for (l = 0; l < VW / 4; l++)
+                    pp[l] = palette + 8 * bone[8 * (4*l + j) + k] + i;
+                e[i + j] = VLOADLANEPTRS(pp);
+            }
+            ML_SIMD_KERNEL(transpose4)(e[i], e[i + 1], e[i + 2], e[i + 3]);
+        }
+
+        VF wk = w[k];
+        if (k == 0)
+        {
+            for (j = 0; j < 4; j++)
+                first[j] = e[j];
+        }
+        else
+        {
+            VF c = VADD(VADD(VADD(VMUL(e[0], first[0]), VMUL(e[1], first[1])),
+                VMUL(e[2], first[2])), VMUL(e[3], first[3]));
+            wk = VXOR(wk, VAND(c, sign));
+        }
+        for (i = 0; i < 8; i++)
+            q[i] = VADD(q[i], VMUL(wk, e[i]));
+    }
+
+    // Normalize by the length of the real part. The translation does not
+    // depend on the component of the dual part along the real part, so
+    // that need not be removed.
+    VF s = VRECIP_NONZERO(VSQRT(VADD(VADD(VADD(VMUL(q[0], q[0]), VMUL(q[1], q[1])),
+        VMUL(q[2], q[2])), VMUL(q[3], q[3]))));
+    for (i = 0; i < 8; i++)
+        q[i] = VMUL(q[i], s);
+
+    // The translation 2 (w d - dw r + r x d), with r and w the vector and
+    // scalar parts of the real part, and d and dw those of the dual part.
+    VF two = VSET1(2.0f);
+    VF tx = VMUL(two, VADD(VSUB(VMUL(q[3], q[4]), VMUL(q[7], q[0])),
+        VSUB(VMUL(q[1], q[6]), VMUL(q[2], q[5]))));
+    VF ty = VMUL(two, VADD(VSUB(VMUL(q[3], q[5]), VMUL(q[7], q[1])),
+        VSUB(VMUL(q[2], q[4]), VMUL(q[0], q[6]))));
+    VF tz = VMUL(two, VADD(VSUB(VMUL(q[3], q[6]), VMUL(q[7], q[2])),
+        VSUB(VMUL(q[0], q[5]), VMUL(q[1], q[4]))));
+
+    // Rotate as v + 2 r x (r x v + w v).
+    VF x, y, z;
+    ML_SIMD_KERNEL(load3)(p, x, y, z);
+    VF cx = VADD(VSUB(VMUL(q[1], z), VMUL(q[2], y)), VMUL(q[3], x));
+    VF cy = VADD(VSUB(VMUL(q[2], x), VMUL(q[0], z)), VMUL(q[3], y));
+    VF cz = VADD(VSUB(VMUL(q[0], y), VMUL(q[1], x)), VMUL(q[3], z));
+    ML_SIMD_KERNEL(store3)(rp,
+        VADD(VADD(x, VMUL(two, VSUB(VMUL(q[1], cz), VMUL(q[2], cy)))), tx),
+        VADD(VADD(y, VMUL(two, VSUB(VMUL(q[2], cx), VMUL(q[0], cz)))), ty),
+        VADD(VADD(z, VMUL(two, VSUB(VMUL(q[0], cy), VMUL(q[1], cx)))), tz));
+
+    if (n != NULL)
+    {
+        ML_SIMD_KERNEL(load3)(n, x, y, z);
+        cx = VADD(VSUB(VMUL(q[1], z), VMUL(q[2], y)), VMUL(q[3], x));
+        cy = VADD(VSUB(VMUL(q[2], x), VMUL(q[0], z)), VMUL(q[3], y));
+        cz = VADD(VSUB(VMUL(q[0], y), VMUL(q[1], x)), VMUL(q[3], z));
+        ML_SIMD_KERNEL(store3)(rn,
+            VADD(x, VMUL(two, VSUB(VMUL(q[1], cz), VMUL(q[2], cy)))),
+            VADD(y, VMUL(two, VSUB(VMUL(q[2], cx), VMUL(q[0], cz)))),
+            VADD(z, VMUL(two, VSUB(VMUL(q[0], cy), VMUL(q[1], cx)))));
+    }
+}
+
+
+// Runs a skinning block over count vertices, padding the last block with
+// vertices that have zero weights on bone 0.
+
+static inline void ML_SIMD_KERNEL(skinArray)(
+    void (*block)(const float *, const float *, const float *, const float *, float *, float *),
+    const float *palette, const float *inf, const float *p, const float *n,
+    float *rp, float *rn, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+        (*block)(palette, inf + 8*i, p + 3*i,
+            (n != NULL) ? n + 3*i : NULL, rp + 3*i, (n != NULL) ? rn + 3*i : NULL);
+    if (i < count)
+    {
+        float infb[8*VW], pb[3*VW], nb[3*VW], rpb[3*VW], rnb[3*VW];
+        int m = count - i;
+        memset(infb, 0, sizeof(infb));
+        memcpy(infb, inf + 8*i, 8*m*sizeof(float));
+        for (int j = 0; j < 3*VW; j++)
+        {
+            pb[j] = (j < 3*m) ? p[3*i + j] : 0.0f;
+            nb[j] = (j < 3*m && n != NULL) ? n[3*i + j] : 0.0f;
+        }
+        (*block)(palette, infb, pb, (n != NULL) ? nb : NULL, rpb, rnb);
+        for (int j = 0; j < 3*m; j++)
+        {
+            rp[3*i + j] = rpb[j];
+            if (n != NULL)
+                rn[3*i + j] = rnb[j];
+        }
+    }
+}
+
+
+static void ML_SIMD_KERNEL(skin)(const float *palette, const float *inf,
+    const float *p, const float *n, float *rp, float *rn, int count)
+{
+    ML_SIMD_KERNEL(skinArray)(ML_SIMD_KERNEL(skinBlock), palette, inf, p, n, rp, rn, count);
+}
+
+
+static void ML_SIMD_KERNEL(skinDual)(const float *palette, const float *inf,
+    const float *p, const float *n, float *rp, float *rn, int count)
+{
+    ML_SIMD_KERNEL(skinArray)(ML_SIMD_KERNEL(skinDualBlock), palette, inf, p, n, rp, rn, count);
+}
+
+
+// Smallest three encoding of VW quaternions, see rotation.cxx. The largest
+// magnitude component is found, with ties going to the first, and the
+// quaternion is negated if that component is negative. The other three are
+// quantized to integers in [0, 2c], with the rounding of the scalar code.
+
+static inline void ML_SIMD_KERNEL(packRotBlock)(const float *q, int c,
+    VI &idx, VI &ua, VI &ub, VI &uc)
+{
+    const VF sign = VSET1(-0.0f);
+    VF x, y, z, w;
+    ML_SIMD_KERNEL(load4)(q, x, y, z, w);
+
+    VF m = VANDNOT(sign, x);
+    VF l = x;
+    VF i = VSET1(0.0f);
+    VF a = VANDNOT(sign, y);
+    VMASK g = VCMPGT(a, m);
+    m = VBLEND(g, m, a);
+    l = VBLEND(g, l, y);
+    i = VBLEND(g, i, VSET1(1.0f));
+    a = VANDNOT(sign, z);
+    g = VCMPGT(a, m);
+    m = VBLEND(g, m, a);
+    l = VBLEND(g, l, z);
+    i = VBLEND(g, i, VSET1(2.0f));
+    a = VANDNOT(sign, w);
+    g = VCMPGT(a, m);
+    l = VBLEND(g, l, w);
+    i = VBLEND(g, i, VSET1(3.0f));
+
+    VF s = VAND(l, sign);
+    x = VXOR(x, s);
+    y = VXOR(y, s);
+    z = VXOR(z, s);
+    w = VXOR(w, s);
+
+    const VF cf = VSET1((float) c);
+    const VF ncf = VSET1((float) -c);
+    const VF k = VSET1((float) c * 1.41421356f);
+    VF v0 = VBLEND(VCMPEQ(i, VSET1(0.0f)), x, y);
+    VF v1 = VBLEND(VCMPGT(VSET1(1.5f), i), y, z);
+    VF v2 = VBLEND(VCMPGT(VSET1(2.5f), i), z, w);
+    ua = VCVTI(VADD(VMIN(VMAX(VMUL(v0, k), ncf), cf), cf));
+    ub = VCVTI(VADD(VMIN(VMAX(VMUL(v1, k), ncf), cf), cf));
+    uc = VCVTI(VADD(VMIN(VMAX(VMUL(v2, k), ncf), cf), cf));
+    idx = VCVTI(i);
+}
+
+
+// Decoding of VW quaternions. The largest component is recomputed from the
+// unit length, and placed at its index among the other three.
+
+static inline void ML_SIMD_KERNEL(unpackRotBlock)(VI idx, VI ua, VI ub, VI uc,
+    int c, float *q)
+{
+    const VF cf = VSET1((float) c);
+    const VF step = VSET1(0.70710678f / (float) c);
+    VF a = VMUL(VSUB(VCVTIF(ua), cf), step);
+    VF b = VMUL(VSUB(VCVTIF(ub), cf), step);
+    VF d = VMUL(VSUB(VCVTIF(uc), cf), step);
+    VF s = VSUB(VSET1(1.0f), VADD(VADD(VMUL(a, a), VMUL(b, b)), VMUL(d, d)));
+    VF l = VSQRT(VMAX(s, VSET1(0.0f)));
+
+    VF i = VCVTIF(idx);
+    VMASK i0 = VCMPEQ(i, VSET1(0.0f));
+    ML_SIMD_KERNEL(store4)(q, VBLEND(i0, a, l),
+        VBLEND(VCMPEQ(i, VSET1(1.0f)), VBLEND(i0, b, a), l),
+        VBLEND(VCMPEQ(i, VSET1(2.0f)), VBLEND(VCMPGT(VSET1(1.5f), i), d, b), l),
+        VBLEND(VCMPEQ(i, VSET1(3.0f)), d, l));
+}
+
+
+static inline void ML_SIMD_KERNEL(packRot32Block)(const float *q, unsigned int *r)
+{
+    VI idx, ua, ub, uc;
+    ML_SIMD_KERNEL(packRotBlock)(q, 511, idx, ua, ub, uc);
+    VISTOREU(r, VIOR(VIOR(VISLLI(idx, 30), VISLLI(ua, 20)), VIOR(VISLLI(ub, 10), uc)));
+}
+
+
+static inline void ML_SIMD_KERNEL(unpackRot32Block)(const unsigned int *p, float *q)
+{
+    const VI mask = VISET1(0x3ff);
+    VI v = VILOADU(p);
+    ML_SIMD_KERNEL(unpackRotBlock)(VISRLI(v, 30), VIAND(VISRLI(v, 20), mask),
+        VIAND(VISRLI(v, 10), mask), VIAND(v, mask), 511, q);
+}
+
+
+// The 48 bit encoding is 3 words to a quaternion. Each quaternion is stored
+// from the stack as 8 bytes, the last 2 of which are rewritten by the next
+// quaternion, or are not written for the last. It is loaded as the 32 bit
+// elements at the first and second words, to avoid reading past the end.
+
+static inline void ML_SIMD_KERNEL(packRot48Block)(const float *q, unsigned short *r)
+{
+    unsigned int lo[VW], hi[VW];
+    VI idx, ua, ub, uc;
+    ML_SIMD_KERNEL(packRotBlock)(q, 16383, idx, ua, ub, uc);
+    VI s0 = VIOR(ua, VISLLI(VIAND(idx, VISET1(1)), 15));
+    VI s1 = VIOR(ub, VISLLI(VISRLI(idx, 1), 15));
+    VISTOREU(lo, VIOR(s0, VISLLI(s1, 16)));
+    VISTOREU(hi, uc);
+    for (int j = 0; j < VW - 1; j++)
+    {
+        unsigned long long v = lo[j] | ((unsigned long long) hi[j] << 32);
+        memcpy(r + 3*j, &v, 8);
+    }
+    memcpy(r + 3*(VW - 1), &lo[VW - 1], 4);
+    r[3*VW - 1] = (unsigned short) hi[VW - 1];
+}
+
+
+static inline void ML_SIMD_KERNEL(unpackRot48Block)(const unsigned short *p, float *q)
+{
+    const VI mask = VISET1(0x7fff);
+    VI l = VIGATHER(p, 6);
+    VI h = VIGATHER(p + 1, 6);
+    VI idx = VIOR(VIAND(VISRLI(l, 15), VISET1(1)), VISLLI(VISRLI(l, 31), 1));
+    ML_SIMD_KERNEL(unpackRotBlock)(idx, VIAND(l, mask), VIAND(VISRLI(l, 16), mask),
+        VIAND(VISRLI(h, 16), mask), 16383, q);
+}
+
+
+static void ML_SIMD_KERNEL(packRot32)(const float *q, unsigned int *r, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+        ML_SIMD_KERNEL(packRot32Block)(q + 4*i, r + i);
+    if (i < count)
+    {
+        float qb[4*VW];
+        unsigned int rb[VW];
+        int m = count - i;
+        for (int j = 0; j < 4*VW; j++)
+            qb[j] = (j < 4*m) ? q[4*i + j] : 0.0f;
+        ML_SIMD_KERNEL(packRot32Block)(qb, rb);
+        for (int j = 0; j < m; j++)
+            r[i + j] = rb[j];
+    }
+}
+
+
+static void ML_SIMD_KERNEL(unpackRot32)(const unsigned int *p, float *q, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+        ML_SIMD_KERNEL(unpackRot32Block)(p + i, q + 4*i);
+    if (i < count)
+    {
+        unsigned int pb[VW];
+        float qb[4*VW];
+        int m = count - i;
+        for (int j = 0; j < VW; j++)
+            pb[j] = (j < m) ? p[i + j] : 0;
+        ML_SIMD_KERNEL(unpackRot32Block)(pb, qb);
+        for (int j = 0; j < 4*m; j++)
+            q[4*i + j] = qb[j];
+    }
+}
+
+
+static void ML_SIMD_KERNEL(packRot48)(const float *q, unsigned short *r, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+        ML_SIMD_KERNEL(packRot48Block)(q + 4*i, r + 3*i);
+    if (i < count)
+    {
+        float qb[4*VW];
+        unsigned short rb[3*VW];
+        int m = count - i;
+        for (int j = 0; j < 4*VW; j++)
+            qb[j] = (j < 4*m) ? q[4*i + j] : 0.0f;
+        ML_SIMD_KERNEL(packRot48Block)(qb, rb);
+        for (int j = 0; j < 3*m; j++)
+            r[3*i + j] = rb[j];
+    }
+}
+
+
+static void ML_SIMD_KERNEL(unpackRot48)(const unsigned short *p, float *q, int count)
+{
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+        ML_SIMD_KERNEL(unpackRot48Block)(p + 3*i, q + 4*i);
+    if (i < count)
+    {
+        unsigned short pb[3*VW];
+        float qb[4*VW];
+        int m = count - i;
+        for (int j = 0; j < 3*VW; j++)
+            pb[j] = (j < 3*m) ? p[3*i + j] : 0;
+        ML_SIMD_KERNEL(unpackRot48Block)(pb, qb);
+        for (int j = 0; j < 4*m; j++)
+            q[4*i + j] = qb[j];
+    }
+}
+
+
+// Quantization of arrays of vectors of n elements. The arrays are handled
+// as streams of floats, n*VW at a time, so that each vector register holds
+// elements in a fixed pattern that repeats every n registers. The origin,
+// scale and step are expanded to the same pattern.
+
+static inline void ML_SIMD_KERNEL(pattern)(const float *e, int n, VF *r)
+{
+    float p[3*VW];
+    for (int j = 0; j < n*VW; j++)
+        p[j] = e[j % n];
+    for (int j = 0; j < n; j++)
+        r[j] = VLOADU(p + j*VW);
+}
+
+
+static void ML_SIMD_KERNEL(bounds)(const float *v, float *lo, float *hi, int count, int n)
+{
+    VF mn[3], mx[3];
+    int total = count*n;
+    int i = 0, j;
+    for (j = 0; j < n; j++)
+        lo[j] = hi[j] = v[j];
+    ML_SIMD_KERNEL(pattern)(v, n, mn);
+    ML_SIMD_KERNEL(pattern)(v, n, mx);
+    for (; i + n*VW <= total; i += n*VW)
+    {
+        for (j = 0; j < n; j++)
+        {
+            VF x = VLOADU(v + i + j*VW);
+            mn[j] = VMIN(mn[j], x);
+            mx[j] = VMAX(mx[j], x);
+        }
+    }
+
+    float a[3*VW], b[3*VW];
+    for (j = 0; j < n; j++)
+    {
+        VSTOREU(a + j*VW, mn[j]);
+        VSTOREU(b + j*VW, mx[j]);
+    }
+    for (j = 0; j < n*VW; j++)
+    {
+        if (a[j] < lo[j % n])
+            lo[j % n] = a[j];
+        if (b[j] > hi[j % n])
+            hi[j % n] = b[j];
+    }
+    for (; i < total; i++)
+    {
+        if (v[i] < lo[i % n])
+            lo[i % n] = v[i];
+        if (v[i] > hi[i % n])
+            hi[i % n] = v[i];
+    }
+}
+
+
+static void ML_SIMD_KERNEL(quantize)(const float *v, short *q, const float *origin,
+    const float *scale, int count, int n)
+{
+    const VF range = VSET1(32767.0f);
+    const VF nrange = VSET1(-32767.0f);
+    VF o[3], s[3];
+    ML_SIMD_KERNEL(pattern)(origin, n, o);
+    ML_SIMD_KERNEL(pattern)(scale, n, s);
+
+    int total = count*n;
+    int i = 0;
+    for (; i + n*VW <= total; i += n*VW)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            VF x = VMUL(VSUB(VLOADU(v + i + j*VW), o[j]), s[j]);
+            VISTORES16(q + i + j*VW, VCVTI(VMIN(VMAX(x, nrange), range)));
+        }
+    }
+    for (; i < total; i++)
+    {
+        float x = (v[i] - origin[i % n]) * scale[i % n];
+        x = (x < -32767.0f) ? -32767.0f : ((x > 32767.0f) ? 32767.0f : x);
+        q[i] = (short) lrintf(x);
+    }
+}
+
+
+static void ML_SIMD_KERNEL(dequantize)(const short *q, const float *origin,
+    const float *step, float *v, int count, int n)
+{
+    VF o[3], s[3];
+    ML_SIMD_KERNEL(pattern)(origin, n, o);
+    ML_SIMD_KERNEL(pattern)(step, n, s);
+
+    int total = count*n;
+    int i = 0;
+    for (; i + n*VW <= total; i += n*VW)
+    {
+        for (int j = 0; j < n; j++)
+            VSTOREU(v + i + j*VW, VADD(o[j], VMUL(VCVTIF(VILOADS16(q + i + j*VW)), s[j])));
+    }
+    for (; i < total; i++)
+        v[i] = origin[i % n] + (float) q[i] * step[i % n];
+}
+
+
+static void ML_SIMD_KERNEL(rebase)(const double *v, const double *origin, float *r,
+    int count, int n)
+{
+    // The origin repeated VW times, so that it lines up with each group of
+    // VW elements.
+    double o[12*VW];
+    for (int k = 0; k < n*VW; k++)
+        o[k] = origin[k % n];
+
+    int total = count*n;
+    int i = 0;
+    for (; i + n*VW <= total; i += n*VW)
+    {
+        for (int j = 0; j < n; j++)
+            VSTOREU(r + i + j*VW, VDSUBF(v + i + j*VW, o + j*VW));
+    }
+    for (; i < total; i++)
+        r[i] = (float) (v[i] - origin[i % n]);
+}
+
+
+// Each row is a combination of the rows of m, weighted by its elements.
+// The rows are consecutive, so a vector holds VW/4 of them, and each
+// weight is broadcast within its 128-bit lane.
+
+static void ML_SIMD_KERNEL(mult4)(const float *m, const float *v, float *r, int count)
+{
+    const VF m0 = VLOADLANES(m, 0);
+    const VF m1 = VLOADLANES(m + 4, 0);
+    const VF m2 = VLOADLANES(m + 8, 0);
+    const VF m3 = VLOADLANES(m + 12, 0);
+    int i = 0;
+    for (; i + VW/4 <= count; i += VW/4)
+    {
+        VF a = VLOADU(v + 4*i);
+        VSTOREU(r + 4*i,
+                VADD(VADD(VMUL(VSHUF(a, a, _MM_SHUFFLE(0,0,0,0)), m0),
+                          VMUL(VSHUF(a, a, _MM_SHUFFLE(1,1,1,1)), m1)),
+                     VADD(VMUL(VSHUF(a, a, _MM_SHUFFLE(2,2,2,2)), m2),
+                          VMUL(VSHUF(a, a, _MM_SHUFFLE(3,3,3,3)), m3))));
+    }
+    for (; i < count; i++)
+    {
+        float a[4] = { v[4*i], v[4*i + 1], v[4*i + 2], v[4*i + 3] };
+        for (int j = 0; j < 4; j++)
+            r[4*i + j] = (a[0]*m[j] + a[1]*m[4 + j]) + (a[2]*m[8 + j] + a[3]*m[12 + j]);
+    }
+}
+
+
+static void ML_SIMD_KERNEL(project)(const float *m, const float *v, float *r,
+    int count, int divide)
+{
+    VF c[16];
+    for (int j = 0; j < 16; j++)
+        c[j] = VSET1(m[j]);
+    const VF one = VSET1(1.0f);
+
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        VF x, y, z;
+        ML_SIMD_KERNEL(load3)(v + 3*i, x, y, z);
+        VF rx = VADD(VADD(VMUL(x, c[0]), VMUL(y, c[4])), VADD(VMUL(z, c[8]), c[12]));
+        VF ry = VADD(VADD(VMUL(x, c[1]), VMUL(y, c[5])), VADD(VMUL(z, c[9]), c[13]));
+        VF rz = VADD(VADD(VMUL(x, c[2]), VMUL(y, c[6])), VADD(VMUL(z, c[10]), c[14]));
+        VF rw = VADD(VADD(VMUL(x, c[3]), VMUL(y, c[7])), VADD(VMUL(z, c[11]), c[15]));
+        if (divide)
+        {
+            VF s = VDIV(one, rw);
+            ML_SIMD_KERNEL(store3)(r + 3*i, VMUL(rx, s), VMUL(ry, s), VMUL(rz, s));
+        }
+        else
+            ML_SIMD_KERNEL(store4)(r + 4*i, rx, ry, rz, rw);
+    }
+    for (; i < count; i++)
+    {
+        float x = v[3*i], y = v[3*i + 1], z = v[3*i + 2];
+        float h[4];
+        for (int j = 0; j < 4; j++)
+            h[j] = (x*m[j] + y*m[4 + j]) + (z*m[8 + j] + m[12 + j]);
+        if (divide)
+        {
+            float s = 1.0f / h[3];
+            r[3*i] = h[0]*s; r[3*i + 1] = h[1]*s; r[3*i + 2] = h[2]*s;
+        }
+        else
+        {
+            r[4*i] = h[0]; r[4*i + 1] = h[1]; r[4*i + 2] = h[2]; r[4*i + 3] = h[3];
+        }
+    }
+}
+
+
+// Each result element sums the products of a row vector left to right, as
+// MlTransform::multVecMatrix() does, and then adds the translation. The
+// products and sums are not fused into the FMA instructions that come with
+// AVX-512, so that each vector gets the bits of multVecMatrix() at every
+// level, whether it falls in the vector loop or in the remainder.
+
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+static void ML_SIMD_KERNEL(transform3)(const float *m, const float *x, const float *y,
+    const float *z, float *rx, float *ry, float *rz, int count, int translate)
+{
+    VF c[12];
+    for (int j = 0; j < 12; j++)
+        c[j] = VSET1(m[j]);
+
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        VF a = VLOADU(x + i), b = VLOADU(y + i), d = VLOADU(z + i);
+        VF r0 = VADD(VADD(VMUL(a, c[0]), VMUL(b, c[3])), VMUL(d, c[6]));
+        VF r1 = VADD(VADD(VMUL(a, c[1]), VMUL(b, c[4])), VMUL(d, c[7]));
+        VF r2 = VADD(VADD(VMUL(a, c[2]), VMUL(b, c[5])), VMUL(d, c[8]));
+        if (translate)
+        {
+            r0 = VADD(r0, c[9]);
+            r1 = VADD(r1, c[10]);
+            r2 = VADD(r2, c[11]);
+        }
+        VSTOREU(rx + i, r0);
+        VSTOREU(ry + i, r1);
+        VSTOREU(rz + i, r2);
+    }
+    for (; i < count; i++)
+    {
+        float a = x[i], b = y[i], d = z[i];
+        float r[3];
+        for (int j = 0; j < 3; j++)
+        {
+            r[j] = a*m[j] + b*m[3 + j] + d*m[6 + j];
+            if (translate)
+                r[j] += m[9 + j];
+        }
+        rx[i] = r[0]; ry[i] = r[1]; rz[i] = r[2];
+    }
+}
+
+#if defined(__clang__)
+#pragma clang fp contract(on)
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+
+// Frustum culling. Each volume is outside if its signed distance from one
+// of the planes, or that of its corner furthest along the plane normal, is
+// negative. The smallest distance over the planes is compared once, and
+// VW visibility bits at a time are gathered into each mask word.
+
+static void ML_SIMD_KERNEL(cullSpheres)(const float *planes, const float *x,
+    const float *y, const float *z, const float *r, unsigned int *mask, int count)
+{
+    VF p[24];
+    for (int k = 0; k < 24; k++)
+        p[k] = VSET1(planes[k]);
+    const VF zero = VSET1(0.0f);
+    const unsigned int all = (1u << VW) - 1;
+
+    unsigned int bits = 0;
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        VF vx = VLOADU(x + i), vy = VLOADU(y + i), vz = VLOADU(z + i), vr = VLOADU(r + i);
+        VF d = VADD(VADD(VMUL(vx, p[0]), VMUL(vy, p[1])), VADD(VMUL(vz, p[2]), VADD(p[3], vr)));
+        for (int k = 4; k < 24; k += 4)
+            d = VMIN(d, VADD(VADD(VMUL(vx, p[k]), VMUL(vy, p[k + 1])),
+                             VADD(VMUL(vz, p[k + 2]), VADD(p[k + 3], vr))));
+        bits |= (~(unsigned int) VMASKBITS(VCMPGT(zero, d)) & all) << (i & 31);
+        if (((i + VW) & 31) == 0)
+        {
+            mask[i >> 5] = bits;
+            bits = 0;
+        }
+    }
+    for (; i < count; i++)
+    {
+        int inside = 1;
+        for (int k = 0; k < 24; k += 4)
+            if ((x[i]*planes[k] + y[i]*planes[k + 1]) +
+                (z[i]*planes[k + 2] + (planes[k + 3] + r[i])) < 0.0f)
+                inside = 0;
+        bits |= (unsigned int) inside << (i & 31);
+        if (((i + 1) & 31) == 0)
+        {
+            mask[i >> 5] = bits;
+            bits = 0;
+        }
+    }
+    if (count & 31)
+        mask[count >> 5] = bits;
+}
+
+
+static void ML_SIMD_KERNEL(cullBoxes)(const float *planes, const float *minX,
+    const float *minY, const float *minZ, const float *maxX, const float *maxY,
+    const float *maxZ, unsigned int *mask, int count)
+{
+    // The streams of the corner of each box furthest along each normal.
+    const float *c[18];
+    VF p[24];
+    for (int k = 0; k < 6; k++)
+    {
+        c[3*k] = (planes[4*k] >= 0.0f) ? maxX : minX;
+        c[3*k + 1] = (planes[4*k + 1] >= 0.0f) ? maxY : minY;
+        c[3*k + 2] = (planes[4*k + 2] >= 0.0f) ? maxZ : minZ;
+        for (int j = 0; j < 4; j++)
+            p[4*k + j] = VSET1(planes[4*k + j]);
+    }
+    const VF zero = VSET1(0.0f);
+    const unsigned int all = (1u << VW) - 1;
+
+    unsigned int bits = 0;
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        VF d = VADD(VADD(VMUL(VLOADU(c[0] + i), p[0]), VMUL(VLOADU(c[1] + i), p[1])),
+                    VADD(VMUL(VLOADU(c[2] + i), p[2]), p[3]));
+        for (int k = 1; k < 6; k++)
+            d = VMIN(d, VADD(VADD(VMUL(VLOADU(c[3*k] + i), p[4*k]),
+                                  VMUL(VLOADU(c[3*k + 1] + i), p[4*k + 1])),
+                             VADD(VMUL(VLOADU(c[3*k + 2] + i), p[4*k + 2]), p[4*k + 3])));
+        bits |= (~(unsigned int) VMASKBITS(VCMPGT(zero, d)) & all) << (i & 31);
+        if (((i + VW) & 31) == 0)
+        {
+            mask[i >> 5] = bits;
+            bits = 0;
+        }
+    }
+    for (; i < count; i++)
+    {
+        int inside = 1;
+        for (int k = 0; k < 6; k++)
+            if ((c[3*k][i]*planes[4*k] + c[3*k + 1][i]*planes[4*k + 1]) +
+                (c[3*k + 2][i]*planes[4*k + 2] + planes[4*k + 3]) < 0.0f)
+                inside = 0;
+        bits |= (unsigned int) inside << (i & 31);
+        if (((i + 1) & 31) == 0)
+        {
+            mask[i >> 5] = bits;
+            bits = 0;
+        }
+    }
+    if (count & 31)
+        mask[count >> 5] = bits;
+}
+
+
+// Bounding volumes. Boxes are deinterleaved as pairs of 3 element vectors,
+// so the 4 boxes of a 128-bit lane are 24 floats apart.
+
+static inline void ML_SIMD_KERNEL(loadBoxes)(const float *p, VF *lo, VF *hi)
+{
+    VF a[3], b[3];
+    ML_SIMD_KERNEL(load3s)(p, 24, a[0], a[1], a[2]);        // lo0 hi0 lo1 hi1
+    ML_SIMD_KERNEL(load3s)(p + 12, 24, b[0], b[1], b[2]);   // lo2 hi2 lo3 hi3
+    for (int j = 0; j < 3; j++)
+    {
+        lo[j] = VSHUF(a[j], b[j], _MM_SHUFFLE(2,0,2,0));
+        hi[j] = VSHUF(a[j], b[j], _MM_SHUFFLE(3,1,3,1));
+    }
+}
+
+
+static inline void ML_SIMD_KERNEL(storeBoxes)(float *p, const VF *lo, const VF *hi)
+{
+    ML_SIMD_KERNEL(store3s)(p, 24, VUNPLO(lo[0], hi[0]), VUNPLO(lo[1], hi[1]),
+                            VUNPLO(lo[2], hi[2]));
+    ML_SIMD_KERNEL(store3s)(p + 12, 24, VUNPHI(lo[0], hi[0]), VUNPHI(lo[1], hi[1]),
+                            VUNPHI(lo[2], hi[2]));
+}
+
+
+// Transforms VW boxes by the matrices e, one element to a vector, by the
+// absolute value method of Arvo: the center of a box is transformed, and
+// its half extent by the absolute values of the matrix.
+
+static inline void ML_SIMD_KERNEL(transformBoxBlock)(const VF *e, const float *b, float *r)
+{
+    const VF half = VSET1(0.5f);
+    const VF sign = VSET1(-0.0f);
+    VF lo[3], hi[3], c[3], h[3], rlo[3], rhi[3];
+
+    ML_SIMD_KERNEL(loadBoxes)(b, lo, hi);
+    for (int j = 0; j < 3; j++)
+    {
+        c[j] = VMUL(VADD(lo[j], hi[j]), half);
+        h[j] = VMUL(VSUB(hi[j], lo[j]), half);
+    }
+    VMASK empty = VCMPGT(VSET1(0.0f), VMIN(VMIN(h[0], h[1]), h[2]));
+    for (int j = 0; j < 3; j++)
+    {
+        VF tc = VADD(VADD(VMUL(c[0], e[j]), VMUL(c[1], e[3 + j])),
+                     VADD(VMUL(c[2], e[6 + j]), e[9 + j]));
+        VF th = VADD(VADD(VMUL(h[0], VANDNOT(sign, e[j])), VMUL(h[1], VANDNOT(sign, e[3 + j]))),
+                     VMUL(h[2], VANDNOT(sign, e[6 + j])));
+        rlo[j] = VBLEND(empty, VSUB(tc, th), lo[j]);
+        rhi[j] = VBLEND(empty, VADD(tc, th), hi[j]);
+    }
+    ML_SIMD_KERNEL(storeBoxes)(r, rlo, rhi);
+}
+
+
+// The bounds of an array of boxes. Empty boxes are replaced by ones whose
+// corners are at the far ends of the range of floats, which no other box is
+// beyond, so a box of empty ones is also empty.
+
+static void ML_SIMD_KERNEL(mergeBoxes)(const float *b, float *r, int count)
+{
+    const VF big = VSET1(FLT_MAX);
+    const VF zero = VSET1(0.0f);
+    VF mn[3], mx[3];
+    int i, j;
+
+    for (j = 0; j < 3; j++)
+    {
+        mn[j] = big;
+        mx[j] = VSUB(zero, big);
+    }
+    for (i = 0; i < count; i += VW)
+    {
+        const float *bi = b + 6*i;
+        float pb[6*VW];
+        if (count - i < VW)
+        {
+            for (j = 0; j < 6*VW; j++)
+                pb[j] = (j < 6*(count - i)) ? bi[j] : ((j % 6 < 3) ? 1.0f : -1.0f);
+            bi = pb;
+        }
+        VF lo[3], hi[3];
+        ML_SIMD_KERNEL(loadBoxes)(bi, lo, hi);
+        VMASK empty = VCMPGT(zero, VMIN(VMIN(VSUB(hi[0], lo[0]), VSUB(hi[1], lo[1])),
+                                        VSUB(hi[2], lo[2])));
+        for (j = 0; j < 3; j++)
+        {
+            mn[j] = VMIN(mn[j], VBLEND(empty, lo[j], big));
+            mx[j] = VMAX(mx[j], VBLEND(empty, hi[j], VSUB(zero, big)));
+        }
+    }
+
+    float a[VW], c[VW];
+    for (j = 0; j < 3; j++)
+    {
+        VSTOREU(a, mn[j]);
+        VSTOREU(c, mx[j]);
+        r[j] = a[0];
+        r[3 + j] = c[0];
+        for (i = 1; i < VW; i++)
+        {
+            if (a[i] < r[j])
+                r[j] = a[i];
+            if (c[i] > r[3 + j])
+                r[3 + j] = c[i];
+        }
+    }
+}
+
+
+// With a matrix per box, the matrices are loaded 4 floats at a time, one
+// box to a 128-bit lane, and transposed as in skinBlock(). The last few
+// boxes are padded with empty ones.
+
+static void ML_SIMD_KERNEL(transformBoxes)(const float *m, int mstride, const float *b,
+    float *r, int count)
+{
+    VF e[12];
+    int i = 0, j, k;
+    if (mstride == 0)
+    {
+        for (j = 0; j < 12; j++)
+            e[j] = VSET1(m[j]);
+    }
+    for (; i < count; i += VW)
+    {
+        const float *mi = m + mstride*i;
+        const float *bi = b + 6*i;
+        float *ri = r + 6*i;
+        int n = (count - i < VW) ? count - i : VW;
+        float pm[12*VW], pb[6*VW], pr[6*VW];
+        if (n < VW)
+        {
+            for (j = 0; j < 6*VW; j++)
+                pb[j] = (j < 6*n) ? bi[j] : ((j % 6 < 3) ? 1.0f : -1.0f);
+            if (mstride != 0)
+            {
+                for (j = 0; j < 12*VW; j++)
+                    pm[j] = (j < 12*n) ? mi[j] : 0.0f;
+                mi = pm;
+            }
+            bi = pb;
+            ri = pr;
+        }
+        if (mstride != 0)
+        {
+            for (j = 0; j < 12; j += 4)
+            {
+                for (k = 0; k < 4; k++)
+                    e[j + k] = VLOADLANES(mi + 12*k + j, 48);
+                ML_SIMD_KERNEL(transpose4)(e[j], e[j + 1], e[j + 2], e[j + 3]);
+            }
+        }
+        ML_SIMD_KERNEL(transformBoxBlock)(e, bi, ri);
+        if (n < VW)
+        {
+            for (j = 0; j < 6*n; j++)
+                r[6*i + j] = pr[j];
+        }
+    }
+}
+
+
+// Tests of VW boxes, spheres or points against the volume v, broadcast to
+// q. Each returns a value that is negative for those that fail the test.
+// The box v of boxOverlaps is not empty; the caller checks.
+
+static inline VF ML_SIMD_KERNEL(boxOverlapsBlock)(const VF *q, const float *b)
+{
+    VF lo[3], hi[3];
+    ML_SIMD_KERNEL(loadBoxes)(b, lo, hi);
+    VF d = VMIN(VSUB(q[3], lo[0]), VSUB(hi[0], q[0]));
+    for (int j = 1; j < 3; j++)
+        d = VMIN(d, VMIN(VSUB(q[3 + j], lo[j]), VSUB(hi[j], q[j])));
+
+    // An empty box overlaps nothing.
+    for (int j = 0; j < 3; j++)
+        d = VMIN(d, VSUB(hi[j], lo[j]));
+    return d;
+}
+
+
+static inline VF ML_SIMD_KERNEL(boxContainsBlock)(const VF *q, const float *p)
+{
+    VF x[3];
+    ML_SIMD_KERNEL(load3)(p, x[0], x[1], x[2]);
+    VF d = VMIN(VSUB(x[0], q[0]), VSUB(q[3], x[0]));
+    for (int j = 1; j < 3; j++)
+        d = VMIN(d, VMIN(VSUB(x[j], q[j]), VSUB(q[3 + j], x[j])));
+    return d;
+}
+
+
+// A sphere of negative radius is empty, and fails every test.
+
+static inline VF ML_SIMD_KERNEL(sphereOverlapsBlock)(const VF *q, const float *s)
+{
+    VF x, y, z, r;
+    ML_SIMD_KERNEL(load4)(s, x, y, z, r);
+    VF dx = VSUB(x, q[0]), dy = VSUB(y, q[1]), dz = VSUB(z, q[2]);
+    VF rr = VADD(r, q[3]);
+    VF d2 = VADD(VADD(VMUL(dx, dx), VMUL(dy, dy)), VMUL(dz, dz));
+    return VMIN(VSUB(VMUL(rr, rr), d2), VMIN(r, q[3]));
+}
+
+
+static inline VF ML_SIMD_KERNEL(sphereContainsBlock)(const VF *q, const float *p)
+{
+    VF x, y, z;
+    ML_SIMD_KERNEL(load3)(p, x, y, z);
+    VF dx = VSUB(x, q[0]), dy = VSUB(y, q[1]), dz = VSUB(z, q[2]);
+    VF d2 = VADD(VADD(VMUL(dx, dx), VMUL(dy, dy)), VMUL(dz, dz));
+    return VMIN(VSUB(VMUL(q[3], q[3]), d2), q[3]);
+}
+
+
+// Runs a test over count elements of n floats, gathering VW mask bits at a
+// time as the culling kernels do. The last few are copied to a block padded
+// with zeros, whose extra bits are dropped.
+
+static inline void ML_SIMD_KERNEL(testArray)(VF (*block)(const VF *, const float *),
+    const float *v, int nv, const float *a, int n, unsigned int *mask, int count)
+{
+    VF q[6];
+    for (int j = 0; j < nv; j++)
+        q[j] = VSET1(v[j]);
+    const VF zero = VSET1(0.0f);
+    const unsigned int all = (1u << VW) - 1;
+
+    unsigned int bits = 0;
+    int i = 0;
+    for (; i + VW <= count; i += VW)
+    {
+        bits |= (~(unsigned int) VMASKBITS(VCMPGT(zero, block(q, a + n*i))) & all) << (i & 31);
+        if (((i + VW) & 31) == 0)
+        {
+            mask[i >> 5] = bits;
+            bits = 0;
+        }
+    }
+    if (i < count)
+    {
+        float pad[6*VW];
+        for (int j = 0; j < n*VW; j++)
+            pad[j] = (j < n*(count - i)) ? a[n*i + j] : 0.0f;
+        bits |= (~(unsigned int) VMASKBITS(VCMPGT(zero, block(q, pad))) &
+                 ((1u << (count - i)) - 1)) << (i & 31);
+    }
+    if (count & 31)
+        mask[count >> 5] = bits;
+}
+
+
+static void ML_SIMD_KERNEL(boxOverlaps)(const float *v, const float *b, unsigned int *mask,
+    int count)
+{
+    ML_SIMD_KERNEL(testArray)(ML_SIMD_KERNEL(boxOverlapsBlock), v, 6, b, 6, mask, count);
+}
+
+
+static void ML_SIMD_KERNEL(boxContains)(const float *v, const float *p, unsigned int *mask,
+    int count)
+{
+    ML_SIMD_KERNEL(testArray)(ML_SIMD_KERNEL(boxContainsBlock), v, 6, p, 3, mask, count);
+}
+
+
+static void ML_SIMD_KERNEL(sphereOverlaps)(const float *v, const float *s, unsigned int *mask,
+    int count)
+{
+    ML_SIMD_KERNEL(testArray)(ML_SIMD_KERNEL(sphereOverlapsBlock), v, 4, s, 4, mask, count);
+}
+
+
+static void ML_SIMD_KERNEL(sphereContains)(const float *v, const float *p, unsigned int *mask,
+    int count)
+{
+    ML_SIMD_KERNEL(testArray)(ML_SIMD_KERNEL(sphereContainsBlock), v, 4, p, 3, mask, count);
+}
+
+
+// Traversal of a bounding volume hierarchy by packets of VW rays, visiting
+// each node that any ray of the packet enters. The children of a node are
+// visited nearest first for the average direction of the packet. Each
+// triangle hit updates the distances of the rays in memory, which are then
+// reloaded, so that hits stay cheap to record one ray at a time. The slab
+// tests widen each node slightly, and the tree is at most 64 levels deep,
+// see bvh.cxx.
+
+static void ML_SIMD_KERNEL(traceRays)(const float *nodes, const float *tris, const float *o,
+    const float *d, float *t, int *hit, float *uv, int count, int any)
+{
+    const VF zero = VSET1(0.0f), one = VSET1(1.0f);
+    const VF tiny = VSET1(1.0e-30f), sign = VSET1(-0.0f);
+    const VF farScale = VSET1(1.0000004f);
+    const int all = (1 << VW) - 1;
+    int j, k;
+
+    for (int i = 0; i < count; i += VW)
+    {
+        int n = (count - i < VW) ? count - i : VW;
+        const float *oi = o + 3*i, *di = d + 3*i;
+        float pb[6*VW], tb[VW], hb[VW], ub[VW], vb[VW];
+
+        // The last few rays are padded with rays of negative length, which
+        // enter no node.
+        if (n < VW)
+        {
+            for (j = 0; j < 3*VW; j++)
+            {
+                pb[j] = (j < 3*n) ? oi[j] : 0.0f;
+                pb[3*VW + j] = (j < 3*n) ? di[j] : 1.0f;
+            }
+            oi = pb;
+            di = pb + 3*VW;
+        }
+        for (j = 0; j < VW; j++)
+            tb[j] = (j < n) ? t[i + j] : -1.0f;
+        for (j = 0; j < n; j++)
+            hit[i + j] = -1;
+
+        VF ro[3], rd[3], ri[3];
+        ML_SIMD_KERNEL(load3)(oi, ro[0], ro[1], ro[2]);
+        ML_SIMD_KERNEL(load3)(di, rd[0], rd[1], rd[2]);
+        int neg[3];
+        for (k = 0; k < 3; k++)
+        {
+            VMASK low = VCMPGT(tiny, VANDNOT(sign, rd[k]));
+            ri[k] = VDIV(one, VBLEND(low, rd[k], VXOR(VAND(rd[k], sign), tiny)));
+            float sum = 0.0f;
+            for (j = 0; j < n; j++)
+                sum += di[3*j + k];
+            neg[k] = (sum < 0.0f);
+        }
+
+        VF rt = VLOADU(tb);
+        int stack[64];
+        int sp = 0, node = 0;
+        for (;;)
+        {
+            const float *b = nodes + 8*node;
+            VF tn = zero, tf = VSET1(FLT_MAX);
+            for (k = 0; k < 3; k++)
+            {
+                VF t0 = VMUL(VSUB(VSET1(b[k]), ro[k]), ri[k]);
+                VF t1 = VMUL(VSUB(VSET1(b[4 + k]), ro[k]), ri[k]);
+                tn = VMAX(tn, VMIN(t0, t1));
+                tf = VMIN(tf, VMAX(t0, t1));
+            }
+
+            if (VMASKBITS(VCMPGT(tn, VMIN(rt, VMUL(tf, farScale)))) != all)
+            {
+                int offset, c;
+                memcpy(&offset, b + 3, sizeof(int));
+                memcpy(&c, b + 7, sizeof(int));
+                if (c <= 0)
+                {
+                    stack[sp++] = offset + 1 - neg[-c];
+                    node = offset + neg[-c];
+                    continue;
+                }
+
+                for (int m = offset; m < offset + c; m++)
+                {
+                    const float *tr = tris + 9*m;
+                    VF e1[3], e2[3], s[3];
+                    for (k = 0; k < 3; k++)
+                    {
+                        e1[k] = VSET1(tr[3 + k]);
+                        e2[k] = VSET1(tr[6 + k]);
+                        s[k] = VSUB(ro[k], VSET1(tr[k]));
+                    }
+                    VF px = VSUB(VMUL(rd[1], e2[2]), VMUL(rd[2], e2[1]));
+                    VF py = VSUB(VMUL(rd[2], e2[0]), VMUL(rd[0], e2[2]));
+                    VF pz = VSUB(VMUL(rd[0], e2[1]), VMUL(rd[1], e2[0]));
+                    VF r = VDIV(one, VADD(VADD(VMUL(e1[0], px), VMUL(e1[1], py)),
+                                          VMUL(e1[2], pz)));
+                    VF u = VMUL(VADD(VADD(VMUL(s[0], px), VMUL(s[1], py)), VMUL(s[2], pz)), r);
+                    VF qx = VSUB(VMUL(s[1], e1[2]), VMUL(s[2], e1[1]));
+                    VF qy = VSUB(VMUL(s[2], e1[0]), VMUL(s[0], e1[2]));
+                    VF qz = VSUB(VMUL(s[0], e1[1]), VMUL(s[1], e1[0]));
+                    VF v = VMUL(VADD(VADD(VMUL(rd[0], qx), VMUL(rd[1], qy)), VMUL(rd[2], qz)), r);
+                    VF h = VMUL(VADD(VADD(VMUL(e2[0], qx), VMUL(e2[1], qy)), VMUL(e2[2], qz)), r);
+
+                    // A triangle parallel to a ray gives an infinite or
+                    // undefined distance, which fails the first test.
+                    int bits = VMASKBITS(VCMPGT(rt, h)) &
+                        ~(VMASKBITS(VCMPGT(zero, h)) | VMASKBITS(VCMPGT(zero, u)) |
+                          VMASKBITS(VCMPGT(zero, v)) | VMASKBITS(VCMPGT(VADD(u, v), one)));
+                    if (bits == 0)
+                        continue;
+
+                    VSTOREU(hb, h);
+                    VSTOREU(ub, u);
+                    VSTOREU(vb, v);
+                    for (j = 0; j < n; j++)
+                    {
+                        if (((bits >> j) & 1) == 0)
+                            continue;
+                        hit[i + j] = m;
+                        if (uv != NULL)
+                        {
+                            uv[2*(i + j)] = ub[j];
+                            uv[2*(i + j) + 1] = vb[j];
+                        }
+                        if (any)
+                        {
+                            t[i + j] = hb[j];
+                            tb[j] = -1.0f;
+                        }
+                        else
+                            tb[j] = hb[j];
+                    }
+                    rt = VLOADU(tb);
+                }
+
+                // Rays that have hit something stop once all have.
+                if (any && VMASKBITS(VCMPGT(zero, rt)) == all)
+                    break;
+            }
+
+            if (sp == 0)
+                break;
+            node = stack[--sp];
+        }
+
+        if (! any)
+        {
+            for (j = 0; j < n; j++)
+                t[i + j] = tb[j];
+        }
+    }
+}
+
+
+static const MlVectorKernels ML_SIMD_KERNEL(kernels) =
+{
+    ML_SIMD_LEVEL,
+    ML_SIMD_KERNEL(add),
+    ML_SIMD_KERNEL(subtract),
+    ML_SIMD_KERNEL(scale),
+    ML_SIMD_KERNEL(dot3),
+    ML_SIMD_KERNEL(cross3),
+    ML_SIMD_KERNEL(length3),
+    ML_SIMD_KERNEL(normalize3),
+    ML_SIMD_KERNEL(dot4),
+    ML_SIMD_KERNEL(length4),
+    ML_SIMD_KERNEL(normalize4),
+    ML_SIMD_KERNEL(sinCos),
+    ML_SIMD_KERNEL(atan2),
+    ML_SIMD_KERNEL(asin),
+    ML_SIMD_KERNEL(acos),
+    ML_SIMD_KERNEL(slerp),
+    ML_SIMD_KERNEL(nlerp),
+    ML_SIMD_KERNEL(skin),
+    ML_SIMD_KERNEL(skinDual),
+    ML_SIMD_KERNEL(packRot32),
+    ML_SIMD_KERNEL(unpackRot32),
+    ML_SIMD_KERNEL(packRot48),
+    ML_SIMD_KERNEL(unpackRot48),
+    ML_SIMD_KERNEL(bounds),
+    ML_SIMD_KERNEL(quantize),
+    ML_SIMD_KERNEL(dequantize),
+    ML_SIMD_KERNEL(rebase),
+    ML_SIMD_KERNEL(mult4),
+    ML_SIMD_KERNEL(project),
+    ML_SIMD_KERNEL(transform3),
+    ML_SIMD_KERNEL(cullSpheres),
+    ML_SIMD_KERNEL(cullBoxes),
+    ML_SIMD_KERNEL(transformBoxes),
+    ML_SIMD_KERNEL(mergeBoxes),
+    ML_SIMD_KERNEL(boxOverlaps),
+    ML_SIMD_KERNEL(boxContains),
+    ML_SIMD_KERNEL(sphereOverlaps),
+    ML_SIMD_KERNEL(sphereContains),
+    ML_SIMD_KERNEL(traceRays)
+};
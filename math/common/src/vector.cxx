@@ -37,6 +37,11 @@
 
 // include Mltuer math header files
 #include "math/vector.h"
+#if ML_FIXED_POINT
+#include "math/sqrt.h"
+#include "math/recip.h"
+#endif
+#include "vecsimd.h"
 
 
 //////////////////////////////////////////////////////////////////////////////
@@ -112,48 +117,232 @@ calcScale(
 #endif
 }
 
+#if ML_FIXED_POINT
 //////////////////////////////////////////////////////////////////////////////
 //
-// Vec3f class
+// Normalizes an array of vectors of n components, in blocks, so that the
+// square roots and reciprocals go through FixedSqrtBatch() and
+// FixedReciprocalBatch(). The arithmetic is that of normalize() followed
+// by length(), so the results are the same as normalizing one at a time.
 //
-//////////////////////////////////////////////////////////////////////////////
+#define NORMALIZE_BLOCK 64
 
+static void
+normalizeBatchFixed( MlScalar *v, const int n, MlScalar *lengths, int count )
+{
+    MlScalar len[NORMALIZE_BLOCK];
+    MlScalar recipLen[NORMALIZE_BLOCK];
+    MlScalar recipScale[NORMALIZE_BLOCK];
+    MlScalar scale;
 
-const MlVector3 MlVector3::zero (ML_SCALAR_ZERO,ML_SCALAR_ZERO,ML_SCALAR_ZERO);
+    for (int base = 0; base < count; base += NORMALIZE_BLOCK) {
+        int m = (count - base < NORMALIZE_BLOCK) ? count - base : NORMALIZE_BLOCK;
+        int i, j;
 
+        for (i = 0; i < m; i++) {
+            MlScalar *u = v + (base + i) * n;
 
-int MlVector3::isZero(void) const
+            // Scale it into an appropriate range, then scale it
+            // again for the length calculation.
+            calcScale( u, n, scale, recipScale[i] );
+            for (j = 0; j < n; j++)
+                mlMulBy(u[j], scale);
+            calcScale( u, n, scale, recipScale[i] );
+
+            len[i] = ML_SCALAR_ZERO;
+            for (j = 0; j < n; j++)
+                len[i] += mlSquare(mlMul(u[j], scale));
+        }
+
+        FixedSqrtBatch(len, len, m);
+        for (i = 0; i < m; i++) {
+            len[i] = mlMul(len[i], recipScale[i]);
+            recipLen[i] = (len[i] != ML_SCALAR_ZERO) ? len[i] : ML_SCALAR_ONE;
+        }
+        FixedReciprocalBatch(recipLen, recipLen, m);
+
+        for (i = 0; i < m; i++) {
+            MlScalar *u = v + (base + i) * n;
+            for (j = 0; j < n; j++) {
+                if (len[i] != ML_SCALAR_ZERO)
+                    mlMulBy(u[j], recipLen[i]);
+                else
+                    u[j] = ML_SCALAR_ZERO;
+            }
+            if (lengths != NULL)
+                lengths[base + i] = len[i];
+        }
+    }
+}
+#endif /* ML_FIXED_POINT */
+
+//////////////////////////////////////////////////////////////////////////////
 //
-// Returns true if all elements are zero
+// Quantizes an array of vectors of n components to shorts. Each component
+// is stored relative to the center of the bounding box, scaled so that the
+// box spans -QUANTIZE_RANGE to QUANTIZE_RANGE. In floating point the
+// components are multiplied by a scale on the way in and a step on the way
+// out, rounding as the SIMD kernels do. In fixed point both the scale and
+// the step are the extent, which is divided and multiplied in 64 bits.
 //
+#define QUANTIZE_RANGE 32767
+
+#if ML_FIXED_POINT
+
+static inline short
+quantizeComponent(MlScalar v, MlScalar origin, MlScalar extent)
 {
-    return (vec == zero);
+    long long e = mlScalarGetValue(extent);
+    if (e <= 0)
+        return 0;
+
+    long long d = ((long long) mlScalarGetValue(v) - mlScalarGetValue(origin)) * QUANTIZE_RANGE;
+    long long q = (d + ((d < 0) ? -e : e) / 2) / e;
+    if (q < -QUANTIZE_RANGE)
+        q = -QUANTIZE_RANGE;
+    else if (q > QUANTIZE_RANGE)
+        q = QUANTIZE_RANGE;
+    return (short) q;
 }
 
-// constructor that creates vector from intersection of three planes
-//
+static inline MlScalar
+dequantizeComponent(short q, MlScalar origin, MlScalar extent)
+{
+    long long d = (long long) q * mlScalarGetValue(extent);
+    return origin + mlScalarSetValue((long) ((d + ((d < 0) ? -QUANTIZE_RANGE : QUANTIZE_RANGE) / 2)
+                                             / QUANTIZE_RANGE));
+}
 
-MlVector3 MlVector3::cross(const MlVector3&v) const
-//
-// Returns right-handed cross product of vector and another vector
-//
+#else
+
+static inline short
+quantizeComponent(MlScalar v, MlScalar origin, MlScalar scale)
 {
-    return MlVector3(mlMul(vec[1], v.vec[2]) - mlMul(vec[2], v.vec[1]),
-                     mlMul(vec[2], v.vec[0]) - mlMul(vec[0], v.vec[2]),
-                     mlMul(vec[0], v.vec[1]) - mlMul(vec[1], v.vec[0]));
+    float s = (mlScalarToFloat(v) - mlScalarToFloat(origin)) * mlScalarToFloat(scale);
+    if (s < (float) -QUANTIZE_RANGE)
+        s = (float) -QUANTIZE_RANGE;
+    else if (s > (float) QUANTIZE_RANGE)
+        s = (float) QUANTIZE_RANGE;
+    return (short) lrintf(s);
 }
 
+static inline MlScalar
+dequantizeComponent(short q, MlScalar origin, MlScalar step)
+{
+    return mlFloatToScalar(mlScalarToFloat(origin) + (float) q * mlScalarToFloat(step));
+}
+
+#endif /* ML_FIXED_POINT */
+
+static void
+quantizeArray(const MlScalar *v, int n, short *q,
+              MlScalar *origin, MlScalar *extent, int count)
+{
+    MlScalar lo[3], hi[3], scale[3];
+    int i, j;
 
-MlScalar MlVector3::dot(const MlVector3&v) const
+    if (count <= 0) {
+        for (j = 0; j < n; j++)
+            origin[j] = extent[j] = ML_SCALAR_ZERO;
+        return;
+    }
+
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL)
+        k->bounds(v, lo, hi, count, n);
+    else
+#endif
+    {
+        for (j = 0; j < n; j++)
+            lo[j] = hi[j] = v[j];
+        for (i = 1; i < count; i++) {
+            for (j = 0; j < n; j++) {
+                MlScalar c = v[i * n + j];
+                if (c < lo[j])
+                    lo[j] = c;
+                if (c > hi[j])
+                    hi[j] = c;
+            }
+        }
+    }
+
+    for (j = 0; j < n; j++) {
+        extent[j] = mlMul(hi[j] - lo[j], ML_SCALAR_HALF);
+        origin[j] = lo[j] + extent[j];
+#if ML_FIXED_POINT
+        scale[j] = extent[j];
+#else
+        scale[j] = (extent[j] > ML_SCALAR_ZERO)
+                   ? mlFloatToScalar((float) QUANTIZE_RANGE / mlScalarToFloat(extent[j]))
+                   : ML_SCALAR_ZERO;
+#endif
+    }
+
+#if ML_VECTOR_SIMD
+    if (k != NULL) {
+        k->quantize(v, q, origin, scale, count, n);
+        return;
+    }
+#endif
+    for (i = 0; i < count; i++) {
+        for (j = 0; j < n; j++)
+            q[i * n + j] = quantizeComponent(v[i * n + j], origin[j], scale[j]);
+    }
+}
+
+static void
+dequantizeArray(const short *q, int n, const MlScalar *origin,
+                const MlScalar *extent, MlScalar *v, int count)
+{
+    MlScalar step[3];
+    int i, j;
+
+    for (j = 0; j < n; j++) {
+#if ML_FIXED_POINT
+        step[j] = extent[j];
+#else
+        step[j] = mlFloatToScalar(mlScalarToFloat(extent[j]) / (float) QUANTIZE_RANGE);
+#endif
+    }
+
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->dequantize(q, origin, step, v, count, n);
+        return;
+    }
+#endif
+    for (i = 0; i < count; i++) {
+        for (j = 0; j < n; j++)
+            v[i * n + j] = dequantizeComponent(q[i * n + j], origin[j], step[j]);
+    }
+}
+
+// The arrays of vectors are handled as arrays of their components.
+static_assert(sizeof(MlVector3s) == 3 * sizeof(short), "MlVector3s must hold 3 shorts");
+static_assert(sizeof(MlVector2s) == 2 * sizeof(short), "MlVector2s must hold 2 shorts");
+
+//////////////////////////////////////////////////////////////////////////////
 //
-// Returns dot (inner) product of vector and another vector
+// Vec3f class
+//
+//////////////////////////////////////////////////////////////////////////////
+
+
+const MlVector3 MlVector3::zero (ML_SCALAR_ZERO,ML_SCALAR_ZERO,ML_SCALAR_ZERO);
+
+
+int MlVector3::isZero(void) const
+//
+// Returns true if all elements are zero
 //
 {
-    return (mlMul(vec[0], v.vec[0]) +
-            mlMul(vec[1], v.vec[1]) +
-            mlMul(vec[2], v.vec[2]));
+    return (vec == zero);
 }
 
+// constructor that creates vector from intersection of three planes
+//
 
 void MlVector3::getValue(MlScalar&x, MlScalar&y, MlScalar&z) const
 //
@@ -357,59 +546,6 @@ MlVector3& MlVector3::operator -=(MlVector3 v)
 }
 
 
-MlVector3 MlVector3::operator -() const
-//
-// Nondestructive unary negation - returns a new vector
-//
-{
-    return MlVector3(-vec[0], -vec[1], -vec[2]);
-}
-
-
-MlVector3 operator *(const MlVector3&v, MlScalar d)
-//
-// Component-wise binary scalar multiplication operator
-//
-{
-    return MlVector3(mlMul(v.vec[0], d),
-                     mlMul(v.vec[1], d),
-                     mlMul(v.vec[2], d));
-}
-
-
-MlVector3 operator +(const MlVector3&v1, const MlVector3&v2)
-//
-// Component-wise binary vector addition operator
-//
-{
-    return MlVector3(v1.vec[0] + v2.vec[0],
-                     v1.vec[1] + v2.vec[1],
-                     v1.vec[2] + v2.vec[2]);
-}
-
-
-MlVector3 operator -(const MlVector3&v1, const MlVector3&v2)
-//
-// Component-wise binary vector subtraction operator
-//
-{
-    return MlVector3(v1.vec[0] - v2.vec[0],
-                     v1.vec[1] - v2.vec[1],
-                     v1.vec[2] - v2.vec[2]);
-}
-
-
-int operator ==(const MlVector3&v1, const MlVector3&v2)
-//
-// Equality comparison operator. Componenents must match exactly.
-//
-{
-    return (v1.vec[0] == v2.vec[0]&&
-            v1.vec[1] == v2.vec[1]&&
-            v1.vec[2] == v2.vec[2]);
-}
-
-
 int MlVector3::equals(const MlVector3 v, MlScalar tolerance) const
 //
 // Equality comparison operator within a tolerance.
@@ -461,8 +597,163 @@ MlVector3 MlVector3::getClosestAxis() const
     return bestAxis;
 }
 
+//
+// Batch operations on arrays of vectors. When the host processor supports
+// it, these are carried out by the SIMD kernels selected in vecsimd.cxx.
+//
+
+void MlVector3::addBatch(const MlVector3 *a, const MlVector3 *b,
+                         MlVector3 *result, int count)
+//
+// Adds corresponding vectors of two arrays
+//
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->add((const MlScalar *) a, (const MlScalar *) b, (MlScalar *) result, 3 * count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        result[i] = a[i] + b[i];
+}
+
+
+void MlVector3::subtractBatch(const MlVector3 *a, const MlVector3 *b,
+                              MlVector3 *result, int count)
+//
+// Subtracts corresponding vectors of two arrays
+//
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->subtract((const MlScalar *) a, (const MlScalar *) b, (MlScalar *) result, 3 * count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        result[i] = a[i] - b[i];
+}
+
+
+void MlVector3::scaleBatch(const MlVector3 *v, MlScalar d,
+                           MlVector3 *result, int count)
+//
+// Multiplies each vector of an array by a scalar
+//
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->scale((const MlScalar *) v, d, (MlScalar *) result, 3 * count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        result[i] = v[i] * d;
+}
+
+
+void MlVector3::dotBatch(const MlVector3 *a, const MlVector3 *b,
+                         MlScalar *result, int count)
+//
+// Returns dot products of corresponding vectors of two arrays
+//
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->dot3((const MlScalar *) a, (const MlScalar *) b, result, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        result[i] = a[i].dot(b[i]);
+}
+
+
+void MlVector3::crossBatch(const MlVector3 *a, const MlVector3 *b,
+                           MlVector3 *result, int count)
+//
+// Returns right-handed cross products of corresponding vectors of two arrays
+//
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->cross3((const MlScalar *) a, (const MlScalar *) b, (MlScalar *) result, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        result[i] = a[i].cross(b[i]);
+}
+
+
+void MlVector3::lengthBatch(const MlVector3 *v, MlScalar *result, int count)
+//
+// Returns geometric lengths of an array of vectors
+//
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->length3((const MlScalar *) v, result, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        result[i] = v[i].length();
+}
+
+
+void MlVector3::normalizeBatch(MlVector3 *v, MlScalar *lengths, int count)
+//
+// Changes an array of vectors to be unit length, optionally returning
+// the original lengths
+//
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->normalize3((MlScalar *) v, lengths, count);
+        return;
+    }
+#endif
+#if ML_FIXED_POINT
+    normalizeBatchFixed((MlScalar *) v, 3, lengths, count);
+#else
+    for (int i = 0; i < count; i++) {
+        MlScalar len = v[i].normalize();
+        if (lengths != NULL)
+            lengths[i] = len;
+    }
+#endif
+}
+
+
+void MlVector3::quantizeBatch(const MlVector3 *v, MlVector3s *q,
+                              MlVector3 &origin, MlVector3 &extent, int count)
+//
+// Quantizes an array of vectors to shorts, relative to their bounding box
+//
+{
+    quantizeArray((const MlScalar *) v, 3, (short *) q, origin.vec, extent.vec, count);
+}
+
+
+void MlVector3::dequantizeBatch(const MlVector3s *q, const MlVector3 &origin,
+                                const MlVector3 &extent, MlVector3 *v, int count)
+//
+// Decodes an array of vectors quantized by quantizeBatch()
+//
+{
+    dequantizeArray((const short *) q, 3, origin.vec, extent.vec, (MlScalar *) v, count);
+}
+
 
-#if 0
 //////////////////////////////////////////////////////////////////////////////
 //
 // Vec2s class
@@ -536,6 +827,7 @@ MlVector2s& MlVector2s::operator *=(int d)
 }
 
 
+#if 0
 MlVector2s& MlVector2s::operator *=(MlScalar d)
 {
     vec[0] = short(mlScalarToLong(vec[0] * d));
@@ -543,6 +835,7 @@ MlVector2s& MlVector2s::operator *=(MlScalar d)
 
     return *this;
 }
+#endif /* 0 */
 
 
 MlVector2s& MlVector2s::operator /=(int d)
@@ -599,10 +892,12 @@ MlVector2s operator *(const MlVector2s&v, int d)
 }
 
 
+#if 0
 MlVector2s operator *(const MlVector2s&v, MlScalar d)
 {
     return MlVector2s(short(mlScalarToLong(v.vec[0] * d)), short(mlScalarToLong(v.vec[1] * d)));
 }
+#endif /* 0 */
 
 
 MlVector2s operator /(const MlVector2s&v, int d)
@@ -644,7 +939,6 @@ int operator ==(const MlVector2s&v1, const MlVector2s&v2)
     return (v1.vec[0] == v2.vec[0]&&
             v1.vec[1] == v2.vec[1]);
 }
-#endif
 
 //////////////////////////////////////////////////////////////////////////////
 //
@@ -664,15 +958,6 @@ int MlVector2::isZero(void) const
     return (vec == zero);
 }
 
-MlScalar MlVector2::dot(const MlVector2&v) const
-//
-// Returns dot (inner) product of vector and another vector
-//
-{
-    return mlMul(vec[0], v.vec[0]) + mlMul(vec[1], v.vec[1]);
-}
-
-
 void MlVector2::getValue(MlScalar &x, MlScalar &y) const
 //
 // Returns 2 individual components
@@ -817,62 +1102,34 @@ MlVector2& MlVector2::operator -=(const MlVector2&u)
 }
 
 
-MlVector2 MlVector2::operator -() const
-//
-// Nondestructive unary negation - returns a new vector
-//
-{
-    return MlVector2(-vec[0], -vec[1]);
-}
-
-
-MlVector2 operator *(const MlVector2&v, MlScalar d)
-//
-// Component-wise binary scalar multiplication operator
-//
-{
-    return MlVector2(mlMul(v.vec[0], d), mlMul(v.vec[1], d));
-}
-
-
-MlVector2 operator +(const MlVector2&v1, const MlVector2&v2)
+int MlVector2::equals(const MlVector2 v, MlScalar tolerance) const
 //
-// Component-wise binary vector addition operator
+// Equality comparison operator within a tolerance.
 //
 {
-    return MlVector2(v1.vec[0] + v2.vec[0],
-                     v1.vec[1] + v2.vec[1]);
-}
-
+    MlVector2    diff = *this - v;
 
-MlVector2 operator -(const MlVector2&v1, const MlVector2&v2)
-//
-// Component-wise binary vector subtraction operator
-//
-{
-    return MlVector2(v1.vec[0] - v2.vec[0],
-                     v1.vec[1] - v2.vec[1]);
+    return diff.dot(diff) <= tolerance;
 }
 
 
-int operator ==(const MlVector2&v1, const MlVector2&v2)
+void MlVector2::quantizeBatch(const MlVector2 *v, MlVector2s *q,
+                              MlVector2 &origin, MlVector2 &extent, int count)
 //
-// Equality comparison operator. Componenents must match exactly.
+// Quantizes an array of vectors to shorts, relative to their bounding box
 //
 {
-    return (v1.vec[0] == v2.vec[0]&&
-            v1.vec[1] == v2.vec[1]);
+    quantizeArray((const MlScalar *) v, 2, (short *) q, origin.vec, extent.vec, count);
 }
 
 
-int MlVector2::equals(const MlVector2 v, MlScalar tolerance) const
+void MlVector2::dequantizeBatch(const MlVector2s *q, const MlVector2 &origin,
+                                const MlVector2 &extent, MlVector2 *v, int count)
 //
-// Equality comparison operator within a tolerance.
+// Decodes an array of vectors quantized by quantizeBatch()
 //
 {
-    MlVector2    diff = *this - v;
-
-    return diff.dot(diff) <= tolerance;
+    dequantizeArray((const short *) q, 2, origin.vec, extent.vec, (MlScalar *) v, count);
 }
 
 
@@ -896,16 +1153,6 @@ int MlVector4::isZero(void) const
     return ((MlVector4)vec == zero);
 }
 
-MlScalar MlVector4::dot(const MlVector4&v) const
-//
-// Returns dot (inner) product of vector and another vector
-//
-{
-    return mlMul(vec[0], v.vec[0]) + mlMul(vec[1], v.vec[1]) + 
-           mlMul(vec[2], v.vec[2]) + mlMul(vec[3], v.vec[3]) ;
-}
-
-
 void MlVector4::getValue(MlScalar&x, MlScalar&y, MlScalar&z, MlScalar&w) const
 //
 // Returns 4 individual components
@@ -1081,75 +1328,135 @@ MlVector4& MlVector4::operator -=(const MlVector4&u)
 }
 
 
-MlVector4 MlVector4::operator -() const
+int MlVector4::equals(const MlVector4 v, MlScalar tolerance) const
 //
-// Nondestructive unary negation - returns a new vector
+// Equality comparison operator within a tolerance.
 //
 {
-    return MlVector4(-vec[0], -vec[1], -vec[2], -vec[3]);
+    MlVector4 diff = *this - v;
+
+    return diff.dot(diff) <= tolerance;
 }
 
+//
+// Batch operations on arrays of vectors. When the host processor supports
+// it, these are carried out by the SIMD kernels selected in vecsimd.cxx.
+//
 
-MlVector4 operator *(const MlVector4&v, MlScalar d)
+void MlVector4::addBatch(const MlVector4 *a, const MlVector4 *b,
+                         MlVector4 *result, int count)
 //
-// Component-wise binary scalar multiplication operator
+// Adds corresponding vectors of two arrays
 //
 {
-    return MlVector4(mlMul(v.vec[0], d),
-                     mlMul(v.vec[1], d),
-                     mlMul(v.vec[2], d),
-                     mlMul(v.vec[3], d));
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->add((const MlScalar *) a, (const MlScalar *) b, (MlScalar *) result, 4 * count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        result[i] = a[i] + b[i];
 }
 
 
-MlVector4 operator +(const MlVector4&v1, const MlVector4&v2)
+void MlVector4::subtractBatch(const MlVector4 *a, const MlVector4 *b,
+                              MlVector4 *result, int count)
 //
-// Component-wise binary vector addition operator
+// Subtracts corresponding vectors of two arrays
 //
 {
-    return MlVector4(v1.vec[0] + v2.vec[0],
-                     v1.vec[1] + v2.vec[1],
-                     v1.vec[2] + v2.vec[2],
-                     v1.vec[3] + v2.vec[3]);
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->subtract((const MlScalar *) a, (const MlScalar *) b, (MlScalar *) result, 4 * count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        result[i] = a[i] - b[i];
 }
 
 
-MlVector4 operator -(const MlVector4&v1, const MlVector4&v2)
+void MlVector4::scaleBatch(const MlVector4 *v, MlScalar d,
+                           MlVector4 *result, int count)
 //
-// Component-wise binary vector subtraction operator
+// Multiplies each vector of an array by a scalar
 //
 {
-    return MlVector4(v1.vec[0] - v2.vec[0],
-                     v1.vec[1] - v2.vec[1],
-                     v1.vec[2] - v2.vec[2],
-                     v1.vec[3] - v2.vec[3]);
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->scale((const MlScalar *) v, d, (MlScalar *) result, 4 * count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        result[i] = v[i] * d;
 }
 
 
-int operator ==(const MlVector4&v1, const MlVector4&v2)
+void MlVector4::dotBatch(const MlVector4 *a, const MlVector4 *b,
+                         MlScalar *result, int count)
 //
-// Equality comparison operator. Componenents must match exactly.
+// Returns dot products of corresponding vectors of two arrays
 //
 {
-    return (v1.vec[0] == v2.vec[0]&&
-            v1.vec[1] == v2.vec[1]&&
-            v1.vec[2] == v2.vec[2]&&
-            v1.vec[3] == v2.vec[3]);
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->dot4((const MlScalar *) a, (const MlScalar *) b, result, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        result[i] = a[i].dot(b[i]);
 }
 
 
-int MlVector4::equals(const MlVector4 v, MlScalar tolerance) const
+void MlVector4::lengthBatch(const MlVector4 *v, MlScalar *result, int count)
 //
-// Equality comparison operator within a tolerance.
+// Returns geometric lengths of an array of vectors
 //
 {
-    MlVector4 diff = *this - v;
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->length4((const MlScalar *) v, result, count);
+        return;
+    }
+#endif
+    for (int i = 0; i < count; i++)
+        result[i] = v[i].length();
+}
 
-    return diff.dot(diff) <= tolerance;
+
+void MlVector4::normalizeBatch(MlVector4 *v, MlScalar *lengths, int count)
+//
+// Changes an array of vectors to be unit length, optionally returning
+// the original lengths
+//
+{
+#if ML_VECTOR_SIMD
+    const MlVectorKernels *k = mlVectorKernels();
+    if (k != NULL) {
+        k->normalize4((MlScalar *) v, lengths, count);
+        return;
+    }
+#endif
+#if ML_FIXED_POINT
+    normalizeBatchFixed((MlScalar *) v, 4, lengths, count);
+#else
+    for (int i = 0; i < count; i++) {
+        MlScalar len = v[i].normalize();
+        if (lengths != NULL)
+            lengths[i] = len;
+    }
+#endif
 }
 
 
-#if 0
 //////////////////////////////////////////////////////////////////////////////
 //
 // Vec3s class
@@ -1192,6 +1499,7 @@ void MlVector3s::getValue(short&x, short&y, short&z) const
 }
 
 
+#if 0
 MlScalar MlVector3s::length() const
 //
 // Returns geometric length of vector
@@ -1199,6 +1507,7 @@ MlScalar MlVector3s::length() const
 {
     return mlSqrt(mlLongToScalar(vec[0] * vec[0] + vec[1] * vec[1] + vec[2] * vec[2]));
 }
+#endif /* 0 */
 
 
 void MlVector3s::negate()
@@ -1212,6 +1521,7 @@ void MlVector3s::negate()
 }
 
 
+#if 0
 int MlVector3s::normalize()
 //
 // Changes vector to be unit length
@@ -1234,6 +1544,7 @@ MlVector3s& MlVector3s::setValue(const MlVector3s&barycentric,
     *this = v0 * barycentric[0] + v1 * barycentric[1] + v2 * barycentric[2];
     return (*this);
 }
+#endif /* 0 */
     
 
 MlVector3s& MlVector3s::operator *=(short d)
@@ -1378,5 +1689,3 @@ MlVector3s MlVector3s::getClosestAxis() const
 
     return bestAxis;
 }
-
-#endif
@@ -0,0 +1,379 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Accuracy-versus-throughput characterization of the library's
+// approximations.
+//
+// Each function is swept over its input domain and compared against a
+// double-precision reference. One CSV row is written to stdout per
+// function with the maximum and mean absolute error, the maximum and mean
+// error in units in the last place, the maximum relative error and the
+// measured throughput.
+//
+// The same source is built for each scalar representation by the CMake
+// targets mlmathAccuracy (floating-point), mlmathAccuracyFixed16 (16.16)
+// and mlmathAccuracyFixed12 (20.12). In fixed-point mode the functions
+// measured are FixedSin(), FixedCos(), FixedSqrt(), FixedReciprocal(),
+// FixedRecipSqrt(), FixedAtan2(), FixedAsin() and FixedAcos(), through
+// their ml* wrappers, and one ULP is one LSB of the fixed-point format;
+// the lut_bits column gives the size of the table each function uses, so
+// builds with different ML_FIXED_*_LUT_BITS can be compared. In
+// floating-point mode one ULP is the spacing of floats at the reference
+// value.
+//
+// Angles are in the library's units of turns. Errors of the angle
+// functions are taken modulo one turn.
+
+// Include system header files.
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <vector>
+
+// Include Magic Lantern header files.
+#include "math/scalar.h"
+#include "math/atan.h"
+#include "math/asine.h"
+#include "math/vector.h"
+#include "math/sine.h"
+
+#if ML_FIXED_POINT
+// The table sizes.
+#include "math/fixedlut.h"
+#endif
+
+
+// The minimum time spent measuring the throughput of each function.
+#define MIN_SECONDS 0.2
+
+#define TWO_PI 6.28318530717958647692
+
+
+// The inputs of one sweep: one, two or three operands per sample.
+struct Samples
+{
+    std::vector<MlScalar> a, b, c;
+
+    int size() const { return (int) a.size(); }
+
+    void add(MlScalar x, MlScalar y = ML_SCALAR_ZERO, MlScalar z = ML_SCALAR_ZERO)
+    {
+        a.push_back(x);
+        b.push_back(y);
+        c.push_back(z);
+    }
+};
+
+
+// Exact conversions between scalars and doubles.
+static double
+toDouble(MlScalar x)
+{
+#if ML_FIXED_POINT
+    return (double) mlScalarGetValue(x) / ML_FIXED_SCALE_I;
+#else
+    return (double) x;
+#endif
+}
+
+static MlScalar
+fromDouble(double x)
+{
+#if ML_FIXED_POINT
+    return mlScalarSetValue((long) floor(x * ML_FIXED_SCALE_I + 0.5));
+#else
+    return (MlScalar) x;
+#endif
+}
+
+// The largest value a scalar can hold.
+static double
+maxScalar()
+{
+#if ML_FIXED_POINT
+    return (double) 0x7fffffff / ML_FIXED_SCALE_I;
+#else
+    return FLT_MAX;
+#endif
+}
+
+// One unit in the last place at the given value.
+static double
+ulp(double ref)
+{
+#if ML_FIXED_POINT
+    (void) ref;
+    return 1.0 / ML_FIXED_SCALE_I;
+#else
+    double a = fabs(ref);
+    if (a < FLT_MIN)
+        a = FLT_MIN;
+    return ldexp(1.0, ilogb(a) - (FLT_MANT_DIG - 1));
+#endif
+}
+
+
+// sin and cos of an angle in turns. The angle is first reduced exactly to
+// the nearest quarter turn, so that the zeros fall where they should.
+static double
+refSin(double turns)
+{
+    double q = floor(4.0 * turns + 0.5);
+    double r = TWO_PI * (turns - 0.25 * q);
+    switch ((long) q & 3) {
+      case 0: return sin(r);
+      case 1: return cos(r);
+      case 2: return -sin(r);
+      default: return -cos(r);
+    }
+}
+
+static double
+refCos(double turns)
+{
+    return refSin(turns + 0.25);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//  Input domains
+//////////////////////////////////////////////////////////////////////////
+
+// Every representable value in [lo, hi] in fixed-point; n + 1 evenly
+// spaced values in floating-point.
+static void
+sweepLinear(Samples &s, double lo, double hi, int n)
+{
+#if ML_FIXED_POINT
+    (void) n;
+    long last = mlScalarGetValue(fromDouble(hi));
+    for (long v = mlScalarGetValue(fromDouble(lo)); v <= last; v++)
+        s.add(mlScalarSetValue(v));
+#else
+    for (int i = 0; i <= n; i++)
+        s.add(fromDouble(lo + (hi - lo) * i / n));
+#endif
+}
+
+// Positive values over the whole range, with the same density in every
+// octave: 2^10 samples per octave.
+#if ML_FIXED_POINT
+#define POSITIVE_DOMAIN "(0..max]"
+#define NONZERO_DOMAIN "[-max..0)|(0..max]"
+#else
+#define POSITIVE_DOMAIN "[2^-20..2^20)"
+#define NONZERO_DOMAIN "(-2^20..-2^-20]|[2^-20..2^20)"
+#endif
+
+static void
+sweepPositive(Samples &s, int sign = 1)
+{
+#if ML_FIXED_POINT
+    for (long v = 1; v <= 0x7fffffff && v > 0; v += 1 + (v >> 10))
+        s.add(mlScalarSetValue(sign * v));
+#else
+    for (double x = 1.0 / (1 << 20); x < (double) (1 << 20); x *= 1.0 + 1.0 / 1024)
+        s.add(fromDouble(sign * x));
+#endif
+}
+
+// Points on circles about the origin, 4096 per circle, with radii
+// doubling from 1/64 to 4096.
+static void
+sweepCircles(Samples &s)
+{
+    for (double r = 1.0 / 64; r <= 4096.0; r *= 2.0)
+        for (int i = 0; i < 4096; i++) {
+            double t = TWO_PI * i / 4096;
+            s.add(fromDouble(r * sin(t)), fromDouble(r * cos(t)));
+        }
+}
+
+// Random vectors with components in [-range, range].
+static void
+sweepVectors(Samples &s, double range, int n)
+{
+    srand(1);
+    for (int i = 0; i < n; i++)
+        s.add(fromDouble(range * (2.0 * rand() / RAND_MAX - 1.0)),
+              fromDouble(range * (2.0 * rand() / RAND_MAX - 1.0)),
+              fromDouble(range * (2.0 * rand() / RAND_MAX - 1.0)));
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//  Measurement
+//////////////////////////////////////////////////////////////////////////
+
+static void
+printHeader()
+{
+    printf("mode,function,domain,lut_bits,samples,"
+           "max_abs_err,mean_abs_err,max_ulp,mean_ulp,max_rel_err,"
+           "ns_per_call,mcalls_per_sec\n");
+}
+
+// Sweeps op over the samples, compares it with ref and times it.
+// op(s, i) and ref(s, i) compute the function of sample i. If angle is
+// set, errors are taken modulo one turn.
+template <class Op, class Ref>
+static void
+characterize(const char *function, const char *domain, int lutBits,
+             const Samples &s, int angle, Op op, Ref ref)
+{
+    int n = s.size();
+    std::vector<MlScalar> out(n);
+    int i;
+
+    // Accuracy. Samples whose true result does not fit in a scalar
+    // are skipped. In floating-point mode, samples whose true result is
+    // zero have no ULP, and are left out of the ULP figures.
+    double maxAbs = 0.0, sumAbs = 0.0;
+    double maxUlp = 0.0, sumUlp = 0.0;
+    double maxRel = 0.0;
+    int counted = 0, ulpCounted = 0;
+    for (i = 0; i < n; i++) {
+        double r = ref(s, i);
+        if (fabs(r) >= maxScalar())
+            continue;
+        double e = toDouble(op(s, i)) - r;
+        if (angle)
+            e = remainder(e, 1.0);
+        e = fabs(e);
+        maxAbs = (e > maxAbs) ? e : maxAbs;
+        sumAbs += e;
+        counted++;
+        if (r != 0.0 && e / fabs(r) > maxRel)
+            maxRel = e / fabs(r);
+#if ! ML_FIXED_POINT
+        if (r == 0.0)
+            continue;
+#endif
+        double u = e / ulp(r);
+        maxUlp = (u > maxUlp) ? u : maxUlp;
+        sumUlp += u;
+        ulpCounted++;
+    }
+
+    // Throughput, over as many passes as fill MIN_SECONDS.
+    typedef std::chrono::steady_clock Clock;
+    long calls = 0;
+    double seconds = 0.0;
+    Clock::time_point start = Clock::now();
+    do {
+        for (i = 0; i < n; i++)
+            out[i] = op(s, i);
+        calls += n;
+        seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (seconds < MIN_SECONDS);
+    volatile double sink = toDouble(out[n / 2]);
+    (void) sink;
+
+#if ML_FIXED_POINT
+    printf("fixed%d.%d,", 32 - ML_FIXED_RADIX, ML_FIXED_RADIX);
+#else
+    printf("float,");
+#endif
+    if (lutBits > 0)
+        printf("%s,%s,%d,", function, domain, lutBits);
+    else
+        printf("%s,%s,,", function, domain);
+    printf("%d,%.9g,%.9g,%.4f,%.4f,%.9g,%.3f,%.3f\n",
+           counted, maxAbs, counted ? sumAbs / counted : 0.0,
+           maxUlp, ulpCounted ? sumUlp / ulpCounted : 0.0, maxRel,
+           1.0e9 * seconds / calls, 1.0e-6 * calls / seconds);
+}
+
+
+#if ML_FIXED_POINT
+#define LUT_BITS(name) ML_FIXED_##name##_LUT_BITS
+#else
+#define LUT_BITS(name) 0
+#endif
+
+int
+main()
+{
+    Samples turns, unit, positive, negative, circles, vectors;
+    sweepLinear(turns, 0.0, 1.0, 1 << 20);
+    sweepLinear(unit, -1.0, 1.0, 1 << 20);
+    sweepPositive(positive);
+    sweepPositive(negative, -1);
+    sweepCircles(circles);
+    sweepVectors(vectors, 100.0, 1 << 16);
+
+    // The reciprocal takes both signs.
+    Samples nonzero = negative;
+    for (int i = 0; i < positive.size(); i++)
+        nonzero.add(positive.a[i]);
+
+    printHeader();
+
+    characterize("mlSin", "[0..1] turn", LUT_BITS(SINE), turns, FALSE,
+        [](const Samples &s, int i) { return mlSin(s.a[i]); },
+        [](const Samples &s, int i) { return refSin(toDouble(s.a[i])); });
+    characterize("mlCos", "[0..1] turn", LUT_BITS(SINE), turns, FALSE,
+        [](const Samples &s, int i) { return mlCos(s.a[i]); },
+        [](const Samples &s, int i) { return refCos(toDouble(s.a[i])); });
+    characterize("mlSqrt", POSITIVE_DOMAIN, LUT_BITS(SQRT), positive, FALSE,
+        [](const Samples &s, int i) { return mlSqrt(s.a[i]); },
+        [](const Samples &s, int i) { return sqrt(toDouble(s.a[i])); });
+    characterize("mlReciprocal", NONZERO_DOMAIN, LUT_BITS(RECIP), nonzero, FALSE,
+        [](const Samples &s, int i) { return mlReciprocal(s.a[i]); },
+        [](const Samples &s, int i) { return 1.0 / toDouble(s.a[i]); });
+    characterize("mlRecipSqrt", POSITIVE_DOMAIN, LUT_BITS(RSQRT), positive, FALSE,
+        [](const Samples &s, int i) { return mlRecipSqrt(s.a[i]); },
+        [](const Samples &s, int i) { return 1.0 / sqrt(toDouble(s.a[i])); });
+    characterize("mlAtan2", "circles r=[1/64..4096]", LUT_BITS(ATAN), circles, TRUE,
+        [](const Samples &s, int i) { return mlAtan2(s.a[i], s.b[i]); },
+        [](const Samples &s, int i)
+        { return atan2(toDouble(s.a[i]), toDouble(s.b[i])) / TWO_PI; });
+    characterize("mlAsin", "[-1..1]", LUT_BITS(ASIN), unit, TRUE,
+        [](const Samples &s, int i) { return mlAsin(s.a[i]); },
+        [](const Samples &s, int i) { return asin(toDouble(s.a[i])) / TWO_PI; });
+    characterize("mlAcos", "[-1..1]", LUT_BITS(ASIN), unit, TRUE,
+        [](const Samples &s, int i) { return mlAcos(s.a[i]); },
+        [](const Samples &s, int i) { return acos(toDouble(s.a[i])) / TWO_PI; });
+    characterize("MlVector3::approximateLength", "[-100..100]^3", 0, vectors, FALSE,
+        [](const Samples &s, int i)
+        { return MlVector3(s.a[i], s.b[i], s.c[i]).approximateLength(); },
+        [](const Samples &s, int i)
+        {
+            double x = toDouble(s.a[i]), y = toDouble(s.b[i]), z = toDouble(s.c[i]);
+            return sqrt(x*x + y*y + z*z);
+        });
+
+    return 0;
+}
@@ -0,0 +1,1037 @@
+// COPYRIGHT_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this source file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Microbenchmarks for the public Magic Lantern math API.
+//
+// The same source is built for each scalar representation by the CMake
+// targets mlmathBench (floating-point), mlmathBenchFixed16 (16.16
+// fixed-point) and mlmathBenchFixed12 (20.12 fixed-point), so that the
+// numbers can be compared between modes on the same host. Inputs are drawn
+// from small pools of pseudo-random values that stay within the range of
+// every representation; each iteration takes the next element of the pool
+// so the compiler cannot fold the operation away.
+
+// Include system header files.
+#include <stdio.h>
+
+// Include Google Benchmark header files.
+#include "benchmark/benchmark.h"
+
+// Include Magic Lantern header files.
+#include "math/scalar.h"
+#include "math/angle.h"
+#include "math/atan.h"
+#include "math/asine.h"
+#include "math/sine.h"
+#include "math/vector.h"
+#include "math/rotation.h"
+#include "math/dualquat.h"
+#include "math/rotspline.h"
+#include "math/skin.h"
+#include "math/track.h"
+#include "math/transfrm.h"
+#include "math/matrix4.h"
+#include "math/frustum.h"
+#include "math/bounds.h"
+#include "math/bvh.h"
+#include "math/vectort.h"
+#include "math/transfrmt.h"
+#include "math/rebase.h"
+
+
+// The size of each input pool; a power of two.
+#define POOL_SIZE 1024
+#define POOL_MASK (POOL_SIZE - 1)
+
+// The element count of the batch benchmarks.
+#define BATCH_COUNT 1024
+
+
+// A deterministic generator, so that every mode sees the same inputs.
+static float
+nextFloat(unsigned int &seed, float lo, float hi)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return lo + (hi - lo) * (float) (seed >> 8) / (float) (1u << 24);
+}
+
+static void
+fillScalars(MlScalar *x, int count, float lo, float hi, unsigned int seed)
+{
+    for (int i = 0; i < count; i++)
+        x[i] = mlFloatToScalar(nextFloat(seed, lo, hi));
+}
+
+// A pool of scalars in [lo, hi).
+struct ScalarPool
+{
+    MlScalar x[POOL_SIZE];
+
+    ScalarPool(float lo, float hi, unsigned int seed)
+    { fillScalars(x, POOL_SIZE, lo, hi, seed); }
+};
+
+// A pool of vectors with components in [-range, range).
+template <class V, int N>
+struct VectorPool
+{
+    V v[POOL_SIZE];
+
+    VectorPool(float range, unsigned int seed)
+    {
+        for (int i = 0; i < POOL_SIZE; i++)
+            for (int j = 0; j < N; j++)
+                v[i][j] = mlFloatToScalar(nextFloat(seed, -range, range));
+    }
+};
+
+typedef VectorPool<MlVector2, 2> Vector2Pool;
+typedef VectorPool<MlVector3, 3> Vector3Pool;
+typedef VectorPool<MlVector4, 4> Vector4Pool;
+
+// A pool of unit rotations about random axes.
+struct RotationPool
+{
+    MlRotation q[POOL_SIZE];
+
+    RotationPool(unsigned int seed)
+    {
+        for (int i = 0; i < POOL_SIZE; i++) {
+            MlVector3 axis(mlFloatToScalar(nextFloat(seed, -1.0f, 1.0f)),
+                           mlFloatToScalar(nextFloat(seed, -1.0f, 1.0f)),
+                           mlFloatToScalar(nextFloat(seed, 0.1f, 1.0f)));
+            axis.normalize();
+            q[i].setValue(axis, mlFloatToScalar(nextFloat(seed, -3.0f, 3.0f)));
+        }
+    }
+};
+
+// A pool of rotations in the 32 and 48 bit smallest three encodings.
+struct PackedRotationPool
+{
+    unsigned int p32[POOL_SIZE];
+    unsigned short p48[3 * POOL_SIZE];
+
+    PackedRotationPool(const RotationPool &rot)
+    {
+        for (int i = 0; i < POOL_SIZE; i++) {
+            p32[i] = rot.q[i].pack32();
+            rot.q[i].pack48(p48 + 3*i);
+        }
+    }
+};
+
+// A pool of rotation splines, each through SPLINE_KEYS random keys.
+#define SPLINE_KEYS 8
+
+struct SplinePool
+{
+    MlRotationSpline s[POOL_SIZE];
+
+    SplinePool(unsigned int seed)
+    {
+        RotationPool rotations(seed);
+        MlRotation keys[SPLINE_KEYS];
+        for (int i = 0; i < POOL_SIZE; i++) {
+            for (int j = 0; j < SPLINE_KEYS; j++)
+                keys[j] = rotations.q[(i + j) & POOL_MASK];
+            s[i].setValue(keys, SPLINE_KEYS);
+        }
+    }
+};
+
+// A pool of animation tracks, each with TRACK_KEYS keys spaced a tenth of
+// a second apart, and the playback time that the track benchmarks advance
+// by one frame per pass over the pool.
+#define TRACK_KEYS 32
+
+struct TrackPool
+{
+    MlVector3Track v[POOL_SIZE];
+    MlRotationTrack q[POOL_SIZE];
+
+    TrackPool(unsigned int seed)
+    {
+        MlScalar times[TRACK_KEYS];
+        MlVector3 vkeys[TRACK_KEYS];
+        MlRotation qkeys[TRACK_KEYS];
+        Vector3Pool vectors(10.0f, seed);
+        RotationPool rotations(seed);
+        for (int j = 0; j < TRACK_KEYS; j++)
+            times[j] = mlFloatToScalar(0.1f * j);
+        for (int i = 0; i < POOL_SIZE; i++) {
+            for (int j = 0; j < TRACK_KEYS; j++) {
+                vkeys[j] = vectors.v[(i + j) & POOL_MASK];
+                qkeys[j] = rotations.q[(i + j) & POOL_MASK];
+            }
+            v[i].setValue(times, vkeys, TRACK_KEYS);
+            q[i].setValue(times, qkeys, TRACK_KEYS);
+        }
+    }
+};
+
+static MlScalar playTime = ML_SCALAR_ZERO;
+
+static MlScalar
+nextFrame()
+{
+    playTime += mlFloatToScalar(1.0f / 60.0f);
+    if (playTime > mlFloatToScalar(0.1f * TRACK_KEYS))
+        playTime = ML_SCALAR_ZERO;
+    return playTime;
+}
+
+// A pool of affine transforms built from a translation, a rotation
+// and a positive scale.
+struct TransformPool
+{
+    MlTransform m[POOL_SIZE];
+
+    TransformPool(unsigned int seed)
+    {
+        RotationPool rotations(seed);
+        for (int i = 0; i < POOL_SIZE; i++) {
+            MlVector3 t(mlFloatToScalar(nextFloat(seed, -10.0f, 10.0f)),
+                        mlFloatToScalar(nextFloat(seed, -10.0f, 10.0f)),
+                        mlFloatToScalar(nextFloat(seed, -10.0f, 10.0f)));
+            MlVector3 s(mlFloatToScalar(nextFloat(seed, 0.5f, 2.0f)),
+                        mlFloatToScalar(nextFloat(seed, 0.5f, 2.0f)),
+                        mlFloatToScalar(nextFloat(seed, 0.5f, 2.0f)));
+            m[i].setTransform(t, rotations.q[i], s);
+        }
+    }
+};
+
+// A pool of view projections: the inverse of a transform of the pool
+// followed by a perspective projection.
+struct ProjectionPool
+{
+    MlMatrix4 m[POOL_SIZE];
+
+    ProjectionPool(const TransformPool &views, unsigned int seed)
+    {
+        for (int i = 0; i < POOL_SIZE; i++) {
+            MlMatrix4 proj;
+            proj.setPerspective(mlFloatToScalar(nextFloat(seed, 0.5f, 1.5f)),
+                                mlFloatToScalar(nextFloat(seed, 1.0f, 2.0f)),
+                                ML_SCALAR(0.5f), ML_SCALAR(100.0f));
+            m[i] = MlMatrix4(views.m[i].inverse()) * proj;
+        }
+    }
+};
+
+// Pools of double precision positions and transforms a few hundred
+// kilometres from the world origin, around the camera position worldEye.
+static const MlVector3d worldEye(312345.678, -4321.5, 287654.321);
+
+struct WorldPool
+{
+    MlVector3d p[POOL_SIZE];
+    MlTransformd m[POOL_SIZE];
+
+    WorldPool(unsigned int seed)
+    {
+        Vector3Pool vectors(1000.0f, seed);
+        TransformPool transforms(seed);
+        for (int i = 0; i < POOL_SIZE; i++) {
+            p[i] = worldEye + MlVector3d(vectors.v[i]);
+            m[i] = MlTransformd(transforms.m[i]);
+            m[i].setTranslationOnly(p[i]);
+        }
+    }
+};
+
+// A pool of rigid transforms as dual quaternions.
+struct DualQuatPool
+{
+    MlDualQuat d[POOL_SIZE];
+
+    DualQuatPool(unsigned int seed)
+    {
+        RotationPool rotations(seed);
+        Vector3Pool translations(10.0f, seed);
+        for (int i = 0; i < POOL_SIZE; i++)
+            d[i].setValue(rotations.q[i], translations.v[i]);
+    }
+};
+
+// A skinned mesh of SKIN_VERTICES vertices, each influenced by four of the
+// first SKIN_BONES transforms of a palette, and space for its deformed
+// positions and normals.
+#define SKIN_BONES 64
+#define SKIN_VERTICES (64 * 1024)
+
+struct SkinPool
+{
+    MlSkin skin;
+    MlVector3 positions[SKIN_VERTICES];
+    MlVector3 normals[SKIN_VERTICES];
+
+    SkinPool(unsigned int seed)
+    {
+        Vector3Pool vectors(10.0f, seed);
+        MlSkinInfluence *influences = new MlSkinInfluence[SKIN_VERTICES];
+        for (int i = 0; i < SKIN_VERTICES; i++) {
+            positions[i] = vectors.v[i & POOL_MASK];
+            normals[i] = vectors.v[(i + 1) & POOL_MASK];
+            normals[i].normalize();
+            for (int j = 0; j < 4; j++) {
+                influences[i].bone[j] = (int) nextFloat(seed, 0.0f, (float) SKIN_BONES);
+                influences[i].weight[j] = mlFloatToScalar(nextFloat(seed, 0.1f, 1.0f));
+            }
+        }
+        skin.setValue(positions, normals, influences, SKIN_VERTICES);
+        delete [] influences;
+    }
+};
+
+// A pool of local bounding boxes with half sizes in [0.1, 2), some of them
+// empty, and their circumscribed spheres.
+struct BoundsPool
+{
+    MlAABB box[POOL_SIZE];
+    MlSphere sphere[POOL_SIZE];
+
+    BoundsPool(unsigned int seed)
+    {
+        Vector3Pool centers(10.0f, seed);
+        for (int i = 0; i < POOL_SIZE; i++) {
+            MlVector3 h(mlFloatToScalar(nextFloat(seed, 0.1f, 2.0f)),
+                        mlFloatToScalar(nextFloat(seed, 0.1f, 2.0f)),
+                        mlFloatToScalar(nextFloat(seed, 0.1f, 2.0f)));
+            if ((i & 63) != 0)
+                box[i].setBounds(centers.v[i] - h, centers.v[i] + h);
+            sphere[i].circumscribe(box[i]);
+        }
+    }
+};
+
+// SoA arrays of CULL_VOLUMES spheres and boxes with coordinates in
+// [-50, 50), the view frustum of the first projection of projA, and space
+// for their visibility mask.
+#define CULL_VOLUMES (256 * 1024)
+
+struct CullPool
+{
+    MlFrustum frustum;
+    MlScalar x[CULL_VOLUMES], y[CULL_VOLUMES], z[CULL_VOLUMES], radius[CULL_VOLUMES];
+    MlScalar maxX[CULL_VOLUMES], maxY[CULL_VOLUMES], maxZ[CULL_VOLUMES];
+    unsigned int mask[CULL_VOLUMES / 32];
+
+    CullPool(const ProjectionPool &views, unsigned int seed)
+    {
+        frustum.setValue(views.m[0]);
+        fillScalars(x, CULL_VOLUMES, -50.0f, 50.0f, seed);
+        fillScalars(y, CULL_VOLUMES, -50.0f, 50.0f, seed + 1);
+        fillScalars(z, CULL_VOLUMES, -50.0f, 50.0f, seed + 2);
+        fillScalars(radius, CULL_VOLUMES, 0.1f, 2.0f, seed + 3);
+        for (int i = 0; i < CULL_VOLUMES; i++) {
+            maxX[i] = x[i] + radius[i];
+            maxY[i] = y[i] + radius[i];
+            maxZ[i] = z[i] + radius[i];
+        }
+    }
+};
+
+// A height field of BVH_GRID by BVH_GRID squares over [-100, 100] in x and
+// z, two triangles each, and BVH_RAYS rays cast at it: coherent ones from a
+// camera above it through the pixels of a 256 by 256 image, ordered in
+// tiles of 4 by 4, and segments between scattered points above and below
+// it, whose directions reach their ends at a distance of one.
+#define BVH_GRID 512
+#define BVH_TRIANGLES (2 * BVH_GRID * BVH_GRID)
+#define BVH_RAYS (64 * 1024)
+
+struct BvhPool
+{
+    MlVector3 vertices[(BVH_GRID + 1) * (BVH_GRID + 1)];
+    int indices[3 * BVH_TRIANGLES];
+    MlBvh bvh;
+    MlVector3 origins[BVH_RAYS], directions[BVH_RAYS];
+    MlVector3 segmentOrigins[BVH_RAYS], segmentDirections[BVH_RAYS];
+    MlScalar segmentLengths[BVH_RAYS];
+
+    BvhPool(unsigned int seed)
+    {
+        for (int z = 0; z <= BVH_GRID; z++) {
+            for (int x = 0; x <= BVH_GRID; x++) {
+                float fx = 200.0f * x / BVH_GRID - 100.0f, fz = 200.0f * z / BVH_GRID - 100.0f;
+                vertices[z * (BVH_GRID + 1) + x].setValue(
+                    mlFloatToScalar(fx), mlFloatToScalar(5.0f * sinf(0.1f * fx) * cosf(0.07f * fz) +
+                                                        nextFloat(seed, -0.5f, 0.5f)),
+                    mlFloatToScalar(fz));
+            }
+        }
+        for (int z = 0; z < BVH_GRID; z++) {
+            for (int x = 0; x < BVH_GRID; x++) {
+                int v = z * (BVH_GRID + 1) + x, *t = indices + 6 * (z * BVH_GRID + x);
+                t[0] = v; t[1] = v + BVH_GRID + 1; t[2] = v + 1;
+                t[3] = v + 1; t[4] = v + BVH_GRID + 1; t[5] = v + BVH_GRID + 2;
+            }
+        }
+        bvh.build(vertices, indices, BVH_TRIANGLES);
+
+        for (int i = 0; i < BVH_RAYS; i++) {
+            origins[i].setValue(ML_SCALAR_ZERO, mlFloatToScalar(40.0f), mlFloatToScalar(-120.0f));
+            int x = ((i >> 4) & 63) * 4 + (i & 3), y = (i >> 10) * 4 + ((i >> 2) & 3);
+            directions[i].setValue(mlFloatToScalar((x - 128) / 256.0f),
+                                   mlFloatToScalar(-0.2f - y / 512.0f), ML_SCALAR_ONE);
+            segmentOrigins[i].setValue(mlFloatToScalar(nextFloat(seed, -100.0f, 100.0f)),
+                                       mlFloatToScalar(nextFloat(seed, -10.0f, 20.0f)),
+                                       mlFloatToScalar(nextFloat(seed, -100.0f, 100.0f)));
+            segmentDirections[i].setValue(mlFloatToScalar(nextFloat(seed, -10.0f, 10.0f)),
+                                          mlFloatToScalar(nextFloat(seed, -10.0f, 10.0f)),
+                                          mlFloatToScalar(nextFloat(seed, -10.0f, 10.0f)));
+            segmentLengths[i] = ML_SCALAR_ONE;
+        }
+    }
+};
+
+
+//////////////////////////////////////////////////////////////////////////
+//  Generic drivers
+//////////////////////////////////////////////////////////////////////////
+
+// Applies op to successive elements of one pool.
+template <class Pool, class Op>
+static void
+benchUnary(benchmark::State &state, const Pool *a, Op op)
+{
+    int i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(op(a->x[i & POOL_MASK]));
+        i++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Applies op to successive pairs of elements of two pools.
+template <class Pool, class Op>
+static void
+benchBinary(benchmark::State &state, const Pool *a, const Pool *b, Op op)
+{
+    int i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(op(a->x[i & POOL_MASK], b->x[(i + 1) & POOL_MASK]));
+        i++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Applies op to an element index; op fetches its own operands. This is
+// the driver for operations that update their operand or return void.
+template <class Op>
+static void
+benchIndexed(benchmark::State &state, Op op)
+{
+    int i = 0;
+    for (auto _ : state) {
+        op(i & POOL_MASK);
+        benchmark::ClobberMemory();
+        i++;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Runs op, which processes BATCH_COUNT elements, once per iteration.
+template <class Op>
+static void
+benchBatch(benchmark::State &state, Op op)
+{
+    for (auto _ : state) {
+        op();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH_COUNT);
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+//  Input pools
+//////////////////////////////////////////////////////////////////////////
+
+static const ScalarPool anyA(-64.0f, 64.0f, 1);
+static const ScalarPool anyB(-64.0f, 64.0f, 2);
+static const ScalarPool anyC(-64.0f, 64.0f, 3);
+static const ScalarPool positive(0.01f, 100.0f, 4);
+static const ScalarPool unit(-1.0f, 1.0f, 5);
+static const ScalarPool turns(-2.0f, 2.0f, 6);
+static const ScalarPool degrees(-360.0f, 360.0f, 7);
+static const ScalarPool weights(0.0f, 1.0f, 8);
+
+static Vector2Pool v2A(10.0f, 11);
+static Vector2Pool v2B(10.0f, 12);
+static Vector3Pool v3A(10.0f, 13);
+static Vector3Pool v3B(10.0f, 14);
+static Vector4Pool v4A(10.0f, 15);
+static Vector4Pool v4B(10.0f, 16);
+
+static RotationPool rotA(21);
+static RotationPool rotB(22);
+static PackedRotationPool packed(rotA);
+static SplinePool splines(23);
+static TrackPool tracks(24);
+static TransformPool xfA(31);
+static TransformPool xfB(32);
+static ProjectionPool projA(xfA, 37);
+static ProjectionPool projB(xfB, 38);
+static DualQuatPool dqA(34);
+static DualQuatPool dqB(35);
+static SkinPool mesh(33);
+static WorldPool world(36);
+static CullPool volumes(projA, 39);
+static BoundsPool boundsA(40);
+static BvhPool scene(41);
+
+// Scratch space for the operations that write their result.
+static MlVector2 v2Out[POOL_SIZE];
+static MlVector3 v3Out[POOL_SIZE];
+static MlVector4 v4Out[POOL_SIZE];
+static MlScalar sOut[POOL_SIZE];
+static MlScalar sOut2[POOL_SIZE];
+static MlRotation rotOut[POOL_SIZE];
+static unsigned int p32Out[POOL_SIZE];
+static unsigned short p48Out[3 * POOL_SIZE];
+static MlVector2s v2sOut[POOL_SIZE];
+static MlVector3s v3sOut[POOL_SIZE];
+static MlVector3 boxOrigin, boxExtent;
+static MlVector2 box2Origin, box2Extent;
+static MlTransform xfOut[POOL_SIZE];
+static MlMatrix4 m4Out[POOL_SIZE];
+static MlDualQuat dqOut[POOL_SIZE];
+static MlAABB boxOut[POOL_SIZE];
+static unsigned int maskOut[POOL_SIZE / 32];
+static MlBvhHit bvhHits[BVH_RAYS];
+static unsigned int bvhMask[BVH_RAYS / 32];
+
+
+//////////////////////////////////////////////////////////////////////////
+//  Scalar arithmetic (scalar.h)
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchBinary, mlMul, &anyA, &anyB,
+    [](MlScalar a, MlScalar b) { return mlMul(a, b); });
+BENCHMARK_CAPTURE(benchBinary, mlDiv, &anyA, &positive,
+    [](MlScalar a, MlScalar b) { return mlDiv(a, b); });
+BENCHMARK_CAPTURE(benchBinary, mlMax, &anyA, &anyB,
+    [](MlScalar a, MlScalar b) { return mlMax(a, b); });
+BENCHMARK_CAPTURE(benchBinary, mlEqualAbsErr, &anyA, &anyB,
+    [](MlScalar a, MlScalar b) { return mlEqualAbsErr(a, b, 8); });
+BENCHMARK_CAPTURE(benchIndexed, mlMulMul,
+    [](int i) { sOut[i] = mlMulMul(unit.x[i], anyA.x[i], anyB.x[i]); });
+BENCHMARK_CAPTURE(benchIndexed, mlMulDiv,
+    [](int i) { sOut[i] = mlMulDiv(anyA.x[i], anyB.x[i], positive.x[i]); });
+BENCHMARK_CAPTURE(benchUnary, mlReciprocal, &positive,
+    [](MlScalar a) { return mlReciprocal(a); });
+BENCHMARK_CAPTURE(benchUnary, mlRecipSqrt, &positive,
+    [](MlScalar a) { return mlRecipSqrt(a); });
+BENCHMARK_CAPTURE(benchUnary, mlSqrt, &positive,
+    [](MlScalar a) { return mlSqrt(a); });
+BENCHMARK_CAPTURE(benchUnary, mlSquare, &anyA,
+    [](MlScalar a) { return mlSquare(a); });
+BENCHMARK_CAPTURE(benchUnary, mlAbs, &anyA,
+    [](MlScalar a) { return mlAbs(a); });
+BENCHMARK_CAPTURE(benchUnary, mlSign, &anyA,
+    [](MlScalar a) { return mlSign(a); });
+BENCHMARK_CAPTURE(benchUnary, mlFloor, &anyA,
+    [](MlScalar a) { return mlFloor(a); });
+BENCHMARK_CAPTURE(benchUnary, mlCeil, &anyA,
+    [](MlScalar a) { return mlCeil(a); });
+BENCHMARK_CAPTURE(benchUnary, mlTrunc, &anyA,
+    [](MlScalar a) { return mlTrunc(a); });
+BENCHMARK_CAPTURE(benchUnary, mlScalarToFloat, &anyA,
+    [](MlScalar a) { return mlScalarToFloat(a); });
+BENCHMARK_CAPTURE(benchIndexed, mlFloatToScalar,
+    [](int i) { sOut[i] = mlFloatToScalar((float) i * 0.0625f); });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  Trigonometry (angle.h, sine.h, atan.h, asine.h)
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchUnary, mlSin, &turns,
+    [](MlScalar a) { return mlSin(a); });
+BENCHMARK_CAPTURE(benchUnary, mlCos, &turns,
+    [](MlScalar a) { return mlCos(a); });
+BENCHMARK_CAPTURE(benchIndexed, mlSinCos,
+    [](int i) { mlSinCos(turns.x[i], sOut[i], sOut2[i]); });
+BENCHMARK_CAPTURE(benchBinary, mlAtan2, &anyA, &anyB,
+    [](MlScalar a, MlScalar b) { return mlAtan2(a, b); });
+BENCHMARK_CAPTURE(benchBinary, mlAtan2Quick, &anyA, &anyB,
+    [](MlScalar a, MlScalar b) { return mlAtan2Quick(a, b); });
+BENCHMARK_CAPTURE(benchUnary, mlAsin, &unit,
+    [](MlScalar a) { return mlAsin(a); });
+BENCHMARK_CAPTURE(benchUnary, mlAcos, &unit,
+    [](MlScalar a) { return mlAcos(a); });
+BENCHMARK_CAPTURE(benchUnary, mlDegreesToAngle, &degrees,
+    [](MlScalar a) { return mlDegreesToAngle(a); });
+BENCHMARK_CAPTURE(benchUnary, mlAngleToRadians, &turns,
+    [](MlScalar a) { return mlAngleToRadians(a); });
+
+BENCHMARK_CAPTURE(benchBatch, mlSinCosBatch,
+    []() { mlSinCosBatch(turns.x, sOut, sOut2, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, mlAtan2Batch,
+    []() { mlAtan2Batch(anyA.x, anyB.x, sOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, mlAsinBatch,
+    []() { mlAsinBatch(unit.x, sOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, mlAcosBatch,
+    []() { mlAcosBatch(unit.x, sOut, BATCH_COUNT); });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlVector2
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchIndexed, MlVector2_dot,
+    [](int i) { sOut[i] = v2A.v[i].dot(v2B.v[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector2_length,
+    [](int i) { sOut[i] = v2A.v[i].length(); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector2_normalize,
+    [](int i) { v2Out[i] = v2A.v[i]; sOut[i] = v2Out[i].normalize(); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector2_add,
+    [](int i) { v2Out[i] = v2A.v[i] + v2B.v[i]; });
+BENCHMARK_CAPTURE(benchIndexed, MlVector2_scale,
+    [](int i) { v2Out[i] = v2A.v[i] * unit.x[i]; });
+
+BENCHMARK_CAPTURE(benchBatch, MlVector2_quantizeBatch,
+    []() { MlVector2::quantizeBatch(v2A.v, v2sOut, box2Origin, box2Extent, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlVector2_dequantizeBatch,
+    []() { MlVector2::dequantizeBatch(v2sOut, box2Origin, box2Extent, v2Out, BATCH_COUNT); });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlVector3
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_dot,
+    [](int i) { sOut[i] = v3A.v[i].dot(v3B.v[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_cross,
+    [](int i) { v3Out[i] = v3A.v[i].cross(v3B.v[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_length,
+    [](int i) { sOut[i] = v3A.v[i].length(); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_approximateLength,
+    [](int i) { sOut[i] = v3A.v[i].approximateLength(); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_normalize,
+    [](int i) { v3Out[i] = v3A.v[i]; sOut[i] = v3Out[i].normalize(); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_approximateNormalize,
+    [](int i) { v3Out[i] = v3A.v[i]; sOut[i] = v3Out[i].approximateNormalize(); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_add,
+    [](int i) { v3Out[i] = v3A.v[i] + v3B.v[i]; });
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_subtract,
+    [](int i) { v3Out[i] = v3A.v[i] - v3B.v[i]; });
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_scale,
+    [](int i) { v3Out[i] = v3A.v[i] * unit.x[i]; });
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_lerp,
+    [](int i) { v3Out[i] = v3A.v[i] * (ML_SCALAR_ONE - unit.x[i]) + v3B.v[i] * unit.x[i]; });
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_equals,
+    [](int i) { sOut[i] = mlLongToScalar(v3A.v[i].equals(v3B.v[i], ML_SCALAR_ONE)); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector3_getClosestAxis,
+    [](int i) { v3Out[i] = v3A.v[i].getClosestAxis(); });
+
+BENCHMARK_CAPTURE(benchBatch, MlVector3_addBatch,
+    []() { MlVector3::addBatch(v3A.v, v3B.v, v3Out, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlVector3_subtractBatch,
+    []() { MlVector3::subtractBatch(v3A.v, v3B.v, v3Out, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlVector3_scaleBatch,
+    []() { MlVector3::scaleBatch(v3A.v, ML_SCALAR_HALF, v3Out, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlVector3_dotBatch,
+    []() { MlVector3::dotBatch(v3A.v, v3B.v, sOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlVector3_crossBatch,
+    []() { MlVector3::crossBatch(v3A.v, v3B.v, v3Out, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlVector3_lengthBatch,
+    []() { MlVector3::lengthBatch(v3A.v, sOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlVector3_normalizeBatch,
+    []() {
+        for (int i = 0; i < BATCH_COUNT; i++)
+            v3Out[i] = v3A.v[i];
+        MlVector3::normalizeBatch(v3Out, sOut, BATCH_COUNT);
+    });
+BENCHMARK_CAPTURE(benchBatch, MlVector3_quantizeBatch,
+    []() { MlVector3::quantizeBatch(v3A.v, v3sOut, boxOrigin, boxExtent, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlVector3_dequantizeBatch,
+    []() { MlVector3::dequantizeBatch(v3sOut, boxOrigin, boxExtent, v3Out, BATCH_COUNT); });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlVector4
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchIndexed, MlVector4_dot,
+    [](int i) { sOut[i] = v4A.v[i].dot(v4B.v[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector4_length,
+    [](int i) { sOut[i] = v4A.v[i].length(); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector4_normalize,
+    [](int i) { v4Out[i] = v4A.v[i]; sOut[i] = v4Out[i].normalize(); });
+BENCHMARK_CAPTURE(benchIndexed, MlVector4_add,
+    [](int i) { v4Out[i] = v4A.v[i] + v4B.v[i]; });
+BENCHMARK_CAPTURE(benchIndexed, MlVector4_scale,
+    [](int i) { v4Out[i] = v4A.v[i] * unit.x[i]; });
+
+BENCHMARK_CAPTURE(benchBatch, MlVector4_addBatch,
+    []() { MlVector4::addBatch(v4A.v, v4B.v, v4Out, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlVector4_dotBatch,
+    []() { MlVector4::dotBatch(v4A.v, v4B.v, sOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlVector4_lengthBatch,
+    []() { MlVector4::lengthBatch(v4A.v, sOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlVector4_normalizeBatch,
+    []() {
+        for (int i = 0; i < BATCH_COUNT; i++)
+            v4Out[i] = v4A.v[i];
+        MlVector4::normalizeBatch(v4Out, sOut, BATCH_COUNT);
+    });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlRotation
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchIndexed, MlRotation_multiply,
+    [](int i) { rotOut[i] = rotA.q[i] * rotB.q[i]; });
+BENCHMARK_CAPTURE(benchIndexed, MlRotation_slerp,
+    [](int i) { rotOut[i] = MlRotation::slerp(rotA.q[i], rotB.q[i], ML_SCALAR_HALF); });
+BENCHMARK_CAPTURE(benchIndexed, MlRotation_nlerp,
+    [](int i) { rotOut[i] = MlRotation::nlerp(rotA.q[i], rotB.q[i], ML_SCALAR_HALF); });
+BENCHMARK_CAPTURE(benchBatch, MlRotation_slerpBatch,
+    []() { MlRotation::slerpBatch(rotA.q, rotB.q, weights.x, rotOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlRotation_nlerpBatch,
+    []() { MlRotation::nlerpBatch(rotA.q, rotB.q, weights.x, rotOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchIndexed, MlRotation_pack32,
+    [](int i) { p32Out[i] = rotA.q[i].pack32(); });
+BENCHMARK_CAPTURE(benchIndexed, MlRotation_unpack32,
+    [](int i) { rotOut[i].unpack32(packed.p32[i]); });
+BENCHMARK_CAPTURE(benchBatch, MlRotation_pack32Batch,
+    []() { MlRotation::pack32Batch(rotA.q, p32Out, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlRotation_unpack32Batch,
+    []() { MlRotation::unpack32Batch(packed.p32, rotOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlRotation_pack48Batch,
+    []() { MlRotation::pack48Batch(rotA.q, p48Out, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlRotation_unpack48Batch,
+    []() { MlRotation::unpack48Batch(packed.p48, rotOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchIndexed, MlRotation_squadControl,
+    [](int i) { rotOut[i] = MlRotation::squadControl(rotA.q[i], rotB.q[i], rotA.q[(i + 1) & POOL_MASK]); });
+BENCHMARK_CAPTURE(benchIndexed, MlRotationSpline_getValue,
+    [](int i) { rotOut[i] = splines.s[i].getValue(mlFloatToScalar(3.37f)); });
+BENCHMARK_CAPTURE(benchBatch, MlRotationSpline_getValueBatch,
+    []() { MlRotationSpline::getValueBatch(splines.s, BATCH_COUNT, mlFloatToScalar(3.37f), rotOut); });
+BENCHMARK_CAPTURE(benchIndexed, MlRotation_setValueTransform,
+    [](int i) { rotOut[i].setValue(xfA.m[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlRotation_setValueAxisAngle,
+    [](int i) { rotOut[i].setValue(v3A.v[i], turns.x[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlRotation_getValueTransform,
+    [](int i) { rotA.q[i].getValue(xfOut[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlRotation_multVec,
+    [](int i) { rotA.q[i].multVec(v3A.v[i], v3Out[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlRotation_invert,
+    [](int i) { rotOut[i] = rotA.q[i]; rotOut[i].invert(); });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlVector3Track and MlRotationTrack
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchIndexed, MlVector3Track_getValue,
+    [](int i) { if (i == 0) nextFrame(); v3Out[i] = tracks.v[i].getValue(playTime); });
+BENCHMARK_CAPTURE(benchIndexed, MlRotationTrack_getValue,
+    [](int i) { if (i == 0) nextFrame(); rotOut[i] = tracks.q[i].getValue(playTime); });
+BENCHMARK_CAPTURE(benchBatch, MlVector3Track_getValueBatch,
+    []() { MlVector3Track::getValueBatch(tracks.v, BATCH_COUNT, nextFrame(), v3Out); });
+BENCHMARK_CAPTURE(benchBatch, MlRotationTrack_getValueBatch,
+    []() { MlRotationTrack::getValueBatch(tracks.q, BATCH_COUNT, nextFrame(), rotOut); });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlTransform
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchIndexed, MlTransform_multRight,
+    [](int i) { xfOut[i] = xfA.m[i]; xfOut[i].multRight(xfB.m[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlTransform_multLeft,
+    [](int i) { xfOut[i] = xfA.m[i]; xfOut[i].multLeft(xfB.m[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlTransform_inverse,
+    [](int i) { xfOut[i] = xfA.m[i].inverse(); });
+BENCHMARK_CAPTURE(benchIndexed, MlTransform_transpose,
+    [](int i) { xfOut[i] = xfA.m[i].transpose(); });
+BENCHMARK_CAPTURE(benchIndexed, MlTransform_det,
+    [](int i) { sOut[i] = xfA.m[i].det(); });
+BENCHMARK_CAPTURE(benchIndexed, MlTransform_factor,
+    [](int i) {
+        MlTransform r, u, proj;
+        MlVector3 s, t;
+        xfA.m[i].factor(r, s, u, t, proj);
+        v3Out[i] = s;
+    });
+BENCHMARK_CAPTURE(benchIndexed, MlTransform_getTransform,
+    [](int i) {
+        MlVector3 t, s;
+        MlRotation r, so;
+        xfA.m[i].getTransform(t, r, s, so);
+        rotOut[i] = r;
+    });
+BENCHMARK_CAPTURE(benchIndexed, MlTransform_setTransform,
+    [](int i) { xfOut[i].setTransform(v3A.v[i], rotA.q[i], v3B.v[i], rotB.q[i], v3A.v[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlTransform_multVecMatrix,
+    [](int i) { xfA.m[i].multVecMatrix(v3A.v[i], v3Out[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlTransform_multDirMatrix,
+    [](int i) { xfA.m[i].multDirMatrix(v3A.v[i], v3Out[i]); });
+
+BENCHMARK_CAPTURE(benchBatch, MlTransform_multVecMatrixBatch,
+    []() { xfA.m[0].multVecMatrixBatch(v3A.v, v3Out, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlTransform_multDirMatrixBatch,
+    []() { xfA.m[0].multDirMatrixBatch(v3A.v, v3Out, BATCH_COUNT); });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlMatrix4
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchIndexed, MlMatrix4_multRight,
+    [](int i) { m4Out[i] = projA.m[i]; m4Out[i].multRight(projB.m[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlMatrix4_inverse,
+    [](int i) { m4Out[i] = projA.m[i].inverse(); });
+BENCHMARK_CAPTURE(benchIndexed, MlMatrix4_multVecMatrix,
+    [](int i) { projA.m[i].multVecMatrix(v3A.v[i], v3Out[i]); });
+
+BENCHMARK_CAPTURE(benchBatch, MlMatrix4_multVecMatrixBatch,
+    []() { projA.m[0].multVecMatrixBatch(v3A.v, v3Out, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlMatrix4_multVecMatrixBatchClip,
+    []() { projA.m[0].multVecMatrixBatch(v3A.v, v4Out, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlMatrix4_multVecMatrixBatch4,
+    []() { projA.m[0].multVecMatrixBatch(v4A.v, v4Out, BATCH_COUNT); });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlAABB and MlSphere
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchIndexed, MlAABB_transform,
+    [](int i) { boxOut[i] = boundsA.box[i]; boxOut[i].transform(xfA.m[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlSphere_overlapsAABB,
+    [](int i) { p32Out[i] = boundsA.sphere[i].overlaps(boundsA.box[i ^ 1]); });
+
+BENCHMARK_CAPTURE(benchBatch, MlAABB_transformBatch,
+    []() { MlAABB::transformBatch(xfA.m, boundsA.box, boxOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlAABB_transformBatchOne,
+    []() { MlAABB::transformBatch(xfA.m[0], boundsA.box, boxOut, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlAABB_merge,
+    []() { boxOut[0] = MlAABB::merge(boundsA.box + 1, BATCH_COUNT - 1); });
+BENCHMARK_CAPTURE(benchBatch, MlAABB_containsBatch,
+    []() { boundsA.box[1].containsBatch(v3A.v, BATCH_COUNT, maskOut); });
+BENCHMARK_CAPTURE(benchBatch, MlAABB_overlapsBatch,
+    []() { boundsA.box[1].overlapsBatch(boundsA.box, BATCH_COUNT, maskOut); });
+BENCHMARK_CAPTURE(benchBatch, MlSphere_overlapsBatch,
+    []() { boundsA.sphere[1].overlapsBatch(boundsA.sphere, BATCH_COUNT, maskOut); });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlVector3d and MlTransformd (rebase.h)
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchBatch, MlVector3d_rebaseBatch,
+    []() { mlRebaseBatch(world.p, worldEye, v3Out, BATCH_COUNT); });
+BENCHMARK_CAPTURE(benchBatch, MlTransformd_rebaseBatch,
+    []() { mlRebaseBatch(world.m, worldEye, xfOut, BATCH_COUNT); });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlDualQuat
+//////////////////////////////////////////////////////////////////////////
+
+BENCHMARK_CAPTURE(benchIndexed, MlDualQuat_multiply,
+    [](int i) { dqOut[i] = dqA.d[i] * dqB.d[i]; });
+BENCHMARK_CAPTURE(benchIndexed, MlDualQuat_sclerp,
+    [](int i) { dqOut[i] = MlDualQuat::sclerp(dqA.d[i], dqB.d[i], weights.x[i]); });
+BENCHMARK_CAPTURE(benchIndexed, MlDualQuat_blend,
+    [](int i) { dqOut[i] = MlDualQuat::blend(&dqA.d[i & ~3], &weights.x[i & ~3], 4); });
+BENCHMARK_CAPTURE(benchIndexed, MlDualQuat_multVec,
+    [](int i) { dqA.d[i].multVec(v3A.v[i], v3Out[i]); });
+BENCHMARK_CAPTURE(benchBatch, MlDualQuat_multVecBatch,
+    []() { dqA.d[0].multVecBatch(v3A.v, v3Out, BATCH_COUNT); });
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlSkin
+//////////////////////////////////////////////////////////////////////////
+
+// Skins the whole mesh by the palette xfA once per iteration, on
+// state.range(0) threads; zero means one per processor.
+static void
+benchSkin(benchmark::State &state)
+{
+    int numThreads = (int) state.range(0);
+    for (auto _ : state) {
+        mesh.skin.apply(xfA.m, SKIN_BONES, mesh.positions, mesh.normals, numThreads);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SKIN_VERTICES);
+}
+BENCHMARK(benchSkin)->Name("MlSkin_apply")->Arg(1)->Arg(4)->Arg(0)->UseRealTime();
+
+// The same with the dual quaternion palette dqA.
+static void
+benchSkinDualQuat(benchmark::State &state)
+{
+    int numThreads = (int) state.range(0);
+    for (auto _ : state) {
+        mesh.skin.apply(dqA.d, SKIN_BONES, mesh.positions, mesh.normals, numThreads);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SKIN_VERTICES);
+}
+BENCHMARK(benchSkinDualQuat)->Name("MlSkin_applyDualQuat")->Arg(1)->Arg(4)->Arg(0)->UseRealTime();
+
+
+//////////////////////////////////////////////////////////////////////////
+//  MlFrustum
+//////////////////////////////////////////////////////////////////////////
+
+// Culls all the spheres of the pool once per iteration, on state.range(0)
+// threads; zero means one per processor.
+static void
+benchCullSpheres(benchmark::State &state)
+{
+    int numThreads = (int) state.range(0);
+    for (auto _ : state) {
+        volumes.frustum.cullSpheres(volumes.x, volumes.y, volumes.z, volumes.radius,
+                                    CULL_VOLUMES, volumes.mask, numThreads);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * CULL_VOLUMES);
+}
+BENCHMARK(benchCullSpheres)->Name("MlFrustum_cullSpheres")->Arg(1)->Arg(4)->Arg(0)->UseRealTime();
+
+// The same with the boxes of the pool.
+static void
+benchCullBoxes(benchmark::State &state)
+{
+    int numThreads = (int) state.range(0);
+    for (auto _ : state) {
+        volumes.frustum.cullBoxes(volumes.x, volumes.y, volumes.z,
+                                  volumes.maxX, volumes.maxY, volumes.maxZ,
+                                  CULL_VOLUMES, volumes.mask, numThreads);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * CULL_VOLUMES);
+}
+BENCHMARK(benchCullBoxes)->Name("MlFrustum_cullBoxes")->Arg(1)->Arg(4)->Arg(0)->UseRealTime();
+
+//////////////////////////////////////////////////////////////////////////
+//  MlBvh
+//////////////////////////////////////////////////////////////////////////
+
+// Builds a tree over the height field once per iteration, on
+// state.range(0) threads; zero means one per processor.
+static void
+benchBvhBuild(benchmark::State &state)
+{
+    int numThreads = (int) state.range(0);
+    MlBvh bvh;
+    for (auto _ : state) {
+        bvh.build(scene.vertices, scene.indices, BVH_TRIANGLES, numThreads);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * BVH_TRIANGLES);
+}
+BENCHMARK(benchBvhBuild)->Name("MlBvh_build")->Arg(1)->Arg(4)->Arg(0)->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Casts the camera rays one at a time.
+static void
+benchBvhIntersect(benchmark::State &state)
+{
+    for (auto _ : state) {
+        for (int i = 0; i < BVH_RAYS; i++)
+            scene.bvh.intersect(scene.origins[i], scene.directions[i], ML_SCALAR_MAX, bvhHits[i]);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * BVH_RAYS);
+}
+BENCHMARK(benchBvhIntersect)->Name("MlBvh_intersect");
+
+// Casts the camera rays as a batch, on state.range(0) threads.
+static void
+benchBvhIntersectBatch(benchmark::State &state)
+{
+    int numThreads = (int) state.range(0);
+    for (auto _ : state) {
+        scene.bvh.intersectBatch(scene.origins, scene.directions, NULL, bvhHits, BVH_RAYS,
+                                 numThreads);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * BVH_RAYS);
+}
+BENCHMARK(benchBvhIntersectBatch)->Name("MlBvh_intersectBatch")->Arg(1)->Arg(4)->Arg(0)
+    ->UseRealTime();
+
+// Tests the segments for occlusion one at a time, and as a batch.
+static void
+benchBvhOccluded(benchmark::State &state)
+{
+    for (auto _ : state) {
+        for (int i = 0; i < BVH_RAYS; i++)
+            p32Out[i & POOL_MASK] = scene.bvh.occluded(scene.segmentOrigins[i],
+                                                       scene.segmentDirections[i], ML_SCALAR_ONE);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * BVH_RAYS);
+}
+BENCHMARK(benchBvhOccluded)->Name("MlBvh_occluded");
+
+static void
+benchBvhOccludedBatch(benchmark::State &state)
+{
+    int numThreads = (int) state.range(0);
+    for (auto _ : state) {
+        scene.bvh.occludedBatch(scene.segmentOrigins, scene.segmentDirections,
+                                scene.segmentLengths, BVH_RAYS, bvhMask, numThreads);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * BVH_RAYS);
+}
+BENCHMARK(benchBvhOccludedBatch)->Name("MlBvh_occludedBatch")->Arg(1)->Arg(4)->Arg(0)
+    ->UseRealTime();
+
+int
+main(int argc, char **argv)
+{
+#if ML_FIXED_POINT
+    printf("mlmathBench: fixed-point %d.%d\n", 32 - ML_FIXED_RADIX, ML_FIXED_RADIX);
+#else
+    printf("mlmathBench: floating-point\n");
+#endif
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
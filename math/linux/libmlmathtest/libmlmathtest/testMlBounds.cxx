@@ -0,0 +1,279 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "math/vector.h"
+#include "math/rotation.h"
+#include "math/transfrm.h"
+#include "math/bounds.h"
+#include "testCoord.h"
+
+// Fills boxes and transforms; some of the boxes are empty.
+static void fillBoxes(MlAABB *boxes, MlTransform *xf, int count) {
+	for (int i = 0; i < count; i++) {
+		MlVector3 c(mlFloatToScalar(testCoord(6*i, 10)), mlFloatToScalar(testCoord(6*i + 1, 10)),
+		            mlFloatToScalar(testCoord(6*i + 2, 10)));
+		MlVector3 h(mlAbs(mlFloatToScalar(testCoord(6*i + 3, 2))),
+		            mlAbs(mlFloatToScalar(testCoord(6*i + 4, 2))),
+		            mlAbs(mlFloatToScalar(testCoord(6*i + 5, 2))));
+		if (i % 9 == 4)
+			boxes[i].makeEmpty();
+		else
+			boxes[i].setBounds(c - h, c + h);
+		xf[i].setTransform(MlVector3(mlFloatToScalar(testCoord(3*i, 5)),
+		                             mlFloatToScalar(testCoord(3*i + 1, 5)), 1),
+		                   MlRotation(MlVector3(1, mlFloatToScalar(testCoord(i, 1)), 2),
+		                              mlFloatToScalar(testCoord(i + 7, 3))),
+		                   MlVector3(1 + ML_SCALAR(0.1f) * (i % 5), 1, 2 - ML_SCALAR(0.1f) * (i % 3)));
+	}
+}
+
+// The kernels may fuse multiplies and adds, so the batch results are
+// compared with a tolerance.
+static bool nearBox(const MlAABB &a, const MlAABB &b) {
+	if (a.isEmpty() || b.isEmpty())
+		return a == b;
+	return a.getMin().equals(b.getMin(), 1e-5f) && a.getMax().equals(b.getMax(), 1e-5f);
+}
+
+TEST(MlBoundsTest, Box) {
+    // This test is named "Box", and belongs to the "MlBoundsTest"
+    // test case.
+
+	MlAABB box;
+	EXPECT_TRUE(box.isEmpty());
+	box.extendBy(MlVector3(1, 2, 3));
+	EXPECT_FALSE(box.isEmpty());
+	EXPECT_TRUE(box.getMin() == MlVector3(1, 2, 3));
+	box.extendBy(MlVector3(-1, 4, 0));
+	EXPECT_TRUE(box == MlAABB(MlVector3(-1, 2, 0), MlVector3(1, 4, 3)));
+	EXPECT_TRUE(box.getCenter() == MlVector3(0, 3, 1.5f));
+	EXPECT_TRUE(box.getSize() == MlVector3(2, 2, 3));
+
+	EXPECT_TRUE(box.contains(MlVector3(0, 3, 1)));
+	EXPECT_TRUE(box.contains(MlVector3(1, 4, 3)));
+	EXPECT_FALSE(box.contains(MlVector3(0, 4.5f, 1)));
+	EXPECT_TRUE(box.overlaps(MlAABB(MlVector3(1, 4, 3), MlVector3(2, 5, 4))));
+	EXPECT_FALSE(box.overlaps(MlAABB(MlVector3(1.5f, 3, 1), MlVector3(2, 5, 4))));
+	EXPECT_FALSE(box.overlaps(MlAABB()));
+	EXPECT_FALSE(MlAABB().overlaps(box));
+	EXPECT_FALSE(MlAABB().contains(MlVector3(0, 0, 0)));
+
+	MlAABB other(MlVector3(0, -5, 1), MlVector3(0.5f, 0, 8));
+	MlAABB merged = box;
+	merged.extendBy(other);
+	merged.extendBy(MlAABB());
+	EXPECT_TRUE(merged == MlAABB(MlVector3(-1, -5, 0), MlVector3(1, 4, 8)));
+
+	// The bounds of an array of points or of boxes.
+	MlVector3 points[11];
+	MlAABB expected;
+	for (int i = 0; i < 11; i++) {
+		points[i].setValue(mlFloatToScalar(testCoord(3*i, 5)), mlFloatToScalar(testCoord(3*i + 1, 5)),
+		                   mlFloatToScalar(testCoord(3*i + 2, 5)));
+		expected.extendBy(points[i]);
+	}
+	MlAABB bounds;
+	bounds.setBounds(points, 11);
+	EXPECT_TRUE(bounds == expected);
+	bounds.setBounds(points, 0);
+	EXPECT_TRUE(bounds.isEmpty());
+
+	const int count = 37;
+	MlAABB boxes[count];
+	MlTransform xf[count];
+	fillBoxes(boxes, xf, count);
+	expected.makeEmpty();
+	for (int i = 0; i < count; i++)
+		expected.extendBy(boxes[i]);
+	EXPECT_TRUE(MlAABB::merge(boxes, count) == expected);
+	boxes[4].setBounds(MlVector3(1, 0, 0), MlVector3(0, 100, 100));
+	EXPECT_TRUE(boxes[4].isEmpty());
+	EXPECT_TRUE(MlAABB::merge(boxes, count) == expected);
+	EXPECT_TRUE(MlAABB::merge(boxes, 0).isEmpty());
+	EXPECT_TRUE(MlAABB::merge(boxes + 4, 1).isEmpty());
+}
+
+TEST(MlBoundsTest, Transform) {
+    // This test is named "Transform", and belongs to the "MlBoundsTest"
+    // test case.
+
+	const int count = 37;
+	MlAABB boxes[count], result[count], result1[count];
+	MlTransform xf[count];
+	fillBoxes(boxes, xf, count);
+
+	// The transformed box is the bounds of the transformed corners.
+	for (int i = 0; i < count; i++) {
+		MlAABB box = boxes[i];
+		box.transform(xf[i]);
+		if (boxes[i].isEmpty()) {
+			EXPECT_TRUE(box == boxes[i]);
+			continue;
+		}
+		MlAABB corners;
+		for (int k = 0; k < 8; k++) {
+			MlVector3 p((k & 1) ? boxes[i].getMax()[0] : boxes[i].getMin()[0],
+			            (k & 2) ? boxes[i].getMax()[1] : boxes[i].getMin()[1],
+			            (k & 4) ? boxes[i].getMax()[2] : boxes[i].getMin()[2]);
+			xf[i].multVecMatrix(p, p);
+			corners.extendBy(p);
+		}
+		EXPECT_TRUE(box.getMin().equals(corners.getMin(), 1e-8f)) << i;
+		EXPECT_TRUE(box.getMax().equals(corners.getMax(), 1e-8f)) << i;
+	}
+
+	// The batches give the same as transforming each box.
+	MlAABB::transformBatch(xf, boxes, result, count);
+	MlAABB::transformBatch(xf[3], boxes, result1, count);
+	for (int i = 0; i < count; i++) {
+		MlAABB box = boxes[i];
+		box.transform(xf[i]);
+		EXPECT_TRUE(nearBox(result[i], box)) << i;
+		box = boxes[i];
+		box.transform(xf[3]);
+		EXPECT_TRUE(nearBox(result1[i], box)) << i;
+	}
+
+	// In place.
+	MlAABB::transformBatch(xf, boxes, boxes, count);
+	for (int i = 0; i < count; i++)
+		EXPECT_TRUE(boxes[i] == result[i]) << i;
+}
+
+TEST(MlBoundsTest, Sphere) {
+    // This test is named "Sphere", and belongs to the "MlBoundsTest"
+    // test case.
+
+	MlSphere sphere;
+	EXPECT_TRUE(sphere.isEmpty());
+	sphere.extendBy(MlVector3(1, 0, 0));
+	EXPECT_EQ(sphere.getRadius(), 0.0f);
+	sphere.extendBy(MlVector3(-3, 0, 0));
+	EXPECT_TRUE(sphere.getCenter().equals(MlVector3(-1, 0, 0), 1e-12f));
+	EXPECT_NEAR(sphere.getRadius(), 2.0f, 1e-6f);
+	sphere.extendBy(MlVector3(-1, 1, 0));
+	EXPECT_NEAR(sphere.getRadius(), 2.0f, 1e-6f);
+
+	// The smallest sphere containing two others.
+	MlSphere a(MlVector3(0, 0, 0), 1), b(MlVector3(4, 0, 0), 2);
+	a.extendBy(b);
+	EXPECT_TRUE(a.getCenter().equals(MlVector3(2.5f, 0, 0), 1e-12f));
+	EXPECT_NEAR(a.getRadius(), 3.5f, 1e-6f);
+	a.extendBy(MlSphere(MlVector3(3, 0, 0), 1));
+	EXPECT_NEAR(a.getRadius(), 3.5f, 1e-6f);
+	a.extendBy(MlSphere(MlVector3(3, 0, 0), 10));
+	EXPECT_TRUE(a == MlSphere(MlVector3(3, 0, 0), 10));
+	a.extendBy(MlSphere());
+	EXPECT_TRUE(a == MlSphere(MlVector3(3, 0, 0), 10));
+
+	EXPECT_TRUE(b.contains(MlVector3(5, 1, 0)));
+	EXPECT_FALSE(b.contains(MlVector3(5.5f, 1.5f, 0)));
+	EXPECT_TRUE(b.overlaps(MlSphere(MlVector3(4, 3, 0), 1)));
+	EXPECT_FALSE(b.overlaps(MlSphere(MlVector3(4, 3.5f, 0), 1)));
+	EXPECT_FALSE(b.overlaps(MlSphere()));
+
+	// Against boxes, near a corner of the box.
+	MlAABB box(MlVector3(0, 0, 0), MlVector3(1, 1, 1));
+	EXPECT_TRUE(MlSphere(MlVector3(2, 2, 1), 1.5f).overlaps(box));
+	EXPECT_FALSE(MlSphere(MlVector3(2, 2, 2), 1.5f).overlaps(box));
+	EXPECT_TRUE(box.overlaps(MlSphere(MlVector3(0.5f, 0.5f, 0.5f), 0.1f)));
+	EXPECT_FALSE(box.overlaps(MlSphere()));
+
+	MlSphere c;
+	c.circumscribe(box);
+	EXPECT_TRUE(c.getCenter() == MlVector3(0.5f, 0.5f, 0.5f));
+	EXPECT_NEAR(c.getRadius(), mlSqrt(ML_SCALAR(0.75f)), 1e-6f);
+
+	// Transform by a rotation and a scale.
+	MlTransform m;
+	m.setTransform(MlVector3(1, 2, 3), MlRotation(MlVector3(0, 0, 1), ML_SCALAR(0.5f)), MlVector3(2, 3, 1));
+	MlVector3 p;
+	m.multVecMatrix(c.getCenter(), p);
+	c.transform(m);
+	EXPECT_TRUE(c.getCenter().equals(p, 1e-6f));
+	EXPECT_NEAR(c.getRadius(), 3 * mlSqrt(ML_SCALAR(0.75f)), 1e-5f);
+}
+
+TEST(MlBoundsTest, Batch) {
+    // This test is named "Batch", and belongs to the "MlBoundsTest"
+    // test case.
+
+	const int count = 101;
+	MlAABB boxes[count];
+	MlTransform xf[count];
+	MlSphere spheres[count];
+	MlVector3 points[count];
+	fillBoxes(boxes, xf, count);
+	for (int i = 0; i < count; i++) {
+		spheres[i].circumscribe(boxes[i]);
+		points[i] = boxes[(i + 1) % count].getCenter();
+	}
+
+	MlAABB box(MlVector3(-4, -6, -3), MlVector3(5, 2, 7));
+	MlSphere sphere(MlVector3(1, -2, 0), 6);
+	unsigned int mask[4][(count + 31) / 32];
+	box.containsBatch(points, count, mask[0]);
+	box.overlapsBatch(boxes, count, mask[1]);
+	sphere.containsBatch(points, count, mask[2]);
+	sphere.overlapsBatch(spheres, count, mask[3]);
+
+	int found[4] = { 0, 0, 0, 0 };
+	for (int i = 0; i < count; i++) {
+		int expected[4] = { box.contains(points[i]), box.overlaps(boxes[i]),
+		                    sphere.contains(points[i]), sphere.overlaps(spheres[i]) };
+		for (int j = 0; j < 4; j++) {
+			EXPECT_EQ((mask[j][i / 32] >> (i % 32)) & 1, (unsigned int) expected[j]) << j << " " << i;
+			found[j] += expected[j];
+		}
+	}
+	for (int j = 0; j < 4; j++) {
+		EXPECT_GT(found[j], 0);
+		EXPECT_LT(found[j], count);
+		EXPECT_EQ(mask[j][count / 32] >> (count % 32), 0u);
+	}
+
+	// An empty box contains and overlaps nothing.
+	MlAABB().containsBatch(points, count, mask[0]);
+	MlAABB().overlapsBatch(boxes, count, mask[1]);
+	MlSphere().overlapsBatch(spheres, count, mask[3]);
+	for (int i = 0; i < (count + 31) / 32; i++) {
+		EXPECT_EQ(mask[0][i], 0u);
+		EXPECT_EQ(mask[1][i], 0u);
+		EXPECT_EQ(mask[3][i], 0u);
+	}
+}
@@ -0,0 +1,311 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include system header files.
+#include <float.h>
+#include <math.h>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "math/vector.h"
+#include "math/bounds.h"
+#include "math/bvh.h"
+#include "testCoord.h"
+
+// A soup of small triangles scattered through a cube, three vertices each.
+static void fillSoup(MlVector3 *vertices, int numTriangles) {
+	for (int i = 0; i < numTriangles; i++) {
+		MlVector3 c(testCoord(12*i, 10), testCoord(12*i + 1, 10), testCoord(12*i + 2, 10));
+		for (int k = 0; k < 3; k++)
+			vertices[3*i + k] = c + MlVector3(testCoord(12*i + 3 + 3*k, 1.5f),
+			                                  testCoord(12*i + 4 + 3*k, 1.5f),
+			                                  testCoord(12*i + 5 + 3*k, 1.5f));
+	}
+}
+
+// A height field of n by n squares over [-10, 10] in x and z, two
+// triangles each.
+static void fillTerrain(MlVector3 *vertices, int *indices, int n) {
+	for (int z = 0; z <= n; z++) {
+		for (int x = 0; x <= n; x++) {
+			float fx = 20.0f * x / n - 10.0f, fz = 20.0f * z / n - 10.0f;
+			vertices[z * (n + 1) + x].setValue(fx, sinf(fx) * cosf(0.7f * fz), fz);
+		}
+	}
+	for (int z = 0; z < n; z++) {
+		for (int x = 0; x < n; x++) {
+			int v = z * (n + 1) + x, *t = indices + 6 * (z * n + x);
+			t[0] = v; t[1] = v + n + 1; t[2] = v + 1;
+			t[3] = v + 1; t[4] = v + n + 1; t[5] = v + n + 2;
+		}
+	}
+}
+
+// Random rays through the soup; every seventh is along an axis.
+static void fillRays(MlVector3 *origins, MlVector3 *directions, int count) {
+	for (int i = 0; i < count; i++) {
+		origins[i].setValue(testCoord(6*i + 100001, 14), testCoord(6*i + 100002, 14),
+		                    testCoord(6*i + 100003, 14));
+		if (i % 7 == 3)
+			directions[i].setValue(0, (i & 8) ? -1.0f : 1.0f, 0);
+		else
+			directions[i] = MlVector3(testCoord(6*i + 100004, 1), testCoord(6*i + 100005, 1),
+			                          testCoord(6*i + 100006, 1)) - origins[i] * 0.05f;
+	}
+}
+
+// Tests a ray against every triangle, with the same arithmetic as the
+// tree, returning the nearest hit closer than t.
+static int bruteForce(const MlVector3 *vertices, const int *indices, int numTriangles,
+                      const MlVector3 &origin, const MlVector3 &dir, float &t, int any) {
+	int hit = -1;
+	for (int i = 0; i < numTriangles; i++) {
+		MlVector3 v0 = vertices[indices ? indices[3*i] : 3*i];
+		MlVector3 e1 = vertices[indices ? indices[3*i + 1] : 3*i + 1] - v0;
+		MlVector3 e2 = vertices[indices ? indices[3*i + 2] : 3*i + 2] - v0;
+		float p[3] = { dir[1] * e2[2] - dir[2] * e2[1],
+		               dir[2] * e2[0] - dir[0] * e2[2],
+		               dir[0] * e2[1] - dir[1] * e2[0] };
+		float det = (e1[0] * p[0] + e1[1] * p[1]) + e1[2] * p[2];
+		if (det == 0.0f)
+			continue;
+		float r = 1.0f / det;
+		MlVector3 s = origin - v0;
+		float u = ((s[0] * p[0] + s[1] * p[1]) + s[2] * p[2]) * r;
+		float q[3] = { s[1] * e1[2] - s[2] * e1[1],
+		               s[2] * e1[0] - s[0] * e1[2],
+		               s[0] * e1[1] - s[1] * e1[0] };
+		float v = ((dir[0] * q[0] + dir[1] * q[1]) + dir[2] * q[2]) * r;
+		float h = ((e2[0] * q[0] + e2[1] * q[1]) + e2[2] * q[2]) * r;
+		if (! (t > h) || h < 0.0f || u < 0.0f || v < 0.0f || u + v > 1.0f)
+			continue;
+		t = h;
+		hit = i;
+		if (any)
+			break;
+	}
+	return hit;
+}
+
+TEST(MlBvhTest, Quad) {
+    // This test is named "Quad", and belongs to the "MlBvhTest"
+    // test case.
+
+	MlVector3 vertices[4] = { MlVector3(0, 0, 0), MlVector3(2, 0, 0),
+	                          MlVector3(2, 2, 0), MlVector3(0, 2, 0) };
+	int indices[6] = { 0, 1, 2, 0, 2, 3 };
+	MlBvh bvh(vertices, indices, 2);
+	EXPECT_EQ(bvh.getNumTriangles(), 2);
+	EXPECT_GE(bvh.getNumNodes(), 1);
+	EXPECT_TRUE(bvh.getBounds() == MlAABB(MlVector3(0, 0, 0), MlVector3(2, 2, 0)));
+
+	// A ray down onto the upper triangle, and one that stops short of it.
+	MlBvhHit hit;
+	EXPECT_TRUE(bvh.intersect(MlVector3(0.5f, 1.5f, 4), MlVector3(0, 0, -2), 10, hit));
+	EXPECT_EQ(hit.triangle, 1);
+	EXPECT_FLOAT_EQ(hit.t, 2);
+	EXPECT_FLOAT_EQ(hit.u, 0.25f);
+	EXPECT_FLOAT_EQ(hit.v, 0.5f);
+	EXPECT_FALSE(bvh.intersect(MlVector3(0.5f, 1.5f, 4), MlVector3(0, 0, -2), 1.5f, hit));
+	EXPECT_EQ(hit.triangle, -1);
+	EXPECT_FLOAT_EQ(hit.t, 1.5f);
+	EXPECT_TRUE(bvh.occluded(MlVector3(1.5f, 0.5f, -1), MlVector3(0, 0, 1), 2));
+	EXPECT_FALSE(bvh.occluded(MlVector3(1.5f, 0.5f, -1), MlVector3(0, 0, 1), 0.5f));
+
+	// Rays beside the quad, pointing away from it and parallel to it.
+	EXPECT_FALSE(bvh.intersect(MlVector3(3, 1, 4), MlVector3(0, 0, -1), FLT_MAX, hit));
+	EXPECT_FALSE(bvh.intersect(MlVector3(1, 1, 4), MlVector3(0, 0, 1), FLT_MAX, hit));
+	EXPECT_FALSE(bvh.occluded(MlVector3(-1, 1, 0), MlVector3(1, 0, 0), FLT_MAX));
+
+	// The triangles as consecutive vertices, and copies of the tree.
+	MlVector3 soup[6] = { vertices[0], vertices[1], vertices[2],
+	                      vertices[0], vertices[2], vertices[3] };
+	MlBvh copy(MlBvh(soup, NULL, 2));
+	EXPECT_TRUE(copy.intersect(MlVector3(1.5f, 0.5f, 1), MlVector3(0, 0, -1), FLT_MAX, hit));
+	EXPECT_EQ(hit.triangle, 0);
+	copy = bvh;
+	EXPECT_EQ(copy.getNumNodes(), bvh.getNumNodes());
+	EXPECT_TRUE(copy.intersect(MlVector3(0.5f, 1.5f, 4), MlVector3(0, 0, -2), 10, hit));
+	EXPECT_EQ(hit.triangle, 1);
+
+	// An empty tree is hit by nothing.
+	MlBvh empty;
+	EXPECT_EQ(empty.getNumNodes(), 0);
+	EXPECT_TRUE(empty.getBounds().isEmpty());
+	EXPECT_FALSE(empty.intersect(MlVector3(0, 0, 0), MlVector3(1, 0, 0), FLT_MAX, hit));
+	EXPECT_FALSE(empty.occluded(MlVector3(0, 0, 0), MlVector3(1, 0, 0), FLT_MAX));
+	unsigned int mask = ~0u;
+	empty.occludedBatch(vertices, vertices, NULL, 4, &mask);
+	EXPECT_EQ(mask, 0u);
+	copy = empty;
+	EXPECT_EQ(copy.getNumTriangles(), 0);
+}
+
+TEST(MlBvhTest, BruteForce) {
+    // This test is named "BruteForce", and belongs to the "MlBvhTest"
+    // test case.
+
+	const int numTriangles = 3000, count = 1000;
+	static MlVector3 vertices[3 * numTriangles], origins[count], directions[count];
+	fillSoup(vertices, numTriangles);
+	fillRays(origins, directions, count);
+
+	MlBvh bvh(vertices, NULL, numTriangles);
+	EXPECT_LT(bvh.getNumNodes(), 2 * numTriangles);
+	MlAABB bounds;
+	bounds.setBounds(vertices, 3 * numTriangles);
+	EXPECT_TRUE(bvh.getBounds() == bounds);
+
+	int hits = 0;
+	for (int i = 0; i < count; i++) {
+		float maxDistance = (i % 5 == 0) ? 10.0f : FLT_MAX;
+		float t = maxDistance;
+		int expected = bruteForce(vertices, NULL, numTriangles, origins[i], directions[i], t, 0);
+
+		MlBvhHit hit;
+		EXPECT_EQ(bvh.intersect(origins[i], directions[i], maxDistance, hit), expected >= 0);
+		EXPECT_EQ(hit.triangle, expected);
+		EXPECT_FLOAT_EQ(hit.t, t);
+		EXPECT_EQ(bvh.occluded(origins[i], directions[i], maxDistance), expected >= 0);
+		if (expected >= 0) {
+			MlVector3 p = origins[i] + directions[i] * hit.t;
+			MlVector3 q = vertices[3 * expected] * (1 - hit.u - hit.v) +
+				vertices[3 * expected + 1] * hit.u + vertices[3 * expected + 2] * hit.v;
+			EXPECT_TRUE(p.equals(q, 1e-3f));
+			hits++;
+		}
+	}
+
+	// Most of the rays should hit something, but not all.
+	EXPECT_GT(hits, count / 2);
+	EXPECT_LT(hits, count);
+}
+
+TEST(MlBvhTest, Batch) {
+    // This test is named "Batch", and belongs to the "MlBvhTest"
+    // test case.
+
+	// Rays from a camera over a height field, which are coherent, and
+	// random rays through a soup, with a count that leaves a partial
+	// packet.
+	const int n = 64, width = 48, height = 37, count = width * height;
+	static MlVector3 terrain[(n + 1) * (n + 1)], origins[count], directions[count];
+	static int indices[6 * n * n];
+	static MlScalar maxDistances[count];
+	static MlBvhHit hits[count];
+	static unsigned int mask[(count + 31) / 32];
+	fillTerrain(terrain, indices, n);
+	for (int i = 0; i < count; i++) {
+		origins[i].setValue(0, 8, -12);
+		directions[i].setValue(0.6f * ((i % width) - width / 2) / (float) width,
+		                       -0.4f - (i / width) / (float) height, 1);
+		maxDistances[i] = (i % 11 == 0) ? 5.0f : 100.0f;
+	}
+
+	const int numTriangles = 2000;
+	static MlVector3 soup[3 * numTriangles];
+	fillSoup(soup, numTriangles);
+
+	for (int pass = 0; pass < 2; pass++) {
+		MlBvh bvh;
+		if (pass == 0)
+			bvh.build(terrain, indices, 2 * n * n);
+		else {
+			bvh.build(soup, NULL, numTriangles);
+			fillRays(origins, directions, count);
+		}
+
+		bvh.intersectBatch(origins, directions, maxDistances, hits, count);
+		bvh.occludedBatch(origins, directions, maxDistances, count, mask);
+		int numHits = 0;
+		for (int i = 0; i < count; i++) {
+			MlBvhHit hit;
+			int expected = bvh.intersect(origins[i], directions[i], maxDistances[i], hit);
+			EXPECT_EQ(hits[i].triangle, hit.triangle);
+			EXPECT_NEAR(hits[i].t, hit.t, 1e-4f * hit.t);
+			EXPECT_NEAR(hits[i].u, hit.u, 1e-4f);
+			EXPECT_NEAR(hits[i].v, hit.v, 1e-4f);
+			EXPECT_EQ((mask[i / 32] >> (i % 32)) & 1, (unsigned int) expected);
+			numHits += expected;
+		}
+		EXPECT_GT(numHits, count / 3);
+		EXPECT_EQ(mask[count / 32] >> (count % 32), 0u);
+
+		// Without distances, every ray over the height field hits it.
+		bvh.intersectBatch(origins, directions, NULL, hits, count);
+		for (int i = 0; i < count; i++) {
+			MlBvhHit hit;
+			bvh.intersect(origins[i], directions[i], FLT_MAX, hit);
+			EXPECT_EQ(hits[i].triangle, hit.triangle);
+			if (pass == 0) {
+				EXPECT_GE(hit.triangle, 0);
+			}
+		}
+	}
+}
+
+TEST(MlBvhTest, Threads) {
+    // This test is named "Threads", and belongs to the "MlBvhTest"
+    // test case.
+
+	// Large enough that the top of the tree is binned in parallel.
+	const int n = 300, numTriangles = 2 * n * n, count = 5000;
+	static MlVector3 terrain[(n + 1) * (n + 1)], origins[count], directions[count];
+	static int indices[6 * n * n];
+	static MlBvhHit hits[count], threadHits[count];
+	static unsigned int mask[(count + 31) / 32], threadMask[(count + 31) / 32];
+	fillTerrain(terrain, indices, n);
+	fillRays(origins, directions, count);
+
+	MlBvh bvh(terrain, indices, numTriangles);
+	bvh.intersectBatch(origins, directions, NULL, hits, count);
+	bvh.occludedBatch(origins, directions, NULL, count, mask);
+
+	const int threads[2] = { 4, 0 };
+	for (int j = 0; j < 2; j++) {
+		MlBvh threaded(terrain, indices, numTriangles, threads[j]);
+		EXPECT_EQ(threaded.getNumNodes(), bvh.getNumNodes());
+		EXPECT_TRUE(threaded.getBounds() == bvh.getBounds());
+
+		threaded.intersectBatch(origins, directions, NULL, threadHits, count, threads[j]);
+		threaded.occludedBatch(origins, directions, NULL, count, threadMask, threads[j]);
+		for (int i = 0; i < count; i++) {
+			EXPECT_EQ(threadHits[i].triangle, hits[i].triangle);
+			EXPECT_EQ(threadHits[i].t, hits[i].t);
+		}
+		for (int i = 0; i < (count + 31) / 32; i++)
+			EXPECT_EQ(threadMask[i], mask[i]);
+	}
+}
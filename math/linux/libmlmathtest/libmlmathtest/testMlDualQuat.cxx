@@ -0,0 +1,218 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include Google Test header files.
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "math/vector.h"
+#include "math/rotation.h"
+#include "math/transfrm.h"
+#include "math/dualquat.h"
+
+static MlDualQuat makeDualQuat(float phase) {
+	MlRotation r(MlVector3(0.3f + phase, -1, 0.5f), 2.1f * phase - 1.0f);
+	return MlDualQuat(r, MlVector3(3.0f * phase, 1 - phase, -2.0f));
+}
+
+static void expectSameTransform(const MlDualQuat &dq, const MlTransform &m, float tolerance) {
+	MlVector3 points[] = { MlVector3(0, 0, 0), MlVector3(1, 2, 3), MlVector3(-4, 0.5f, 2) };
+	for (int i = 0; i < 3; i++) {
+		MlVector3 a, b;
+		dq.multVec(points[i], a);
+		m.multVecMatrix(points[i], b);
+		for (int j = 0; j < 3; j++)
+			EXPECT_NEAR(a[j], b[j], tolerance);
+	}
+}
+
+TEST(MlDualQuatTest, Conversion) {
+    // This test is named "Conversion", and belongs to the "MlDualQuatTest"
+    // test case.
+
+	MlRotation r(MlVector3(1, 2, -1), 0.8f);
+	MlVector3 t(1, -2, 5);
+	MlDualQuat dq(r, t);
+
+	// A rotation followed by a translation, as with MlTransform.
+	MlTransform m;
+	m.setTransform(t, r, MlVector3(1, 1, 1));
+	expectSameTransform(dq, m, 1e-5f);
+
+	MlRotation r2;
+	MlVector3 t2;
+	dq.getValue(r2, t2);
+	EXPECT_TRUE(r2.equals(r, 1e-12f));
+	EXPECT_TRUE(t2.equals(t, 1e-10f));
+
+	MlTransform m2;
+	dq.getValue(m2);
+	EXPECT_TRUE(m2.equals(m, 1e-6f));
+	EXPECT_TRUE(MlDualQuat(m).equals(dq, 1e-10f));
+
+	MlVector3 d;
+	dq.multDir(MlVector3(0, 1, 0), d);
+	MlVector3 e;
+	r.multVec(MlVector3(0, 1, 0), e);
+	EXPECT_TRUE(d.equals(e, 1e-12f));
+
+	MlVector3 p(2, 3, 4);
+	MlDualQuat::identity().multVec(p, e);
+	EXPECT_TRUE(e.equals(p, 0));
+}
+
+TEST(MlDualQuatTest, Multiply) {
+    // This test is named "Multiply", and belongs to the "MlDualQuatTest"
+    // test case.
+
+	MlDualQuat a = makeDualQuat(0.3f);
+	MlDualQuat b = makeDualQuat(0.9f);
+	MlTransform ma, mb;
+	a.getValue(ma);
+	b.getValue(mb);
+
+	// a * b applies a and then b, like the matrix product.
+	expectSameTransform(a * b, ma * mb, 1e-5f);
+
+	MlDualQuat c = a;
+	c *= b;
+	EXPECT_TRUE(c.equals(a * b, 0));
+
+	// The inverse undoes the transform.
+	EXPECT_TRUE((a * a.inverse()).equals(MlDualQuat::identity(), 1e-12f));
+	MlVector3 p(1, -3, 2), q;
+	a.multVec(p, q);
+	a.inverse().multVec(q, q);
+	EXPECT_TRUE(q.equals(p, 1e-10f));
+}
+
+TEST(MlDualQuatTest, Normalize) {
+    // This test is named "Normalize", and belongs to the "MlDualQuatTest"
+    // test case.
+
+	// Scaling a dual quaternion and disturbing its dual part along the
+	// real part does not change the transform it normalizes to.
+	MlDualQuat a = makeDualQuat(0.4f);
+	MlScalar real[4], dual[4];
+	for (int i = 0; i < 4; i++) {
+		real[i] = 2.5f * a.getReal()[i];
+		dual[i] = 2.5f * a.getDual()[i] + 0.3f * a.getReal()[i];
+	}
+	MlDualQuat b(real, dual);
+	b.normalize();
+	EXPECT_TRUE(b.equals(a, 1e-12f));
+
+	MlScalar dot = 0;
+	for (int i = 0; i < 4; i++)
+		dot += b.getReal()[i] * b.getDual()[i];
+	EXPECT_NEAR(dot, 0, 1e-6);
+}
+
+TEST(MlDualQuatTest, Sclerp) {
+    // This test is named "Sclerp", and belongs to the "MlDualQuatTest"
+    // test case.
+
+	MlDualQuat a = makeDualQuat(0.2f);
+	MlDualQuat b = makeDualQuat(0.7f);
+	EXPECT_TRUE(MlDualQuat::sclerp(a, b, 0).equals(a, 1e-10f));
+	EXPECT_TRUE(MlDualQuat::sclerp(a, b, 1).equals(b, 1e-10f));
+
+	// The rotation follows slerp().
+	for (int i = 1; i < 10; i++) {
+		MlScalar t = 0.1f * i;
+		MlRotation r = MlDualQuat::sclerp(a, b, t).getRotation();
+		MlRotation e = MlRotation::slerp(a.getRotation(), b.getRotation(), t);
+		EXPECT_TRUE(r.equals(e, 1e-10f)) << "at " << t;
+	}
+
+	// A screw about the z axis turns and slides uniformly.
+	MlDualQuat c(MlRotation(MlVector3(0, 0, 1), 0), MlVector3(1, 0, 0));
+	MlDualQuat d(MlRotation(MlVector3(0, 0, 1), 2.0f), MlVector3(1, 0, 4));
+	MlDualQuat h = MlDualQuat::sclerp(c, d, 0.25f);
+	MlVector3 axis;
+	MlScalar angle;
+	h.getRotation().getValue(axis, angle);
+	EXPECT_NEAR(angle, 0.5f, 1e-5);
+	EXPECT_NEAR(h.getTranslation()[2], 1.0f, 1e-5);
+
+	// Nearly pure translations are interpolated linearly.
+	MlDualQuat f(MlRotation::identity(), MlVector3(-2, 4, 6));
+	h = MlDualQuat::sclerp(c, f, 0.75f);
+	EXPECT_TRUE(h.getTranslation().equals(MlVector3(-1.25f, 3, 4.5f), 1e-10f));
+}
+
+TEST(MlDualQuatTest, Blend) {
+    // This test is named "Blend", and belongs to the "MlDualQuatTest"
+    // test case.
+
+	MlDualQuat dq[3] = { makeDualQuat(0.1f), makeDualQuat(0.5f), makeDualQuat(0.6f) };
+	MlScalar one[3] = { ML_SCALAR(0.0f), ML_SCALAR(1.0f), ML_SCALAR(0.0f) };
+	EXPECT_TRUE(MlDualQuat::blend(dq, one, 3).equals(dq[1], 1e-12f));
+
+	// A pair is blended along the shorter path whatever its signs, and
+	// the blend stays rigid.
+	MlScalar real[4], dual[4];
+	for (int i = 0; i < 4; i++) {
+		real[i] = -dq[2].getReal()[i];
+		dual[i] = -dq[2].getDual()[i];
+	}
+	MlDualQuat pair[2] = { dq[0], dq[2] };
+	MlDualQuat flipped[2] = { dq[0], MlDualQuat(real, dual) };
+	MlScalar half[2] = { ML_SCALAR(0.5f), ML_SCALAR(0.5f) };
+	MlDualQuat m = MlDualQuat::blend(pair, half, 2);
+	EXPECT_TRUE(MlDualQuat::blend(flipped, half, 2).equals(m, 1e-12f));
+	MlRotation r = m.getRotation();
+	MlRotation e = MlRotation::slerp(dq[0].getRotation(), dq[2].getRotation(), 0.5f);
+	EXPECT_TRUE(r.equals(e, 1e-10f));
+}
+
+TEST(MlDualQuatTest, MultVecBatch) {
+    // This test is named "MultVecBatch", and belongs to the "MlDualQuatTest"
+    // test case.
+
+	const int count = 29;
+	MlVector3 p[count], q[count];
+	for (int i = 0; i < count; i++)
+		p[i].setValue(0.5f * i, 3.0f - i, (float) (i % 4));
+
+	MlDualQuat dq = makeDualQuat(0.8f);
+	dq.multVecBatch(p, q, count);
+	for (int i = 0; i < count; i++) {
+		MlVector3 e;
+		dq.multVec(p[i], e);
+		for (int j = 0; j < 3; j++)
+			EXPECT_NEAR(q[i][j], e[j], 1e-5);
+	}
+}
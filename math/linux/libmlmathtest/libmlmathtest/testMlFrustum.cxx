@@ -0,0 +1,210 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "math/vector.h"
+#include "math/rotation.h"
+#include "math/transfrm.h"
+#include "math/matrix4.h"
+#include "math/frustum.h"
+#include "testCoord.h"
+
+// A frustum looking along a skew direction from a point off the origin.
+static void skewFrustum(MlFrustum &frustum) {
+	MlTransform camera;
+	camera.setTransform(MlVector3(1, -2, 3), MlRotation(MlVector3(1, 2, -1), ML_SCALAR(0.4f)),
+	                    MlVector3(1, 1, 1));
+	frustum.setPerspective(camera.inverse(), 1.0f, ML_SCALAR(1.5f), ML_SCALAR(0.5f), 40.0f);
+}
+
+TEST(MlFrustumTest, Planes) {
+    // This test is named "Planes", and belongs to the "MlFrustumTest"
+    // test case.
+
+	// A right angled view from the origin down the -z axis.
+	MlFrustum frustum;
+	frustum.setPerspective(MlTransform::identity(), ML_SCALAR_PI / 2, 1.0f, 1.0f, 10.0f);
+
+	MlScalar s = mlSqrt(ML_SCALAR(0.5f));
+	EXPECT_TRUE(frustum.getPlane(0).equals(MlVector4(s, 0, -s, 0), ML_SCALAR(1e-6f)));
+	EXPECT_TRUE(frustum.getPlane(1).equals(MlVector4(-s, 0, -s, 0), ML_SCALAR(1e-6f)));
+	EXPECT_TRUE(frustum.getPlane(2).equals(MlVector4(0, s, -s, 0), ML_SCALAR(1e-6f)));
+	EXPECT_TRUE(frustum.getPlane(3).equals(MlVector4(0, -s, -s, 0), ML_SCALAR(1e-6f)));
+	EXPECT_TRUE(frustum.getPlane(4).equals(MlVector4(0, 0, -1, -1), ML_SCALAR(1e-5f)));
+	EXPECT_TRUE(frustum.getPlane(5).equals(MlVector4(0, 0, 1, 10), ML_SCALAR(1e-5f)));
+
+	EXPECT_TRUE(frustum.isVisible(MlVector3(0, 0, -5), ML_SCALAR(0.1f)));
+	EXPECT_FALSE(frustum.isVisible(MlVector3(0, 0, 5), 1.0f));
+	EXPECT_FALSE(frustum.isVisible(MlVector3(0, 0, ML_SCALAR(-11.5f)), 1.0f));
+	EXPECT_TRUE(frustum.isVisible(MlVector3(0, 0, ML_SCALAR(-10.5f)), 1.0f));
+	EXPECT_FALSE(frustum.isVisible(MlVector3(7, 0, -5), 1.0f));
+	EXPECT_TRUE(frustum.isVisible(MlVector3(ML_SCALAR(5.5f), 0, -5), 1.0f));
+
+	EXPECT_TRUE(frustum.isVisible(MlVector3(-1, -1, -6), MlVector3(1, 1, -4)));
+	EXPECT_TRUE(frustum.isVisible(MlVector3(4, -1, -6), MlVector3(8, 1, -4)));
+	EXPECT_FALSE(frustum.isVisible(MlVector3(ML_SCALAR(6.5f), -1, -6), MlVector3(8, 1, -4)));
+	EXPECT_FALSE(frustum.isVisible(MlVector3(-1, -1, 0), MlVector3(1, 1, 2)));
+	EXPECT_TRUE(frustum.isVisible(MlAABB(MlVector3(-1, -1, -6), MlVector3(1, 1, -4))));
+	EXPECT_FALSE(frustum.isVisible(MlAABB()));
+	EXPECT_TRUE(frustum.isVisible(MlSphere(MlVector3(0, 0, -5), ML_SCALAR(0.1f))));
+	EXPECT_FALSE(frustum.isVisible(MlSphere(MlVector3(0, 0, 5), 1.0f)));
+	EXPECT_FALSE(frustum.isVisible(MlSphere()));
+
+	// The same planes from an orthographic view, moved by a view transform.
+	MlTransform camera;
+	camera.setTranslation(MlVector3(0, 0, 5));
+	frustum.setOrthographic(camera.inverse(), -2, 2, -1, 1, 1, 10);
+	EXPECT_TRUE(frustum.getPlane(0).equals(MlVector4(1, 0, 0, 2), ML_SCALAR(1e-6f)));
+	EXPECT_TRUE(frustum.getPlane(4).equals(MlVector4(0, 0, -1, 4), ML_SCALAR(1e-5f)));
+	EXPECT_TRUE(frustum.getPlane(5).equals(MlVector4(0, 0, 1, 5), ML_SCALAR(1e-5f)));
+}
+
+TEST(MlFrustumTest, CullSpheres) {
+    // This test is named "CullSpheres", and belongs to the "MlFrustumTest"
+    // test case.
+
+	MlFrustum frustum;
+	skewFrustum(frustum);
+
+	const int count = 1001;
+	static MlScalar x[count], y[count], z[count], r[count];
+	// Pseudo-random spheres in a cube around the frustum.
+	for (int i = 0; i < count; i++) {
+		x[i] = mlFloatToScalar(testCoord(3*i, 30));
+		y[i] = mlFloatToScalar(testCoord(3*i + 1, 30));
+		z[i] = mlFloatToScalar(testCoord(3*i + 2, 30));
+		r[i] = ML_SCALAR(0.1f) * (i % 20);
+	}
+
+	unsigned int mask[(count + 31) / 32];
+	int indices[count];
+	frustum.cullSpheres(x, y, z, r, count, mask);
+	int n = frustum.cullSpheres(x, y, z, r, count, indices);
+
+	int visible = 0;
+	for (int i = 0; i < count; i++) {
+		int expected = frustum.isVisible(MlVector3(x[i], y[i], z[i]), r[i]);
+		EXPECT_EQ((mask[i / 32] >> (i % 32)) & 1, (unsigned int) expected) << i;
+		if (expected && visible < n) {
+			EXPECT_EQ(indices[visible], i);
+		}
+		visible += expected;
+	}
+	EXPECT_EQ(n, visible);
+	EXPECT_GT(visible, 0);
+	EXPECT_LT(visible, count);
+
+	// The unused bits of the last word are clear.
+	EXPECT_EQ(mask[count / 32] >> (count % 32), 0u);
+}
+
+TEST(MlFrustumTest, CullBoxes) {
+    // This test is named "CullBoxes", and belongs to the "MlFrustumTest"
+    // test case.
+
+	MlFrustum frustum;
+	skewFrustum(frustum);
+
+	const int count = 1001;
+	static MlScalar minX[count], minY[count], minZ[count], maxX[count], maxY[count], maxZ[count];
+	for (int i = 0; i < count; i++) {
+		minX[i] = mlFloatToScalar(testCoord(3*i, 30));
+		minY[i] = mlFloatToScalar(testCoord(3*i + 1, 30));
+		minZ[i] = mlFloatToScalar(testCoord(3*i + 2, 30));
+		maxX[i] = minX[i] + ML_SCALAR(0.1f) * (i % 20);
+		maxY[i] = minY[i] + ML_SCALAR(0.1f) * (i % 7);
+		maxZ[i] = minZ[i] + ML_SCALAR(0.1f) * (i % 11);
+	}
+
+	unsigned int mask[(count + 31) / 32];
+	int indices[count];
+	frustum.cullBoxes(minX, minY, minZ, maxX, maxY, maxZ, count, mask);
+	int n = frustum.cullBoxes(minX, minY, minZ, maxX, maxY, maxZ, count, indices);
+
+	int visible = 0;
+	for (int i = 0; i < count; i++) {
+		int expected = frustum.isVisible(MlVector3(minX[i], minY[i], minZ[i]),
+		                                 MlVector3(maxX[i], maxY[i], maxZ[i]));
+		EXPECT_EQ((mask[i / 32] >> (i % 32)) & 1, (unsigned int) expected) << i;
+		if (expected && visible < n) {
+			EXPECT_EQ(indices[visible], i);
+		}
+		visible += expected;
+	}
+	EXPECT_EQ(n, visible);
+	EXPECT_GT(visible, 0);
+	EXPECT_LT(visible, count);
+	EXPECT_EQ(mask[count / 32] >> (count % 32), 0u);
+}
+
+TEST(MlFrustumTest, Threads) {
+    // This test is named "Threads", and belongs to the "MlFrustumTest"
+    // test case.
+
+	MlFrustum frustum;
+	skewFrustum(frustum);
+
+	const int count = 300007;
+	MlScalar *x = new MlScalar[count], *y = new MlScalar[count];
+	MlScalar *z = new MlScalar[count], *r = new MlScalar[count];
+	for (int i = 0; i < count; i++) {
+		x[i] = mlFloatToScalar(testCoord(3*i, 30));
+		y[i] = mlFloatToScalar(testCoord(3*i + 1, 30));
+		z[i] = mlFloatToScalar(testCoord(3*i + 2, 30));
+		r[i] = ML_SCALAR(0.05f) * (i % 40);
+	}
+
+	const int words = (count + 31) / 32;
+	unsigned int *mask1 = new unsigned int[words];
+	unsigned int *mask4 = new unsigned int[words];
+	frustum.cullSpheres(x, y, z, r, count, mask1);
+	frustum.cullSpheres(x, y, z, r, count, mask4, 4);
+	for (int i = 0; i < words; i++)
+		EXPECT_EQ(mask4[i], mask1[i]) << i;
+
+	frustum.cullBoxes(x, y, z, r, r, r, count, mask1);
+	frustum.cullBoxes(x, y, z, r, r, r, count, mask4, 0);
+	for (int i = 0; i < words; i++)
+		EXPECT_EQ(mask4[i], mask1[i]) << i;
+
+	delete [] mask4;
+	delete [] mask1;
+	delete [] r;
+	delete [] z;
+	delete [] y;
+	delete [] x;
+}
@@ -0,0 +1,186 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "math/vector.h"
+#include "math/rotation.h"
+#include "math/transfrm.h"
+#include "math/matrix4.h"
+
+// A view transform and a perspective projection, and their product.
+static MlMatrix4 viewProjection(MlMatrix4 &proj) {
+	MlTransform view;
+	view.setTransform(MlVector3(1, -2, 3), MlRotation(MlVector3(1, 2, -1), 0.4f),
+	                  MlVector3(1, 1, 1));
+	proj.setPerspective(1.0f, 1.5f, 0.5f, 100.0f);
+	return MlMatrix4(view.inverse()) * proj;
+}
+
+TEST(MlMatrix4Test, Transform) {
+    // This test is named "Transform", and belongs to the "MlMatrix4Test"
+    // test case.
+
+	MlTransform m1, m2;
+	m1.setTransform(MlVector3(1, -2, 3), MlRotation(MlVector3(1, 2, -1), 0.8f),
+	                MlVector3(2, 1, 1));
+	m2.setTransform(MlVector3(0, 4, 1), MlRotation(MlVector3(0, 1, 3), -1.3f),
+	                MlVector3(1, 1, 0.5f));
+
+	MlMatrix4 a(m1);
+	EXPECT_TRUE(a.isAffine());
+	EXPECT_EQ(a[3][3], 1.0f);
+	EXPECT_TRUE(MlMatrix4::identity().isIdentity());
+
+	MlTransform t;
+	(a * MlMatrix4(m2)).getValue(t);
+	EXPECT_TRUE(t.equals(m1 * m2, 1e-5f));
+	a.multLeft(m2).getValue(t);
+	EXPECT_TRUE(t.equals(m2 * m1, 1e-5f));
+
+	// Affine matrices invert as transforms do.
+	MlMatrix4(m1).inverse().getValue(t);
+	EXPECT_TRUE(t.equals(m1.inverse(), 1e-6f));
+	EXPECT_NEAR(MlMatrix4(m1).det(), m1.det(), 1e-5f);
+
+	MlVector3 p(3, -1, 2), b, c;
+	m1.multVecMatrix(p, b);
+	MlMatrix4(m1).multVecMatrix(p, c);
+	EXPECT_TRUE(b.equals(c, 1e-10f));
+	m1.multDirMatrix(p, b);
+	MlMatrix4(m1).multDirMatrix(p, c);
+	EXPECT_TRUE(b.equals(c, 1e-10f));
+}
+
+TEST(MlMatrix4Test, Inverse) {
+    // This test is named "Inverse", and belongs to the "MlMatrix4Test"
+    // test case.
+
+	MlMatrix4 proj;
+	MlMatrix4 m = viewProjection(proj);
+	EXPECT_FALSE(m.isAffine());
+	EXPECT_TRUE((m * m.inverse()).equals(MlMatrix4::identity(), 1e-5f));
+	EXPECT_TRUE((m.inverse() * m).equals(MlMatrix4::identity(), 1e-5f));
+	EXPECT_TRUE((proj * proj.inverse()).equals(MlMatrix4::identity(), 1e-5f));
+	EXPECT_NEAR(m.det() * m.inverse().det(), 1.0f, 1e-4f);
+	EXPECT_TRUE(m.transpose().transpose() == m);
+
+	// Points projected to normalized device coordinates unproject back.
+	MlVector3 p(0.5f, -0.25f, -10), q, r;
+	proj.multVecMatrix(p, q);
+	proj.inverse().multVecMatrix(q, r);
+	EXPECT_TRUE(r.equals(p, 1e-8f));
+
+	// A singular matrix is returned unchanged.
+	MlMatrix4 s(1, 2, 3, 4, 2, 4, 6, 8, 0, 1, 0, 1, 1, 0, 0, 1);
+	EXPECT_EQ(s.det(), 0.0f);
+	EXPECT_TRUE(s.inverse() == s);
+}
+
+TEST(MlMatrix4Test, Projection) {
+    // This test is named "Projection", and belongs to the "MlMatrix4Test"
+    // test case.
+
+	MlMatrix4 proj;
+	// A field of view of 2 atan(1/2) radians.
+	proj.setPerspective(ML_SCALAR(0.92729521800161223f), 2.0f, 1.0f, 10.0f);
+
+	// The near and far planes map to -1 and 1, and the top of the view
+	// at the near plane, half as high as the plane is distant, to 1.
+	MlVector3 q;
+	proj.multVecMatrix(MlVector3(0, 0, -1), q);
+	EXPECT_NEAR(q[2], -1.0f, 1e-6f);
+	proj.multVecMatrix(MlVector3(0, 0, -10), q);
+	EXPECT_NEAR(q[2], 1.0f, 1e-6f);
+	proj.multVecMatrix(MlVector3(1, 0.5f, -1), q);
+	EXPECT_NEAR(q[0], 1.0f, 1e-6f);
+	EXPECT_NEAR(q[1], 1.0f, 1e-6f);
+
+	// The clip space w is the distance in front of the eye.
+	MlVector4 h;
+	proj.multVecMatrix(MlVector4(3, 2, -7, 1), h);
+	EXPECT_NEAR(h[3], 7.0f, 1e-6f);
+
+	MlMatrix4 ortho;
+	ortho.setOrthographic(-2, 6, -1, 3, 1, 5);
+	ortho.multVecMatrix(MlVector3(-2, -1, -1), q);
+	EXPECT_TRUE(q.equals(MlVector3(-1, -1, -1), 1e-12f));
+	ortho.multVecMatrix(MlVector3(6, 3, -5), q);
+	EXPECT_TRUE(q.equals(MlVector3(1, 1, 1), 1e-12f));
+}
+
+TEST(MlMatrix4Test, Batch) {
+    // This test is named "Batch", and belongs to the "MlMatrix4Test"
+    // test case.
+
+	MlMatrix4 proj;
+	MlMatrix4 m = viewProjection(proj);
+
+	const int count = 37;
+	MlVector3 src[count], dst[count];
+	MlVector4 clip[count], src4[count], dst4[count];
+	for (int i = 0; i < count; i++) {
+		src[i].setValue(0.3f * i - 5, 2.0f / (i + 1), -20 + 0.25f * i);
+		src4[i].setValue(src[i][0], src[i][1], src[i][2], 0.5f + 0.1f * i);
+	}
+
+	m.multVecMatrixBatch(src, dst, count);
+	m.multVecMatrixBatch(src, clip, count);
+	m.multVecMatrixBatch(src4, dst4, count);
+	for (int i = 0; i < count; i++) {
+		MlVector3 p;
+		MlVector4 h;
+		m.multVecMatrix(src[i], p);
+		m.multVecMatrix(MlVector4(src[i][0], src[i][1], src[i][2], 1), h);
+		for (int j = 0; j < 3; j++) {
+			MlScalar tolerance = mlMul(ML_SCALAR(1e-5f), ML_SCALAR_ONE + mlAbs(p[j]));
+			EXPECT_NEAR(dst[i][j], p[j], tolerance);
+			EXPECT_NEAR(mlDiv(clip[i][j], clip[i][3]), p[j], tolerance);
+		}
+		for (int j = 0; j < 4; j++)
+			EXPECT_NEAR(clip[i][j], h[j], mlMul(ML_SCALAR(1e-5f), ML_SCALAR_ONE + mlAbs(h[j])));
+		m.multVecMatrix(src4[i], h);
+		for (int j = 0; j < 4; j++)
+			EXPECT_NEAR(dst4[i][j], h[j], mlMul(ML_SCALAR(1e-5f), ML_SCALAR_ONE + mlAbs(h[j])));
+	}
+
+	// In place.
+	m.multVecMatrixBatch(src, src, count);
+	m.multVecMatrixBatch(src4, src4, count);
+	for (int i = 0; i < count; i++) {
+		EXPECT_TRUE(src[i] == dst[i]);
+		EXPECT_TRUE(src4[i] == dst4[i]);
+	}
+}
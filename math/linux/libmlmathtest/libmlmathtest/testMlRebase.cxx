@@ -0,0 +1,108 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "math/vector.h"
+#include "math/transfrm.h"
+#include "math/vectort.h"
+#include "math/rotationt.h"
+#include "math/transfrmt.h"
+#include "math/rebase.h"
+
+TEST(MlRebaseTest, Positions) {
+    // This test is named "Positions", and belongs to the "MlRebaseTest"
+    // test case.
+
+	// Positions a few hundred kilometres out, around a camera there.
+	const MlVector3d origin(312345.678, -4321.5, 287654.321);
+	const int count = 37;
+	MlVector3d src[count];
+	MlVector3 dst[count];
+	for (int i = 0; i < count; i++)
+		src[i] = origin + MlVector3d(0.013 * i - 0.2, 1.0 / (i + 1), -0.007 * i * i);
+
+	mlRebaseBatch(src, origin, dst, count);
+	for (int i = 0; i < count; i++) {
+		MlVector3d d = src[i] - origin;
+		for (int j = 0; j < 3; j++)
+			EXPECT_EQ(dst[i][j], (float) d[j]);
+	}
+
+	// The differences keep the precision that float positions lose.
+	MlVector3 near;
+	mlRebase(src[5], origin, near);
+	MlVector3 lost = MlVector3((float) src[5][0], (float) src[5][1], (float) src[5][2]) -
+		MlVector3((float) origin[0], (float) origin[1], (float) origin[2]);
+	EXPECT_NEAR(near[0], 0.013 * 5 - 0.2, 1e-7);
+	EXPECT_GT(fabs(lost[0] - (0.013 * 5 - 0.2)), 1e-3);
+}
+
+TEST(MlRebaseTest, Transforms) {
+    // This test is named "Transforms", and belongs to the "MlRebaseTest"
+    // test case.
+
+	const MlVector3d origin(-198765.4321, 1234.5, 401234.5678);
+	const int count = 11;
+	MlTransformd src[count];
+	MlTransform dst[count];
+	for (int i = 0; i < count; i++) {
+		MlRotationd r(MlVector3d(1, 0.5 * i, -1), 0.3 * i);
+		src[i].setTransform(origin + MlVector3d(2.5 * i, -0.125, 0.01 * i), r,
+		                    MlVector3d(1, 1 + 0.1 * i, 1));
+	}
+
+	mlRebaseBatch(src, origin, dst, count);
+	const MlVector3d p(0.5, -1.25, 2);
+	for (int i = 0; i < count; i++) {
+		for (int r = 0; r < 3; r++)
+			for (int c = 0; c < 3; c++)
+				EXPECT_EQ(dst[i][r][c], (float) src[i][r][c]);
+		for (int c = 0; c < 3; c++)
+			EXPECT_EQ(dst[i][3][c], (float) (src[i][3][c] - origin[c]));
+
+		// The rebased transform maps into coordinates relative to the origin.
+		MlVector3d world;
+		src[i].multVecMatrix(p, world);
+		MlVector3 a;
+		dst[i].multVecMatrix(MlVector3((float) p[0], (float) p[1], (float) p[2]), a);
+		for (int c = 0; c < 3; c++)
+			EXPECT_NEAR(a[c], world[c] - origin[c], 1e-5);
+	}
+
+	MlTransform one;
+	mlRebase(src[3], origin, one);
+	EXPECT_TRUE(one == dst[3]);
+}
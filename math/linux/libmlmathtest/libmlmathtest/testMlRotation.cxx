@@ -38,6 +38,7 @@
 #include "math/rotation.h"
 #include "math/transfrm.h"
 #include "math/angle.h"
+#include "math/asine.h"
 
 // Print rotation for debugging purposes.
 void printTransform(MlRotation &r) {
@@ -135,3 +136,206 @@ TEST(MlRotationTest, Multiplication2) {
     EXPECT_FLOAT_EQ(q2, 0.0);
     EXPECT_FLOAT_EQ(q3, 0.9998469948768616);
 }
+
+TEST(MlRotationTest, SlerpBatch) {
+    // This test is named "SlerpBatch", and belongs to the "MlRotationTest"
+    // test case.
+
+	// Use an odd count so that the non-SIMD remainder is exercised too,
+	// with pairs on both sides of the hemisphere and nearly equal pairs.
+	const int count = 37;
+	MlRotation r0[count], r1[count], r[count];
+	MlScalar t[count];
+	for (int i = 0; i < count; i++) {
+		r0[i].setValue(MlVector3(1, 0.1f * i, -0.5f), 0.02f * i);
+		r1[i].setValue(MlVector3(0.3f - 0.05f * i, 1, 0.25f), 0.45f - 0.03f * i);
+		t[i] = (MlScalar) (i % 11) / 10;
+	}
+	r1[3] = r0[3];
+	r1[4].setValue(MlVector3(1, 0.4f, -0.5f), 0.0801f);
+
+	MlRotation::slerpBatch(r0, r1, t, r, count);
+	for (int i = 0; i < count; i++) {
+		MlRotation e = MlRotation::slerp(r0[i], r1[i], t[i]);
+		for (int j = 0; j < 4; j++)
+			EXPECT_NEAR(r[i].getValue()[j], e.getValue()[j], 2e-6);
+	}
+
+	// The result may replace the input.
+	MlRotation::slerpBatch(r0, r1, t, r0, count);
+	for (int i = 0; i < count; i++) {
+		for (int j = 0; j < 4; j++)
+			EXPECT_FLOAT_EQ(r0[i].getValue()[j], r[i].getValue()[j]);
+	}
+}
+
+TEST(MlRotationTest, Nlerp) {
+    // This test is named "Nlerp", and belongs to the "MlRotationTest"
+    // test case.
+
+	const int count = 37;
+	MlRotation r0[count], r1[count], r[count];
+	MlScalar t[count];
+	for (int i = 0; i < count; i++) {
+		r0[i].setValue(MlVector3(1, 0.1f * i, -0.5f), 0.02f * i);
+		r1[i].setValue(MlVector3(0.3f - 0.05f * i, 1, 0.25f), 0.45f - 0.03f * i);
+		t[i] = (MlScalar) (i % 11) / 10;
+	}
+
+	// The end points are reproduced, up to the sign of rot1, and the
+	// result is a unit quaternion.
+	MlRotation a = MlRotation::nlerp(r0[7], r1[7], 0);
+	MlRotation b = MlRotation::nlerp(r0[7], r1[7], 1);
+	MlScalar s = (r0[7].getValue()[3] * r1[7].getValue()[3] < 0) ? -1 : 1;
+	for (int j = 0; j < 4; j++) {
+		EXPECT_NEAR(a.getValue()[j], r0[7].getValue()[j], 1e-6);
+		EXPECT_NEAR(b.getValue()[j], s * r1[7].getValue()[j], 1e-6);
+	}
+
+	MlRotation::nlerpBatch(r0, r1, t, r, count);
+	for (int i = 0; i < count; i++) {
+		MlRotation e = MlRotation::nlerp(r0[i], r1[i], t[i]);
+		MlScalar n = 0;
+		for (int j = 0; j < 4; j++) {
+			EXPECT_NEAR(r[i].getValue()[j], e.getValue()[j], 1e-6);
+			n += e.getValue()[j] * e.getValue()[j];
+		}
+		EXPECT_NEAR(n, 1, 1e-6);
+	}
+
+	// Close rotations interpolate much as slerp() does.
+	MlRotation c0(MlVector3(0, 1, 0), 0.3f);
+	MlRotation c1(MlVector3(0, 1, 0), 0.35f);
+	MlRotation n = MlRotation::nlerp(c0, c1, 0.3f);
+	MlRotation e = MlRotation::slerp(c0, c1, 0.3f);
+	for (int j = 0; j < 4; j++)
+		EXPECT_NEAR(n.getValue()[j], e.getValue()[j], 1e-4);
+}
+
+TEST(MlRotationTest, Pack32) {
+    // This test is named "Pack32", and belongs to the "MlRotationTest"
+    // test case.
+
+	// The identity is encoded exactly.
+	MlRotation r;
+	r.unpack32(MlRotation::identity().pack32());
+	EXPECT_EQ(r.getValue()[0], 0);
+	EXPECT_EQ(r.getValue()[1], 0);
+	EXPECT_EQ(r.getValue()[2], 0);
+	EXPECT_EQ(r.getValue()[3], 1);
+
+	// Each of the components is the largest in turn, with both signs,
+	// and the decoded rotation is within the documented bound.
+	const int count = 37;
+	MlRotation rot[count], dec[count];
+	unsigned int packed[count];
+	for (int i = 0; i < count; i++) {
+		MlVector3 axis((i & 1) ? -1 : 1, 0.1f * (i % 5), 0.3f - 0.05f * i);
+		rot[i].setValue(axis, 0.17f * i - 3);
+	}
+	MlRotation::pack32Batch(rot, packed, count);
+	MlRotation::unpack32Batch(packed, dec, count);
+	for (int i = 0; i < count; i++) {
+		EXPECT_EQ(packed[i], rot[i].pack32());
+		r.unpack32(packed[i]);
+		MlScalar d = 0, e = 0;
+		for (int j = 0; j < 4; j++) {
+			EXPECT_FLOAT_EQ(dec[i].getValue()[j], r.getValue()[j]);
+			d += mlMul(r.getValue()[j], rot[i].getValue()[j]);
+		}
+		for (int j = 0; j < 4; j++) {
+			MlScalar c = r.getValue()[j] - ((d < 0) ? -1 : 1) * rot[i].getValue()[j];
+			e += mlMul(c, c);
+		}
+		EXPECT_LT(4 * mlAngleToRadians(mlAsin(mlSqrt(e) / 2)), mlMul(ML_SCALAR(0.28f / 180), ML_SCALAR_PI));
+	}
+}
+
+TEST(MlRotationTest, Pack48) {
+    // This test is named "Pack48", and belongs to the "MlRotationTest"
+    // test case.
+
+	MlRotation r;
+	unsigned short p[3];
+	MlRotation::identity().pack48(p);
+	r.unpack48(p);
+	EXPECT_EQ(r.getValue()[0], 0);
+	EXPECT_EQ(r.getValue()[1], 0);
+	EXPECT_EQ(r.getValue()[2], 0);
+	EXPECT_EQ(r.getValue()[3], 1);
+
+	// A rotation with a negative largest component is negated.
+	r.setValue(0.1f, -0.9f, 0.2f, 0.3f);
+	r.pack48(p);
+	EXPECT_EQ((p[0] >> 15) | ((p[1] >> 15) << 1), 1);
+	MlRotation n;
+	n.unpack48(p);
+	for (int j = 0; j < 4; j++)
+		EXPECT_NEAR(n.getValue()[j], -r.getValue()[j], 3e-5);
+
+	const int count = 37;
+	MlRotation rot[count], dec[count];
+	unsigned short packed[3 * count];
+	for (int i = 0; i < count; i++) {
+		MlVector3 axis(0.2f - 0.03f * i, (i & 2) ? -1 : 1, 0.1f * (i % 7));
+		rot[i].setValue(axis, 0.17f * i - 3);
+	}
+	MlRotation::pack48Batch(rot, packed, count);
+	MlRotation::unpack48Batch(packed, dec, count);
+	for (int i = 0; i < count; i++) {
+		rot[i].pack48(p);
+		EXPECT_EQ(packed[3 * i], p[0]);
+		EXPECT_EQ(packed[3 * i + 1], p[1]);
+		EXPECT_EQ(packed[3 * i + 2], p[2]);
+		r.unpack48(p);
+		MlScalar d = 0, e = 0;
+		for (int j = 0; j < 4; j++) {
+			EXPECT_FLOAT_EQ(dec[i].getValue()[j], r.getValue()[j]);
+			d += mlMul(r.getValue()[j], rot[i].getValue()[j]);
+		}
+		for (int j = 0; j < 4; j++) {
+			MlScalar c = r.getValue()[j] - ((d < 0) ? -1 : 1) * rot[i].getValue()[j];
+			e += mlMul(c, c);
+		}
+		EXPECT_LT(4 * mlAngleToRadians(mlAsin(mlSqrt(e) / 2)), mlMul(ML_SCALAR(0.0086f / 180), ML_SCALAR_PI));
+	}
+}
+
+#if !ML_FIXED_POINT && !ML_MATH_DEBUG
+TEST(MlRotationTest, ConstantExpressions) {
+    // This test is named "ConstantExpressions", and belongs to the "MlRotationTest"
+    // test case.
+
+	// A table of rotations built at compile time.
+	static constexpr MlRotation keys[] = {
+		MlRotation::identity(),
+		MlRotation::fromNormalized(0, 0, 0.6f, 0.8f)
+	};
+	static_assert(keys[0][3] == 1 && keys[1][2] == 0.6f, "constexpr rotations");
+	static_assert(keys[1] != keys[0], "constexpr comparison");
+
+	EXPECT_TRUE(keys[0] == MlRotation(0, 0, 0, 1));
+	MlVector3 axis;
+	MlScalar angle;
+	keys[1].getValue(axis, angle);
+	EXPECT_NEAR(angle, 2 * atan2(0.6, 0.8), 1e-6);
+	EXPECT_FLOAT_EQ(axis[2], 1);
+
+#if defined(ML_SQRT_CONSTANT_EVALUATED)
+	// Products normalize, so they need the compiler's help to run at
+	// compile time; the results are those of the run time exactly.
+	static constexpr MlRotation r1 = MlRotation::fromNormalized(0.28f, -0.36f, 0.48f, 0.75f);
+	static constexpr MlRotation r2 = MlRotation::fromNormalized(0, 0.6f, 0, 0.8f);
+	constexpr MlRotation rr = r1 * r2;
+	static_assert(keys[1] * keys[0] == keys[1], "constexpr product");
+	static_assert(rr[3] > 0 && rr != r1, "constexpr product");
+	static_assert(mlSqrt(2.0f) == 1.41421356f && mlRecipSqrt(4.0f) == 0.5f,
+	              "constexpr square roots");
+
+	MlRotation q1 = r1, q2 = r2;
+	MlRotation q = q1 * q2;
+	for (int j = 0; j < 4; j++)
+		EXPECT_EQ(q[j], rr[j]);
+#endif
+}
+#endif /* !ML_FIXED_POINT && !ML_MATH_DEBUG */
@@ -0,0 +1,154 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include Google Test header files.
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "math/rotation.h"
+#include "math/rotspline.h"
+
+// Expect two rotations to be equal, allowing for the sign of the quaternion.
+static void expectSameRotation(const MlRotation &a, const MlRotation &b, float tol) {
+	const MlScalar *p = a.getValue();
+	const MlScalar *q = b.getValue();
+	MlScalar s = (p[0]*q[0] + p[1]*q[1] + p[2]*q[2] + p[3]*q[3] < 0) ? -1 : 1;
+	for (int j = 0; j < 4; j++)
+		EXPECT_NEAR(p[j], s * q[j], tol);
+}
+
+// A path that turns about a changing axis, with one key on the far
+// side of the hemisphere.
+static void makeKeys(MlRotation *keys, int count, float phase) {
+	for (int i = 0; i < count; i++)
+		keys[i].setValue(MlVector3(1, 0.5f * i + phase, -0.25f * i), 0.7f * i + phase);
+	if (count > 2) {
+		const MlScalar *q = keys[2].getValue();
+		keys[2].setValue(-q[0], -q[1], -q[2], -q[3]);
+	}
+}
+
+TEST(MlRotationSplineTest, DefaultConstructor) {
+    // This test is named "DefaultConstructor", and belongs to the "MlRotationSplineTest"
+    // test case.
+
+	MlRotationSpline s;
+	EXPECT_EQ(s.getNumKeys(), 0);
+	EXPECT_EQ(s.getNumSegments(), 0);
+	expectSameRotation(s.getValue(0.5f), MlRotation::identity(), 0);
+}
+
+TEST(MlRotationSplineTest, PassesThroughKeys) {
+    // This test is named "PassesThroughKeys", and belongs to the "MlRotationSplineTest"
+    // test case.
+
+	MlRotation keys[6];
+	makeKeys(keys, 6, 0.1f);
+	MlRotationSpline s(keys, 6);
+	EXPECT_EQ(s.getNumKeys(), 6);
+	EXPECT_EQ(s.getNumSegments(), 5);
+
+	for (int i = 0; i < 6; i++)
+		expectSameRotation(s.getValue((MlScalar) i), keys[i], 1e-6);
+
+	// Positions outside the spline are clamped.
+	expectSameRotation(s.getValue(-1.0f), keys[0], 1e-6);
+	expectSameRotation(s.getValue(7.0f), keys[5], 1e-6);
+
+	// A copy evaluates the same.
+	MlRotationSpline c(s);
+	expectSameRotation(c.getValue(2.3f), s.getValue(2.3f), 0);
+}
+
+TEST(MlRotationSplineTest, SmoothAtKeys) {
+    // This test is named "SmoothAtKeys", and belongs to the "MlRotationSplineTest"
+    // test case.
+
+	MlRotation keys[5];
+	makeKeys(keys, 5, 0.2f);
+	MlRotationSpline s(keys, 5);
+
+	// The rotation across a short step on either side of each interior key
+	// is the same, to first order.
+	const float e = 1e-3f;
+	for (int i = 1; i < 4; i++) {
+		MlRotation a = s.getValue(i - e);
+		MlRotation b = s.getValue((MlScalar) i);
+		MlRotation c = s.getValue(i + e);
+		expectSameRotation(b * a.inverse(), c * b.inverse(), 2e-6);
+	}
+}
+
+TEST(MlRotationSplineTest, UniformRotation) {
+    // This test is named "UniformRotation", and belongs to the "MlRotationSplineTest"
+    // test case.
+
+	// Keys at equal steps about one axis need no correction, so the
+	// control points are the keys and squad reduces to slerp.
+	MlVector3 axis(0.3f, 1, -0.2f);
+	MlRotation k0(axis, 0.4f), k1(axis, 0.9f), k2(axis, 1.4f);
+	expectSameRotation(MlRotation::squadControl(k0, k1, k2), k1, 1e-6);
+
+	MlRotation keys[3] = { k0, k1, k2 };
+	MlRotationSpline s(keys, 3);
+	expectSameRotation(s.getValue(1.25f), MlRotation(axis, 1.025f), 1e-6);
+}
+
+TEST(MlRotationSplineTest, GetValueBatch) {
+    // This test is named "GetValueBatch", and belongs to the "MlRotationSplineTest"
+    // test case.
+
+	// Splines of different lengths, including empty and constant ones,
+	// in a count that is not a whole number of blocks.
+	const int count = 71;
+	MlRotationSpline splines[count];
+	for (int i = 0; i < count; i++) {
+		MlRotation keys[8];
+		int n = i % 9;
+		makeKeys(keys, n, 0.01f * i);
+		splines[i].setValue(keys, n);
+	}
+
+	MlRotation r[count];
+	const MlScalar u[] = {
+		ML_SCALAR(-0.5f), ML_SCALAR(0.0f), ML_SCALAR(0.3f), ML_SCALAR(1.0f),
+		ML_SCALAR(2.75f), ML_SCALAR(6.5f), ML_SCALAR(9.0f)
+	};
+	for (int k = 0; k < (int) (sizeof(u) / sizeof(u[0])); k++) {
+		MlRotationSpline::getValueBatch(splines, count, u[k], r);
+		for (int i = 0; i < count; i++)
+			expectSameRotation(r[i], splines[i].getValue(u[k]), 2e-6);
+	}
+}
@@ -0,0 +1,401 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "math/vector.h"
+#include "math/rotation.h"
+#include "math/transfrm.h"
+#include "math/scalart.h"
+#include "math/vectort.h"
+#include "math/rotationt.h"
+#include "math/transfrmt.h"
+
+// Rotates and transforms a few points with scalars of type S, and checks
+// them against the same computed in double.
+template <class S>
+static void checkScalarType(double tolerance) {
+	MlVector3d axisd(1, 2, -1);
+	MlRotationd rd(axisd, 0.8);
+	MlVector3d td(3, -2, 5), sd(2, 1, 0.5);
+	MlTransformd md;
+	md.setTransform(td, rd, sd);
+
+	MlRotationT<S> r(MlVector3T<S>(axisd), S(0.8));
+	MlTransformT<S> m;
+	m.setTransform(MlVector3T<S>(td), r, MlVector3T<S>(sd));
+
+	MlVector3d points[] = { MlVector3d(0, 0, 0), MlVector3d(1, 2, 3), MlVector3d(-4, 0.5, 2) };
+	for (int i = 0; i < 3; i++) {
+		MlVector3d ad, bd;
+		rd.multVec(points[i], ad);
+		md.multVecMatrix(points[i], bd);
+
+		MlVector3T<S> a, b, c;
+		r.multVec(MlVector3T<S>(points[i]), a);
+		m.multVecMatrix(MlVector3T<S>(points[i]), b);
+		m.inverse().multVecMatrix(b, c);
+		for (int j = 0; j < 3; j++) {
+			EXPECT_NEAR(mlScalarCast<double>(a[j]), ad[j], tolerance);
+			EXPECT_NEAR(mlScalarCast<double>(b[j]), bd[j], tolerance);
+			EXPECT_NEAR(mlScalarCast<double>(c[j]), points[i][j], tolerance);
+		}
+	}
+
+	// Halfway between the identity and r is half the angle.
+	MlRotationT<S> half = MlRotationT<S>::slerp(MlRotationT<S>::identity(), r, S(0.5f));
+	MlVector3T<S> axis;
+	S radians;
+	half.getValue(axis, radians);
+	EXPECT_NEAR(mlScalarCast<double>(radians), 0.4, tolerance);
+	EXPECT_TRUE((r * r.inverse()).equals(MlRotationT<S>::identity(), S(tolerance)));
+}
+
+TEST(MlScalarTypesTest, FixedArithmetic) {
+    // This test is named "FixedArithmetic", and belongs to the "MlScalarTypesTest"
+    // test case.
+
+	EXPECT_EQ(MlFixed16(1.5f) * MlFixed16(2.25f), MlFixed16(3.375f));
+	EXPECT_EQ(MlFixed12(1.5f) * MlFixed12(2.25f), MlFixed12(3.375f));
+	EXPECT_EQ(MlFixed16(1).getValue(), 0x10000);
+	EXPECT_EQ(MlFixed12(1).getValue(), 0x1000);
+	EXPECT_EQ((MlFixed16(7) / MlFixed16(2)).getValue(), 0x38000);
+
+	// Products and quotients truncate toward zero, as FixedMultiply() and
+	// FixedDivide() do.
+	EXPECT_EQ((MlFixed16::fromRaw(-3) * MlFixed16(0.5f)).getValue(), -1);
+	EXPECT_EQ((MlFixed16::fromRaw(3) * MlFixed16(0.5f)).getValue(), 1);
+	EXPECT_EQ((MlFixed16::fromRaw(-1) / MlFixed16(3)).getValue(), 0);
+
+	// Conversions round to nearest.
+	EXPECT_EQ(MlFixed16(1.0 / 3.0).getValue(), 21845);
+	EXPECT_EQ(MlFixed16(-1.0 / 3.0).getValue(), -21845);
+	EXPECT_EQ(MlFixed16(2.0 / 3.0).getValue(), 43691);
+
+	// Out of range results saturate.
+	EXPECT_EQ((MlFixed16(30000) * MlFixed16(30000)).getValue(), 0x7fffffff);
+	EXPECT_EQ((MlFixed16(-30000) * MlFixed16(30000)).getValue(), -0x7fffffff);
+	EXPECT_EQ((MlFixed16(30000) + MlFixed16(30000)).getValue(), 0x7fffffff);
+	EXPECT_EQ(MlFixed16(1e10).getValue(), 0x7fffffff);
+	EXPECT_EQ((MlFixed16(1) / MlFixed16(0)).getValue(), 0x7fffffff);
+	EXPECT_EQ((MlFixed16(-1) / MlFixed16(0)).getValue(), -0x7fffffff);
+	EXPECT_EQ(MlFixed16(0) / MlFixed16(0), MlFixed16(1));
+
+	EXPECT_EQ(MlScalarTraits<MlFixed16>::sqrt(MlFixed16(2)).getValue(), 92682);
+	EXPECT_EQ(MlScalarTraits<MlFixed12>::sqrt(MlFixed12(16)), MlFixed12(4));
+
+	// The length of a vector does not overflow with its squared length.
+	MlVector3x16 v(MlFixed16(20000), MlFixed16(20000), MlFixed16(0));
+	EXPECT_NEAR(mlScalarCast<double>(v.length()), 20000 * sqrt(2.0), 1.0 / 65536);
+}
+
+// The library's fixed point functions for a radix, transcribed on raw
+// values from sqrt.cxx, sine.cxx, asine.cxx and fixed.cxx, with tables
+// from the same generators. The float build has no fixed point functions
+// to call, so the traits of MlFixed are checked against these.
+template <int RADIX>
+struct FixedLibrary
+{
+	// FixedMultiply(): truncated toward zero, then saturated.
+	static long multiply(long a, long b)
+	{
+		long long prod = (long long) a * b;
+		prod += (prod >> 63) & ((1 << RADIX) - 1);
+		prod >>= RADIX;
+		return (prod > 0x7fffffff) ? 0x7fffffff : (prod < -0x7fffffff) ? -0x7fffffff : (long) prod;
+	}
+
+	// mlRadiansToAngle() and mlAngleToRadians(), with the constants of
+	// ML_SCALAR().
+	static long radiansToAngle(long x)
+	{ return multiply(x, (long) (5.09295817894065075808 * (float) (1 << RADIX))) >> 5; }
+	static long angleToRadians(long a)
+	{ return multiply((long) (6.2831853071795864f * (float) (1 << RADIX)), a); }
+
+	// fixedSqrt().
+	static unsigned long sqrt(uint32_t op)
+	{
+		static constexpr auto lut = mlSqrtLut<ML_FIXED_SQRT_LUT_BITS, RADIX>();
+		const int indexShift = 32 - ML_FIXED_SQRT_LUT_BITS;
+		const unsigned long indexMask = ((1UL << ML_FIXED_SQRT_LUT_BITS) - 1) << indexShift;
+
+		int shift = mlFixedClz(op) >> 1;
+		op <<= 2 * shift;
+		unsigned long estimate =
+			lut.value[((indexMask & op) >> indexShift) - (1 << (ML_FIXED_SQRT_LUT_BITS - 2))];
+		uint64_t sOp = ((uint64_t) op + 1) >> 1;
+		unsigned long div = (unsigned long) ((sOp << RADIX) / estimate) << 1;
+		if (div > estimate)
+			estimate += (div - estimate) >> 1;
+		else
+			estimate -= (estimate - div) >> 1;
+		return (estimate + ((1UL << shift) >> 1)) >> shift;
+	}
+
+	// FixedTableInterp() and FixedShortTableInterp().
+	template <class T>
+	static long interpolate(const T table[], unsigned long index, unsigned long remdr,
+	                        unsigned long sign, long remdrShift)
+	{
+		long lower = table[index];
+		if (remdr != 0)
+			lower += ((table[index + 1] - lower) * ((long) remdr << remdrShift) +
+			          (1 << (RADIX - 1))) >> RADIX;
+		return sign ? -lower : lower;
+	}
+
+	// sineTableIndex() and cosineTableIndex().
+	enum
+	{
+		INDEX_SHIFT = RADIX - 2 - ML_FIXED_SINE_LUT_BITS,
+		INDEX_MASK = ((2 << ML_FIXED_SINE_LUT_BITS) - 1) << INDEX_SHIFT,
+		REMDR_MASK = (1 << INDEX_SHIFT) - 1,
+		ONE_HALF = 0x1 << (RADIX - 1),
+		ONE_FOURTH = 0x1 << (RADIX - 2),
+		THREE_FOURTHS = 0x11 << (RADIX - 2)
+	};
+
+	static void sineTableIndex(unsigned long a, unsigned long &index, unsigned long &remdr,
+	                           unsigned long &sign)
+	{
+		switch ((a >> (RADIX - 2)) & 0x3) {
+		case 0x0:
+			sign = 0;
+			index = (a & INDEX_MASK) >> INDEX_SHIFT;
+			remdr = a & REMDR_MASK;
+			break;
+		case 0x1:
+			sign = 0;
+			index = ((ONE_HALF - a) & INDEX_MASK) >> INDEX_SHIFT;
+			remdr = (ONE_HALF - a) & REMDR_MASK;
+			break;
+		case 0x2:
+			sign = 1;
+			index = (a & INDEX_MASK) >> INDEX_SHIFT;
+			remdr = a & REMDR_MASK;
+			break;
+		default:
+			sign = 1;
+			index = ((ONE_HALF - a) & INDEX_MASK) >> INDEX_SHIFT;
+			remdr = (ONE_HALF - a) & REMDR_MASK;
+			break;
+		}
+	}
+
+	static void cosineTableIndex(unsigned long a, unsigned long &index, unsigned long &remdr,
+	                             unsigned long &sign)
+	{
+		switch ((a >> (RADIX - 2)) & 0x3) {
+		case 0x0:
+			sign = 0;
+			index = ((ONE_FOURTH - a) & INDEX_MASK) >> INDEX_SHIFT;
+			remdr = (ONE_FOURTH - a) & REMDR_MASK;
+			break;
+		case 0x1:
+			sign = 1;
+			index = (a & (INDEX_MASK >> 1)) >> INDEX_SHIFT;
+			remdr = a & REMDR_MASK;
+			break;
+		case 0x2:
+			sign = 1;
+			index = ((THREE_FOURTHS - a) & INDEX_MASK) >> INDEX_SHIFT;
+			remdr = (THREE_FOURTHS - a) & REMDR_MASK;
+			break;
+		default:
+			sign = 0;
+			index = (a & (INDEX_MASK >> 1)) >> INDEX_SHIFT;
+			remdr = a & REMDR_MASK;
+			break;
+		}
+	}
+
+	// FixedSin() and FixedCos().
+	static long sin(long x)
+	{
+		static constexpr auto lut = mlSineLut<ML_FIXED_SINE_LUT_BITS, RADIX>();
+		unsigned long index, remdr, sign;
+		sineTableIndex(x, index, remdr, sign);
+		return interpolate(lut.value, index, remdr, sign, RADIX - INDEX_SHIFT);
+	}
+
+	static long cos(long x)
+	{
+		static constexpr auto lut = mlSineLut<ML_FIXED_SINE_LUT_BITS, RADIX>();
+		unsigned long index, remdr, sign;
+		cosineTableIndex(x, index, remdr, sign);
+		return interpolate(lut.value, index, remdr, sign, RADIX - INDEX_SHIFT);
+	}
+
+	// FixedAcos(), a quarter turn less FixedAsin().
+	static long acos(long opX)
+	{
+		static constexpr auto lut = mlAsinLut<ML_FIXED_ASIN_LUT_BITS, RADIX>();
+		const int indexShift = RADIX - ML_FIXED_ASIN_LUT_BITS;
+		const unsigned long indexMask = ((1UL << ML_FIXED_ASIN_LUT_BITS) - 1) << indexShift;
+
+		long asin;
+		if (opX >= (1 << RADIX))
+			asin = 1 << (RADIX - 2);
+		else if (opX <= -(1 << RADIX))
+			asin = -(1 << (RADIX - 2));
+		else {
+			unsigned long sign = (opX < 0);
+			unsigned long op = sign ? -opX : opX;
+			asin = interpolate(lut.value, (op & indexMask) >> indexShift,
+			                   op & ((1 << indexShift) - 1), sign, RADIX - indexShift);
+		}
+		return (1 << (RADIX - 2)) - asin;
+	}
+};
+
+// Checks that the traits of MlFixed<RADIX> give the bits of the library's
+// functions built with ML_FIXED_RADIX set to RADIX.
+template <int RADIX>
+static void checkFixedLibrary() {
+	typedef MlFixed<RADIX> Fixed;
+	typedef MlScalarTraits<Fixed> Traits;
+	typedef FixedLibrary<RADIX> Library;
+
+	for (int64_t raw = 1; raw <= 0x7fffffff; raw += raw / 512 + 1)
+		EXPECT_EQ(Traits::sqrt(Fixed::fromRaw((int32_t) raw)).getValue(), Library::sqrt((uint32_t) raw));
+	for (int32_t raw = -(8 << RADIX); raw <= 8 << RADIX; raw++) {
+		Fixed x = Fixed::fromRaw(raw);
+		long a = Library::radiansToAngle(raw);
+		EXPECT_EQ(Traits::sin(x).getValue(), Library::sin(a));
+		EXPECT_EQ(Traits::cos(x).getValue(), Library::cos(a));
+	}
+	for (int32_t raw = -(1 << RADIX) - 2; raw <= (1 << RADIX) + 2; raw++)
+		EXPECT_EQ(Traits::acos(Fixed::fromRaw(raw)).getValue(),
+		          Library::angleToRadians(Library::acos(raw)));
+}
+
+TEST(MlScalarTypesTest, FixedLibraryResults) {
+    // This test is named "FixedLibraryResults", and belongs to the "MlScalarTypesTest"
+    // test case.
+
+	// The functions of MlFixed16 and MlFixed12 give the bits of those of
+	// the 16.16 and 20.12 libraries, whose tables they share.
+	checkFixedLibrary<16>();
+	checkFixedLibrary<12>();
+}
+
+TEST(MlScalarTypesTest, Conversion) {
+    // This test is named "Conversion", and belongs to the "MlScalarTypesTest"
+    // test case.
+
+	// Fixed point values are exact in double and in another fixed point
+	// type of the same radix.
+	MlVector3x16 v(MlFixed16::fromRaw(1), MlFixed16(-2.5f), MlFixed16(1000));
+	MlVector3d vd(v);
+	EXPECT_EQ(vd[0], 1.0 / 65536);
+	EXPECT_TRUE(MlVector3x16(vd) == v);
+
+	// Radix 16 to radix 12 rounds to nearest.
+	MlVector3x12 v12(v);
+	EXPECT_EQ(v12[0].getValue(), 0);
+	EXPECT_EQ(v12[1], MlFixed12(-2.5f));
+
+	// The native scalar type converts exactly to and from MlScalar.
+	MlVector3 n(ML_SCALAR(0.1f), ML_SCALAR(-7.25f), ML_SCALAR(3.0f));
+	MlVector3T<MlNativeScalar> nt(n);
+	MlVector3 n2;
+	nt.getValue(n2);
+	EXPECT_TRUE(n2 == n);
+
+	MlRotation r(MlVector3(1, -1, 2), ML_SCALAR(0.5f));
+	MlRotation r2;
+	MlRotationT<MlNativeScalar>(r).getValue(r2);
+	EXPECT_TRUE(r2.equals(r, ML_SCALAR(1e-12f)));
+
+	MlTransform m;
+	m.setTransform(MlVector3(1, 2, 3), r, MlVector3(1, 2, 1));
+	MlTransform m2;
+	MlTransformT<MlNativeScalar>(m).getValue(m2);
+	EXPECT_TRUE(m2 == m);
+}
+
+TEST(MlScalarTypesTest, SameConventions) {
+    // This test is named "SameConventions", and belongs to the "MlScalarTypesTest"
+    // test case.
+
+	MlRotation r1(MlVector3(1, 2, -1), 0.8f);
+	MlRotation r2(MlVector3(0, 1, 3), -1.3f);
+	MlRotationf r1f(r1), r2f(r2);
+
+	MlRotation r3;
+	(r1f * r2f).getValue(r3);
+	EXPECT_TRUE(r3.equals(r1 * r2, 1e-12f));
+	MlRotationf::slerp(r1f, r2f, 0.3f).getValue(r3);
+	EXPECT_TRUE(r3.equals(MlRotation::slerp(r1, r2, 0.3f), 1e-12f));
+
+	MlTransform m1, m2;
+	m1.setTransform(MlVector3(1, -2, 3), r1, MlVector3(2, 1, 1));
+	m2.setTransform(MlVector3(0, 4, 1), r2, MlVector3(1, 1, 0.5f));
+	MlTransformf m1f(m1), m2f(m2);
+
+	MlTransformf mf;
+	mf.setTransform(MlVector3f(1, -2, 3), r1f, MlVector3f(2, 1, 1));
+	EXPECT_TRUE(mf.equals(m1f, 1e-6f));
+
+	MlTransform m3;
+	(m1f * m2f).getValue(m3);
+	EXPECT_TRUE(m3.equals(m1 * m2, 1e-5f));
+	m1f.inverse().getValue(m3);
+	EXPECT_TRUE(m3.equals(m1.inverse(), 1e-5f));
+
+	MlVector3 p(3, -1, 2), a, b;
+	MlVector3f af, bf;
+	r1.multVec(p, a);
+	r1f.multVec(MlVector3f(p), af);
+	m1.multVecMatrix(p, b);
+	m1f.multVecMatrix(MlVector3f(p), bf);
+	MlVector3 a2, b2;
+	af.getValue(a2);
+	bf.getValue(b2);
+	EXPECT_TRUE(a2.equals(a, 1e-10f));
+	EXPECT_TRUE(b2.equals(b, 1e-10f));
+}
+
+TEST(MlScalarTypesTest, AllTypes) {
+    // This test is named "AllTypes", and belongs to the "MlScalarTypesTest"
+    // test case.
+
+	checkScalarType<float>(1e-5);
+	checkScalarType<double>(1e-12);
+	// The fixed point types have the accuracy of the library's tables;
+	// the arc cosine is least accurate near one, as for small angles.
+	checkScalarType<MlFixed16>(3e-3);
+	checkScalarType<MlFixed12>(3e-2);
+}
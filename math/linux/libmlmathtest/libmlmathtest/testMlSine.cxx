@@ -0,0 +1,184 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+
+// Include system header files.
+#include <math.h>
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "math/sine.h"
+#include "math/atan.h"
+#include "math/asine.h"
+#include "math/angle.h"
+
+TEST(MlSineTest, SinCosQuadrants) {
+    // This test is named "SinCosQuadrants", and belongs to the "MlSineTest"
+    // test case.
+
+	// Whole quarter turns are reduced exactly.
+	float s, c;
+	mlFloatSinCos(0.0f, s, c);
+	EXPECT_EQ(s, 0.0f);
+	EXPECT_EQ(c, 1.0f);
+	mlFloatSinCos(0.25f, s, c);
+	EXPECT_EQ(s, 1.0f);
+	EXPECT_EQ(c, 0.0f);
+	mlFloatSinCos(0.5f, s, c);
+	EXPECT_EQ(s, 0.0f);
+	EXPECT_EQ(c, -1.0f);
+	mlFloatSinCos(-0.25f, s, c);
+	EXPECT_EQ(s, -1.0f);
+	EXPECT_EQ(c, 0.0f);
+	mlFloatSinCos(3.0f, s, c);
+	EXPECT_EQ(s, 0.0f);
+	EXPECT_EQ(c, 1.0f);
+
+	MlScalar ms, mc;
+	mlSinCos(ML_ANGLE_PI_FOURTH, ms, mc);
+	EXPECT_FLOAT_EQ(ms, 0.70710678f);
+	EXPECT_FLOAT_EQ(mc, 0.70710678f);
+}
+
+TEST(MlSineTest, SinCosAccuracy) {
+    // This test is named "SinCosAccuracy", and belongs to the "MlSineTest"
+    // test case.
+
+	const double twoPi = 6.283185307179586;
+	for (int i = -2000; i <= 2000; i++) {
+	    float turns = i * 0.00137f;
+	    double rs = sin(twoPi * turns);
+	    double rc = cos(twoPi * turns);
+	    float s, c;
+
+	    mlFloatSinCos(turns, s, c, ML_SINCOS_FULL);
+	    EXPECT_NEAR(s, rs, 2.0e-7);
+	    EXPECT_NEAR(c, rc, 2.0e-7);
+	    mlFloatSinCos(turns, s, c, ML_SINCOS_MEDIUM);
+	    EXPECT_NEAR(s, rs, 1.2e-5);
+	    EXPECT_NEAR(c, rc, 1.2e-5);
+	    mlFloatSinCos(turns, s, c, ML_SINCOS_FAST);
+	    EXPECT_NEAR(s, rs, 2.0e-3);
+	    EXPECT_NEAR(c, rc, 2.0e-3);
+	}
+}
+
+TEST(MlSineTest, SinCosBatch) {
+    // This test is named "SinCosBatch", and belongs to the "MlSineTest"
+    // test case.
+
+	// Use a count that leaves a remainder for every SIMD width.
+	const int count = 1003;
+	MlScalar angles[count], s[count], c[count];
+	for (int i = 0; i < count; i++)
+	    angles[i] = (i - 500) * 0.00731f;
+
+	const int tiers[3] = { ML_SINCOS_FULL, ML_SINCOS_MEDIUM, ML_SINCOS_FAST };
+	const float bounds[3] = { 2.0e-7f, 1.2e-5f, 2.0e-3f };
+	for (int k = 0; k < 3; k++) {
+	    mlSinCosBatch(angles, s, c, count, tiers[k]);
+	    for (int i = 0; i < count; i++) {
+	        float es, ec;
+	        mlFloatSinCos(angles[i], es, ec, tiers[k]);
+	        EXPECT_NEAR(s[i], es, 1.2e-7);
+	        EXPECT_NEAR(c[i], ec, 1.2e-7);
+	        EXPECT_NEAR(s[i], sin(6.283185307179586 * angles[i]), bounds[k]);
+	        EXPECT_NEAR(c[i], cos(6.283185307179586 * angles[i]), bounds[k]);
+	    }
+	}
+
+	// Whole quarter turns are exact in the batch version as well.
+	angles[0] = 0.25f;
+	angles[1] = -0.5f;
+	mlSinCosBatch(angles, s, c, 2);
+	EXPECT_EQ(s[0], 1.0f);
+	EXPECT_EQ(c[0], 0.0f);
+	EXPECT_EQ(s[1], 0.0f);
+	EXPECT_EQ(c[1], -1.0f);
+}
+
+TEST(MlSineTest, Atan2Batch) {
+    // This test is named "Atan2Batch", and belongs to the "MlSineTest"
+    // test case.
+
+	const int count = 1001;
+	MlScalar y[count], x[count], angles[count];
+	for (int i = 0; i < count; i++) {
+	    float a = i * 0.0062831853f;
+	    float r = 0.5f + (i % 7);
+	    y[i] = r * sinf(a);
+	    x[i] = r * cosf(a);
+	}
+	// Axes and signed zeros.
+	y[0] = 0.0f;  x[0] = 0.0f;
+	y[1] = 0.0f;  x[1] = -2.0f;
+	y[2] = -0.0f; x[2] = -2.0f;
+	y[3] = 3.0f;  x[3] = 0.0f;
+	y[4] = -3.0f; x[4] = 0.0f;
+
+	mlAtan2Batch(y, x, angles, count);
+	for (int i = 0; i < count; i++)
+	    EXPECT_NEAR(angles[i], mlAtan2(y[i], x[i]), 1.0e-7);
+
+	EXPECT_EQ(angles[0], 0.0f);
+	EXPECT_EQ(angles[1], ML_ANGLE_PI);
+	EXPECT_EQ(angles[2], -ML_ANGLE_PI);
+	EXPECT_EQ(angles[3], ML_ANGLE_PI_HALF);
+	EXPECT_EQ(angles[4], -ML_ANGLE_PI_HALF);
+}
+
+TEST(MlSineTest, AsinAcosBatch) {
+    // This test is named "AsinAcosBatch", and belongs to the "MlSineTest"
+    // test case.
+
+	const int count = 1001;
+	MlScalar x[count], as[count], ac[count];
+	for (int i = 0; i < count; i++)
+	    x[i] = (i - 500) / 500.0f;
+
+	mlAsinBatch(x, as, count);
+	mlAcosBatch(x, ac, count);
+	for (int i = 0; i < count; i++) {
+	    EXPECT_NEAR(as[i], mlAsin(x[i]), 1.0e-7);
+	    EXPECT_NEAR(ac[i], mlAcos(x[i]), 1.0e-7);
+	}
+
+	EXPECT_EQ(as[0], -ML_ANGLE_PI_HALF);
+	EXPECT_EQ(as[500], 0.0f);
+	EXPECT_EQ(as[1000], ML_ANGLE_PI_HALF);
+	EXPECT_EQ(ac[0], ML_ANGLE_PI);
+	EXPECT_EQ(ac[500], ML_ANGLE_PI_HALF);
+	EXPECT_EQ(ac[1000], 0.0f);
+}
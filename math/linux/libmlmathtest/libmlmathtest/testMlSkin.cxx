@@ -0,0 +1,279 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include Google Test header files.
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include system header files.
+#include <math.h>
+
+// Include Magic Lantern header files.
+#include "math/vector.h"
+#include "math/rotation.h"
+#include "math/transfrm.h"
+#include "math/dualquat.h"
+#include "math/skin.h"
+
+// A palette of bones with rotation, translation and uniform scale.
+static const int skinBones = 9;
+
+static void makeSkinPalette(MlTransform *palette, float phase) {
+	for (int i = 0; i < skinBones; i++) {
+		MlRotation r(MlVector3(1, 0.3f * i, -0.5f), 0.7f * i + phase);
+		MlScalar s = 0.75f + 0.125f * i;
+		palette[i].setTransform(MlVector3(i - phase, 0.5f * i, 2.0f - i), r, MlVector3(s, s, s));
+	}
+}
+
+// Bind positions, normals and up to four influences per vertex, with some
+// weights left unnormalized and some slots unused.
+static void makeSkinMesh(MlVector3 *p, MlVector3 *n, MlSkinInfluence *inf, int count) {
+	for (int i = 0; i < count; i++) {
+		p[i].setValue(0.01f * i - 3.0f, (float) ((i * 7) % 13) - 6.0f, 0.5f * (i % 5));
+		n[i].setValue(1.0f, 0.1f * (i % 9), -0.2f * (i % 4));
+		n[i].normalize();
+		int used = 1 + i % 4;
+		for (int j = 0; j < 4; j++) {
+			inf[i].bone[j] = (i + 3 * j) % skinBones;
+			inf[i].weight[j] = (j < used) ? 1.0f + j + 0.25f * (i % 3) : 0.0f;
+		}
+	}
+}
+
+// Skins one vertex by blending the bone transforms in double precision.
+static void skinVertex(const MlTransform *palette, const MlSkinInfluence &inf,
+                       const MlVector3 &p, const MlVector3 &n, double *rp, double *rn) {
+	double m[4][3] = { { 0 } };
+	double sum = 0;
+	for (int j = 0; j < 4; j++)
+		sum += inf.weight[j];
+	for (int j = 0; j < 4; j++) {
+		const MlTrans &b = palette[inf.bone[j]].getValue();
+		for (int r = 0; r < 4; r++)
+			for (int c = 0; c < 3; c++)
+				m[r][c] += inf.weight[j] / sum * b.m[r][c];
+	}
+	double l = 0;
+	for (int c = 0; c < 3; c++) {
+		rp[c] = p[0] * m[0][c] + p[1] * m[1][c] + p[2] * m[2][c] + m[3][c];
+		rn[c] = n[0] * m[0][c] + n[1] * m[1][c] + n[2] * m[2][c];
+		l += rn[c] * rn[c];
+	}
+	for (int c = 0; c < 3; c++)
+		rn[c] /= sqrt(l);
+}
+
+TEST(MlSkinTest, SingleBone) {
+    // This test is named "SingleBone", and belongs to the "MlSkinTest"
+    // test case.
+
+	// A vertex bound to a single bone moves as multVecMatrix() and
+	// multDirMatrix() would move it.
+	MlTransform palette[skinBones];
+	makeSkinPalette(palette, 0.2f);
+
+	const int count = 23;
+	MlVector3 p[count], n[count], rp[count], rn[count];
+	MlSkinInfluence inf[count];
+	makeSkinMesh(p, n, inf, count);
+	for (int i = 0; i < count; i++) {
+		for (int j = 1; j < 4; j++)
+			inf[i].weight[j] = 0;
+		inf[i].weight[0] = 0.5f;
+	}
+
+	MlSkin skin(p, n, inf, count);
+	skin.apply(palette, skinBones, rp, rn);
+	for (int i = 0; i < count; i++) {
+		MlVector3 ep, en;
+		palette[inf[i].bone[0]].multVecMatrix(p[i], ep);
+		palette[inf[i].bone[0]].multDirMatrix(n[i], en);
+		en.normalize();
+		EXPECT_TRUE(rp[i].equals(ep, 1e-10f)) << "at " << i;
+		EXPECT_TRUE(rn[i].equals(en, 1e-10f)) << "at " << i;
+	}
+}
+
+TEST(MlSkinTest, Blend) {
+    // This test is named "Blend", and belongs to the "MlSkinTest"
+    // test case.
+
+	MlTransform palette[skinBones];
+	makeSkinPalette(palette, 0.6f);
+
+	const int count = 37;
+	MlVector3 p[count], n[count], rp[count], rn[count];
+	MlSkinInfluence inf[count];
+	makeSkinMesh(p, n, inf, count);
+
+	MlSkin skin(p, n, inf, count);
+	EXPECT_EQ(skin.getNumVertices(), count);
+	EXPECT_EQ(skin.getNumBones(), skinBones);
+
+	// The weights are normalized, and unused slots point at bone 0.
+	for (int i = 0; i < count; i++) {
+		const MlSkinInfluence &s = skin.getInfluences()[i];
+		EXPECT_NEAR(s.weight[0] + s.weight[1] + s.weight[2] + s.weight[3], 1.0f, 1e-6);
+		for (int j = 0; j < 4; j++) {
+			if (inf[i].weight[j] == 0) {
+				EXPECT_EQ(s.bone[j], 0);
+			}
+		}
+	}
+
+	skin.apply(palette, skinBones, rp, rn);
+	for (int i = 0; i < count; i++) {
+		double ep[3], en[3];
+		skinVertex(palette, inf[i], p[i], n[i], ep, en);
+		for (int c = 0; c < 3; c++) {
+			EXPECT_NEAR(rp[i][c], ep[c], 2e-5) << "at " << i;
+			EXPECT_NEAR(rn[i][c], en[c], 2e-6) << "at " << i;
+		}
+	}
+
+	// Positions may be skinned without normals, and a copy skins alike.
+	MlVector3 cp[count];
+	MlSkin copy(skin);
+	copy.apply(palette, skinBones, cp, NULL);
+	for (int i = 0; i < count; i++)
+		EXPECT_TRUE(cp[i].equals(rp[i], 0));
+}
+
+TEST(MlSkinTest, Threads) {
+    // This test is named "Threads", and belongs to the "MlSkinTest"
+    // test case.
+
+	// Enough vertices to be split between threads, and a count that
+	// leaves a partial block.
+	const int count = 20011;
+	MlTransform palette[skinBones];
+	makeSkinPalette(palette, 1.1f);
+	MlVector3 *p = new MlVector3[count];
+	MlVector3 *n = new MlVector3[count];
+	MlSkinInfluence *inf = new MlSkinInfluence[count];
+	makeSkinMesh(p, n, inf, count);
+
+	MlVector3 *rp = new MlVector3[count];
+	MlVector3 *rn = new MlVector3[count];
+	MlVector3 *tp = new MlVector3[count];
+	MlVector3 *tn = new MlVector3[count];
+	MlSkin skin(p, n, inf, count);
+	skin.apply(palette, skinBones, rp, rn);
+
+	const int threads[] = { 4, 0, 3 };
+	for (int k = 0; k < 3; k++) {
+		skin.apply(palette, skinBones, tp, tn, threads[k]);
+		for (int i = 0; i < count; i++) {
+			EXPECT_TRUE(tp[i].equals(rp[i], 0));
+			EXPECT_TRUE(tn[i].equals(rn[i], 0));
+		}
+	}
+
+	// A skin without normals leaves them alone.
+	MlSkin bare(p, NULL, inf, count);
+	EXPECT_TRUE(bare.getNormals() == NULL);
+	tn[0].setValue(7, 7, 7);
+	bare.apply(palette, skinBones, tp, tn, 4);
+	EXPECT_TRUE(tn[0].equals(MlVector3(7, 7, 7), 0));
+	for (int i = 0; i < count; i++)
+		EXPECT_TRUE(tp[i].equals(rp[i], 0));
+
+	delete [] p;
+	delete [] n;
+	delete [] inf;
+	delete [] rp;
+	delete [] rn;
+	delete [] tp;
+	delete [] tn;
+}
+
+TEST(MlSkinTest, DualQuat) {
+    // This test is named "DualQuat", and belongs to the "MlSkinTest"
+    // test case.
+
+	// Each vertex moves by the blend of its bones, with and without
+	// threads, including a partial block.
+	const int count = 10007;
+	MlTransform matrices[skinBones];
+	MlDualQuat palette[skinBones];
+	makeSkinPalette(matrices, 0.4f);
+	for (int i = 0; i < skinBones; i++) {
+		MlVector3 t, s;
+		MlRotation r, so;
+		matrices[i].getTransform(t, r, s, so);
+		palette[i].setValue(r, t);
+	}
+
+	MlVector3 *p = new MlVector3[count];
+	MlVector3 *n = new MlVector3[count];
+	MlSkinInfluence *inf = new MlSkinInfluence[count];
+	makeSkinMesh(p, n, inf, count);
+	MlVector3 *rp = new MlVector3[count];
+	MlVector3 *rn = new MlVector3[count];
+	MlVector3 *tp = new MlVector3[count];
+	MlVector3 *tn = new MlVector3[count];
+
+	MlSkin skin(p, n, inf, count);
+	skin.apply(palette, skinBones, rp, rn);
+	for (int i = 0; i < count; i++) {
+		const MlSkinInfluence &s = skin.getInfluences()[i];
+		MlDualQuat bones[4];
+		for (int j = 0; j < 4; j++)
+			bones[j] = palette[s.bone[j]];
+		MlDualQuat blend = MlDualQuat::blend(bones, s.weight, 4);
+		MlVector3 ep, en;
+		blend.multVec(p[i], ep);
+		blend.multDir(n[i], en);
+		float tolerance = 1e-6f * (10 + ep.length());
+		for (int c = 0; c < 3; c++) {
+			EXPECT_NEAR(rp[i][c], ep[c], tolerance) << "at " << i;
+			EXPECT_NEAR(rn[i][c], en[c], 2e-6) << "at " << i;
+		}
+	}
+
+	skin.apply(palette, skinBones, tp, tn, 3);
+	for (int i = 0; i < count; i++) {
+		EXPECT_TRUE(tp[i].equals(rp[i], 0));
+		EXPECT_TRUE(tn[i].equals(rn[i], 0));
+	}
+
+	delete [] p;
+	delete [] n;
+	delete [] inf;
+	delete [] rp;
+	delete [] rn;
+	delete [] tp;
+	delete [] tn;
+}
@@ -0,0 +1,200 @@
+// COPYRTIGH_BEGIN
+//
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Wizzer Works
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+//  For information concerning this header file, contact Mark S. Millard,
+//  of Wizzer Works at msm@wizzerworks.com.
+//
+//  More information concerning Wizzer Works may be found at
+//
+//      http://www.wizzerworks.com
+//
+// COPYRIGHT_END
+
+// Include Google Test header files.
+
+// Include Google Test header files.
+#include "gtest/gtest.h"
+
+// Include Magic Lantern header files.
+#include "math/vector.h"
+#include "math/rotation.h"
+#include "math/track.h"
+
+// Key times with uneven spacing.
+static const MlScalar trackTimes[] = {
+	ML_SCALAR(-1.0f), ML_SCALAR(0.0f), ML_SCALAR(0.25f), ML_SCALAR(1.0f),
+	ML_SCALAR(1.5f), ML_SCALAR(3.0f), ML_SCALAR(3.125f)
+};
+static const int trackKeys = sizeof(trackTimes) / sizeof(trackTimes[0]);
+
+// Returns the key at or before time and the weight to the next, by a linear
+// search, for checking the cursor.
+static int findTrackKey(MlScalar time, MlScalar &weight) {
+	if (time <= trackTimes[0]) {
+		weight = 0;
+		return 0;
+	}
+	for (int i = 0; i < trackKeys - 1; i++) {
+		if (time < trackTimes[i + 1]) {
+			weight = mlDiv(time - trackTimes[i], trackTimes[i + 1] - trackTimes[i]);
+			return i;
+		}
+	}
+	weight = 1;
+	return trackKeys - 2;
+}
+
+static void makeVector3Keys(MlVector3 *keys, float phase) {
+	for (int i = 0; i < trackKeys; i++)
+		keys[i].setValue(i + phase, 2.0f * i * i - phase, 1 - 3.0f * i);
+}
+
+static void makeRotationKeys(MlRotation *keys, float phase) {
+	for (int i = 0; i < trackKeys; i++)
+		keys[i].setValue(MlVector3(1, 0.5f * i + phase, -0.25f * i), 1.1f * i + phase);
+}
+
+TEST(MlTrackTest, Vector3Track) {
+    // This test is named "Vector3Track", and belongs to the "MlTrackTest"
+    // test case.
+
+	MlVector3 keys[trackKeys];
+	makeVector3Keys(keys, 0.5f);
+	MlVector3Track track(trackTimes, keys, trackKeys);
+	EXPECT_EQ(track.getNumKeys(), trackKeys);
+	EXPECT_FLOAT_EQ(track.getStartTime(), -1.0f);
+	EXPECT_FLOAT_EQ(track.getEndTime(), 3.125f);
+
+	for (int i = 0; i < trackKeys; i++)
+		EXPECT_TRUE(track.getValue(trackTimes[i]).equals(keys[i], 1e-8f));
+	EXPECT_TRUE(track.getValue(-5.0f).equals(keys[0], 0));
+	EXPECT_TRUE(track.getValue(5.0f).equals(keys[trackKeys - 1], 0));
+
+	MlVector3 e;
+	MlVector3::interpolate(0.4f, &keys[3], &keys[4], &e);
+	EXPECT_TRUE(track.getValue(1.2f).equals(e, 1e-8f));
+
+	// Tracks with fewer than two keys are constant.
+	MlVector3Track one(trackTimes, keys, 1);
+	EXPECT_TRUE(one.getValue(2.0f).equals(keys[0], 0));
+	MlVector3Track none;
+	EXPECT_TRUE(none.getValue(2.0f).equals(MlVector3(0, 0, 0), 0));
+}
+
+TEST(MlTrackTest, Cursor) {
+    // This test is named "Cursor", and belongs to the "MlTrackTest"
+    // test case.
+
+	// Play forward in small steps, backward, then jump about; every
+	// sample must agree with a search from scratch.
+	MlVector3 keys[trackKeys];
+	makeVector3Keys(keys, 0);
+	MlVector3Track track(trackTimes, keys, trackKeys);
+
+	MlScalar samples[200];
+	int n = 0;
+	for (int i = 0; i < 80; i++)
+		samples[n++] = -1.5f + 0.06f * i;
+	for (int i = 0; i < 60; i++)
+		samples[n++] = 3.5f - 0.07f * i;
+	for (int i = 0; i < 60; i++)
+		samples[n++] = -2.0f + (float) ((i * 37) % 61) * 0.09f;
+
+	for (int i = 0; i < n; i++) {
+		MlScalar weight;
+		int key = findTrackKey(samples[i], weight);
+		MlVector3 e;
+		MlVector3::interpolate(weight, &keys[key], &keys[key + 1], &e);
+		EXPECT_TRUE(track.getValue(samples[i]).equals(e, 1e-8f)) << "at " << samples[i];
+	}
+}
+
+TEST(MlTrackTest, RotationTrack) {
+    // This test is named "RotationTrack", and belongs to the "MlTrackTest"
+    // test case.
+
+	MlRotation keys[trackKeys];
+	makeRotationKeys(keys, 0.3f);
+	MlRotationTrack track(trackTimes, keys, trackKeys);
+
+	for (int i = 0; i < 100; i++) {
+		MlScalar time = -1.5f + 0.05f * i;
+		MlScalar weight;
+		int key = findTrackKey(time, weight);
+		MlRotation e = MlRotation::slerp(keys[key], keys[key + 1], weight);
+		MlRotation r = track.getValue(time);
+		for (int j = 0; j < 4; j++)
+			EXPECT_NEAR(r.getValue()[j], e.getValue()[j], 1e-5);
+	}
+
+	MlRotationTrack none;
+	for (int j = 0; j < 4; j++)
+		EXPECT_FLOAT_EQ(none.getValue(1.0f).getValue()[j], MlRotation::identity().getValue()[j]);
+}
+
+TEST(MlTrackTest, GetValueBatch) {
+    // This test is named "GetValueBatch", and belongs to the "MlTrackTest"
+    // test case.
+
+	// Enough tracks to be split between threads, with some constant ones.
+	const int count = 4001;
+	MlVector3Track *vectors = new MlVector3Track[count];
+	MlRotationTrack *rotations = new MlRotationTrack[count];
+	MlVector3Track *vectorCopies = new MlVector3Track[count];
+	MlRotationTrack *rotationCopies = new MlRotationTrack[count];
+	MlVector3 *v = new MlVector3[count];
+	MlRotation *r = new MlRotation[count];
+
+	for (int i = 0; i < count; i++) {
+		MlVector3 vkeys[trackKeys];
+		MlRotation rkeys[trackKeys];
+		int n = (i % 13 == 0) ? i % 2 : trackKeys;
+		makeVector3Keys(vkeys, 0.01f * i);
+		makeRotationKeys(rkeys, 0.01f * i);
+		vectors[i].setValue(trackTimes, vkeys, n);
+		rotations[i].setValue(trackTimes, rkeys, n);
+		vectorCopies[i] = vectors[i];
+		rotationCopies[i] = rotations[i];
+	}
+
+	const int threads[] = { 1, 4, 0, 3 };
+	for (int k = 0; k < 4; k++) {
+		MlScalar time = -0.5f + 0.9f * k;
+		MlVector3Track::getValueBatch(vectors, count, time, v, threads[k]);
+		MlRotationTrack::getValueBatch(rotations, count, time, r, threads[k]);
+		for (int i = 0; i < count; i++) {
+			EXPECT_TRUE(v[i].equals(vectorCopies[i].getValue(time), 0));
+			MlRotation e = rotationCopies[i].getValue(time);
+			for (int j = 0; j < 4; j++)
+				EXPECT_NEAR(r[i].getValue()[j], e.getValue()[j], 2e-6);
+		}
+	}
+
+	delete [] vectors;
+	delete [] rotations;
+	delete [] vectorCopies;
+	delete [] rotationCopies;
+	delete [] v;
+	delete [] r;
+}
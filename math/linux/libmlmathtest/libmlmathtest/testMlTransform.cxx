@@ -37,6 +37,7 @@
 // Include Magic Lantern header files.
 #include "math/transfrm.h"
 #include "math/angle.h"
+#include "testCoord.h"
 
 // Print transform for debugging purposes.
 void printTransform(MlTransform &t) {
@@ -282,9 +283,9 @@ TEST(MlTransformTest, SetScaleOnly) {
 	//printTransform(t);
 	EXPECT_FLOAT_EQ(t[0][0], 1.67600882);
 	EXPECT_FLOAT_EQ(t[0][1], -0.925301969);
-	EXPECT_FLOAT_EQ(t[0][2], 0.578628063);
+	EXPECT_FLOAT_EQ(t[0][2], 0.578628421);
 	EXPECT_FLOAT_EQ(t[1][0], 2.05352569);
-	EXPECT_FLOAT_EQ(t[1][1], 1.9552827);
+	EXPECT_FLOAT_EQ(t[1][1], 1.95528173);
 	EXPECT_FLOAT_EQ(t[1][2], -2.82132959);
 	EXPECT_FLOAT_EQ(t[2][0], 1.47920048);
 	EXPECT_FLOAT_EQ(t[2][1], 5.91680145);
@@ -489,3 +490,126 @@ TEST(MlTransformTest, Factor) {
 	EXPECT_FLOAT_EQ(t[3][1], 0);
 	EXPECT_FLOAT_EQ(t[3][2], 0);
 }
+
+TEST(MlTransformTest, MultVecMatrixBatch) {
+    // This test is named "MultVecMatrixBatch", and belongs to the "MlTransformTest"
+    // test case.
+
+	MlTransform t(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12);
+
+	// Use an odd count so that the non-SIMD remainder is exercised too.
+	const int count = 19;
+	MlVector3 src[count], dst[count], dir[count];
+	MlScalar x[count], y[count], z[count];
+	for (int i = 0; i < count; i++) {
+		src[i].setValue(i, i * 0.5f, -i);
+		x[i] = src[i][0]; y[i] = src[i][1]; z[i] = src[i][2];
+	}
+
+	t.multVecMatrixBatch(src, dst, count);
+	t.multDirMatrixBatch(src, dir, count);
+	for (int i = 0; i < count; i++) {
+		MlVector3 expected;
+		t.multVecMatrix(src[i], expected);
+		EXPECT_FLOAT_EQ(dst[i][0], expected[0]);
+		EXPECT_FLOAT_EQ(dst[i][1], expected[1]);
+		EXPECT_FLOAT_EQ(dst[i][2], expected[2]);
+
+		t.multDirMatrix(src[i], expected);
+		EXPECT_FLOAT_EQ(dir[i][0], expected[0]);
+		EXPECT_FLOAT_EQ(dir[i][1], expected[1]);
+		EXPECT_FLOAT_EQ(dir[i][2], expected[2]);
+	}
+
+	// Transform the structure-of-arrays streams in place.
+	t.multVecMatrixBatch(x, y, z, x, y, z, count);
+	for (int i = 0; i < count; i++) {
+		EXPECT_FLOAT_EQ(x[i], dst[i][0]);
+		EXPECT_FLOAT_EQ(y[i], dst[i][1]);
+		EXPECT_FLOAT_EQ(z[i], dst[i][2]);
+	}
+}
+
+TEST(MlTransformTest, MultVecMatrixBatchPositions) {
+    // This test is named "MultVecMatrixBatchPositions", and belongs to the "MlTransformTest"
+    // test case.
+
+	MlTransform t;
+	t.setTransform(MlVector3(ML_SCALAR(1.5f), ML_SCALAR(-2.25f), ML_SCALAR(0.75f)),
+	               MlRotation(MlVector3(1, 2, -1), ML_SCALAR(0.8f)),
+	               MlVector3(ML_SCALAR(1.1f), ML_SCALAR(0.9f), ML_SCALAR(1.3f)));
+
+	const int count = 40;
+	MlVector3 src[count];
+	for (int i = 0; i < count; i++)
+		src[i].setValue(mlFloatToScalar(testCoord(3*i, 100)),
+		                mlFloatToScalar(testCoord(3*i + 1, 100)),
+		                mlFloatToScalar(testCoord(3*i + 2, 100)));
+
+	// Each vector gets the bits of multVecMatrix() and multDirMatrix()
+	// wherever it falls in the batch, in a SIMD vector or in the remainder.
+	for (int offset = 0; offset < 16; offset++) {
+		MlVector3 dst[count], dir[count];
+		int n = count - offset;
+		t.multVecMatrixBatch(src + offset, dst, n);
+		t.multDirMatrixBatch(src + offset, dir, n);
+		for (int i = 0; i < n; i++) {
+			MlVector3 expected;
+			t.multVecMatrix(src[offset + i], expected);
+			EXPECT_TRUE(dst[i] == expected);
+			t.multDirMatrix(src[offset + i], expected);
+			EXPECT_TRUE(dir[i] == expected);
+		}
+	}
+}
+
+#if !ML_FIXED_POINT && !ML_MATH_DEBUG
+// Transforms a point, at compile time if need be.
+static constexpr MlVector3 transformPoint(const MlTransform &m, const MlVector3 &p)
+{
+	MlVector3 r(0, 0, 0);
+	m.multVecMatrix(p, r);
+	return r;
+}
+
+TEST(MlTransformTest, ConstantExpressions) {
+    // This test is named "ConstantExpressions", and belongs to the "MlTransformTest"
+    // test case.
+
+	// Default poses built at compile time.
+	static constexpr MlTransform poses[] = {
+		MlTransform::identity(),
+		MlTransform(1, 0, 0, 0, 1, 0, 0, 0, 1, 2, 3, 4)
+	};
+
+	EXPECT_TRUE(poses[0].isIdentity());
+	MlTransform copy = poses[1];
+	MlVector3 t;
+	copy.getTranslation(t);
+	EXPECT_TRUE(t == MlVector3(2, 3, 4));
+	copy.setTranslation(MlVector3(0, 0, 0));
+	EXPECT_TRUE(copy.isIdentity());
+
+	// Products, points and elements too. The index operator cannot be
+	// evaluated at compile time, but getValue() can.
+	static constexpr MlTransform a(0, 1, 0, -1, 0, 0, 0, 0, 2, 1, 2, 3);
+	constexpr MlTransform aa = a * a;
+	static_assert(aa.getValue().m[0][1] == 0 && aa.getValue().m[0][0] == -1 &&
+	              aa.getValue().m[1][1] == -1 && aa.getValue().m[2][2] == 4,
+	              "constexpr product");
+	static_assert(aa.getValue().m[3][0] == -1 && aa.getValue().m[3][1] == 3 &&
+	              aa.getValue().m[3][2] == 9, "constexpr product translation");
+	static_assert((a * MlTransform::identity()).getValue().m[3][1] == 2 &&
+	              (MlTransform::identity() * a).getValue().m[1][0] == -1,
+	              "constexpr identity product");
+	static_assert(MlTransform::identity().getValue().m[3][2] == 0, "constexpr element");
+	static_assert(transformPoint(a, MlVector3(1, 0, 0)) == MlVector3(1, 3, 3),
+	              "constexpr multVecMatrix");
+
+	MlTransform b = a;
+	EXPECT_TRUE(b * b == aa);
+	MlVector3 p;
+	b.multVecMatrix(MlVector3(1, 0, 0), p);
+	EXPECT_TRUE(p == transformPoint(a, MlVector3(1, 0, 0)));
+}
+#endif /* !ML_FIXED_POINT && !ML_MATH_DEBUG */
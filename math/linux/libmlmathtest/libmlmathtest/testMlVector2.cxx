@@ -27,3 +27,54 @@ TEST(MlVector2Test, InitConstrutor) {
 
     EXPECT_TRUE(v != NULL);
 }
+
+TEST(MlVector2Test, Quantize) {
+    // This test is named "Quantize", and belongs to the "MlVector2Test"
+    // test case.
+
+	const int count = 37;
+	MlVector2 v[count], r[count], origin, extent;
+	MlVector2s q[count];
+	for (int i = 0; i < count; i++)
+		v[i].setValue(1000 + 0.25f * ((i * 7) % count), -0.01f * i);
+
+	MlVector2::quantizeBatch(v, q, origin, extent, count);
+	EXPECT_FLOAT_EQ(origin[0], 1000 + 0.25f * 18);
+	EXPECT_FLOAT_EQ(extent[0], 0.25f * 18);
+	EXPECT_FLOAT_EQ(origin[1], -0.01f * 18);
+	EXPECT_FLOAT_EQ(extent[1], 0.01f * 18);
+	EXPECT_EQ(q[0][0], -32767);
+	EXPECT_EQ(q[0][1], 32767);
+
+	MlVector2::dequantizeBatch(q, origin, extent, r, count);
+	for (int i = 0; i < count; i++) {
+		for (int j = 0; j < 2; j++)
+			EXPECT_NEAR(r[i][j], v[i][j], extent[j] / 65534 + mlMul(ML_SCALAR(1e-6f), mlAbs(v[i][j])));
+	}
+}
+
+TEST(MlVector2Test, ExpressionMembers) {
+    // This test is named "ExpressionMembers", and belongs to the "MlVector2Test"
+    // test case.
+
+	// Every const method of a vector may be called on the result of an
+	// operator, whether or not it is an expression template.
+	MlVector2 a(1.5f, -2), b(-3, 0.5f);
+	MlVector2 d = b - a;
+
+	EXPECT_EQ((b - a).getValue()[1], d[1]);
+	EXPECT_FALSE((b - a).isZero());
+	EXPECT_TRUE((a - a).isZero());
+	EXPECT_EQ((b - a).length(), d.length());
+
+	MlScalar x, y;
+	(b - a).getValue(x, y);
+	EXPECT_EQ(x, d[0]);
+	EXPECT_EQ(y, d[1]);
+
+	MlScalar scale, recipScale, s, r;
+	(b - a).getScale(scale, recipScale);
+	d.getScale(s, r);
+	EXPECT_EQ(scale, s);
+	EXPECT_EQ(recipScale, r);
+}
@@ -15,3 +15,190 @@ TEST(MlVector3Test, DefaultConstrutor) {
 
     EXPECT_TRUE(v != NULL);
 }
+
+TEST(MlVector3Test, BatchOperations) {
+    // This test is named "BatchOperations", and belongs to the "MlVector3Test"
+    // test case.
+
+	// Use an odd count so that the non-SIMD remainder is exercised too.
+	const int count = 37;
+	MlVector3 a[count], b[count], r[count], n[count];
+	MlScalar s[count], len[count];
+	for (int i = 0; i < count; i++) {
+		a[i].setValue(i + 1, -0.5f * i, 3 - i);
+		b[i].setValue(0.25f * i, 2, i - 7);
+	}
+	a[5].setValue(0, 0, 0);
+
+	MlVector3::addBatch(a, b, r, count);
+	for (int i = 0; i < count; i++) {
+		MlVector3 e = a[i] + b[i];
+		EXPECT_FLOAT_EQ(r[i][0], e[0]); EXPECT_FLOAT_EQ(r[i][1], e[1]); EXPECT_FLOAT_EQ(r[i][2], e[2]);
+	}
+
+	MlVector3::subtractBatch(a, b, r, count);
+	for (int i = 0; i < count; i++) {
+		MlVector3 e = a[i] - b[i];
+		EXPECT_FLOAT_EQ(r[i][0], e[0]); EXPECT_FLOAT_EQ(r[i][1], e[1]); EXPECT_FLOAT_EQ(r[i][2], e[2]);
+	}
+
+	MlVector3::scaleBatch(a, 1.5f, r, count);
+	for (int i = 0; i < count; i++) {
+		MlVector3 e = a[i] * 1.5f;
+		EXPECT_FLOAT_EQ(r[i][0], e[0]); EXPECT_FLOAT_EQ(r[i][1], e[1]); EXPECT_FLOAT_EQ(r[i][2], e[2]);
+	}
+
+	MlVector3::crossBatch(a, b, r, count);
+	for (int i = 0; i < count; i++) {
+		MlVector3 e = a[i].cross(b[i]);
+		EXPECT_FLOAT_EQ(r[i][0], e[0]); EXPECT_FLOAT_EQ(r[i][1], e[1]); EXPECT_FLOAT_EQ(r[i][2], e[2]);
+	}
+
+	MlVector3::dotBatch(a, b, s, count);
+	for (int i = 0; i < count; i++)
+		EXPECT_FLOAT_EQ(s[i], a[i].dot(b[i]));
+
+	MlVector3::lengthBatch(a, s, count);
+	for (int i = 0; i < count; i++)
+		EXPECT_FLOAT_EQ(s[i], a[i].length());
+
+	for (int i = 0; i < count; i++)
+		n[i] = a[i];
+	MlVector3::normalizeBatch(n, len, count);
+	for (int i = 0; i < count; i++) {
+		MlVector3 e = a[i];
+		EXPECT_FLOAT_EQ(len[i], e.normalize());
+		EXPECT_FLOAT_EQ(n[i][0], e[0]); EXPECT_FLOAT_EQ(n[i][1], e[1]); EXPECT_FLOAT_EQ(n[i][2], e[2]);
+	}
+}
+
+TEST(MlVector3Test, Quantize) {
+    // This test is named "Quantize", and belongs to the "MlVector3Test"
+    // test case.
+
+	// The z components are all the same, so that axis is flat.
+	const int count = 37;
+	MlVector3 v[count], r[count], origin, extent;
+	MlVector3s q[count];
+	for (int i = 0; i < count; i++)
+		v[i].setValue(0.37f * i - 5, 100 - 7.5f * ((i * 11) % count), 2.5f);
+
+	MlVector3::quantizeBatch(v, q, origin, extent, count);
+	EXPECT_FLOAT_EQ(origin[0], 0.37f * 18 - 5);
+	EXPECT_FLOAT_EQ(extent[0], 0.37f * 18);
+	EXPECT_FLOAT_EQ(origin[1], 100 - 7.5f * 18);
+	EXPECT_FLOAT_EQ(extent[1], 7.5f * 18);
+	EXPECT_FLOAT_EQ(origin[2], 2.5f);
+	EXPECT_FLOAT_EQ(extent[2], 0);
+
+	// The box spans the whole range of the shorts.
+	EXPECT_EQ(q[0][0], -32767);
+	EXPECT_EQ(q[count - 1][0], 32767);
+	EXPECT_EQ(q[0][2], 0);
+
+	MlVector3::dequantizeBatch(q, origin, extent, r, count);
+	for (int i = 0; i < count; i++) {
+		for (int j = 0; j < 3; j++)
+			EXPECT_NEAR(r[i][j], v[i][j], extent[j] / 65534 + mlMul(ML_SCALAR(1e-6f), mlAbs(v[i][j])));
+	}
+	for (int i = 0; i < count; i++)
+		EXPECT_EQ(r[i][2], 2.5f);
+
+	// An empty array has an empty box.
+	MlVector3::quantizeBatch(v, q, origin, extent, 0);
+	EXPECT_EQ(origin, MlVector3(0, 0, 0));
+	EXPECT_EQ(extent, MlVector3(0, 0, 0));
+}
+
+TEST(MlVector3Test, Expressions) {
+    // This test is named "Expressions", and belongs to the "MlVector3Test"
+    // test case.
+
+	// Compound expressions must give exactly the component-wise arithmetic,
+	// whether or not they are built as expression templates (ML_VECTOR_EXPR).
+	MlVector3 a(1.5f, -2, 0.25f), b(-3, 0.5f, 7), c(0.125f, 4, -1);
+	MlScalar w = 0.375f;
+
+	MlVector3 r = a * (ML_SCALAR_ONE - w) + b * w;
+	for (int j = 0; j < 3; j++)
+		EXPECT_EQ(r[j], a[j] * (ML_SCALAR_ONE - w) + b[j] * w);
+
+	r = -(a - b) / 4 + 2 * c;
+	for (int j = 0; j < 3; j++)
+		EXPECT_EQ(r[j], -(a[j] - b[j]) * 0.25f + 2 * c[j]);
+
+	// The result may alias an operand.
+	r = a;
+	r = c - r * 2;
+	for (int j = 0; j < 3; j++)
+		EXPECT_EQ(r[j], c[j] - a[j] * 2);
+
+	r = a;
+	r += b * w - c;
+	for (int j = 0; j < 3; j++)
+		EXPECT_EQ(r[j], a[j] + (b[j] * w - c[j]));
+
+	// Expressions are usable wherever a vector is.
+	MlVector3 d = b - a;
+	EXPECT_EQ((b - a).length(), d.length());
+	EXPECT_EQ((b - a).dot(c), d.dot(c));
+	EXPECT_TRUE((b - a).equals(d, 0));
+	EXPECT_TRUE(b - a == d);
+	EXPECT_FALSE(d != b - a);
+	EXPECT_EQ(a.dot(b - a), a.dot(d));
+	EXPECT_EQ(((b - a) * w)[1], d[1] * w);
+}
+
+TEST(MlVector3Test, ExpressionMembers) {
+    // This test is named "ExpressionMembers", and belongs to the "MlVector3Test"
+    // test case.
+
+	// Every const method of a vector may be called on the result of an
+	// operator, whether or not it is an expression template.
+	MlVector3 a(1.5f, -2, 0.25f), b(-3, 0.5f, 7), c(0.125f, 4, -1);
+	MlVector3 d = b - a, e = c - a;
+
+	EXPECT_EQ((b - a).cross(c - a), d.cross(e));
+	EXPECT_EQ((b - a).getValue()[0], d[0]);
+	EXPECT_EQ((b - a).getValue()[2], d[2]);
+	EXPECT_FALSE((b - a).isZero());
+	EXPECT_TRUE((a - a).isZero());
+	EXPECT_EQ((b - a).approximateLength(), d.approximateLength());
+	EXPECT_EQ((a * 0.5f).getClosestAxis(), MlVector3(0, -1, 0));
+
+	MlScalar x, y, z;
+	(b - a).getValue(x, y, z);
+	EXPECT_EQ(x, d[0]);
+	EXPECT_EQ(y, d[1]);
+	EXPECT_EQ(z, d[2]);
+
+	MlScalar scale, recipScale, s, r;
+	(b - a).getScale(scale, recipScale);
+	d.getScale(s, r);
+	EXPECT_EQ(scale, s);
+	EXPECT_EQ(recipScale, r);
+
+	// The components returned by getValue() may be passed on.
+	MlVector3 f;
+	f.setValue((b - a).getValue());
+	EXPECT_EQ(f, d);
+}
+
+#if !ML_FIXED_POINT && !ML_MATH_DEBUG
+TEST(MlVector3Test, ConstantExpressions) {
+    // This test is named "ConstantExpressions", and belongs to the "MlVector3Test"
+    // test case.
+
+	// In floating-point mode the arithmetic can run at compile time.
+	static constexpr MlVector3 a(1, 2, 3), b(-2, 0.5f, 4);
+	constexpr MlVector3 c = a * 2 - b / 2 + -a;
+	static_assert(c == MlVector3(2, 1.75f, 1), "constexpr arithmetic");
+	static_assert(a.dot(b) == 11, "constexpr dot");
+	static_assert(a.cross(b) == MlVector3(6.5f, -10, 4.5f), "constexpr cross");
+
+	// The same expressions at run time.
+	MlVector3 r = a * 2 - b / 2 + -a;
+	EXPECT_TRUE(r == c);
+	EXPECT_TRUE(MlVector3::zero == MlVector3(0, 0, 0));
+}
+#endif /* !ML_FIXED_POINT && !ML_MATH_DEBUG */
@@ -15,3 +15,89 @@ TEST(MlVector4Test, DefaultConstrutor) {
 
     EXPECT_TRUE(v != NULL);
 }
+
+TEST(MlVector4Test, BatchOperations) {
+    // This test is named "BatchOperations", and belongs to the "MlVector4Test"
+    // test case.
+
+	// Use an odd count so that the non-SIMD remainder is exercised too.
+	const int count = 37;
+	MlVector4 a[count], b[count], r[count], n[count];
+	MlScalar s[count], len[count];
+	for (int i = 0; i < count; i++) {
+		a[i].setValue(i + 1, -0.5f * i, 3 - i, 1);
+		b[i].setValue(0.25f * i, 2, i - 7, -i);
+	}
+	a[5].setValue(0, 0, 0, 0);
+
+	MlVector4::addBatch(a, b, r, count);
+	for (int i = 0; i < count; i++) {
+		MlVector4 e = a[i] + b[i];
+		for (int j = 0; j < 4; j++)
+			EXPECT_FLOAT_EQ(r[i][j], e[j]);
+	}
+
+	MlVector4::subtractBatch(a, b, r, count);
+	for (int i = 0; i < count; i++) {
+		MlVector4 e = a[i] - b[i];
+		for (int j = 0; j < 4; j++)
+			EXPECT_FLOAT_EQ(r[i][j], e[j]);
+	}
+
+	MlVector4::scaleBatch(a, 1.5f, r, count);
+	for (int i = 0; i < count; i++) {
+		MlVector4 e = a[i] * 1.5f;
+		for (int j = 0; j < 4; j++)
+			EXPECT_FLOAT_EQ(r[i][j], e[j]);
+	}
+
+	MlVector4::dotBatch(a, b, s, count);
+	for (int i = 0; i < count; i++)
+		EXPECT_FLOAT_EQ(s[i], a[i].dot(b[i]));
+
+	MlVector4::lengthBatch(a, s, count);
+	for (int i = 0; i < count; i++)
+		EXPECT_FLOAT_EQ(s[i], a[i].length());
+
+	for (int i = 0; i < count; i++)
+		n[i] = a[i];
+	MlVector4::normalizeBatch(n, len, count);
+	for (int i = 0; i < count; i++) {
+		MlVector4 e = a[i];
+		EXPECT_FLOAT_EQ(len[i], e.normalize());
+		for (int j = 0; j < 4; j++)
+			EXPECT_FLOAT_EQ(n[i][j], e[j]);
+	}
+}
+
+TEST(MlVector4Test, ExpressionMembers) {
+    // This test is named "ExpressionMembers", and belongs to the "MlVector4Test"
+    // test case.
+
+	// Every const method of a vector may be called on the result of an
+	// operator, whether or not it is an expression template.
+	MlVector4 a(1.5f, -2, 0.25f, 1), b(-3, 0.5f, 7, 1), c(2, 4, -6, 2);
+	MlVector4 d = b - a;
+
+	EXPECT_EQ((b - a).getValue()[2], d[2]);
+	EXPECT_FALSE((b - a).isZero());
+	EXPECT_TRUE((a - a).isZero());
+	EXPECT_EQ((b - a).length(), d.length());
+
+	MlScalar x, y, z, w;
+	(b - a).getValue(x, y, z, w);
+	EXPECT_EQ(x, d[0]);
+	EXPECT_EQ(y, d[1]);
+	EXPECT_EQ(z, d[2]);
+	EXPECT_EQ(w, d[3]);
+
+	MlVector3 real;
+	(c * 0.5f).getReal(real);
+	EXPECT_EQ(real, MlVector3(1, 2, -3));
+
+	MlScalar scale, recipScale, s, r;
+	(b - a).getScale(scale, recipScale);
+	d.getScale(s, r);
+	EXPECT_EQ(scale, s);
+	EXPECT_EQ(recipScale, r);
+}
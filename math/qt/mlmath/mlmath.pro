@@ -3,7 +3,7 @@ QT -= gui
 TEMPLATE = lib
 DEFINES += MLMATH_LIBRARY
 
-CONFIG += c++11
+CONFIG += c++14
 
 # The following define makes your compiler emit warnings if you use
 # any Qt feature that has been marked deprecated (the exact warnings
@@ -23,13 +23,25 @@ INCLUDEPATH += $$PWD/../../common/include /opt/MagicLantern/include
 SOURCES += \
     $$PWD/../../common/src/asine.cxx \
     $$PWD/../../common/src/atan.cxx \
+    $$PWD/../../common/src/bounds.cxx \
+    $$PWD/../../common/src/bvh.cxx \
+    $$PWD/../../common/src/dualquat.cxx \
     $$PWD/../../common/src/fixed.cxx \
+    $$PWD/../../common/src/frustum.cxx \
+    $$PWD/../../common/src/matrix4.cxx \
+    $$PWD/../../common/src/parallel.cxx \
+    $$PWD/../../common/src/rebase.cxx \
     $$PWD/../../common/src/recip.cxx \
     $$PWD/../../common/src/rotation.cxx \
+    $$PWD/../../common/src/rotspline.cxx \
     $$PWD/../../common/src/scalar.cxx \
     $$PWD/../../common/src/sine.cxx \
+    $$PWD/../../common/src/skin.cxx \
     $$PWD/../../common/src/sqrt.cxx \
+    $$PWD/../../common/src/track.cxx \
     $$PWD/../../common/src/transfrm.cxx \
+    $$PWD/../../common/src/trigbatch.cxx \
+    $$PWD/../../common/src/vecsimd.cxx \
     $$PWD/../../common/src/vector.cxx
 
 HEADERS += \
@@ -38,15 +50,30 @@ HEADERS += \
     $$PWD/../../common/include/math/angle.h \
     $$PWD/../../common/include/math/asine.h \
     $$PWD/../../common/include/math/atan.h \
+    $$PWD/../../common/include/math/bounds.h \
+    $$PWD/../../common/include/math/bvh.h \
+    $$PWD/../../common/include/math/dualquat.h \
+    $$PWD/../../common/include/math/fixedlut.h \
+    $$PWD/../../common/include/math/frustum.h \
+    $$PWD/../../common/include/math/matrix4.h \
     $$PWD/../../common/include/math/mlmath.h \
+    $$PWD/../../common/include/math/rebase.h \
     $$PWD/../../common/include/math/recip.h \
     $$PWD/../../common/include/math/rotation.h \
+    $$PWD/../../common/include/math/rotationt.h \
+    $$PWD/../../common/include/math/rotspline.h \
     $$PWD/../../common/include/math/scalar.h \
+    $$PWD/../../common/include/math/scalart.h \
     $$PWD/../../common/include/math/sine.h \
+    $$PWD/../../common/include/math/skin.h \
     $$PWD/../../common/include/math/sqrt.h \
+    $$PWD/../../common/include/math/track.h \
     $$PWD/../../common/include/math/transfrm.h \
+    $$PWD/../../common/include/math/transfrmt.h \
     $$PWD/../../common/include/math/trig.h \
-    $$PWD/../../common/include/math/vector.h
+    $$PWD/../../common/include/math/vecexpr.h \
+    $$PWD/../../common/include/math/vector.h \
+    $$PWD/../../common/include/math/vectort.h
 
 # Default rules for deployment.
 unix {